@@ -142,6 +142,7 @@ retval_t set_fsk(trx_id_t trx_id);
 retval_t set_ofdm(trx_id_t trx_id);
 retval_t set_oqpsk(trx_id_t trx_id);
 retval_t set_leg_oqpsk(trx_id_t trx_id);
+void print_phy_change_stats(trx_id_t trx_id);
 #ifdef USER_CONFIGURATION 
 retval_t set_user_config(trx_id_t trx_id);
 #endif
@@ -290,6 +290,7 @@ static void handle_menu(void)
         }
         status = set_mod(current_trx_id, (modulation_t)(input - '1'));
         printf("\nNew modulation set: %s\n", get_retval_text(status));
+        print_phy_change_stats(current_trx_id);
 		input_len = 0;
 		chat_pay_ptr = tx_frm_pay_ptr;
 		memset(tx_frm_pay_ptr,0,MAX_INPUT_LENGTH);
@@ -693,3 +694,26 @@ void tal_tx_frame_done_cb(trx_id_t trx_id, retval_t status, frame_info_t *frame)
 	chat_tx_done_cb(trx_id, status, frame);
 }
 
+
+/**
+ * @brief User call back function for a completed channel switch
+ *
+ * @param trx_id Transceiver identifier
+ * @param status Status of the channel switch
+ */
+void tal_channel_switch_done_cb(trx_id_t trx_id, retval_t status)
+{
+	if (status != MAC_SUCCESS) {
+		printf("\nChannel switch failed: %s\n", get_trx_id_text(trx_id));
+	}
+}
+
+#ifdef SUPPORT_SPECTRUM_SCAN
+void tal_scan_done_cb(trx_id_t trx_id, retval_t status, uint16_t num_results)
+{
+	if (status != MAC_SUCCESS) {
+		printf("\nEnergy sweep aborted after %u channels: %s\n",
+		       num_results, get_trx_id_text(trx_id));
+	}
+}
+#endif
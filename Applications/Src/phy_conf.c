@@ -93,6 +93,29 @@ retval_t set_mod(trx_id_t trx_id, modulation_t mod)
 #endif /* #ifdef MULTI_TRX_SUPPORT */
 
 
+#ifdef MULTI_TRX_SUPPORT
+/**
+ * @brief Initializes a PHY profile using the settings common to all presets
+ *
+ * @param profile   Profile to be initialized
+ */
+static void init_profile(tal_phy_profile_t *profile)
+{
+    /* Profiles are compared bytewise; clear padding and unused fields */
+    memset(profile, 0, sizeof(tal_phy_profile_t));
+
+    profile->tx_pwr = 14;
+    profile->rpc = true;
+    profile->fsk_preamble_len = 8;
+    profile->fsk_fec = false;
+    profile->fsk_scramble = true; /* Data whitening */
+    profile->ofdm_mcs = MCS3;
+    profile->ofdm_interleaving = false;
+    profile->oqpsk_rate_mode = OQPSK_RATE_MOD_0;
+}
+#endif /* #ifdef MULTI_TRX_SUPPORT */
+
+
 #ifdef MULTI_TRX_SUPPORT
 /**
  * @brief Set FSK modulation
@@ -103,96 +126,31 @@ retval_t set_mod(trx_id_t trx_id, modulation_t mod)
  */
 retval_t set_fsk(trx_id_t trx_id)
 {
-    phy_t phy;
-    retval_t status;
-    int pwr;
+    tal_phy_profile_t profile;
 
-    phy.modulation = FSK;
-    phy.phy_mode.fsk.sym_rate = FSK_SYM_RATE_50;
-    phy.phy_mode.fsk.mod_idx = MOD_IDX_1_0;
-    phy.phy_mode.fsk.mod_type = F2FSK;
+    init_profile(&profile);
+    profile.phy.modulation = FSK;
+    profile.phy.phy_mode.fsk.sym_rate = FSK_SYM_RATE_50;
+    profile.phy.phy_mode.fsk.mod_idx = MOD_IDX_1_0;
+    profile.phy.phy_mode.fsk.mod_type = F2FSK;
     if (trx_id == RF09)
     {
-        phy.freq_band = US_915;
-        phy.ch_spacing = FSK_915_MOD1_CH_SPAC;
-        phy.freq_f0 = FSK_915_MOD1_F0;
-        pwr = 14;
+        profile.phy.freq_band = US_915;
+        profile.phy.ch_spacing = FSK_915_MOD1_CH_SPAC;
+        profile.phy.freq_f0 = FSK_915_MOD1_F0;
     }
     else // RF24
     {
-        phy.freq_band = WORLD_2450;
-        phy.ch_spacing = FSK_2450_MOD1_CH_SPAC;
-        phy.freq_f0 = FSK_2450_MOD1_F0;
+        profile.phy.freq_band = WORLD_2450;
+        profile.phy.ch_spacing = FSK_2450_MOD1_CH_SPAC;
+        profile.phy.freq_f0 = FSK_2450_MOD1_F0;
 #ifdef RF215v1
-        pwr = 12;
-#else
-        pwr = 14;
+        profile.tx_pwr = 12;
 #endif
     }
+    profile.channel = 0;
 
-    /* Set preamble length */
-    uint16_t len = 8;
-    status = tal_pib_set(trx_id, phyFSKPreambleLength, (pib_value_t *)&len);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    /* Set FEC */
-    bool fec = false;
-    status = tal_pib_set(trx_id, phyFSKFECEnabled, (pib_value_t *)&fec);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    /* Data whitening */
-    bool dw = true;
-    status = tal_pib_set(trx_id, phyFSKScramblePSDU, (pib_value_t *)&dw);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    /* CRC */
-    uint16_t crc_type = FCS_TYPE_4_OCTETS;
-    status = tal_pib_set(trx_id, macFCSType, (pib_value_t *)&crc_type);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    /* Set modulation / PHY configuration */
-    status = tal_pib_set(trx_id, phySetting, (pib_value_t *)&phy);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    /* Set channel */
-    channel_t ch = 0;
-    status = tal_pib_set(trx_id, phyCurrentChannel, (pib_value_t *)&ch);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    /* Set transmit power */
-    status = tal_pib_set(trx_id, phyTransmitPower, (pib_value_t *)&pwr);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    /* Enable RPC */
-    bool rpc = true;
-    status = tal_pib_set(trx_id, phyRPCEnabled, (pib_value_t *)&rpc);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    return MAC_SUCCESS;
+    return tal_phy_profile_apply(trx_id, &profile);
 }
 #endif /* #ifdef MULTI_TRX_SUPPORT */
 
@@ -207,72 +165,26 @@ retval_t set_fsk(trx_id_t trx_id)
  */
 retval_t set_ofdm(trx_id_t trx_id)
 {
-    phy_t phy;
-    retval_t status;
+    tal_phy_profile_t profile;
 
-    phy.modulation = OFDM;
-    phy.phy_mode.ofdm.option = OFDM_OPT_1;
+    init_profile(&profile);
+    profile.phy.modulation = OFDM;
+    profile.phy.phy_mode.ofdm.option = OFDM_OPT_1;
     if (trx_id == RF09)
     {
-        phy.freq_band = US_915;
-        phy.ch_spacing = OFDM_915_OPT1_CH_SPAC;
-        phy.freq_f0 = OFDM_915_OPT1_F0;
+        profile.phy.freq_band = US_915;
+        profile.phy.ch_spacing = OFDM_915_OPT1_CH_SPAC;
+        profile.phy.freq_f0 = OFDM_915_OPT1_F0;
     }
     else // RF24
     {
-        phy.freq_band = WORLD_2450;
-        phy.ch_spacing = OFDM_2450_OPT1_CH_SPAC;
-        phy.freq_f0 = OFDM_2450_OPT1_F0;
-    }
-
-    /* Set interleaving */
-    bool interl = false;
-    status = tal_pib_set(trx_id, phyOFDMInterleaving, (pib_value_t *)&interl);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    /* Set data rate / MCS */
-    ofdm_mcs_t mcs = MCS3;
-    status = tal_pib_set(trx_id, phyOFDMMCS, (pib_value_t *)&mcs);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    /* CRC */
-    uint16_t crc_type = FCS_TYPE_4_OCTETS;
-    status = tal_pib_set(trx_id, macFCSType, (pib_value_t *)&crc_type);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    /* Set modulation / PHY configuration */
-    status = tal_pib_set(trx_id, phySetting, (pib_value_t *)&phy);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
+        profile.phy.freq_band = WORLD_2450;
+        profile.phy.ch_spacing = OFDM_2450_OPT1_CH_SPAC;
+        profile.phy.freq_f0 = OFDM_2450_OPT1_F0;
     }
+    profile.channel = 0;
 
-    /* Set channel */
-    channel_t ch = 0;
-    status = tal_pib_set(trx_id, phyCurrentChannel, (pib_value_t *)&ch);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    /* Set transmit power */
-    int pwr = 14;
-    status = tal_pib_set(trx_id, phyTransmitPower, (pib_value_t *)&pwr);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    return MAC_SUCCESS;
+    return tal_phy_profile_apply(trx_id, &profile);
 }
 #endif /* #ifdef MULTI_TRX_SUPPORT */
 
@@ -287,72 +199,26 @@ retval_t set_ofdm(trx_id_t trx_id)
  */
 retval_t set_oqpsk(trx_id_t trx_id)
 {
-    phy_t phy;
-    retval_t status;
+    tal_phy_profile_t profile;
 
-    phy.modulation = OQPSK;
-    phy.phy_mode.oqpsk.chip_rate = CHIP_RATE_100;
+    init_profile(&profile);
+    profile.phy.modulation = OQPSK;
+    profile.phy.phy_mode.oqpsk.chip_rate = CHIP_RATE_100;
     if (trx_id == RF09)
     {
-        phy.freq_band = US_915;
-        phy.ch_spacing = OQPSK_915_CH_SPAC;
-        phy.freq_f0 = OQPSK_915_F0;
+        profile.phy.freq_band = US_915;
+        profile.phy.ch_spacing = OQPSK_915_CH_SPAC;
+        profile.phy.freq_f0 = OQPSK_915_F0;
     }
     else
     {
-        phy.freq_band = WORLD_2450;
-        phy.ch_spacing = OQPSK_2450_CH_SPAC;
-        phy.freq_f0 = OQPSK_2450_F0;
+        profile.phy.freq_band = WORLD_2450;
+        profile.phy.ch_spacing = OQPSK_2450_CH_SPAC;
+        profile.phy.freq_f0 = OQPSK_2450_F0;
     }
+    profile.channel = 0;
 
-    /* Set data rate / rate mode */
-    oqpsk_rate_mode_t rate = OQPSK_RATE_MOD_0;
-    status = tal_pib_set(trx_id, phyOQPSKRateMode, (pib_value_t *)&rate);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    /* CRC */
-    uint16_t crc_type = FCS_TYPE_4_OCTETS;
-    status = tal_pib_set(trx_id, macFCSType, (pib_value_t *)&crc_type);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    /* Set modulation / PHY configuration */
-    status = tal_pib_set(trx_id, phySetting, (pib_value_t *)&phy);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    /* Set channel */
-    channel_t ch = 0;
-    status = tal_pib_set(trx_id, phyCurrentChannel, (pib_value_t *)&ch);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    /* Set transmit power */
-    int pwr = 14;
-    status = tal_pib_set(trx_id, phyTransmitPower, (pib_value_t *)&pwr);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    /* Enable RPC */
-    bool rpc = true;
-    status = tal_pib_set(trx_id, phyRPCEnabled, (pib_value_t *)&rpc);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
-
-    return MAC_SUCCESS;
+    return tal_phy_profile_apply(trx_id, &profile);
 }
 #endif /* #ifdef MULTI_TRX_SUPPORT */
 
@@ -367,51 +233,57 @@ retval_t set_oqpsk(trx_id_t trx_id)
  */
 retval_t set_leg_oqpsk(trx_id_t trx_id)
 {
-    phy_t phy;
-    retval_t status;
-    channel_t ch;
+    tal_phy_profile_t profile;
 
-    phy.modulation = LEG_OQPSK;
+    init_profile(&profile);
+    profile.phy.modulation = LEG_OQPSK;
     if (trx_id == RF09)
     {
-        phy.phy_mode.leg_oqpsk.chip_rate = CHIP_RATE_1000;
-        phy.freq_band = US_915;
-        phy.ch_spacing = LEG_915_CH_SPAC;
-        phy.freq_f0 = LEG_915_F0 - LEG_915_CH_SPAC;
-        ch = 1;
+        profile.phy.phy_mode.leg_oqpsk.chip_rate = CHIP_RATE_1000;
+        profile.phy.freq_band = US_915;
+        profile.phy.ch_spacing = LEG_915_CH_SPAC;
+        profile.phy.freq_f0 = LEG_915_F0 - LEG_915_CH_SPAC;
+        profile.channel = 1;
     }
     else // RF24
     {
-        phy.phy_mode.leg_oqpsk.chip_rate = CHIP_RATE_2000;
-        phy.freq_band = WORLD_2450;
-        phy.ch_spacing = LEG_2450_CH_SPAC;
-        phy.freq_f0 = LEG_2450_F0 - (11 * LEG_2450_CH_SPAC);
-        ch = 11;
+        profile.phy.phy_mode.leg_oqpsk.chip_rate = CHIP_RATE_2000;
+        profile.phy.freq_band = WORLD_2450;
+        profile.phy.ch_spacing = LEG_2450_CH_SPAC;
+        profile.phy.freq_f0 = LEG_2450_F0 - (11 * LEG_2450_CH_SPAC);
+        profile.channel = 11;
     }
 
-    /* Set modulation / PHY configuration */
-    status = tal_pib_set(trx_id, phySetting, (pib_value_t *)&phy);
-    if (status != MAC_SUCCESS)
-    {
-        return status;
-    }
+    return tal_phy_profile_apply(trx_id, &profile);
+}
 
-    /* Set channel */
-    status = tal_pib_set(trx_id, phyCurrentChannel, (pib_value_t *)&ch);
-    if (status != MAC_SUCCESS)
+
+/**
+ * @brief Prints the duration of PHY changes
+ *
+ * A change to a preset used the first time includes compiling its profile.
+ *
+ * @param trx_id    Transceiver identifier
+ */
+void print_phy_change_stats(trx_id_t trx_id)
+{
+    tal_phy_profile_stats_t stats;
+
+    tal_phy_profile_get_stats(trx_id, &stats);
+    if (stats.cold.count > 0)
     {
-        return status;
+        printf("PHY change incl. compile: last %"PRIu32" us, avg %"PRIu32" us (%"PRIu32"x)\n",
+               stats.cold.last_us, (uint32_t)(stats.cold.total_us / stats.cold.count),
+               stats.cold.count);
     }
-
-    /* Set transmit power */
-    int pwr = 14;
-    status = tal_pib_set(trx_id, phyTransmitPower, (pib_value_t *)&pwr);
-    if (status != MAC_SUCCESS)
+    if (stats.cached.count > 0)
     {
-        return status;
+        printf("PHY change cached:        last %"PRIu32" us, avg %"PRIu32" us (%"PRIu32"x)\n",
+               stats.cached.last_us, (uint32_t)(stats.cached.total_us / stats.cached.count),
+               stats.cached.count);
     }
-
-    return MAC_SUCCESS;
+    printf("Last profile: %"PRIu8" burst writes, %"PRIu16" octets\n",
+           stats.writes, stats.image_len);
 }
 
 #ifdef USER_CONFIGURATION 
@@ -1,6 +1,7 @@
 #ifndef _IMX6SXTYPES_H
 #define _IMX6SXTYPES_H
 #include <signal.h>  
+#include <stdint.h>
 
 
 /* program memory space abstraction */
@@ -11,6 +12,13 @@
 #define PGM_READ_BLOCK(dst, src, len) memcpy((dst), (src), (len))
 #define FUNC_PTR(x) void (*x)(union sigval v)
 
+/* segment of a scattered data block, see pal_trx_writev() */
+typedef struct pal_iov_tag
+{
+    uint8_t *base;
+    uint16_t len;
+} pal_iov_t;
+
 
 
 #endif
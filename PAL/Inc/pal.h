@@ -171,6 +171,16 @@ extern "C" {
      */
     void pal_get_current_time(uint32_t *current_time);
 
+    /**
+     * @brief Gets current time in ns
+     *
+     * The time base is the one of pal_get_current_time().
+     *
+     * @param[out] current_time Returns current system time in ns
+     * @ingroup apiPalApi
+     */
+    void pal_get_current_time_ns(uint64_t *current_time);
+
 	
 	void TRX_RST_HIGH();
 	void TRX_RST_LOW();
@@ -183,7 +193,9 @@ extern "C" {
 
 /** Defines if multi device support is not used */
 #define pal_dev_write(dev_id, addr, data, length)   pal_trx_write(addr, data, length)
+#define pal_dev_writev(dev_id, addr, iov, iov_cnt)  pal_trx_writev(addr, iov, iov_cnt)
 #define pal_dev_read(dev_id, addr, data, length)    pal_trx_read(addr, data, length)
+#define pal_dev_read_repeat(dev_id, addr, data, count) pal_trx_read_repeat(addr, data, count)
 #define pal_dev_reg_write(dev_id, addr, data)       pal_trx_reg_write(addr, data)
 #define pal_dev_reg_read(dev_id, addr)              pal_trx_reg_read(addr)
 #define pal_dev_bit_write(dev_id, addr, val)        pal_trx_bit_write(addr, val)
@@ -31,9 +31,62 @@
 
 /* === Macros =============================================================== */
 
+/**
+ * Maximum number of segments of pal_trx_writev()
+ */
+#define PAL_TRX_MAX_IOV                 (SPI_MAX_IOV)
+
+/**
+ * Maximum number of reads of pal_trx_read_repeat()
+ */
+#define PAL_TRX_MAX_REPEAT              (SPI_MAX_REPEAT)
+
+/**
+ * Number of register windows of a pal_trx_shadow_t
+ */
+#define PAL_TRX_SHADOW_WINDOWS          (2)
+
+/**
+ * Number of registers per window of a pal_trx_shadow_t
+ */
+#define PAL_TRX_SHADOW_SIZE             (128)
+
+/**
+ * Number of register shadows tracked at the same time, see
+ * pal_trx_track_start()
+ */
+#define PAL_TRX_MAX_TRACKED             (2)
+
 
 /* === Types =============================================================== */
 
+/**
+ * Register shadow receiving all trx accesses during a capture,
+ * see pal_trx_capture_start()
+ */
+typedef struct pal_trx_shadow_tag
+{
+    /** Start address of each register window */
+    uint16_t base[PAL_TRX_SHADOW_WINDOWS];
+    /** Register values */
+    uint8_t reg[PAL_TRX_SHADOW_WINDOWS][PAL_TRX_SHADOW_SIZE];
+    /** Registers written during the capture, one bit per register */
+    uint8_t written[PAL_TRX_SHADOW_WINDOWS][PAL_TRX_SHADOW_SIZE / 8];
+    /** Set if an access hit a register outside of the windows */
+    bool overflow;
+} pal_trx_shadow_t;
+
+/**
+ * SPI access counters of the transceiver interface, see pal_trx_get_stats()
+ */
+typedef struct pal_trx_stats_tag
+{
+    /** Number of SPI transactions; a bit write counts as read and write */
+    uint32_t accesses;
+    /** Transferred octets including the two octet command header */
+    uint32_t bytes;
+} pal_trx_stats_t;
+
 
 /* === Externals ============================================================ */
 
@@ -56,6 +109,19 @@ extern "C" {
     void pal_trx_write(uint16_t addr, uint8_t *data, uint16_t length);
 
 
+    /**
+     * @brief Writes scattered data into consecutive transceiver registers
+     *
+     * This function writes all segments in a single SPI access, i.e.
+     * the segments are placed back-to-back starting at addr.
+     *
+     * @param   addr Start address of the trx registers
+     * @param   iov Segments to be written
+     * @param   iov_cnt Number of segments, up to PAL_TRX_MAX_IOV
+     */
+    void pal_trx_writev(uint16_t addr, pal_iov_t *iov, uint8_t iov_cnt);
+
+
     /**
      * @brief Reads transceiver register values
      *
@@ -71,6 +137,19 @@ extern "C" {
     void pal_trx_read(uint16_t addr, uint8_t *data, uint16_t length);
 
 
+    /**
+     * @brief Reads a transceiver register several times
+     *
+     * Each read is a separate SPI transaction, but all of them are issued
+     * at once, e.g. to sample a register that changes continuously.
+     *
+     * @param[in]   addr Address of the trx register
+     * @param[out]  data Storage for the values read
+     * @param[in]   count Number of reads, up to PAL_TRX_MAX_REPEAT
+     */
+    void pal_trx_read_repeat(uint16_t addr, uint8_t *data, uint8_t count);
+
+
     /**
      * @brief Writes data into a transceiver register
      *
@@ -117,6 +196,60 @@ extern "C" {
      */
     void pal_trx_bit_write(uint16_t addr, uint8_t mask, uint8_t pos, uint8_t new_value);
 
+
+    /**
+     * @brief Starts capturing trx accesses into a register shadow
+     *
+     * Until pal_trx_capture_stop() is called, all accesses of the
+     * functions above made by the calling thread are redirected to the
+     * shadow; the transceiver is not accessed. Accesses from other threads
+     * (e.g. timer callbacks) are not affected. Reads return the shadow
+     * content, writes update it. Accesses outside of the shadow windows set the overflow flag
+     * and are dropped.
+     *
+     * @param   shadow Register shadow, windows and values set up by the caller
+     */
+    void pal_trx_capture_start(pal_trx_shadow_t *shadow);
+
+
+    /**
+     * @brief Stops capturing trx accesses
+     */
+    void pal_trx_capture_stop(void);
+
+
+    /**
+     * @brief Keeps a register shadow up to date with the transceiver
+     *
+     * All later writes and reads of registers within the shadow windows
+     * that reach the transceiver update the shadow, from any thread.
+     * Accesses redirected to a capture do not. Changes made by the
+     * transceiver itself, e.g. by a reset, are not seen.
+     *
+     * @param   shadow Register shadow, windows and values set up by the caller
+     *
+     * @return  true if the shadow is tracked, false if no slot is free
+     */
+    bool pal_trx_track_start(pal_trx_shadow_t *shadow);
+
+
+    /**
+     * @brief Stops tracking a register shadow
+     *
+     * @param   shadow Register shadow
+     */
+    void pal_trx_track_stop(pal_trx_shadow_t *shadow);
+
+
+    /**
+     * @brief Gets the SPI access counters
+     *
+     * Accesses redirected to a register shadow are not counted.
+     *
+     * @param   stats Counters to be filled
+     */
+    void pal_trx_get_stats(pal_trx_stats_t *stats);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
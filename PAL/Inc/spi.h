@@ -5,6 +5,13 @@
 #include <unistd.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include "pal_types.h"
+
+/* maximum number of data segments of one spi_writev() message */
+#define SPI_MAX_IOV		8
+
+/* maximum number of reads of one spi_read_repeat() message */
+#define SPI_MAX_REPEAT		32
 
 
 typedef struct spi_tag{
@@ -25,6 +32,8 @@ typedef struct spi_data_tag{
 int spi_init(spi_t* spi);
 int spi_write(spi_t* spi,spi_data_t* data);
 int spi_read(spi_t* spi,spi_data_t *data);
+int spi_writev(spi_t* spi,uint16_t address,const pal_iov_t* iov,uint8_t iov_cnt);
+int spi_read_repeat(spi_t* spi,uint16_t address,uint8_t* data,uint8_t count);
 uint8_t spi_reg_read(spi_t* spi,uint16_t address);
 int spi_reg_write(spi_t* spi,uint16_t address,uint8_t value);
 uint8_t spi_reg_bit_read(spi_t* spi,uint16_t address,uint8_t mask,uint8_t pos);
@@ -6,10 +6,11 @@
 #include <sys/time.h>
 #include <string.h> 
 #include <signal.h>
+#include <pthread.h>
 
 /* === Externals ============================================================ */
 extern At86rf215_Dev_t at86rf215_dev;
-struct timeval start;
+struct timespec start;
 
 
 retval_t pal_init(void){
@@ -22,7 +23,7 @@ retval_t pal_init(void){
 	if(-1==gpio_init(at86rf215_dev.gpio_rest)){
 		return FAILURE;
 	}
-	gettimeofday(&start,NULL);
+	clock_gettime(CLOCK_MONOTONIC,&start);
 	return MAC_SUCCESS;
 }
 
@@ -48,12 +49,54 @@ gpio_value_t TRX_IRQ_GET(){
 
 
 void pal_get_current_time(uint32_t *current_time){
-	struct  timeval  cur;
-	gettimeofday(&cur,NULL);
-	*current_time=(uint32_t)(1000000*(cur.tv_sec-start.tv_sec))+(cur.tv_usec-start.tv_usec);//us
+	struct  timespec  cur;
+	clock_gettime(CLOCK_MONOTONIC,&cur);
+	*current_time=(uint32_t)((1000000000LL*(cur.tv_sec-start.tv_sec)+(cur.tv_nsec-start.tv_nsec))/1000);//us, monotonic
 
 }
 
+/* Same time base as pal_get_current_time(); does not wrap */
+void pal_get_current_time_ns(uint64_t *current_time){
+	struct  timespec  cur;
+	clock_gettime(CLOCK_MONOTONIC,&cur);
+	*current_time=(uint64_t)(1000000000LL*(cur.tv_sec-start.tv_sec)+(cur.tv_nsec-start.tv_nsec));//ns, monotonic
+}
+
+
+/*
+ * POSIX timers are created once per timer id and instance and re-armed by
+ * later starts; periodically restarted timers would exhaust the kernel
+ * timers otherwise.
+ */
+#define PAL_MAX_TIMERS		(32)
+
+typedef struct pal_timer_tag{
+	bool used;
+	uint16_t id;
+	timer_instance_id_t instance;
+	FUNC_PTR(cb);
+	timer_t timerid;
+}pal_timer_t;
+
+static pal_timer_t pal_timers[PAL_MAX_TIMERS];
+/* Timers are started and stopped from the timer threads as well */
+static pthread_mutex_t pal_timer_mutex=PTHREAD_MUTEX_INITIALIZER;
+
+/* Called with pal_timer_mutex held */
+
+static pal_timer_t *find_timer(uint16_t id,timer_instance_id_t instance,bool alloc){
+	pal_timer_t *unused=NULL;
+	for(uint8_t i=0;i<PAL_MAX_TIMERS;i++){
+		if(!pal_timers[i].used){
+			if(unused==NULL){
+				unused=&pal_timers[i];
+			}
+		}else if((pal_timers[i].id==id)&&(pal_timers[i].instance==instance)){
+			return &pal_timers[i];
+		}
+	}
+	return alloc?unused:NULL;
+}
 
 retval_t pal_timer_start(uint16_t id,
 						 timer_instance_id_t timer_instance_id,
@@ -61,34 +104,59 @@ retval_t pal_timer_start(uint16_t id,
 						 timeout_type_t timeout_type,
 						 FUNC_PTR(timer_cb),
 						 void *param_cb){
-	timer_t timerid;
-	struct sigevent evp;
-	memset(&evp, 0, sizeof(struct sigevent));		//ʼ
-	evp.sigev_value.sival_int=timer_instance_id;
-	evp.sigev_notify = SIGEV_THREAD;			//֪߳ͨķʽפ߳
-	evp.sigev_notify_function = timer_cb;		//ַ̺߳	
-	if (timer_create(CLOCK_REALTIME, &evp, &timerid) == -1)
-	{
-		perror("fail to timer_create");
+	pthread_mutex_lock(&pal_timer_mutex);
+	pal_timer_t *t=find_timer(id,timer_instance_id,true);
+	if(t==NULL){
+		pthread_mutex_unlock(&pal_timer_mutex);
 		return FAILURE;
 	}
+	if(t->used&&(t->cb!=timer_cb)){
+		timer_delete(t->timerid);
+		t->used=false;
+	}
+	if(!t->used){
+		struct sigevent evp;
+		memset(&evp, 0, sizeof(struct sigevent));		//ʼ
+		evp.sigev_value.sival_int=timer_instance_id;
+		evp.sigev_notify = SIGEV_THREAD;			//֪߳ͨķʽפ߳
+		evp.sigev_notify_function = timer_cb;		//ַ̺߳	
+		if (timer_create(CLOCK_MONOTONIC, &evp, &t->timerid) == -1)
+		{
+			perror("fail to timer_create");
+			pthread_mutex_unlock(&pal_timer_mutex);
+			return FAILURE;
+		}
+		t->used=true;
+		t->id=id;
+		t->instance=timer_instance_id;
+		t->cb=timer_cb;
+	}
 	struct itimerspec it;
 	it.it_interval.tv_sec = 0;
 	it.it_interval.tv_nsec = 0;
 	it.it_value.tv_sec = timer_count/1000000;//s
-	it.it_value.tv_nsec = timer_count*1000-it.it_value.tv_sec*1000000;//ns
-	if (timer_settime(timerid, 0, &it, NULL) == -1)
+	it.it_value.tv_nsec = (timer_count%1000000)*1000;//ns
+	if (timer_settime(t->timerid, 0, &it, NULL) == -1)
 	{
 		perror("fail to timer_settime");
+		pthread_mutex_unlock(&pal_timer_mutex);
 		return FAILURE;
 	}
+	pthread_mutex_unlock(&pal_timer_mutex);
 	return MAC_SUCCESS;
 
 }
 
 retval_t pal_timer_stop(uint16_t timer_id,
 							timer_instance_id_t timer_instance_id){
-	
+	pthread_mutex_lock(&pal_timer_mutex);
+	pal_timer_t *t=find_timer(timer_id,timer_instance_id,false);
+	if(t!=NULL){
+		struct itimerspec it;
+		memset(&it,0,sizeof(it));
+		timer_settime(t->timerid,0,&it,NULL);
+	}
+	pthread_mutex_unlock(&pal_timer_mutex);
 	return MAC_SUCCESS;
 }
 
@@ -1,6 +1,7 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 #include "pal.h"
 #include "pal_types.h"
 
@@ -12,40 +13,151 @@ extern At86rf215_Dev_t at86rf215_dev;
 /* === Macros =============================================================== */
 
 
+/* === Globals ============================================================== */
+
+/*
+ * Shadow receiving the trx accesses while a capture is running; per thread,
+ * the timer callbacks keep accessing the transceiver meanwhile
+ */
+static __thread pal_trx_shadow_t *trx_shadow = NULL;
+
+/* Shadows kept up to date with the transceiver, see pal_trx_track_start() */
+static pal_trx_shadow_t *trx_tracked[PAL_TRX_MAX_TRACKED];
+
+static pal_trx_stats_t trx_stats;
+
+/* === Prototypes =========================================================== */
+
+static uint8_t *shadow_reg(uint16_t addr, bool write);
+static void shadow_write(uint16_t addr, uint8_t *data, uint16_t length);
+static inline void count_access(uint16_t length);
+static void track_update(uint16_t addr, const uint8_t *data, uint16_t length);
+
+/* === Implementation ======================================================= */
+
+
 void pal_trx_write(uint16_t addr, uint8_t *data, uint16_t length)
 {
+	if (trx_shadow != NULL)
+	{
+		shadow_write(addr, data, length);
+		return;
+	}
+
 	spi_data_t message={
 		.address=addr,
 		.data=data,
 		.len=length
 	};
+	count_access(length);
 	spi_write(at86rf215_dev.spi,&message);
+	track_update(addr, data, length);
+}
+
+
+void pal_trx_writev(uint16_t addr, pal_iov_t *iov, uint8_t iov_cnt)
+{
+	if (trx_shadow != NULL)
+	{
+		for (uint8_t i = 0; i < iov_cnt; i++)
+		{
+			shadow_write(addr, iov[i].base, iov[i].len);
+			addr += iov[i].len;
+		}
+		return;
+	}
+
+	uint16_t length = 0;
+	for (uint8_t i = 0; i < iov_cnt; i++)
+	{
+		length += iov[i].len;
+	}
+	count_access(length);
+	spi_writev(at86rf215_dev.spi,addr,iov,iov_cnt);
+	for (uint8_t i = 0; i < iov_cnt; i++)
+	{
+		track_update(addr, iov[i].base, iov[i].len);
+		addr += iov[i].len;
+	}
 }
 
 
 void pal_trx_read(uint16_t addr, uint8_t *data, uint16_t length)
 {
+	if (trx_shadow != NULL)
+	{
+		for (uint16_t i = 0; i < length; i++)
+		{
+			uint8_t *reg = shadow_reg(addr + i, false);
+			data[i] = (reg != NULL) ? *reg : 0;
+		}
+		return;
+	}
+
 	spi_data_t message={
 		.address=addr,
 		.data=data,
 		.len=length
 	};
+	count_access(length);
 	spi_read(at86rf215_dev.spi,&message);
+	track_update(addr, data, length);
+}
+
+
+void pal_trx_read_repeat(uint16_t addr, uint8_t *data, uint8_t count)
+{
+	if (trx_shadow != NULL)
+	{
+		uint8_t *reg = shadow_reg(addr, false);
+		memset(data, (reg != NULL) ? *reg : 0, count);
+		return;
+	}
+
+	for (uint8_t i = 0; i < count; i++)
+	{
+		count_access(1);
+	}
+	spi_read_repeat(at86rf215_dev.spi,addr,data,count);
 }
 
 
 void pal_trx_reg_write(uint16_t addr, uint8_t data)
 {
+	if (trx_shadow != NULL)
+	{
+		shadow_write(addr, &data, 1);
+		return;
+	}
+
+	count_access(1);
 	spi_reg_write(at86rf215_dev.spi,addr,data);
+	track_update(addr, &data, 1);
 }
 
 
 uint8_t pal_trx_reg_read(uint16_t addr)
 {
-	return spi_reg_read(at86rf215_dev.spi,addr);
+	if (trx_shadow != NULL)
+	{
+		uint8_t *reg = shadow_reg(addr, false);
+		return (reg != NULL) ? *reg : 0;
+	}
+
+	count_access(1);
+	uint8_t data = spi_reg_read(at86rf215_dev.spi,addr);
+	track_update(addr, &data, 1);
+	return data;
 }
 
 uint8_t pal_trx_bit_read(uint16_t addr, uint8_t mask, uint8_t pos){
+	if (trx_shadow != NULL)
+	{
+		uint8_t *reg = shadow_reg(addr, false);
+		return (reg != NULL) ? ((*reg & mask) >> pos) : 0;
+	}
+
+	count_access(1);
 	uint8_t ret=spi_reg_bit_read(at86rf215_dev.spi,addr,mask,pos);
 	return ret;
 
@@ -54,7 +166,168 @@ uint8_t pal_trx_bit_read(uint16_t addr, uint8_t mask, uint8_t pos){
  
 void pal_trx_bit_write(uint16_t addr, uint8_t mask, uint8_t pos, uint8_t new_value) 
 {
+	if (trx_shadow != NULL)
+	{
+		uint8_t *reg = shadow_reg(addr, true);
+		if (reg != NULL)
+		{
+			*reg = (*reg & ~mask) | ((new_value << pos) & mask);
+		}
+		return;
+	}
+
+	/* Read-modify-write */
+	count_access(1);
+	count_access(1);
  	spi_reg_bit_write(at86rf215_dev.spi,addr,mask,pos,new_value);
+
+	for (uint8_t t = 0; t < PAL_TRX_MAX_TRACKED; t++)
+	{
+		pal_trx_shadow_t *shadow = trx_tracked[t];
+		for (uint8_t i = 0; (shadow != NULL) && (i < PAL_TRX_SHADOW_WINDOWS); i++)
+		{
+			uint16_t idx = addr - shadow->base[i];
+			if (idx < PAL_TRX_SHADOW_SIZE)
+			{
+				uint8_t *reg = &shadow->reg[i][idx];
+				*reg = (*reg & ~mask) | ((new_value << pos) & mask);
+			}
+		}
+	}
+}
+
+
+void pal_trx_capture_start(pal_trx_shadow_t *shadow)
+{
+	trx_shadow = shadow;
+}
+
+
+void pal_trx_capture_stop(void)
+{
+	trx_shadow = NULL;
+}
+
+
+bool pal_trx_track_start(pal_trx_shadow_t *shadow)
+{
+	for (uint8_t t = 0; t < PAL_TRX_MAX_TRACKED; t++)
+	{
+		if ((trx_tracked[t] == NULL) || (trx_tracked[t] == shadow))
+		{
+			trx_tracked[t] = shadow;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+void pal_trx_track_stop(pal_trx_shadow_t *shadow)
+{
+	for (uint8_t t = 0; t < PAL_TRX_MAX_TRACKED; t++)
+	{
+		if (trx_tracked[t] == shadow)
+		{
+			trx_tracked[t] = NULL;
+		}
+	}
+}
+
+
+void pal_trx_get_stats(pal_trx_stats_t *stats)
+{
+	*stats = trx_stats;
+}
+
+
+/**
+ * @brief Counts an SPI transaction
+ *
+ * @param length Number of data octets
+ */
+static inline void count_access(uint16_t length)
+{
+	trx_stats.accesses++;
+	trx_stats.bytes += 2 + length;
+}
+
+
+/**
+ * @brief Updates the tracked shadows after a transceiver access
+ *
+ * @param addr Start address
+ * @param data Values written or read
+ * @param length Number of registers
+ */
+static void track_update(uint16_t addr, const uint8_t *data, uint16_t length)
+{
+	for (uint8_t t = 0; t < PAL_TRX_MAX_TRACKED; t++)
+	{
+		pal_trx_shadow_t *shadow = trx_tracked[t];
+		for (uint8_t i = 0; (shadow != NULL) && (i < PAL_TRX_SHADOW_WINDOWS); i++)
+		{
+			uint16_t first = (addr > shadow->base[i]) ? addr : shadow->base[i];
+			uint32_t end = (uint32_t)addr + length;
+			if (end > (uint32_t)shadow->base[i] + PAL_TRX_SHADOW_SIZE)
+			{
+				end = (uint32_t)shadow->base[i] + PAL_TRX_SHADOW_SIZE;
+			}
+			if (first < end)
+			{
+				memcpy(&shadow->reg[i][first - shadow->base[i]], &data[first - addr], end - first);
+			}
+		}
+	}
+}
+
+
+/**
+ * @brief Gets the shadow location of a register
+ *
+ * @param addr Register address
+ * @param write true if the register is written
+ *
+ * @return Pointer to the shadow value, NULL if outside of the windows
+ */
+static uint8_t *shadow_reg(uint16_t addr, bool write)
+{
+	for (uint8_t i = 0; i < PAL_TRX_SHADOW_WINDOWS; i++)
+	{
+		uint16_t idx = addr - trx_shadow->base[i];
+		if (idx < PAL_TRX_SHADOW_SIZE)
+		{
+			if (write)
+			{
+				trx_shadow->written[i][idx >> 3] |= (uint8_t)(1 << (idx & 0x07));
+			}
+			return &trx_shadow->reg[i][idx];
+		}
+	}
+
+	trx_shadow->overflow = true;
+	return NULL;
+}
+
+
+/**
+ * @brief Writes consecutive registers of the shadow
+ *
+ * @param addr Start address
+ * @param data Values to be written
+ * @param length Number of registers
+ */
+static void shadow_write(uint16_t addr, uint8_t *data, uint16_t length)
+{
+	for (uint16_t i = 0; i < length; i++)
+	{
+		uint8_t *reg = shadow_reg(addr + i, true);
+		if (reg != NULL)
+		{
+			*reg = data[i];
+		}
+	}
 }
 
 
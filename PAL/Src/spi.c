@@ -8,6 +8,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <getopt.h>
 #include <fcntl.h>
 #include <sys/ioctl.h>
@@ -73,6 +74,41 @@ int spi_write(spi_t* spi,spi_data_t* data){
 	return data->len;
 }
 
+/*
+ * write scattered data to consecutive addresses: the address word and all
+ * segments are sent as one message, i.e. under a single chip-select
+ */
+int spi_writev(spi_t* spi,uint16_t address,const pal_iov_t* iov,uint8_t iov_cnt){
+	struct spi_ioc_transfer tr[SPI_MAX_IOV+1];
+	uint16_t spi_address=set_spi_address(address);
+	int len=0;
+	if(iov_cnt>SPI_MAX_IOV){
+		return -1;
+	}
+	spi_address|=(1<<7);// set write mode
+	memset(tr,0,sizeof(tr));
+	tr[0].tx_buf=(unsigned long)&spi_address;
+	tr[0].len=2;
+	tr[0].delay_usecs=spi->delay;
+	tr[0].speed_hz=spi->speed;
+	tr[0].bits_per_word=spi->bits;
+	for(uint8_t i=0;i<iov_cnt;i++){
+		tr[i+1].tx_buf=(unsigned long)iov[i].base;
+		tr[i+1].len=iov[i].len;
+		tr[i+1].delay_usecs=spi->delay;
+		tr[i+1].speed_hz=spi->speed;
+		tr[i+1].bits_per_word=spi->bits;
+		len+=iov[i].len;
+	}
+
+	int ret = ioctl(spi->fd, SPI_IOC_MESSAGE(iov_cnt+1), &tr);
+	if (ret < 1){
+		perror("can't send spi message");
+		return -1;
+	}
+	return len;
+}
+
 int spi_read(spi_t* spi,spi_data_t *data){
 	uint16_t spi_address=set_spi_address(data->address);
 	struct spi_ioc_transfer tr[2] = {
@@ -101,6 +137,39 @@ int spi_read(spi_t* spi,spi_data_t *data){
 
 }
 
+/*
+ * read the same register several times: each read is a separate chip-select
+ * frame, but all frames are sent as one message
+ */
+int spi_read_repeat(spi_t* spi,uint16_t address,uint8_t* data,uint8_t count){
+	struct spi_ioc_transfer tr[2*SPI_MAX_REPEAT];
+	uint16_t spi_address=set_spi_address(address);
+	if((count==0)||(count>SPI_MAX_REPEAT)){
+		return -1;
+	}
+	memset(tr,0,sizeof(tr));
+	for(uint8_t i=0;i<count;i++){
+		tr[2*i].tx_buf=(unsigned long)&spi_address;
+		tr[2*i].len=2;
+		tr[2*i].delay_usecs=spi->delay;
+		tr[2*i].speed_hz=spi->speed;
+		tr[2*i].bits_per_word=spi->bits;
+		tr[2*i+1].rx_buf=(unsigned long)&data[i];
+		tr[2*i+1].len=1;
+		tr[2*i+1].delay_usecs=spi->delay;
+		tr[2*i+1].speed_hz=spi->speed;
+		tr[2*i+1].bits_per_word=spi->bits;
+		tr[2*i+1].cs_change=(i+1<count);// end the frame
+	}
+
+	int ret = ioctl(spi->fd, SPI_IOC_MESSAGE(2*count), &tr);
+	if (ret < 1){
+		perror("can't send spi message");
+		return -1;
+	}
+	return count;
+}
+
 uint8_t spi_reg_read(spi_t* spi,uint16_t address){
 	uint8_t rx[1];
 	spi_data_t message={
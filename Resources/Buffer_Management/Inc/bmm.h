@@ -22,6 +22,9 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#ifdef ENABLE_BMM_DEBUG
+#include <stdio.h>
+#endif
 
 /* === Macros ============================================================== */
 
@@ -30,6 +33,39 @@
  */
 #define BMM_BUFFER_POINTER(buf) ((buf)->body)
 
+#ifdef ENABLE_BMM_DEBUG
+
+/**
+ * Owner tags used for buffer ownership tracking.
+ * Values starting at BMM_OWNER_APP are free for application use.
+ */
+#define BMM_OWNER_NONE              (0x00)
+#define BMM_OWNER_TAL_RX            (0x01)
+#define BMM_OWNER_TAL_QUEUE         (0x02)
+#define BMM_OWNER_APP               (0x10)
+
+/** Number of buckets of the buffer age histogram */
+#define BMM_DEBUG_AGE_BUCKETS       (6)
+
+/** Byte pattern written to the body of a freed buffer */
+#define BMM_POISON_PATTERN          (0xDB)
+
+/**
+ * Records the allocation site of each buffer.
+ */
+#define bmm_buffer_alloc(size)      bmm_buffer_alloc_at((size), __FILE__, __LINE__)
+
+/**
+ * Hands a buffer over to a new owner.
+ */
+#define BMM_SET_OWNER(buf, tag)     bmm_debug_set_owner((buf), (tag))
+
+#else
+
+#define BMM_SET_OWNER(buf, tag)
+
+#endif  /* #ifdef ENABLE_BMM_DEBUG */
+
 /* === Types =============================================================== */
 
 /**
@@ -46,8 +82,49 @@ typedef struct
     uint8_t *body;
     /** Pointer to next free buffer */
     struct buffer_tag *next;
+#ifdef ENABLE_QMM_INDEX
+    /** Pointer to previous buffer, maintained by indexed queues only */
+    struct buffer_tag *prev;
+#endif
+    /**
+     * Number of references held to this buffer.
+     * The buffer is returned to the pool when the last reference is released.
+     */
+    uint8_t ref_count;
+#ifdef ENABLE_BMM_DEBUG
+    /** Current owner of the buffer, see BMM_OWNER_* */
+    uint8_t owner;
+    /** Body has been poisoned when the buffer was freed */
+    bool poisoned;
+    /** Source line of the allocation */
+    uint16_t alloc_line;
+    /** Source file of the allocation */
+    const char *alloc_file;
+    /** Allocation time in us */
+    uint32_t alloc_time;
+#endif
 } buffer_t;
 
+#ifdef ENABLE_BMM_DEBUG
+/**
+ * @brief Buffer debug statistics
+ */
+typedef struct bmm_debug_stats_tag
+{
+    /** Number of currently allocated buffers */
+    uint8_t outstanding;
+    /** Number of detected double frees */
+    uint16_t double_free;
+    /** Number of detected writes to freed buffers */
+    uint16_t use_after_free;
+    /**
+     * Age histogram of outstanding buffers:
+     * < 1 ms, < 10 ms, < 100 ms, < 1 s, < 10 s, >= 10 s
+     */
+    uint8_t age_hist[BMM_DEBUG_AGE_BUCKETS];
+} bmm_debug_stats_t;
+#endif
+
 /* === Externals =========================================================== */
 
 
@@ -82,7 +159,9 @@ extern "C" {
      *
      * @ingroup apiResApi
      */
-#if defined(ENABLE_LARGE_BUFFER)
+#if defined(ENABLE_BMM_DEBUG)
+    buffer_t *bmm_buffer_alloc_at(uint16_t size, const char *file, uint16_t line);
+#elif defined(ENABLE_LARGE_BUFFER)
     buffer_t *bmm_buffer_alloc(uint16_t size);
 #else
     buffer_t *bmm_buffer_alloc(uint8_t size);
@@ -91,7 +170,8 @@ extern "C" {
     /**
      * @brief Frees up a buffer.
      *
-     * This function frees up a buffer. The pointer passed to this function
+     * This function drops one reference to a buffer and frees it up once the
+     * last reference is dropped. The pointer passed to this function
      * should be the pointer returned during buffer allocation. The result is
      * unpredictable if an incorrect pointer is passed.
      *
@@ -101,6 +181,67 @@ extern "C" {
      */
     void bmm_buffer_free(buffer_t *pbuffer);
 
+    /**
+     * @brief Acquires an additional reference to a buffer.
+     *
+     * This function increments the reference counter of an allocated buffer.
+     * Each reference has to be dropped by a call to bmm_buffer_free();
+     * the buffer is returned to the pool only if the last reference is
+     * dropped. A shared buffer must be treated as read-only and must not be
+     * appended to any queue, since the queue link is part of the buffer header.
+     *
+     * @param pbuffer Pointer to buffer to be retained.
+     *
+     * @return Pointer to the retained buffer,
+     *  NULL if the buffer is invalid or its reference counter is saturated.
+     *
+     * @ingroup apiResApi
+     */
+    buffer_t *bmm_buffer_retain(buffer_t *pbuffer);
+
+#ifdef ENABLE_BMM_DEBUG
+    /**
+     * @brief Enables or disables buffer ownership tracking at runtime.
+     *
+     * While tracking is disabled, allocation and freeing cost one additional
+     * branch only. Enabling tracking also poisons buffers on free and checks
+     * the poison pattern on allocation.
+     *
+     * @param enable true to enable tracking
+     *
+     * @ingroup apiResApi
+     */
+    void bmm_debug_enable(bool enable);
+
+    /**
+     * @brief Hands a buffer over to a new owner.
+     *
+     * @param pbuffer Pointer to buffer
+     * @param owner Owner tag, see BMM_OWNER_*
+     *
+     * @ingroup apiResApi
+     */
+    void bmm_debug_set_owner(buffer_t *pbuffer, uint8_t owner);
+
+    /**
+     * @brief Gets the buffer debug statistics.
+     *
+     * @param stats Pointer to the statistics to be filled
+     *
+     * @ingroup apiResApi
+     */
+    void bmm_debug_get_stats(bmm_debug_stats_t *stats);
+
+    /**
+     * @brief Prints all outstanding buffers and their age histogram.
+     *
+     * @param stream Output stream
+     *
+     * @ingroup apiResApi
+     */
+    void bmm_debug_dump(FILE *stream);
+#endif  /* #ifdef ENABLE_BMM_DEBUG */
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
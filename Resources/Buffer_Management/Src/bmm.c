@@ -19,6 +19,7 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 #include "pal.h"
 #include "return_val.h"
 #include "bmm.h"
@@ -63,8 +64,27 @@ static buffer_t buf_header[TOTAL_NUMBER_OF_LARGE_BUFS];
 static queue_t free_large_buffer_q;
 #endif
 
+#ifdef ENABLE_BMM_DEBUG
+/*
+ * Runtime switch of the buffer ownership tracking
+ */
+static bool bmm_debug_enabled;
+
+/*
+ * Number of detected double frees and writes to freed buffers
+ */
+static uint16_t bmm_double_free_cnt;
+static uint16_t bmm_use_after_free_cnt;
+#endif
+
 /* === Prototypes ========================================================== */
 
+#ifdef ENABLE_BMM_DEBUG
+static void debug_track_alloc(buffer_t *pbuffer, const char *file, uint16_t line);
+static void debug_track_free(buffer_t *pbuffer);
+static uint8_t age_bucket(uint32_t age_us);
+#endif
+
 
 /* === Implementation ====================================================== */
 
@@ -92,6 +112,7 @@ void bmm_buffer_init(void)
          * buffer body
          */
         buf_header[index].body = buf_pool + (index * LARGE_BUFFER_SIZE);
+        buf_header[index].ref_count = 0;
 
         /* Append the buffer to free large buffer queue */
         qmm_queue_append(&free_large_buffer_q, &buf_header[index]);
@@ -112,7 +133,9 @@ void bmm_buffer_init(void)
  * @return pointer to the buffer allocated,
  *  NULL if buffer not available.
  */
-#if defined(ENABLE_LARGE_BUFFER)
+#if defined(ENABLE_BMM_DEBUG)
+buffer_t *bmm_buffer_alloc_at(uint16_t size, const char *file, uint16_t line)
+#elif defined(ENABLE_LARGE_BUFFER)
 buffer_t *bmm_buffer_alloc(uint16_t size)
 #else
 buffer_t *bmm_buffer_alloc(uint8_t size)
@@ -123,6 +146,18 @@ buffer_t *bmm_buffer_alloc(uint8_t size)
     /* Allocate buffer from free large buffer queue */
     pfree_buffer = qmm_queue_remove(&free_large_buffer_q, NULL);
 
+    if (NULL != pfree_buffer)
+    {
+        /* The caller holds the first reference */
+        pfree_buffer->ref_count = 1;
+#ifdef ENABLE_BMM_DEBUG
+        if (bmm_debug_enabled)
+        {
+            debug_track_alloc(pfree_buffer, file, line);
+        }
+#endif
+    }
+
     size = size;    /* Keep compiler happy. */
 
     return pfree_buffer;
@@ -132,7 +167,8 @@ buffer_t *bmm_buffer_alloc(uint8_t size)
 /**
  * @brief Frees up a buffer.
  *
- * This function frees up a buffer. The pointer passed to this function
+ * This function drops one reference to a buffer and frees it up once the
+ * last reference is dropped. The pointer passed to this function
  * should be the pointer returned during buffer allocation. The result is
  * unpredictable if an incorrect pointer is passed.
  *
@@ -146,9 +182,233 @@ void bmm_buffer_free(buffer_t *pbuffer)
         return;
     }
 
+    ENTER_CRITICAL_REGION();
+    if (pbuffer->ref_count > 1)
+    {
+        /* Other references are still held, keep the buffer */
+        pbuffer->ref_count--;
+        LEAVE_CRITICAL_REGION();
+        return;
+    }
+    if (pbuffer->ref_count == 0)
+    {
+        /* Buffer is already free, do not corrupt the free queue */
+        LEAVE_CRITICAL_REGION();
+#ifdef ENABLE_BMM_DEBUG
+        bmm_double_free_cnt++;
+#endif
+        return;
+    }
+    pbuffer->ref_count = 0;
+    LEAVE_CRITICAL_REGION();
+
+#ifdef ENABLE_BMM_DEBUG
+    if (bmm_debug_enabled)
+    {
+        debug_track_free(pbuffer);
+    }
+#endif
+
     /* Append the buffer into free large buffer queue */
     qmm_queue_append(&free_large_buffer_q, pbuffer);
 }
 
+
+
+/**
+ * @brief Acquires an additional reference to a buffer.
+ *
+ * This function increments the reference counter of an allocated buffer.
+ * Each reference has to be dropped by a call to bmm_buffer_free().
+ *
+ * @param pbuffer Pointer to buffer to be retained.
+ *
+ * @return Pointer to the retained buffer,
+ *  NULL if the buffer is invalid or its reference counter is saturated.
+ */
+buffer_t *bmm_buffer_retain(buffer_t *pbuffer)
+{
+    if ((NULL == pbuffer) || (0 == pbuffer->ref_count))
+    {
+        /* Buffer is not allocated */
+        return NULL;
+    }
+
+    ENTER_CRITICAL_REGION();
+    if (pbuffer->ref_count == UINT8_MAX)
+    {
+        LEAVE_CRITICAL_REGION();
+        return NULL;
+    }
+    pbuffer->ref_count++;
+    LEAVE_CRITICAL_REGION();
+
+    return pbuffer;
+}
+
+#ifdef ENABLE_BMM_DEBUG
+
+/**
+ * @brief Enables or disables buffer ownership tracking at runtime.
+ *
+ * @param enable true to enable tracking
+ */
+void bmm_debug_enable(bool enable)
+{
+    bmm_debug_enabled = enable;
+}
+
+
+/**
+ * @brief Hands a buffer over to a new owner.
+ *
+ * @param pbuffer Pointer to buffer
+ * @param owner Owner tag, see BMM_OWNER_*
+ */
+void bmm_debug_set_owner(buffer_t *pbuffer, uint8_t owner)
+{
+    if (bmm_debug_enabled && (NULL != pbuffer))
+    {
+        pbuffer->owner = owner;
+    }
+}
+
+
+/**
+ * @brief Records owner, allocation site and time of an allocated buffer
+ *
+ * A buffer that was poisoned during freeing has to come back unchanged;
+ * any modified byte indicates a write after the buffer has been freed.
+ *
+ * @param pbuffer Pointer to allocated buffer
+ * @param file Source file of the allocation
+ * @param line Source line of the allocation
+ */
+static void debug_track_alloc(buffer_t *pbuffer, const char *file, uint16_t line)
+{
+    if (pbuffer->poisoned)
+    {
+        for (uint16_t i = 0; i < LARGE_BUFFER_SIZE; i++)
+        {
+            if (pbuffer->body[i] != BMM_POISON_PATTERN)
+            {
+                bmm_use_after_free_cnt++;
+                break;
+            }
+        }
+        pbuffer->poisoned = false;
+    }
+
+    pbuffer->owner = BMM_OWNER_NONE;
+    pbuffer->alloc_file = file;
+    pbuffer->alloc_line = line;
+    pal_get_current_time(&pbuffer->alloc_time);
+}
+
+
+/**
+ * @brief Poisons the body of a buffer that is returned to the pool
+ *
+ * @param pbuffer Pointer to freed buffer
+ */
+static void debug_track_free(buffer_t *pbuffer)
+{
+    memset(pbuffer->body, BMM_POISON_PATTERN, LARGE_BUFFER_SIZE);
+    pbuffer->poisoned = true;
+    pbuffer->owner = BMM_OWNER_NONE;
+}
+
+
+/**
+ * @brief Maps a buffer age to its histogram bucket
+ *
+ * @param age_us Age of the buffer in us
+ *
+ * @return Bucket index, 0 .. (BMM_DEBUG_AGE_BUCKETS - 1)
+ */
+static uint8_t age_bucket(uint32_t age_us)
+{
+    uint8_t bucket = 0;
+    uint32_t limit = 1000;
+
+    while ((bucket < (BMM_DEBUG_AGE_BUCKETS - 1)) && (age_us >= limit))
+    {
+        bucket++;
+        limit *= 10;
+    }
+
+    return bucket;
+}
+
+
+/**
+ * @brief Gets the buffer debug statistics.
+ *
+ * @param stats Pointer to the statistics to be filled
+ */
+void bmm_debug_get_stats(bmm_debug_stats_t *stats)
+{
+    uint32_t now;
+
+    pal_get_current_time(&now);
+    memset(stats, 0, sizeof(bmm_debug_stats_t));
+
+    for (uint8_t index = 0; index < TOTAL_NUMBER_OF_LARGE_BUFS; index++)
+    {
+        if (buf_header[index].ref_count > 0)
+        {
+            stats->outstanding++;
+            stats->age_hist[age_bucket(now - buf_header[index].alloc_time)]++;
+        }
+    }
+
+    stats->double_free = bmm_double_free_cnt;
+    stats->use_after_free = bmm_use_after_free_cnt;
+}
+
+
+/**
+ * @brief Prints all outstanding buffers and their age histogram.
+ *
+ * @param stream Output stream
+ */
+void bmm_debug_dump(FILE *stream)
+{
+    static const char *const bucket_name[BMM_DEBUG_AGE_BUCKETS] =
+    {
+        "<1ms", "<10ms", "<100ms", "<1s", "<10s", ">=10s"
+    };
+    bmm_debug_stats_t stats;
+    uint32_t now;
+
+    bmm_debug_get_stats(&stats);
+    pal_get_current_time(&now);
+
+    fprintf(stream, "bmm: %u of %u buffers outstanding, double free %u, use after free %u\n",
+            stats.outstanding, TOTAL_NUMBER_OF_LARGE_BUFS,
+            stats.double_free, stats.use_after_free);
+
+    for (uint8_t index = 0; index < TOTAL_NUMBER_OF_LARGE_BUFS; index++)
+    {
+        buffer_t *buf = &buf_header[index];
+
+        if (buf->ref_count > 0)
+        {
+            fprintf(stream, "  #%u refs %u owner 0x%02X age %u us at %s:%u\n",
+                    index, buf->ref_count, buf->owner,
+                    (unsigned)(now - buf->alloc_time),
+                    (buf->alloc_file != NULL) ? buf->alloc_file : "?",
+                    buf->alloc_line);
+        }
+    }
+
+    for (uint8_t bucket = 0; bucket < BMM_DEBUG_AGE_BUCKETS; bucket++)
+    {
+        fprintf(stream, "  %-7s %u\n", bucket_name[bucket], stats.age_hist[bucket]);
+    }
+}
+
+#endif  /* #ifdef ENABLE_BMM_DEBUG */
+
 #endif /* (TOTAL_NUMBER_OF_BUFS > 0) */
 /* EOF */
@@ -25,6 +25,12 @@
 
 /* === Macros ============================================================== */
 
+#ifdef ENABLE_QMM_INDEX
+/**
+ * Marker of a deleted index slot
+ */
+#define QMM_INDEX_TOMBSTONE         ((buffer_t *)1)
+#endif
 
 /* === Types =============================================================== */
 
@@ -64,8 +70,57 @@ typedef struct
      * Number of buffers present in the current queue
      */
     uint8_t size;
+#ifdef ENABLE_QMM_INDEX
+    /** Keyed index of the queue, NULL if the queue is not indexed */
+    struct qmm_index_tag *index;
+#endif
 } queue_t;
 
+#ifdef ENABLE_QMM_INDEX
+/**
+ * @brief Function extracting the lookup key from a buffer body
+ */
+typedef uint32_t (*qmm_key_func_t)(void *buf);
+
+/**
+ * @brief Slot of a keyed queue index
+ */
+typedef struct qmm_index_slot_tag
+{
+    /** Key of the indexed buffer */
+    uint32_t key;
+    /** Indexed buffer, NULL if empty, QMM_INDEX_TOMBSTONE if deleted */
+    buffer_t *buf;
+} qmm_index_slot_t;
+
+/**
+ * @brief Keyed open-addressing index maintained alongside a queue
+ *
+ * Slots are probed linearly. Deleted slots are never reused until the
+ * index is rebuilt, so buffers sharing a key are found in FIFO order.
+ * The queue depth is limited to half the number of slots, so a rebuild
+ * frees at least a quarter of the slots and is needed at most once per
+ * num_slots / 4 appends.
+ */
+typedef struct qmm_index_tag
+{
+    /** Key extractor applied to the buffer body */
+    qmm_key_func_t key_func;
+    /** Slot storage provided by the user */
+    qmm_index_slot_t *slots;
+    /** Number of slots, power of two */
+    uint16_t num_slots;
+    /** Maximum number of buffers in the queue */
+    uint8_t capacity;
+    /** Number of occupied and deleted slots */
+    uint16_t used_slots;
+    /** Number of key lookups */
+    uint32_t lookups;
+    /** Number of probed slots during lookups */
+    uint32_t probes;
+} qmm_index_t;
+#endif  /* #ifdef ENABLE_QMM_INDEX */
+
 /* === Externals =========================================================== */
 
 
@@ -98,9 +153,12 @@ extern "C"
      * Note that this pointer should be same as the
      * pointer returned by bmm_buffer_alloc.
      *
+     * @return MAC_SUCCESS, or MAC_TRANSACTION_OVERFLOW if an indexed queue
+     *         is full; the buffer is not appended then
+     *
      * @ingroup apiResApi
      */
-    void qmm_queue_append(queue_t *q, buffer_t *buf);
+    retval_t qmm_queue_append(queue_t *q, buffer_t *buf);
 
     /**
      * @brief Removes a buffer from queue.
@@ -147,6 +205,56 @@ extern "C"
      */
     void qmm_queue_flush(queue_t *q);
 
+#ifdef ENABLE_QMM_INDEX
+    /**
+     * @brief Attaches a keyed index to a queue.
+     *
+     * Buffers already present in the queue are indexed. From now on the
+     * index is maintained by all queue operations, and qmm_queue_append()
+     * rejects buffers beyond the capacity.
+     *
+     * @param q Queue to be indexed
+     * @param index Index control structure
+     * @param slots Slot storage
+     * @param num_slots Number of slots, power of two, at least twice the
+     *                  capacity
+     * @param capacity Maximum number of buffers in the queue, at least the
+     *                 current queue size
+     * @param key_func Key extractor applied to the buffer body
+     *
+     * @return MAC_SUCCESS or MAC_INVALID_PARAMETER
+     *
+     * @ingroup apiResApi
+     */
+    retval_t qmm_queue_index_init(queue_t *q, qmm_index_t *index,
+                                  qmm_index_slot_t *slots, uint16_t num_slots,
+                                  uint8_t capacity, qmm_key_func_t key_func);
+
+    /**
+     * @brief Removes the oldest buffer matching a key from an indexed queue.
+     *
+     * @param q Indexed queue
+     * @param key Key to be searched
+     *
+     * @return Pointer to the buffer header, NULL if no buffer matches
+     *
+     * @ingroup apiResApi
+     */
+    buffer_t *qmm_queue_remove_by_key(queue_t *q, uint32_t key);
+
+    /**
+     * @brief Reads the oldest buffer matching a key from an indexed queue.
+     *
+     * @param q Indexed queue
+     * @param key Key to be searched
+     *
+     * @return Pointer to the buffer header, NULL if no buffer matches
+     *
+     * @ingroup apiResApi
+     */
+    buffer_t *qmm_queue_read_by_key(queue_t *q, uint32_t key);
+#endif  /* #ifdef ENABLE_QMM_INDEX */
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
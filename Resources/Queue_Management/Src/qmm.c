@@ -42,12 +42,31 @@ typedef enum buffer_mode_tag
 
 /* === Macros ============================================================== */
 
+#ifdef ENABLE_QMM_INDEX
+/*
+ * Multiplicative hash constant (golden ratio)
+ */
+#define QMM_INDEX_HASH_MULT         (2654435761UL)
+
+/*
+ * Start slot for a key
+ */
+#define QMM_INDEX_HASH(idx, key) \
+    ((uint16_t)(((uint32_t)(key) * QMM_INDEX_HASH_MULT) >> 16) & ((idx)->num_slots - 1))
+#endif
 
 /* === Prototypes ========================================================== */
 
 static buffer_t *queue_read_or_remove(queue_t *q,
                                       buffer_mode_t mode,
                                       search_t *search);
+#ifdef ENABLE_QMM_INDEX
+static bool index_insert(qmm_index_t *idx, buffer_t *buf);
+static void index_delete(qmm_index_t *idx, buffer_t *buf);
+static void index_rebuild(queue_t *q);
+static qmm_index_slot_t *index_lookup(qmm_index_t *idx, uint32_t key);
+static void queue_unlink(queue_t *q, buffer_t *buf, buffer_t *prev);
+#endif
 
 /* === Implementation ====================================================== */
 
@@ -64,6 +83,9 @@ void qmm_queue_init(queue_t *q)
     q->head = NULL;
     q->tail = NULL;
     q->size = 0;
+#ifdef ENABLE_QMM_INDEX
+    q->index = NULL;
+#endif
 }
 
 
@@ -77,11 +99,37 @@ void qmm_queue_init(queue_t *q)
  * @param buf Pointer to the buffer that should be appended into the queue.
  * Note that this pointer should be same as the
  * pointer returned by bmm_buffer_alloc.
+ *
+ * @return MAC_SUCCESS, or MAC_TRANSACTION_OVERFLOW if an indexed queue
+ *         is full; the buffer is not appended then
  */
-void qmm_queue_append(queue_t *q, buffer_t *buf)
+retval_t qmm_queue_append(queue_t *q, buffer_t *buf)
 {
     ENTER_CRITICAL_REGION();
 
+#ifdef ENABLE_QMM_INDEX
+    if (NULL != q->index)
+    {
+        qmm_index_t *idx = q->index;
+
+        if (idx->used_slots >= (idx->num_slots - (idx->num_slots >> 2)))
+        {
+            /* Too many deleted slots; with at most half of the slots in use
+             * the next rebuild is num_slots / 4 appends away. */
+            index_rebuild(q);
+        }
+
+        if ((q->size >= idx->capacity) || !index_insert(idx, buf))
+        {
+            LEAVE_CRITICAL_REGION();
+            return MAC_TRANSACTION_OVERFLOW;
+        }
+    }
+
+    /* Back link to the current tail */
+    buf->prev = (q->size == 0) ? NULL : q->tail;
+#endif
+
     /* Check whether queue is empty */
     if (q->size == 0)
     {
@@ -111,6 +159,8 @@ void qmm_queue_append(queue_t *q, buffer_t *buf)
 #endif
 
     LEAVE_CRITICAL_REGION();
+
+    return MAC_SUCCESS;
 }/* qmm_queue_append */
 
 
@@ -176,6 +226,17 @@ static buffer_t *queue_read_or_remove(queue_t *q,
             /* Remove buffer from the queue */
             if (REMOVE_MODE == mode)
             {
+#ifdef ENABLE_QMM_INDEX
+                if (NULL != q->index)
+                {
+                    index_delete(q->index, buffer_current);
+                }
+                if (NULL != buffer_current->next)
+                {
+                    buffer_current->next->prev =
+                        (buffer_current == q->head) ? NULL : buffer_previous;
+                }
+#endif
                 /* Update head if buffer removed is first node */
                 if (buffer_current == q->head)
                 {
@@ -286,6 +347,275 @@ void qmm_queue_flush(queue_t *q)
     }
 }
 
+#ifdef ENABLE_QMM_INDEX
+
+/**
+ * @brief Attaches a keyed index to a queue.
+ *
+ * @param q Queue to be indexed
+ * @param index Index control structure
+ * @param slots Slot storage
+ * @param num_slots Number of slots, power of two, at least twice the
+ *                  capacity
+ * @param capacity Maximum number of buffers in the queue, at least the
+ *                 current queue size
+ * @param key_func Key extractor applied to the buffer body
+ *
+ * @return MAC_SUCCESS or MAC_INVALID_PARAMETER
+ */
+retval_t qmm_queue_index_init(queue_t *q, qmm_index_t *index,
+                              qmm_index_slot_t *slots, uint16_t num_slots,
+                              uint8_t capacity, qmm_key_func_t key_func)
+{
+    if ((NULL == index) || (NULL == slots) || (NULL == key_func) ||
+        (num_slots < 2) || ((num_slots & (num_slots - 1)) != 0) ||
+        (capacity == 0) || (capacity < q->size) ||
+        (num_slots < ((uint16_t)capacity * 2)))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    ENTER_CRITICAL_REGION();
+
+    index->key_func = key_func;
+    index->slots = slots;
+    index->num_slots = num_slots;
+    index->capacity = capacity;
+    index->lookups = 0;
+    index->probes = 0;
+    q->index = index;
+
+    /* Index the buffers already queued and restore their back links */
+    buffer_t *prev = NULL;
+    for (buffer_t *buf = q->head; NULL != buf; buf = buf->next)
+    {
+        buf->prev = prev;
+        prev = buf;
+    }
+    index_rebuild(q);
+
+    LEAVE_CRITICAL_REGION();
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Removes the oldest buffer matching a key from an indexed queue.
+ *
+ * @param q Indexed queue
+ * @param key Key to be searched
+ *
+ * @return Pointer to the buffer header, NULL if no buffer matches
+ */
+buffer_t *qmm_queue_remove_by_key(queue_t *q, uint32_t key)
+{
+    buffer_t *buf = NULL;
+
+    ENTER_CRITICAL_REGION();
+
+    if (NULL != q->index)
+    {
+        qmm_index_slot_t *slot = index_lookup(q->index, key);
+
+        if (NULL != slot)
+        {
+            buf = slot->buf;
+            slot->buf = QMM_INDEX_TOMBSTONE;
+            queue_unlink(q, buf, buf->prev);
+        }
+    }
+
+    LEAVE_CRITICAL_REGION();
+
+    return buf;
+}
+
+
+/**
+ * @brief Reads the oldest buffer matching a key from an indexed queue.
+ *
+ * @param q Indexed queue
+ * @param key Key to be searched
+ *
+ * @return Pointer to the buffer header, NULL if no buffer matches
+ */
+buffer_t *qmm_queue_read_by_key(queue_t *q, uint32_t key)
+{
+    buffer_t *buf = NULL;
+
+    ENTER_CRITICAL_REGION();
+
+    if (NULL != q->index)
+    {
+        qmm_index_slot_t *slot = index_lookup(q->index, key);
+
+        if (NULL != slot)
+        {
+            buf = slot->buf;
+        }
+    }
+
+    LEAVE_CRITICAL_REGION();
+
+    return buf;
+}
+
+
+/*
+ * @brief Unlinks a buffer from a doubly linked indexed queue
+ *
+ * @param q Queue containing the buffer
+ * @param buf Buffer to be unlinked
+ * @param prev Predecessor of the buffer, NULL if buffer is the head
+ */
+static void queue_unlink(queue_t *q, buffer_t *buf, buffer_t *prev)
+{
+    if (NULL == prev)
+    {
+        q->head = buf->next;
+    }
+    else
+    {
+        prev->next = buf->next;
+    }
+
+    if (NULL == buf->next)
+    {
+        q->tail = prev;
+    }
+    else
+    {
+        buf->next->prev = prev;
+    }
+
+    q->size--;
+}
+
+
+/*
+ * @brief Finds the oldest occupied slot matching a key
+ *
+ * @param idx Index to be searched
+ * @param key Key to be searched
+ *
+ * @return Pointer to the matching slot, NULL if not found
+ */
+static qmm_index_slot_t *index_lookup(qmm_index_t *idx, uint32_t key)
+{
+    uint16_t mask = idx->num_slots - 1;
+    uint16_t pos = QMM_INDEX_HASH(idx, key);
+
+    idx->lookups++;
+
+    for (uint16_t i = 0; i < idx->num_slots; i++)
+    {
+        qmm_index_slot_t *slot = &idx->slots[(pos + i) & mask];
+
+        idx->probes++;
+
+        if (NULL == slot->buf)
+        {
+            /* End of the probe sequence */
+            break;
+        }
+        if ((QMM_INDEX_TOMBSTONE != slot->buf) && (slot->key == key))
+        {
+            return slot;
+        }
+    }
+
+    return NULL;
+}
+
+
+/*
+ * @brief Inserts a buffer into the index
+ *
+ * Deleted slots are not reused to keep the probe order equal to the
+ * insertion order. The index is rebuilt once 3/4 of all slots are in use.
+ *
+ * @param idx Index
+ * @param buf Buffer to be inserted
+ *
+ * @return true if inserted, false if no slot is free
+ */
+static bool index_insert(qmm_index_t *idx, buffer_t *buf)
+{
+    uint16_t mask = idx->num_slots - 1;
+    uint32_t key = idx->key_func((void *)buf->body);
+    uint16_t pos = QMM_INDEX_HASH(idx, key);
+
+    for (uint16_t i = 0; i < idx->num_slots; i++)
+    {
+        if (NULL == idx->slots[pos].buf)
+        {
+            idx->slots[pos].key = key;
+            idx->slots[pos].buf = buf;
+            idx->used_slots++;
+            return true;
+        }
+        pos = (pos + 1) & mask;
+    }
+
+    return false;
+}
+
+
+/*
+ * @brief Deletes a buffer from the index
+ *
+ * @param idx Index
+ * @param buf Buffer to be deleted
+ */
+static void index_delete(qmm_index_t *idx, buffer_t *buf)
+{
+    uint16_t mask = idx->num_slots - 1;
+    uint16_t pos = QMM_INDEX_HASH(idx, idx->key_func((void *)buf->body));
+
+    for (uint16_t i = 0; i < idx->num_slots; i++)
+    {
+        qmm_index_slot_t *slot = &idx->slots[(pos + i) & mask];
+
+        if (NULL == slot->buf)
+        {
+            break;
+        }
+        if (buf == slot->buf)
+        {
+            slot->buf = QMM_INDEX_TOMBSTONE;
+            break;
+        }
+    }
+}
+
+
+/*
+ * @brief Rebuilds the index from the queue in FIFO order
+ *
+ * The queue holds at most half as many buffers as there are slots, so
+ * every buffer finds a slot.
+ *
+ * @param q Indexed queue
+ */
+static void index_rebuild(queue_t *q)
+{
+    qmm_index_t *idx = q->index;
+
+    for (uint16_t i = 0; i < idx->num_slots; i++)
+    {
+        idx->slots[i].buf = NULL;
+    }
+    idx->used_slots = 0;
+
+    for (buffer_t *buf = q->head; NULL != buf; buf = buf->next)
+    {
+        index_insert(idx, buf);
+    }
+}
+
+#endif  /* #ifdef ENABLE_QMM_INDEX */
+
 #endif  /* (TOTAL_NUMBER_OF_BUFS > 0) */
 
 /* EOF */
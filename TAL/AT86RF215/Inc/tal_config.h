@@ -245,6 +245,478 @@
 
 #endif /* TAL_SUPPORT_ALL_FEATURES */
 
+/**
+ * Maximum number of additional receive consumers per transceiver.
+ * Each registered consumer gets a reference to the same received buffer
+ * in addition to tal_rx_frame_cb(), see tal_rx_consumer_register().
+ */
+#ifndef TAL_MAX_RX_CONSUMERS
+#define TAL_MAX_RX_CONSUMERS        (3)
+#endif
+
+/**
+ * Number of frames per transceiver that can be queued by tal_tx_enqueue()
+ * while a transmission is ongoing.
+ */
+#ifndef TAL_TX_QUEUE_LEN
+#define TAL_TX_QUEUE_LEN            (4)
+#endif
+
+/**
+ * Download the TX frame buffer while the CSMA backoff timer is running,
+ * so that CCA and transmission require a single command only.
+ * Set to 0 to download during CCA / preamble transmission instead.
+ */
+#ifndef TAL_PRELOAD_DURING_BACKOFF
+#define TAL_PRELOAD_DURING_BACKOFF  (1)
+#endif
+
+/**
+ * Number of bytes per SPI access when the TX frame buffer is streamed
+ * after the transmit command.
+ */
+#ifndef TAL_TX_STREAM_CHUNK
+#define TAL_TX_STREAM_CHUNK         (64)
+#endif
+
+/**
+ * Number of frame buffer accesses per length used to calibrate the
+ * SPI throughput model during tal_init().
+ */
+#ifndef TAL_SPI_CALIBRATION_ROUNDS
+#define TAL_SPI_CALIBRATION_ROUNDS  (8)
+#endif
+
+#ifdef SUPPORT_AGGREGATION
+/**
+ * Maximum time in us a frame waits for further frames to be aggregated with.
+ */
+#ifndef TAL_AGGR_DELAY_BUDGET_US
+#define TAL_AGGR_DELAY_BUDGET_US    (10000)
+#endif
+
+/**
+ * Maximum number of frames within one aggregate.
+ */
+#ifndef TAL_AGGR_MAX_SUBFRAMES
+#define TAL_AGGR_MAX_SUBFRAMES      (16)
+#endif
+
+/**
+ * Number of aggregates per trx that can be collected or transmitted at a time.
+ */
+#ifndef TAL_AGGR_NUM_BUFFERS
+#define TAL_AGGR_NUM_BUFFERS        (2)
+#endif
+#endif  /* #ifdef SUPPORT_AGGREGATION */
+
+#ifdef SUPPORT_BULK_TRANSFER
+/**
+ * Maximum number of frames sent before a block ACK is requested;
+ * limited by the 64 bit block ACK bitmap.
+ */
+#ifndef TAL_BULK_MAX_WINDOW
+#define TAL_BULK_MAX_WINDOW         (32)
+#endif
+
+/** Window size of the first bulk transfer */
+#ifndef TAL_BULK_INIT_WINDOW
+#define TAL_BULK_INIT_WINDOW        (4)
+#endif
+
+/** The window is halved if more than 1/TAL_BULK_LOSS_THRES_DIV frames are lost. */
+#ifndef TAL_BULK_LOSS_THRES_DIV
+#define TAL_BULK_LOSS_THRES_DIV     (8)
+#endif
+
+/** Time in us to wait for a block ACK */
+#ifndef TAL_BULK_BA_TIMEOUT_US
+#define TAL_BULK_BA_TIMEOUT_US      (20000)
+#endif
+
+/** Number of block ACK requests before the window is considered lost */
+#ifndef TAL_BULK_MAX_BAR_TRIES
+#define TAL_BULK_MAX_BAR_TRIES      (3)
+#endif
+
+/** Time in us until a window is retried if TAL was busy */
+#ifndef TAL_BULK_RETRY_DELAY_US
+#define TAL_BULK_RETRY_DELAY_US     (1000)
+#endif
+
+/** Number of senders whose sequence numbers are tracked */
+#ifndef TAL_BULK_MAX_PEERS
+#define TAL_BULK_MAX_PEERS          (4)
+#endif
+
+/** MAC command identifiers of block ACK request and block ACK */
+#ifndef TAL_BULK_CMD_BAR
+#define TAL_BULK_CMD_BAR            (0xF0)
+#endif
+#ifndef TAL_BULK_CMD_BA
+#define TAL_BULK_CMD_BA             (0xF1)
+#endif
+
+/** Maximum length of BAR and BA frames: MHR, command, start, span, bitmap */
+#define TAL_BULK_CTRL_MAX_LEN       (23 + 3 + 8)
+
+#if (TAL_BULK_MAX_WINDOW > 64) || (TAL_BULK_INIT_WINDOW > TAL_BULK_MAX_WINDOW)
+#   error "Invalid bulk transfer window"
+#endif
+#endif  /* #ifdef SUPPORT_BULK_TRANSFER */
+
+#ifdef SUPPORT_CH_HOPPING
+/**
+ * Maximum number of channels of a hopping channel plan; e.g. 129 channels
+ * of 200 kHz within 902 - 928 MHz.
+ */
+#ifndef TAL_CH_HOP_MAX_CHANNELS
+#define TAL_CH_HOP_MAX_CHANNELS     (129)
+#endif
+
+/** Number of own hop slots computed per sequence table refill; power of 2 */
+#ifndef TAL_CH_HOP_SEQ_LEN
+#define TAL_CH_HOP_SEQ_LEN          (64)
+#endif
+
+/** Time in us until a hop deferred by a reception or an ACK is retried */
+#ifndef TAL_CH_HOP_RETRY_US
+#define TAL_CH_HOP_RETRY_US         (1000)
+#endif
+
+#if (TAL_CH_HOP_SEQ_LEN > 32768) || ((TAL_CH_HOP_SEQ_LEN & (TAL_CH_HOP_SEQ_LEN - 1)) != 0)
+#   error "Invalid hop sequence table length"
+#endif
+#endif  /* #ifdef SUPPORT_CH_HOPPING */
+
+#ifdef SUPPORT_HW_TSTAMP
+/** Frame time stamps are taken from the baseband counter */
+#   ifndef ENABLE_TSTAMP
+#       define ENABLE_TSTAMP
+#   endif
+
+#ifdef MEASURE_TIME_OF_FLIGHT
+#   error "The time of flight measurement resets the baseband counter"
+#endif
+
+/** Interval in ms of the counter correlation samples */
+#ifndef TAL_HW_TSTAMP_INTERVAL_MS
+#define TAL_HW_TSTAMP_INTERVAL_MS   (1000)
+#endif
+
+/** Number of counter readings per sample; the shortest one is used */
+#ifndef TAL_HW_TSTAMP_TRIES
+#define TAL_HW_TSTAMP_TRIES         (4)
+#endif
+
+/** Phase error in ns beyond which the correlation is restarted */
+#ifndef TAL_HW_TSTAMP_MAX_ERR_NS
+#define TAL_HW_TSTAMP_MAX_ERR_NS    (200000)
+#endif
+
+/** Limit of the estimated drift in ppb */
+#ifndef TAL_HW_TSTAMP_MAX_DRIFT_PPB
+#define TAL_HW_TSTAMP_MAX_DRIFT_PPB (200000)
+#endif
+
+#if (TAL_HW_TSTAMP_INTERVAL_MS > 60000)
+#   error "The counter wraps every 134 s"
+#endif
+#endif  /* #ifdef SUPPORT_HW_TSTAMP */
+
+#ifdef SUPPORT_TSCH
+/** The slot synchronization uses the frame start time stamps */
+#   ifndef ENABLE_TSTAMP
+#       define ENABLE_TSTAMP
+#   endif
+
+/** Number of slotframes per trx; the slotframe handle is the index */
+#ifndef TAL_TSCH_MAX_SLOTFRAMES
+#define TAL_TSCH_MAX_SLOTFRAMES     (2)
+#endif
+
+/** Number of cells per slotframe */
+#ifndef TAL_TSCH_MAX_CELLS
+#define TAL_TSCH_MAX_CELLS          (16)
+#endif
+
+/** Maximum length of the hopping sequence */
+#ifndef TAL_TSCH_MAX_HOP_SEQ_LEN
+#define TAL_TSCH_MAX_HOP_SEQ_LEN    (64)
+#endif
+
+/** Number of frames waiting for a TX cell */
+#ifndef TAL_TSCH_TX_QUEUE_LEN
+#define TAL_TSCH_TX_QUEUE_LEN       (8)
+#endif
+
+/**
+ * Time in us ahead of the slot start the trx is tuned and the frame
+ * buffer is filled
+ */
+#ifndef TAL_TSCH_PREPARE_US
+#define TAL_TSCH_PREPARE_US         (1000)
+#endif
+
+/**
+ * Time in us the slot action timer expires early; the remainder is
+ * spent polling the clock to be independent of the timer latency
+ */
+#ifndef TAL_TSCH_SPIN_US
+#define TAL_TSCH_SPIN_US            (150)
+#endif
+
+/** Lateness in us of a slot action counted as late slot */
+#ifndef TAL_TSCH_LATE_US
+#define TAL_TSCH_LATE_US            (100)
+#endif
+
+/** Default timeslot template (IEEE 802.15.4-2015, Table 8-98) in us */
+#define TAL_TSCH_TIMESLOT_US        (10000)
+#define TAL_TSCH_TX_OFFSET_US       (2120)
+#define TAL_TSCH_RX_OFFSET_US       (1020)
+#define TAL_TSCH_RX_WAIT_US         (2200)
+
+#if (TAL_TSCH_MAX_CELLS > 255) || (TAL_TSCH_MAX_HOP_SEQ_LEN > 255)
+#   error "Invalid TSCH schedule size"
+#endif
+#endif  /* #ifdef SUPPORT_TSCH */
+
+#ifdef SUPPORT_ADAPTIVE_CCA
+/** Number of energy samples the noise floor is estimated from */
+#ifndef TAL_CCA_CTRL_WINDOW
+#define TAL_CCA_CTRL_WINDOW         (32)
+#endif
+
+/** Weight of a new window in the noise floor average: 2^-shift */
+#ifndef TAL_CCA_CTRL_EWMA_SHIFT
+#define TAL_CCA_CTRL_EWMA_SHIFT     (2)
+#endif
+
+/** Number of threshold changes kept in the history */
+#ifndef TAL_CCA_CTRL_HISTORY
+#define TAL_CCA_CTRL_HISTORY        (16)
+#endif
+
+#if (TAL_CCA_CTRL_WINDOW < 4) || (TAL_CCA_CTRL_WINDOW > 255) || (TAL_CCA_CTRL_HISTORY > 255)
+#   error "Invalid adaptive CCA window or history size"
+#endif
+#endif  /* #ifdef SUPPORT_ADAPTIVE_CCA */
+
+#ifdef SUPPORT_ENTROPY_POOL
+/** Number of RNDV reads per burst */
+#ifndef TAL_ENTROPY_BURST
+#define TAL_ENTROPY_BURST           (32)
+#endif
+
+/** Entropy in bits credited per RNDV read */
+#ifndef TAL_ENTROPY_BITS_PER_READ
+#define TAL_ENTROPY_BITS_PER_READ   (2)
+#endif
+
+/** Time in ms between bursts while the pool fills, and once it is full */
+#ifndef TAL_ENTROPY_INTERVAL_MS
+#define TAL_ENTROPY_INTERVAL_MS     (20)
+#endif
+#ifndef TAL_ENTROPY_FULL_INTERVAL_MS
+#define TAL_ENTROPY_FULL_INTERVAL_MS (1000)
+#endif
+#endif  /* #ifdef SUPPORT_ENTROPY_POOL */
+
+/*
+ * The adaptive CSMA-CA parameters are not built by default. They trade
+ * access delay for delivery: under heavy contention far fewer frames are
+ * dropped, but a delivered frame waits several times longer, see
+ * tal_csma_adapt.c. Even if built, they stay off until
+ * tal_csma_adapt_enable() is called.
+ */
+#ifdef SUPPORT_ADAPTIVE_CSMA
+/** Number of channels with adapted CSMA-CA parameters */
+#ifndef TAL_CSMA_ADAPT_CHANNELS
+#define TAL_CSMA_ADAPT_CHANNELS     (8)
+#endif
+
+/** Number of CSMA-CA attempts per adaptation step */
+#ifndef TAL_CSMA_ADAPT_PERIOD
+#define TAL_CSMA_ADAPT_PERIOD       (16)
+#endif
+
+/** Collision rates in 1/1000 above which MinBE increases, below which it decreases */
+#ifndef TAL_CSMA_ADAPT_COLL_HIGH
+#define TAL_CSMA_ADAPT_COLL_HIGH    (150)
+#endif
+#ifndef TAL_CSMA_ADAPT_COLL_LOW
+#define TAL_CSMA_ADAPT_COLL_LOW     (40)
+#endif
+
+/** Channel access failure rate in 1/1000 above which more backoffs are allowed */
+#ifndef TAL_CSMA_ADAPT_FAIL_HIGH
+#define TAL_CSMA_ADAPT_FAIL_HIGH    (30)
+#endif
+
+/** Busy CCA rate in 1/1000 below which MaxBE and MaxCSMABackoffs return */
+#ifndef TAL_CSMA_ADAPT_BUSY_LOW
+#define TAL_CSMA_ADAPT_BUSY_LOW     (200)
+#endif
+
+/** Lowest MinBE the adaptation uses */
+#ifndef TAL_CSMA_ADAPT_MIN_BE_LOW
+#define TAL_CSMA_ADAPT_MIN_BE_LOW   (1)
+#endif
+
+/** Highest MaxBE the adaptation uses; lower values bound the access delay */
+#ifndef TAL_CSMA_ADAPT_MAX_BE
+#define TAL_CSMA_ADAPT_MAX_BE       (8)
+#endif
+
+#if (TAL_CSMA_ADAPT_CHANNELS > 255)
+#   error "Invalid adaptive CSMA table size"
+#endif
+#if (TAL_CSMA_ADAPT_MAX_BE < 3) || (TAL_CSMA_ADAPT_MAX_BE > 8)
+#   error "Invalid adaptive CSMA MaxBE limit"
+#endif
+#endif  /* #ifdef SUPPORT_ADAPTIVE_CSMA */
+
+#ifdef SUPPORT_SPECTRUM_MONITOR
+/** The background monitor uses the energy measurement of the sweep */
+#   ifndef SUPPORT_SPECTRUM_SCAN
+#       define SUPPORT_SPECTRUM_SCAN
+#   endif
+
+/** Number of channels of the occupancy table */
+#ifndef TAL_SCAN_MON_MAX_CHANNELS
+#define TAL_SCAN_MON_MAX_CHANNELS   (64)
+#endif
+
+/** Weight of a new measurement in the averages: 2^-shift */
+#ifndef TAL_SCAN_MON_EWMA_SHIFT
+#define TAL_SCAN_MON_EWMA_SHIFT     (3)
+#endif
+
+/** Time in ms until a measurement is retried if the TAL was busy */
+#ifndef TAL_SCAN_MON_RETRY_MS
+#define TAL_SCAN_MON_RETRY_MS       (10)
+#endif
+#endif  /* #ifdef SUPPORT_SPECTRUM_MONITOR */
+
+#ifdef SUPPORT_SPECTRUM_SCAN
+/** Time in us in addition to the AGC settling before a channel is sampled */
+#ifndef TAL_SCAN_SETTLE_US
+#define TAL_SCAN_SETTLE_US          (50)
+#endif
+
+/** Energy histogram of a channel: number of bins, start and width in dB */
+#ifndef TAL_SCAN_HIST_BINS
+#define TAL_SCAN_HIST_BINS          (16)
+#endif
+#ifndef TAL_SCAN_HIST_MIN_DBM
+#define TAL_SCAN_HIST_MIN_DBM       (-104)
+#endif
+#ifndef TAL_SCAN_HIST_STEP_DB
+#define TAL_SCAN_HIST_STEP_DB       (4)
+#endif
+#endif  /* #ifdef SUPPORT_SPECTRUM_SCAN */
+
+/** Size in octets of a precomputed register image, see tal_reg_image.c */
+#ifndef TAL_REG_IMAGE_SIZE
+#define TAL_REG_IMAGE_SIZE          (128)
+#endif
+
+/**
+ * Number of PHY profiles whose register images are kept per trx,
+ * see tal_phy_profile_apply()
+ */
+#ifndef TAL_PHY_PROFILE_CACHE_SIZE
+#define TAL_PHY_PROFILE_CACHE_SIZE  (4)
+#endif
+
+/**
+ * Time in us after which a channel switch without TRXRDY IRQ is checked,
+ * see tal_channel_switch()
+ */
+#ifndef TAL_CH_SWITCH_TIMEOUT_US
+#define TAL_CH_SWITCH_TIMEOUT_US    (1000)
+#endif
+
+/** Number of recent channel switches used for the latency percentiles */
+#ifndef TAL_CH_SWITCH_LAT_SAMPLES
+#define TAL_CH_SWITCH_LAT_SAMPLES   (32)
+#endif
+
+#ifdef SUPPORT_MODE_SWITCH
+/**
+ * Decide per frame whether a mode switch saves airtime,
+ * see tal_ms_policy_set(). Set to 0 to switch for every frame.
+ */
+#ifndef TAL_MS_POLICY_DEFAULT_ENABLE
+#define TAL_MS_POLICY_DEFAULT_ENABLE    (1)
+#endif
+
+/** Airtime in us a mode switch has to save at least */
+#ifndef TAL_MS_POLICY_MIN_SAVING_US
+#define TAL_MS_POLICY_MIN_SAVING_US     (200)
+#endif
+
+/**
+ * Number of mode switch target modes whose register images are kept
+ * per trx; the images are compiled when a target mode is used first.
+ */
+#ifndef TAL_MS_IMAGE_CACHE_SIZE
+#define TAL_MS_IMAGE_CACHE_SIZE         (4)
+#endif
+#endif  /* #ifdef SUPPORT_MODE_SWITCH */
+
+#ifdef SUPPORT_RATE_CONTROL
+/** Number of neighbors whose rate statistics are kept per trx */
+#ifndef TAL_RC_MAX_NEIGHBORS
+#define TAL_RC_MAX_NEIGHBORS        (8)
+#endif
+
+/** Maximum number of rates of a mode switch target mode */
+#define TAL_RC_MAX_RATES            (8)
+
+/** Interval in us after which the success probabilities are updated */
+#ifndef TAL_RC_UPDATE_INTERVAL_US
+#define TAL_RC_UPDATE_INTERVAL_US   (100000)
+#endif
+
+/** Weight in percent of the last interval within the probability EWMA */
+#ifndef TAL_RC_EWMA_WEIGHT
+#define TAL_RC_EWMA_WEIGHT          (25)
+#endif
+
+/** Every n-th frame to a neighbor samples another rate */
+#ifndef TAL_RC_SAMPLE_INTERVAL
+#define TAL_RC_SAMPLE_INTERVAL      (10)
+#endif
+
+/** Use FSK operating modes with and without FEC as separate rates */
+#ifndef TAL_RC_FSK_FEC
+#define TAL_RC_FSK_FEC              (1)
+#endif
+
+/** Fastest O-QPSK rate mode; OQPSK_RATE_MOD_4 is proprietary */
+#ifndef TAL_RC_OQPSK_MAX_RATE_MODE
+#define TAL_RC_OQPSK_MAX_RATE_MODE  (OQPSK_RATE_MOD_3)
+#endif
+
+/**
+ * Energy based start rate of a new neighbor: the slowest rate below
+ * TAL_RC_ED_SEED_DBM, one rate faster per TAL_RC_ED_STEP_DB.
+ */
+#ifndef TAL_RC_ED_SEED_DBM
+#define TAL_RC_ED_SEED_DBM          (-90)
+#endif
+#ifndef TAL_RC_ED_STEP_DB
+#define TAL_RC_ED_STEP_DB           (6)
+#endif
+
+/** Energy drop in dB that invalidates the statistics of fast rates */
+#ifndef TAL_RC_ED_DROP_DB
+#define TAL_RC_ED_DROP_DB           (10)
+#endif
+#endif  /* #ifdef SUPPORT_RATE_CONTROL */
+
 /**
  * Check for unsupported build combinations.
  */
@@ -265,6 +737,22 @@
 #   error "FSK support missing"
 #endif
 
+#if (defined SUPPORT_RATE_CONTROL) && (!defined SUPPORT_MODE_SWITCH)
+#   error "Mode switch support missing"
+#endif
+
+#if (defined SUPPORT_MODE_SWITCH) && (TAL_MS_IMAGE_CACHE_SIZE < 1)
+#   error "Invalid mode switch image cache size"
+#endif
+
+#if (TAL_PHY_PROFILE_CACHE_SIZE < 1)
+#   error "Invalid PHY profile cache size"
+#endif
+
+#if (TAL_CH_SWITCH_LAT_SAMPLES < 1) || (TAL_CH_SWITCH_LAT_SAMPLES > 255)
+#   error "Invalid number of channel switch latency samples"
+#endif
+
 /* === TYPES =============================================================== */
 
 /*
@@ -282,10 +770,64 @@ typedef enum tal_timer_id_tag
                           ,
     TAL_T_AGC           = (TAL_FIRST_TIMER_ID + 2)
 #endif
+#ifdef SUPPORT_AGGREGATION
+                          ,
+    TAL_T_AGGR          = (TAL_FIRST_TIMER_ID + 3)
+#endif
+#ifdef SUPPORT_BULK_TRANSFER
+                          ,
+    TAL_T_BULK          = (TAL_FIRST_TIMER_ID + 4)
+#endif
+                          ,
+    TAL_T_CH_SWITCH     = (TAL_FIRST_TIMER_ID + 5)
+#ifdef SUPPORT_CH_HOPPING
+                          ,
+    TAL_T_CH_HOP        = (TAL_FIRST_TIMER_ID + 6)
+#endif
+#ifdef SUPPORT_TSCH
+                          ,
+    TAL_T_TSCH          = (TAL_FIRST_TIMER_ID + 7)
+#endif
+#ifdef SUPPORT_HW_TSTAMP
+                          ,
+    TAL_T_TSTAMP        = (TAL_FIRST_TIMER_ID + 8)
+#endif
+#ifdef SUPPORT_SPECTRUM_SCAN
+                          ,
+    TAL_T_SCAN          = (TAL_FIRST_TIMER_ID + 9)
+#endif
+#ifdef SUPPORT_SPECTRUM_MONITOR
+                          ,
+    TAL_T_SCAN_MON      = (TAL_FIRST_TIMER_ID + 10)
+#endif
+#ifdef SUPPORT_ADAPTIVE_CCA
+                          ,
+    TAL_T_CCA_CTRL      = (TAL_FIRST_TIMER_ID + 11)
+#endif
+#ifdef SUPPORT_ENTROPY_POOL
+                          ,
+    TAL_T_ENTROPY       = (TAL_FIRST_TIMER_ID + 12)
+#endif
 } tal_timer_id_t;
 
 /* Please adjust this define in case the enum is changed. */
-#define TAL_LAST_TIMER_ID           (TAL_T_CALIBRATION)
+#if (defined SUPPORT_ENTROPY_POOL)
+#define TAL_LAST_TIMER_ID           (TAL_T_ENTROPY)
+#elif (defined SUPPORT_ADAPTIVE_CCA)
+#define TAL_LAST_TIMER_ID           (TAL_T_CCA_CTRL)
+#elif (defined SUPPORT_SPECTRUM_MONITOR)
+#define TAL_LAST_TIMER_ID           (TAL_T_SCAN_MON)
+#elif (defined SUPPORT_SPECTRUM_SCAN)
+#define TAL_LAST_TIMER_ID           (TAL_T_SCAN)
+#elif (defined SUPPORT_HW_TSTAMP)
+#define TAL_LAST_TIMER_ID           (TAL_T_TSTAMP)
+#elif (defined SUPPORT_TSCH)
+#define TAL_LAST_TIMER_ID           (TAL_T_TSCH)
+#elif (defined SUPPORT_CH_HOPPING)
+#define TAL_LAST_TIMER_ID           (TAL_T_CH_HOP)
+#else
+#define TAL_LAST_TIMER_ID           (TAL_T_CH_SWITCH)
+#endif
 
 /* === PROTOTYPES ========================================================== */
 
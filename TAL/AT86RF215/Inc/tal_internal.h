@@ -40,7 +40,8 @@ typedef enum tal_state_tag
     TAL_RESET,
     TAL_WAKING_UP,
     TAL_TX,
-    TAL_ED_SCAN
+    TAL_ED_SCAN,
+    TAL_CH_SWITCH
 #if (defined SUPPORT_TFA) || (defined TFA_CCA) || (defined TFA_CW)
     ,
     TAL_TFA_CW_RX,
@@ -52,6 +53,10 @@ typedef enum tal_state_tag
     TAL_NEW_MODE_RECEIVING,
     TAL_ACK_TRANSMITTING
 #endif
+#ifdef SUPPORT_SPECTRUM_SCAN
+    ,
+    TAL_SPECTRUM_SCAN
+#endif
 } SHORTENUM tal_state_t;
 
 /**
@@ -86,6 +91,68 @@ typedef enum cca_use_tag
     WITH_CCA
 } SHORTENUM cca_use_t;
 
+/**
+ * Field positions within an MHR, see parse_mhr(); a position of 0 marks
+ * an absent field.
+ */
+typedef struct mhr_info_tag
+{
+    uint8_t len;
+    uint8_t dst_pan_pos;
+    uint8_t dst_addr_pos;
+    uint8_t dst_addr_len;
+    uint8_t src_pan_pos;
+    uint8_t src_addr_pos;
+    uint8_t src_addr_len;
+} mhr_info_t;
+
+/**
+ * Register image, see tal_reg_image.c; data holds runs of consecutive
+ * registers, each as start address (2 octets), number of registers and
+ * register values.
+ */
+typedef struct reg_image_tag
+{
+    uint16_t len;
+    /** Number of runs, i.e. burst writes */
+    uint8_t writes;
+    uint8_t data[TAL_REG_IMAGE_SIZE];
+} reg_image_t;
+
+/**
+ * PIB values set as side effect of a PHY configuration; stored along with
+ * a register image since applying the image does not set them.
+ */
+typedef struct reg_image_fx_tag
+{
+    uint16_t agc_settle_dur;
+#ifdef SUPPORT_FSK
+    uint16_t FSKPreambleLengthMin;
+#endif
+#if (defined SUPPORT_FSK) || (defined SUPPORT_OQPSK)
+    bool RPCEnabled;
+#endif
+    int8_t TransmitPower;
+} reg_image_fx_t;
+
+/**
+ * PHY timing values for one modulation / rate combination, see the timing
+ * tables in tal_4g_utils.c
+ */
+typedef struct phy_timing_tag
+{
+    uint16_t symbol_duration_us;
+    uint16_t octet_duration_us;
+    /** aCCATime in symbols; not used for JAPAN_920 */
+    uint16_t cca_duration_sym;
+    /** AckWaitDuration in symbols excl. CCA duration and FSK SHR */
+    uint16_t ack_wait_sym;
+    uint16_t ack_timing_us;
+    int8_t cca_thres;
+    /** PSDU data rate in kbit/s */
+    uint16_t data_rate_kbps;
+} phy_timing_t;
+
 /* === EXTERNALS =========================================================== */
 
 /* Global TAL variables */
@@ -109,6 +176,8 @@ extern uint32_t fs_tstamp[NUM_TRX];
 extern frame_info_t *rx_frm_info[NUM_TRX];
 #ifdef SUPPORT_MODE_SWITCH
 extern bool csm_active[NUM_TRX];
+extern bool ms_tx[NUM_TRX];
+extern new_phy_t ms_tx_mode[NUM_TRX];
 #endif
 extern volatile bb_irq_t tal_bb_irqs[NUM_TRX];
 extern volatile rf_irq_t tal_rf_irqs[NUM_TRX];
@@ -159,6 +228,13 @@ extern volatile rf_irq_t tal_rf_irqs[NUM_TRX];
 
 #define INVALID_TOF_VALUE                       (0xFFFFFFFF)
 
+/** Random number of the TAL, e.g. for backoffs */
+#ifdef SUPPORT_ENTROPY_POOL
+#define TAL_RAND(trx_id)                        prng_next(trx_id)
+#else
+#define TAL_RAND(trx_id)                        ((uint32_t)rand())
+#endif
+
 /* === PROTOTYPES ========================================================== */
 
 
@@ -170,6 +246,7 @@ void switch_to_txprep(trx_id_t trx_id);
 void wait_for_txprep(trx_id_t trx_id);
 void stop_tal_timer(trx_id_t trx_id);
 void cancel_any_reception(trx_id_t trx_id);
+bool parse_mhr(uint8_t *mpdu, uint16_t len, mhr_info_t *mhr);
 #if (defined SUPPORT_FSK) || (defined SUPPORT_OQPSK)
 void stop_rpc(trx_id_t trx_id);
 void start_rpc(trx_id_t trx_id);
@@ -198,6 +275,7 @@ void calculate_pib_values(trx_id_t trx_id);
 retval_t config_phy(trx_id_t trx_id);
 void init_tal_pib(trx_id_t trx_id);
 void write_all_tal_pib_to_trx(trx_id_t trx_id);
+retval_t write_phy_pib_to_trx(trx_id_t trx_id);
 #if (defined SUPPORT_FSK) && ((defined SUPPORT_FSK_RAW_MODE) || (defined SUPPORT_MODE_SWITCH))
 void configure_raw_mode(trx_id_t trx_id, bool enable);
 #endif
@@ -213,25 +291,37 @@ void stop_ed_scan(trx_id_t trx_id);
 /*
  * Prototypes from tal_4g_utils.c
  */
-uint16_t get_cca_duration_us(trx_id_t trx_id);
 int8_t get_cca_thres(trx_id_t trx_id);
 uint16_t ceiling_sym(trx_id_t trx_id, uint16_t duration_us);
-uint16_t get_AckWaitDuration_us(trx_id_t trx_id);
-uint16_t get_AckTiming_us(trx_id_t trx_id);
 void get_ch_freq0_spacing(trx_id_t trx_id, uint32_t *freq, uint32_t *spacing);
 uint8_t phr_duration_sym(trx_id_t trx_id);
 uint16_t calculate_cca_duration_us(trx_id_t trx_id);
-float get_data_rate(trx_id_t trx_id);
+retval_t get_phy_timing(trx_id_t trx_id, phy_timing_t *timing);
+#ifdef SUPPORT_MODE_SWITCH
+uint16_t get_mode_data_rate(new_phy_t *mode);
+uint32_t get_ppdu_duration_us(trx_id_t trx_id, uint16_t psdu_len);
+#endif
 uint8_t shr_duration_sym(trx_id_t trx_id);
 #ifdef MEASURE_ON_AIR_DURATION
 uint16_t get_ack_duration_sym(trx_id_t trx_id);
 #endif
 retval_t get_supported_channels_tuple(trx_id_t trx_id, uint32_t *value);
 
+/*
+ * Prototypes from tal_ch_switch.c
+ */
+retval_t tune_channel(trx_id_t trx_id, uint16_t ch);
+void get_channel_regs(trx_id_t trx_id, uint16_t ch, uint8_t *regs);
+void handle_ch_switch_irq(trx_id_t trx_id);
+void stop_ch_switch(trx_id_t trx_id);
+
 /*
  * Prototypes from tal_phy_cfg.c
  */
 retval_t conf_trx_modulation(trx_id_t trx_id);
+rf_cmd_state_t enter_phy_change(trx_id_t trx_id);
+void leave_phy_change(trx_id_t trx_id, rf_cmd_state_t previous_trx_state);
+retval_t conf_modulation(trx_id_t trx_id);
 #ifdef SUPPORT_FSK
 void set_sfd(trx_id_t trx_id);
 void set_fsk_pibs(trx_id_t trx_id);
@@ -266,8 +356,45 @@ void set_csm(trx_id_t trx_id);
 void tx_ms_ppdu(trx_id_t trx_id);
 void handle_rx_ms_packet(trx_id_t trx_id);
 void save_current_phy(trx_id_t trx_id);
+retval_t convert_fsk_op_mode_to_data_rate(fsk_op_mode_t op_mode, sun_freq_band_t band,
+                                          fsk_sym_rate_t *rate, fsk_mod_type_t *type);
+bool use_mode_switch(trx_id_t trx_id, frame_info_t *frame);
+void prepare_ms_image(trx_id_t trx_id);
+void flush_ms_images(trx_id_t trx_id);
 #endif /* #ifdef SUPPORT_MODE_SWITCH */
 
+/*
+ * Prototypes from tal_rate_ctrl.c
+ */
+#ifdef SUPPORT_RATE_CONTROL
+void rate_ctrl_tx_start(trx_id_t trx_id, frame_info_t *frame);
+void rate_ctrl_tx_retry(trx_id_t trx_id);
+void rate_ctrl_tx_done(trx_id_t trx_id, retval_t status);
+void rate_ctrl_rx_frame(trx_id_t trx_id, frame_info_t *frame, int8_t ed);
+void reset_rate_control(trx_id_t trx_id);
+#endif
+
+/*
+ * Prototypes from tal_reg_image.c
+ */
+void reg_image_seed(trx_id_t trx_id, pal_trx_shadow_t *shadow);
+void reg_image_invalidate(trx_id_t trx_id);
+retval_t reg_image_capture(pal_trx_shadow_t *shadow,
+                           retval_t (*conf)(trx_id_t trx_id), trx_id_t trx_id);
+retval_t reg_image_diff(const pal_trx_shadow_t *from, const pal_trx_shadow_t *to,
+                        reg_image_t *image);
+void reg_image_force_block(pal_trx_shadow_t *from, const pal_trx_shadow_t *to,
+                           uint16_t addr, uint8_t len);
+void reg_image_apply(const reg_image_t *image);
+void reg_image_get_fx(trx_id_t trx_id, reg_image_fx_t *fx);
+void reg_image_set_fx(trx_id_t trx_id, const reg_image_fx_t *fx);
+void add_latency(tal_latency_t *lat, uint32_t start);
+
+/*
+ * Prototypes from tal_phy_profile.c
+ */
+void flush_phy_profiles(trx_id_t trx_id);
+
 /*
  * Prototypes from tal_auto_rx.c
  */
@@ -283,6 +410,79 @@ void transmit_frame(trx_id_t trx_id, cca_use_t cca);
 void handle_tx_end_irq(trx_id_t trx_id);
 void tx_done_handling(trx_id_t trx_id, retval_t status);
 void continue_deferred_transmission(trx_id_t trx_id);
+void flush_tx_queue(trx_id_t trx_id);
+void start_next_queued_frame(trx_id_t trx_id);
+void preload_tx_frame(trx_id_t trx_id);
+retval_t prepare_tx_transaction(trx_id_t trx_id, frame_info_t *tx_frame);
+void start_prepared_tx(trx_id_t trx_id);
+void cancel_prepared_tx(trx_id_t trx_id);
+
+/*
+ * Prototypes from tal_spi_model.c
+ */
+void calibrate_spi_model(void);
+uint16_t get_tx_preload_len(trx_id_t trx_id, uint16_t len, cca_use_t cca);
+
+/*
+ * Prototypes from tal_aggr.c
+ */
+#ifdef SUPPORT_AGGREGATION
+bool aggr_tx_done(trx_id_t trx_id, retval_t status, frame_info_t *frame);
+bool aggr_rx_frame(trx_id_t trx_id, buffer_t *buf_ptr);
+void reset_aggregation(trx_id_t trx_id);
+#endif
+
+/*
+ * Prototypes from tal_bulk.c
+ */
+#ifdef SUPPORT_BULK_TRANSFER
+bool bulk_tx_done(trx_id_t trx_id, retval_t status, frame_info_t *frame);
+bool bulk_rx_frame(trx_id_t trx_id, buffer_t *buf_ptr);
+void reset_bulk_transfer(trx_id_t trx_id);
+#endif
+
+/*
+ * Prototypes from tal_ch_hop.c
+ */
+#ifdef SUPPORT_CH_HOPPING
+bool ch_hop_switch_done(trx_id_t trx_id, retval_t status);
+void ch_hop_resync(trx_id_t trx_id);
+void reset_ch_hopping(trx_id_t trx_id);
+#endif
+
+/*
+ * Prototypes from tal_tstamp.c
+ */
+#ifdef ENABLE_TSTAMP
+uint64_t get_frame_tstamp(trx_id_t trx_id);
+#endif
+#ifdef SUPPORT_HW_TSTAMP
+void init_hw_tstamp(trx_id_t trx_id);
+void capture_frame_cnt(trx_id_t trx_id);
+#endif
+
+/*
+ * Prototypes from tal_tsch.c
+ */
+#ifdef SUPPORT_TSCH
+bool tsch_tx_done(trx_id_t trx_id, retval_t status, frame_info_t *frame);
+void tsch_rx_frame(trx_id_t trx_id);
+void reset_tsch(trx_id_t trx_id);
+#endif
+
+/*
+ * Prototypes from tal_scan.c
+ */
+#ifdef SUPPORT_SPECTRUM_SCAN
+void stop_spectrum_scan(trx_id_t trx_id);
+#endif
+
+/*
+ * Prototypes from tal_cca_ctrl.c
+ */
+#ifdef SUPPORT_ADAPTIVE_CCA
+void cca_ctrl_result(trx_id_t trx_id, bool busy);
+#endif
 
 /*
  * Prototypes from tal_auto_csma.c
@@ -290,6 +490,25 @@ void continue_deferred_transmission(trx_id_t trx_id);
 void cca_done_handling(trx_id_t trx_id);
 void csma_start(trx_id_t trx_id);
 void csma_continue(trx_id_t trx_id);
+#ifdef SUPPORT_ADAPTIVE_CSMA
+uint8_t get_csma_busy_cca(trx_id_t trx_id);
+#endif
+
+/*
+ * Prototypes from tal_csma_adapt.c
+ */
+#ifdef SUPPORT_ADAPTIVE_CSMA
+void get_csma_params(trx_id_t trx_id, tal_csma_params_t *params);
+void csma_adapt_attempt_done(trx_id_t trx_id, retval_t status, uint8_t busy_cca);
+#endif
+
+/*
+ * Prototypes from tal_rand.c
+ */
+#ifdef SUPPORT_ENTROPY_POOL
+void init_entropy_pool(trx_id_t trx_id);
+uint32_t prng_next(trx_id_t trx_id);
+#endif
 
 
 /*
@@ -197,6 +197,7 @@ void tal_task(void)
             if (tal_rx_buffer[trx_id] == NULL)
             {
                 tal_rx_buffer[trx_id] = bmm_buffer_alloc(LARGE_BUFFER_SIZE);
+                BMM_SET_OWNER(tal_rx_buffer[trx_id], BMM_OWNER_TAL_RX);
             }
 
             /* Check if buffer could be allocated */
@@ -328,6 +329,10 @@ static inline void handle_pending_irq(trx_id_t trx_id)
         {
             handle_ed_end_irq((trx_id_t)trx_id);
         }
+        if ((rf_irqs & RF_IRQ_TRXRDY) && (tal_state[trx_id] == TAL_CH_SWITCH))
+        {
+            handle_ch_switch_irq((trx_id_t)trx_id);
+        }
     }
 }
 
@@ -478,6 +483,16 @@ static void handle_trxerr(trx_id_t trx_id)
             break;
 #endif
 
+        case TAL_CH_SWITCH:
+            stop_ch_switch(trx_id); // see tal_ch_switch.c; covers state handling
+            break;
+
+#ifdef SUPPORT_SPECTRUM_SCAN
+        case TAL_SPECTRUM_SCAN:
+            stop_spectrum_scan(trx_id); // see tal_scan.c; covers state handling
+            break;
+#endif
+
         default:
             if (trx_default_state[trx_id] == RF_RX)
             {
@@ -629,6 +644,70 @@ void cancel_any_reception(trx_id_t trx_id)
 }
 
 
+/**
+ * @brief Parses the MHR of a 2003/2006 frame
+ *
+ * Frames with enabled security, a newer frame version or reserved
+ * addressing modes are not parsed.
+ *
+ * @param mpdu Pointer to the MPDU
+ * @param len MPDU length without FCS
+ * @param mhr Returns the MHR length and the field positions
+ *
+ * @return true if the MHR has been parsed, else false
+ */
+bool parse_mhr(uint8_t *mpdu, uint16_t len, mhr_info_t *mhr)
+{
+    uint8_t fcf0 = mpdu[PL_POS_FCF_1];
+    uint8_t fcf1 = mpdu[PL_POS_FCF_2];
+    uint8_t dst_mode = (fcf1 >> FCF_2_DEST_ADDR_OFFSET) & 0x03;
+    uint8_t src_mode = (fcf1 >> FCF_2_SOURCE_ADDR_OFFSET) & 0x03;
+    uint8_t pos = PL_POS_SEQ_NUM + 1;
+
+    if ((len < pos) || (fcf0 & FCF_SECURITY_ENABLED) ||
+        (((fcf1 & FCF1_FV_MASK) >> FCF1_FV_SHIFT) > FCF1_FV_2006) ||
+        (dst_mode == FCF_RESERVED_ADDR) || (src_mode == FCF_RESERVED_ADDR))
+    {
+        return false;
+    }
+
+    mhr->dst_pan_pos = 0;
+    mhr->dst_addr_pos = 0;
+    mhr->dst_addr_len = 0;
+    mhr->src_pan_pos = 0;
+    mhr->src_addr_pos = 0;
+    mhr->src_addr_len = 0;
+
+    if (dst_mode != FCF_NO_ADDR)
+    {
+        mhr->dst_pan_pos = pos;
+        pos += PAN_ID_LEN;
+        mhr->dst_addr_pos = pos;
+        mhr->dst_addr_len = (dst_mode == FCF_SHORT_ADDR) ? SHORT_ADDR_LEN : EXT_ADDR_LEN;
+        pos += mhr->dst_addr_len;
+    }
+    if (src_mode != FCF_NO_ADDR)
+    {
+        if (((fcf0 & FCF_PAN_ID_COMPRESSION) == 0) || (dst_mode == FCF_NO_ADDR))
+        {
+            mhr->src_pan_pos = pos;
+            pos += PAN_ID_LEN;
+        }
+        mhr->src_addr_pos = pos;
+        mhr->src_addr_len = (src_mode == FCF_SHORT_ADDR) ? SHORT_ADDR_LEN : EXT_ADDR_LEN;
+        pos += mhr->src_addr_len;
+    }
+
+    if (pos > len)
+    {
+        return false;
+    }
+    mhr->len = pos;
+
+    return true;
+}
+
+
 #if ((defined RF215v1) || (defined RF215v2)) && (defined SUPPORT_LEGACY_OQPSK)
 /* Workaround for errata reference #4908 */
 static void inline start_agc_timer(trx_id_t trx_id)
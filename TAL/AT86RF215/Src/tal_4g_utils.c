@@ -251,15 +251,195 @@
 
 #define FPGA_CCA_THRES_VALUE    -105
 
+/*
+ * PHY timing tables
+ *
+ * The entries are evaluated by the preprocessor / compiler for every
+ * supported modulation and rate combination, using the same integer rules
+ * as tal_get_symbol_duration_us() and get_cca_thres(). They replace the
+ * former per-PHY calculation of the data rate, the CCA duration, the
+ * AckWaitDuration and the ACK timing. Entry layout: see phy_timing_t.
+ */
+#define TIMING_CEIL(a, b)   (((a) + (b) - 1) / (b))
+
+#if (BOARD_TYPE == FPGA215)
+#define TIMING_CCA_THRES(thres)     FPGA_CCA_THRES_VALUE
+#else
+#define TIMING_CCA_THRES(thres)     (thres)
+#endif
+
+/* PSDU of an ACK: 3 octets + 4 octets FCS */
+#define TIMING_SUN_ACK_LEN          (3 + 4)
+
+/* sym_rate: symbol rate / 10 kHz; mt: 0 = 2FSK, 1 = 4FSK; fec: 0/1 */
+#define FSK_TIMING_RATE(sym_rate, mt, fec) \
+    ((10 * (sym_rate) * ((mt) + 1)) / ((fec) + 1))
+
+#define FSK_TIMING(sym_rate, cca_thres, ack_delay, mt, fec) \
+    {                                                                       \
+        20,                                                                 \
+        (8000 / FSK_TIMING_RATE(sym_rate, mt, fec)),                        \
+        8,                                                                  \
+        (2 * TIMING_CEIL(aMinTurnaroundTimeSUNPHY, 20)) +                   \
+        ((((TIMING_SUN_ACK_LEN + 2) / ((mt) + 1)) * ((fec) + 1)) * 8),      \
+        (TIMING_CEIL(aMinTurnaroundTimeSUNPHY, 20) * 20) - (ack_delay),     \
+        TIMING_CCA_THRES((cca_thres) - ((fec) * FK_CCA_THRES_FEC_OFFSET)),  \
+        FSK_TIMING_RATE(sym_rate, mt, fec)                                  \
+    }
+
+/* Row: [mod_type][FEC] */
+#define FSK_TIMING_ROW(sym_rate, cca_thres, ack_delay) \
+    {                                                                       \
+        { FSK_TIMING(sym_rate, cca_thres, ack_delay, 0, 0),                 \
+          FSK_TIMING(sym_rate, cca_thres, ack_delay, 0, 1) },               \
+        { FSK_TIMING(sym_rate, cca_thres, ack_delay, 1, 0),                 \
+          FSK_TIMING(sym_rate, cca_thres, ack_delay, 1, 1) }                \
+    }
+
+/*
+ * Rows: FSK symbol rate; see FSK_SYM_RATE_TABLE, FSK_CCA_THRES_TABLE and
+ * FSK_PROCESSING_DELAY_ACK_TIMING_AUTO_MODES
+ */
+#define FSK_TIMING_TABLE \
+    FSK_TIMING_ROW(5, FSK_CCA_THRES_50_KBIT, 128),  \
+    FSK_TIMING_ROW(10, FSK_CCA_THRES_100_KBIT, 70), \
+    FSK_TIMING_ROW(15, FSK_CCA_THRES_150_KBIT, 60), \
+    FSK_TIMING_ROW(20, FSK_CCA_THRES_200_KBIT, 60), \
+    FSK_TIMING_ROW(30, FSK_CCA_THRES_300_KBIT, 30), \
+    FSK_TIMING_ROW(40, FSK_CCA_THRES_400_KBIT, 25)
+
+#define FSK_TIMING_TABLE_MOD_SIZE   2
+
+/* rate: kbit/s; phr: PHR duration in symbols */
+#define OFDM_TIMING(rate, cca_thres, phr) \
+    {                                                                       \
+        120,                                                                \
+        (8000 / (rate)),                                                    \
+        8,                                                                  \
+        (2 * TIMING_CEIL(aMinTurnaroundTimeSUNPHY, 120)) + 6 + (phr) +      \
+        TIMING_CEIL(TIMING_SUN_ACK_LEN * (8000 / (rate)), 120),             \
+        (TIMING_CEIL(aMinTurnaroundTimeSUNPHY, 120) * 120) - 100,           \
+        TIMING_CCA_THRES(cca_thres),                                        \
+        (rate)                                                              \
+    }
+
+/* [interleaving]; PHR duration depends on option and interleaving */
+#define OFDM_TIMING_MCS(rate, cca_thres, phr_no_il, phr_il) \
+    { OFDM_TIMING(rate, cca_thres, phr_no_il), OFDM_TIMING(rate, cca_thres, phr_il) }
+
+/*
+ * Rows: OFDM option; columns: MCS;
+ * see OFDM_DATA_RATE_TABLE and OFDM_CCA_THRES_TABLE
+ */
+#define OFDM_TIMING_TABLE \
+    { /* Opt. 1 */ \
+        OFDM_TIMING_MCS(100, (-103 + CCA_OFFSET), 3, 4),   \
+        OFDM_TIMING_MCS(200, (-100 + CCA_OFFSET), 3, 4),   \
+        OFDM_TIMING_MCS(400, (-97 + CCA_OFFSET), 3, 4),    \
+        OFDM_TIMING_MCS(800, (-94 + CCA_OFFSET), 3, 4),    \
+        OFDM_TIMING_MCS(1200, (-91 + CCA_OFFSET), 3, 4),   \
+        OFDM_TIMING_MCS(1600, (-88 + CCA_OFFSET), 3, 4),   \
+        OFDM_TIMING_MCS(2400, (-85 + CCA_OFFSET), 3, 4)    \
+    }, \
+    { /* Opt. 2 */ \
+        OFDM_TIMING_MCS(50, (-105 + CCA_OFFSET), 6, 8),    \
+        OFDM_TIMING_MCS(100, (-103 + CCA_OFFSET), 6, 8),   \
+        OFDM_TIMING_MCS(200, (-100 + CCA_OFFSET), 6, 8),   \
+        OFDM_TIMING_MCS(400, (-97 + CCA_OFFSET), 6, 8),    \
+        OFDM_TIMING_MCS(600, (-94 + CCA_OFFSET), 6, 8),    \
+        OFDM_TIMING_MCS(800, (-91 + CCA_OFFSET), 6, 8),    \
+        OFDM_TIMING_MCS(1200, (-88 + CCA_OFFSET), 6, 8)    \
+    }, \
+    { /* Opt. 3 */ \
+        OFDM_TIMING_MCS(25, (-105 + CCA_OFFSET), 6, 6),    \
+        OFDM_TIMING_MCS(50, (-105 + CCA_OFFSET), 6, 6),    \
+        OFDM_TIMING_MCS(100, (-103 + CCA_OFFSET), 6, 6),   \
+        OFDM_TIMING_MCS(200, (-100 + CCA_OFFSET), 6, 6),   \
+        OFDM_TIMING_MCS(300, (-97 + CCA_OFFSET), 6, 6),    \
+        OFDM_TIMING_MCS(400, (-94 + CCA_OFFSET), 6, 6),    \
+        OFDM_TIMING_MCS(600, (-91 + CCA_OFFSET), 6, 6)     \
+    }, \
+    { /* Opt. 4 */ \
+        OFDM_TIMING_MCS(12, (-105 + CCA_OFFSET), 6, 6),    \
+        OFDM_TIMING_MCS(25, (-105 + CCA_OFFSET), 6, 6),    \
+        OFDM_TIMING_MCS(50, (-105 + CCA_OFFSET), 6, 6),    \
+        OFDM_TIMING_MCS(100, (-103 + CCA_OFFSET), 6, 6),   \
+        OFDM_TIMING_MCS(150, (-100 + CCA_OFFSET), 6, 6),   \
+        OFDM_TIMING_MCS(200, (-97 + CCA_OFFSET), 6, 6),    \
+        OFDM_TIMING_MCS(300, (-94 + CCA_OFFSET), 6, 6)     \
+    }
+
+#define OFDM_TIMING_TABLE_OPT_SIZE  4
+#define OFDM_TIMING_TABLE_MCS_SIZE  7
+
+/*
+ * sym: symbol duration; chip_rate: kchip/s; spread: spreading factor;
+ * ns: symbol length in chips; shr: SHR duration in symbols
+ */
+#define OQPSK_TIMING(sym, chip_rate, spread, ns, cca_sym, shr, ack_offset) \
+    {                                                                       \
+        (sym),                                                              \
+        ((8000 * 2 * (spread)) / (chip_rate)),                              \
+        (cca_sym),                                                          \
+        (2 * TIMING_CEIL(aMinTurnaroundTimeSUNPHY, sym)) + (shr) + 15 +     \
+        TIMING_CEIL(2 * 63 * (spread), ns) +                                \
+        TIMING_CEIL(2 * 63 * (spread), 16 * (ns)),                          \
+        (TIMING_CEIL(aMinTurnaroundTimeSUNPHY, sym) * (sym)) - (ack_offset),\
+        TIMING_CCA_THRES(OQPSK_CCA_THRES),                                  \
+        ((chip_rate) / (spread) / 2)                                        \
+    }
+
+/* Row: [rate mode]; spread_corr: chip rate dependent spreading correction */
+#define OQPSK_TIMING_ROW(sym, chip_rate, spread_corr, ns, cca_sym, shr, ack_offset) \
+    {                                                                                   \
+        OQPSK_TIMING(sym, chip_rate, 8 * (spread_corr), ns, cca_sym, shr, ack_offset),  \
+        OQPSK_TIMING(sym, chip_rate, 4 * (spread_corr), ns, cca_sym, shr, ack_offset),  \
+        OQPSK_TIMING(sym, chip_rate, 2 * (spread_corr), ns, cca_sym, shr, ack_offset),  \
+        OQPSK_TIMING(sym, chip_rate, 1 * (spread_corr), ns, cca_sym, shr, ack_offset),  \
+        OQPSK_TIMING(sym, chip_rate, 1, ns, cca_sym, shr, ack_offset)                   \
+    }
+
+/*
+ * Rows: chip rate; see OQPSK_SYMBOL_DURATION_TABLE, OQPSK_CHIP_RATE_TABLE,
+ * OQPSK_SYMBOL_LENGTH_TABLE, OQPSK_CCA_DURATION_TABLE,
+ * OQPSK_SHR_DURATION_TABLE and OQPSK_ACK_TIMING_OFFSET_TABLE
+ */
+#define OQPSK_TIMING_TABLE \
+    OQPSK_TIMING_ROW(320, 100, 1, 32, 4, 48, 90),   \
+    OQPSK_TIMING_ROW(160, 200, 1, 32, 4, 48, 50),   \
+    OQPSK_TIMING_ROW(64, 1000, 2, 64, 8, 72, 25),   \
+    OQPSK_TIMING_ROW(64, 2000, 4, 128, 8, 72, 20)
+
+#define OQPSK_TIMING_TABLE_CHIP_RATE_SIZE   4
+#define OQPSK_TIMING_TABLE_RATE_MODE_SIZE   5
+
+/* rate: kbit/s */
+#define LEG_OQPSK_TIMING(rate) \
+    {                                                                       \
+        16,                                                                 \
+        (8000 / (rate)),                                                    \
+        8,                                                                  \
+        54,                                                                 \
+        (aTurnaroundTime * 16) - 20,                                        \
+        TIMING_CCA_THRES(-85 + 10),                                         \
+        (rate)                                                              \
+    }
+
+/* Rows: chip rate; columns: high rate mode */
+#define LEG_OQPSK_TIMING_TABLE \
+    { LEG_OQPSK_TIMING(250), LEG_OQPSK_TIMING(1000) },  \
+    { LEG_OQPSK_TIMING(250), LEG_OQPSK_TIMING(1000) },  \
+    { LEG_OQPSK_TIMING(250), LEG_OQPSK_TIMING(500) },   \
+    { LEG_OQPSK_TIMING(250), LEG_OQPSK_TIMING(1000) }
+
+#define LEG_OQPSK_TIMING_TABLE_CHIP_RATE_SIZE   4
+
 /* === GLOBALS ============================================================= */
 
 #if (defined SUPPORT_OQPSK) || (defined SUPPORT_LEGACY_OQPSK)
 FLASH_DECLARE(OQPSK_SYMBOL_DURATION_TABLE_DATA_TYPE
               oqpsk_sym_duration_table[OQPSK_SYMBOL_DURATION_TABLE_SIZE]) = OQPSK_SYMBOL_DURATION_TABLE;
 
-FLASH_DECLARE(OQPSK_CCA_DURATION_TABLE_DATA_TYPE
-              oqpsk_cca_dur_table[OQPSK_CCA_DURATION_TABLE_SIZE]) = OQPSK_CCA_DURATION_TABLE;
-
 FLASH_DECLARE(OQPSK_SHR_DURATION_TABLE_DATA_TYPE
               oqpsk_shr_duration_table[OQPSK_SHR_DURATION_TABLE_SIZE]) = OQPSK_SHR_DURATION_TABLE;
 
@@ -268,9 +448,6 @@ FLASH_DECLARE(OQPSK_SYMBOL_LENGTH_TABLE_DATA_TYPE
 
 FLASH_DECLARE(OQPSK_CHIP_RATE_TABLE_DATA_TYPE
               oqpsk_chip_rate_table[OQPSK_CHIP_RATE_TABLE_SIZE]) = OQPSK_CHIP_RATE_TABLE;
-
-FLASH_DECLARE(OQPSK_ACK_TIMING_OFFSET_TABLE_DATA_TYPE
-              oqpsk_ack_timing_offset_table[OQPSK_ACK_TIMING_OFFSET_TABLE_SIZE]) = OQPSK_ACK_TIMING_OFFSET_TABLE;
 #endif
 
 #ifdef SUPPORT_OFDM
@@ -278,10 +455,6 @@ FLASH_DECLARE(OFDM_CCA_THRES_TABLE_DATA_TYPE
               ofdm_cca_thres[OFDM_CCA_THRES_TABLE_ROW_SIZE][OFDM_CCA_THRES_TABLE_COL_SIZE]) =
 {OFDM_CCA_THRES_TABLE};
 
-FLASH_DECLARE(OFDM_DATA_RATE_TABLE_DATA_TYPE
-              ofdm_data_rate_table[OFDM_DATA_RATE_TABLE_ROW_SIZE][OFDM_DATA_RATE_TABLE_COL_SIZE]) =
-{OFDM_DATA_RATE_TABLE};
-
 FLASH_DECLARE(OFDM_PROCESSING_DELAY_ACK_TIMING_TABLE_DATA_TYPE
               ofdm_processing_delay_ack_timing[OFDM_PROCESSING_DELAY_ACK_TIMING_TABLE_COL_SIZE][OFDM_PROCESSING_DELAY_ACK_TIMING_TABLE_ROW_SIZE]) =
 {OFDM_PROCESSING_DELAY_ACK_TIMING_TABLE};
@@ -294,14 +467,32 @@ FLASH_DECLARE(FSK_SYM_RATE_TABLE_DATA_TYPE fsk_sym_rate_table[FSK_SYM_RATE_TABLE
 FLASH_DECLARE(FSK_CCA_THRES_DATA_TYPE fsk_cca_thres_table[FSK_CCA_THRES_TABLE_SIZE]) =
     FSK_CCA_THRES_TABLE;
 
-FLASH_DECLARE(FSK_PROCESSING_DELAY_ACK_TABLE_DATA_TYPE
-              fsk_processing_delay_ack_timing[FSK_PROCESSING_DELAY_ACK_TABLE_ROW_SIZE]) =
-                  FSK_PROCESSING_DELAY_ACK_TIMING_AUTO_MODES;
+FLASH_DECLARE(phy_timing_t
+              fsk_timing[FSK_SYM_RATE_TABLE_SIZE][FSK_TIMING_TABLE_MOD_SIZE][2]) =
+{FSK_TIMING_TABLE};
 #endif
 
-/* === PROTOTYPES ========================================================== */
+#ifdef SUPPORT_OFDM
+FLASH_DECLARE(phy_timing_t
+              ofdm_timing[OFDM_TIMING_TABLE_OPT_SIZE][OFDM_TIMING_TABLE_MCS_SIZE][2]) =
+{OFDM_TIMING_TABLE};
+#endif
 
 #ifdef SUPPORT_OQPSK
+FLASH_DECLARE(phy_timing_t
+              oqpsk_timing[OQPSK_TIMING_TABLE_CHIP_RATE_SIZE][OQPSK_TIMING_TABLE_RATE_MODE_SIZE]) =
+{OQPSK_TIMING_TABLE};
+#endif
+
+#ifdef SUPPORT_LEGACY_OQPSK
+FLASH_DECLARE(phy_timing_t
+              leg_oqpsk_timing[LEG_OQPSK_TIMING_TABLE_CHIP_RATE_SIZE][2]) =
+{LEG_OQPSK_TIMING_TABLE};
+#endif
+
+/* === PROTOTYPES ========================================================== */
+
+#if (defined SUPPORT_OQPSK) && (defined MEASURE_ON_AIR_DURATION)
 static uint16_t oqpsk_ack_psdu_duration_sym(trx_id_t trx_id);
 static uint8_t oqpsk_spreading(oqpsk_chip_rate_t chip_rate, oqpsk_rate_mode_t rate_mode);
 #endif
@@ -350,58 +541,6 @@ uint16_t tal_get_symbol_duration_us(trx_id_t trx_id)
 }
 
 
-/**
- * @brief Gets the CCA duration in us
- *
- * @param trx_id Transceiver identifier
- *
- * @return CCA duration in us
- */
-uint16_t get_cca_duration_us(trx_id_t trx_id)
-{
-    uint16_t ret_val = 0;
-
-    if (tal_pib[trx_id].phy.freq_band == JAPAN_920)
-    {
-        ret_val = calculate_cca_duration_us(trx_id);
-    }
-    else
-    {
-        switch (tal_pib[trx_id].phy.modulation)
-        {
-#ifdef SUPPORT_FSK
-            case FSK:
-                ret_val = 8;
-                break;
-#endif
-#ifdef SUPPORT_OFDM
-            case OFDM:
-                ret_val = 8; /* symbols */
-                break;
-#endif
-#ifdef SUPPORT_OQPSK
-            case OQPSK:
-                /* Check CCA table for entry */
-                ret_val = (uint8_t)PGM_READ_BYTE(&oqpsk_cca_dur_table[tal_pib[trx_id].phy.phy_mode.oqpsk.chip_rate]); /* symbols */
-                break;
-#endif
-#ifdef SUPPORT_LEGACY_OQPSK
-            case LEG_OQPSK:
-                ret_val = 8;
-                break;
-#endif
-            default:
-                break;
-        }
-
-        /* Change value from symbols to us */
-        ret_val = ret_val * tal_pib[trx_id].SymbolDuration_us;
-    }
-
-    return ret_val;
-}
-
-
 /**
  * @brief Gets the CCA threshold
  *
@@ -457,144 +596,6 @@ int8_t get_cca_thres(trx_id_t trx_id)
 }
 
 
-/**
- * @brief Gets the AckWaitDuration in us
- *
- * @param trx_id Transceiver identifier
- *
- * @return AckWaitDuration in us
- */
-// see section 6.4.3, pg. 30
-uint16_t get_AckWaitDuration_us(trx_id_t trx_id)
-{
-    uint16_t AckWaitDuration;
-
-#ifdef SUPPORT_LEGACY_OQPSK
-    if (tal_pib[trx_id].phy.modulation == LEG_OQPSK)
-    {
-        AckWaitDuration = 54; // symbols
-    }
-    else
-#endif
-    {
-#if ((defined SUPPORT_OFDM) || (defined SUPPORT_FSK))
-        uint8_t ack_len = 3 + tal_pib[trx_id].FCSLen;
-#endif
-        /* aUnitBackoffPeriod + aTurnaroundTime */
-        AckWaitDuration = (2 * ceiling_sym(trx_id, aMinTurnaroundTimeSUNPHY)) +
-                          tal_pib[trx_id].CCADuration_sym;
-        /* phySHRDuration */
-        AckWaitDuration += shr_duration_sym(trx_id);
-
-        switch (tal_pib[trx_id].phy.modulation)
-        {
-#ifdef SUPPORT_FSK
-            case FSK:
-                /* PHR uses same data rate as PSDU */
-                ack_len += 2;
-                if (tal_pib[trx_id].phy.phy_mode.fsk.mod_type == F4FSK)
-                {
-                    ack_len /= 2;
-                }
-                if (tal_pib[trx_id].FSKFECEnabled)
-                {
-                    ack_len *= 2;
-                }
-                AckWaitDuration += ack_len * 8;
-                break;
-#endif
-#ifdef SUPPORT_OFDM
-            case OFDM:
-                /* phyPHRDuration */
-                AckWaitDuration += phr_duration_sym(trx_id);
-                /* PSDU len = 3 + FCS = 5 or 7; add TAIL and PAD; */
-                AckWaitDuration += ceiling_sym(trx_id, ack_len * tal_pib[trx_id].OctetDuration_us);
-                break;
-#endif
-#ifdef SUPPORT_OQPSK
-            case OQPSK:
-                /* phyPHRDuration */
-                AckWaitDuration += phr_duration_sym(trx_id);
-                /* PSDU duration */
-                AckWaitDuration += oqpsk_ack_psdu_duration_sym(trx_id);
-                break;
-#endif
-            default:
-                AckWaitDuration = 0;
-                break;
-        }
-    }
-
-    /* Convert from symbols to us */
-    AckWaitDuration *= tal_pib[trx_id].SymbolDuration_us;
-
-    return AckWaitDuration;
-}
-
-
-/**
- * @brief Gets the ACK timing in us
- *
- * @param trx_id Transceiver identifier
- *
- * @return ACK timing in us
- */
-uint16_t get_AckTiming_us(trx_id_t trx_id)
-{
-    uint16_t ack;
-
-#ifdef SUPPORT_LEGACY_OQPSK
-    if (tal_pib[trx_id].phy.modulation == LEG_OQPSK)
-    {
-        ack = aTurnaroundTime; // = 12
-    }
-    else
-
-#endif
-    {
-        ack = ceiling_sym(trx_id, aMinTurnaroundTimeSUNPHY);
-    }
-
-    /* Convert symbols to usec */
-    ack *= tal_pib[trx_id].SymbolDuration_us;
-
-    /*
-     * ACK timing correction - processing delay:
-     * RX to RXFE IRQ delay - PHY dependent
-     * Txprep to Tx delay
-     * MCU processing delay - MCU dependent
-     * PA ramping delay
-     */
-    switch (tal_pib[trx_id].phy.modulation)
-    {
-#ifdef SUPPORT_FSK
-        case FSK:
-            ack -= (uint8_t)PGM_READ_BYTE(&fsk_processing_delay_ack_timing[tal_pib[trx_id].phy.phy_mode.fsk.sym_rate]);
-            break;
-#endif
-#ifdef SUPPORT_OFDM
-        case OFDM:
-            ack -= 100;
-            break;
-#endif
-#if (defined SUPPORT_OQPSK) 
-        case OQPSK:
-            ack -= (uint8_t)PGM_READ_BYTE(&oqpsk_ack_timing_offset_table[tal_pib[trx_id].phy.phy_mode.oqpsk.chip_rate]);
-            break;
-#endif
-#ifdef SUPPORT_LEGACY_OQPSK
-        case LEG_OQPSK:
-            ack -= 20;
-            break;
-#endif /* #if (defined SUPPORT_LEGACY_OQPSK) */
-        default:
-            break;
-    }
-
-    return ack;
-}
-
-
 /**
  * @brief Implements the ceiling function for symbols
  *
@@ -743,7 +744,7 @@ uint8_t shr_duration_sym(trx_id_t trx_id)
  *
  * @return PSDU length in symbols
  */
-#ifdef SUPPORT_OQPSK
+#if (defined SUPPORT_OQPSK) && (defined MEASURE_ON_AIR_DURATION)
 static uint16_t oqpsk_ack_psdu_duration_sym(trx_id_t trx_id)
 {
     uint8_t Ns = (uint8_t)PGM_READ_BYTE(&oqpsk_sym_len_table[tal_pib[trx_id].phy.phy_mode.oqpsk.chip_rate]); // Table 183
@@ -793,7 +794,7 @@ uint16_t oqpsk_get_chip_rate(trx_id_t trx_id)
  *
  * @return Spreading
  */
-#ifdef SUPPORT_OQPSK
+#if (defined SUPPORT_OQPSK) && (defined MEASURE_ON_AIR_DURATION)
 static uint8_t oqpsk_spreading(oqpsk_chip_rate_t chip_rate, oqpsk_rate_mode_t rate_mode)
 {
     uint8_t spread;
@@ -826,60 +827,129 @@ static uint8_t oqpsk_spreading(oqpsk_chip_rate_t chip_rate, oqpsk_rate_mode_t ra
 
 
 /**
- * @brief Gets PSDU data rate
+ * @brief Gets the timing values of the current PHY
  *
- * @param trx_id Transceiver identifier
+ * The values are taken from the PHY timing tables; the table index is
+ * built from the PHY settings of the PIB.
  *
- * @return data rate in kbit/s
+ * @param[in]   trx_id Transceiver identifier
+ * @param[out]  timing Pointer to timing storage location
+ *
+ * @return MAC_SUCCESS, MAC_INVALID_PARAMETER if the modulation is not
+ *         supported, FAILURE if a PHY setting is out of the table range
  */
-float get_data_rate(trx_id_t trx_id)
+retval_t get_phy_timing(trx_id_t trx_id, phy_timing_t *timing)
 {
-    float rate = 0;
+    const phy_timing_t *entry;
 
     switch (tal_pib[trx_id].phy.modulation)
     {
 #ifdef SUPPORT_FSK
         case FSK:
-            rate = 10 * (uint8_t)PGM_READ_BYTE(&fsk_sym_rate_table[tal_pib[trx_id].phy.phy_mode.fsk.sym_rate]);
-            if (tal_pib[trx_id].phy.phy_mode.fsk.mod_type == F4FSK)
-            {
-                rate *= 2;
-            }
-            if (tal_pib[trx_id].FSKFECEnabled)
             {
-                rate /= 2;
+                uint8_t sym_rate = tal_pib[trx_id].phy.phy_mode.fsk.sym_rate;
+                uint8_t mod_type = tal_pib[trx_id].phy.phy_mode.fsk.mod_type;
+
+                if ((sym_rate >= FSK_SYM_RATE_TABLE_SIZE) ||
+                    (mod_type >= FSK_TIMING_TABLE_MOD_SIZE))
+                {
+                    return FAILURE;
+                }
+                entry = &fsk_timing[sym_rate][mod_type][tal_pib[trx_id].FSKFECEnabled ? 1 : 0];
             }
             break;
 #endif
 #ifdef SUPPORT_OFDM
         case OFDM:
-            rate = (uint16_t)PGM_READ_WORD(&ofdm_data_rate_table[tal_pib[trx_id].OFDMMCS] \
-                                           [tal_pib[trx_id].phy.phy_mode.ofdm.option - 1]);
+            {
+                uint8_t opt = tal_pib[trx_id].phy.phy_mode.ofdm.option - 1;
+                uint8_t mcs = tal_pib[trx_id].OFDMMCS;
+
+                if ((opt >= OFDM_TIMING_TABLE_OPT_SIZE) || (mcs >= OFDM_TIMING_TABLE_MCS_SIZE))
+                {
+                    return FAILURE;
+                }
+                entry = &ofdm_timing[opt][mcs][tal_pib[trx_id].OFDMInterleaving ? 1 : 0];
+            }
             break;
 #endif
 #ifdef SUPPORT_OQPSK
         case OQPSK:
             {
-                uint16_t chip_rate = oqpsk_get_chip_rate(trx_id);
-                uint8_t spread = oqpsk_spreading(tal_pib[trx_id].phy.phy_mode.oqpsk.chip_rate,
-                                                 tal_pib[trx_id].OQPSKRateMode);
-                rate = (float)chip_rate / (float)spread / (float)2;
+                uint8_t chip_rate = tal_pib[trx_id].phy.phy_mode.oqpsk.chip_rate;
+                uint8_t rate_mode = tal_pib[trx_id].OQPSKRateMode;
+
+                if ((chip_rate >= OQPSK_TIMING_TABLE_CHIP_RATE_SIZE) ||
+                    (rate_mode >= OQPSK_TIMING_TABLE_RATE_MODE_SIZE))
+                {
+                    return FAILURE;
+                }
+                entry = &oqpsk_timing[chip_rate][rate_mode];
             }
             break;
 #endif
 #ifdef SUPPORT_LEGACY_OQPSK
         case LEG_OQPSK:
-            rate = 250;
-            if (tal_pib[trx_id].HighRateEnabled)
             {
-                if (tal_pib[trx_id].phy.phy_mode.leg_oqpsk.chip_rate == CHIP_RATE_1000)
-                {
-                    rate *= 2;
-                }
-                else
+                uint8_t chip_rate = tal_pib[trx_id].phy.phy_mode.leg_oqpsk.chip_rate;
+
+                if (chip_rate >= LEG_OQPSK_TIMING_TABLE_CHIP_RATE_SIZE)
                 {
-                    rate *= 4;
+                    return FAILURE;
                 }
+                entry = &leg_oqpsk_timing[chip_rate][tal_pib[trx_id].HighRateEnabled ? 1 : 0];
+            }
+            break;
+#endif
+        default:
+            return MAC_INVALID_PARAMETER;
+    }
+
+    PGM_READ_BLOCK(timing, entry, sizeof(phy_timing_t));
+
+    return MAC_SUCCESS;
+}
+
+
+#ifdef SUPPORT_MODE_SWITCH
+/**
+ * @brief Gets the PSDU data rate of a mode switch target mode
+ *
+ * @param mode New PHY mode incl. rate and FEC setting
+ *
+ * @return data rate in kbit/s, 0 if the mode is not supported
+ */
+uint16_t get_mode_data_rate(new_phy_t *mode)
+{
+    const phy_timing_t *entry = NULL;
+
+    switch (mode->modulation)
+    {
+#ifdef SUPPORT_FSK
+        case FSK:
+            if ((mode->phy_mode.fsk.sym_rate < FSK_SYM_RATE_TABLE_SIZE) &&
+                (mode->phy_mode.fsk.mod_type < FSK_TIMING_TABLE_MOD_SIZE))
+            {
+                entry = &fsk_timing[mode->phy_mode.fsk.sym_rate][mode->phy_mode.fsk.mod_type]
+                        [mode->fec_enabled ? 1 : 0];
+            }
+            break;
+#endif
+#ifdef SUPPORT_OFDM
+        case OFDM:
+            if (((uint8_t)(mode->phy_mode.ofdm.option - 1) < OFDM_TIMING_TABLE_OPT_SIZE) &&
+                (mode->rate.ofdm_mcs < OFDM_TIMING_TABLE_MCS_SIZE))
+            {
+                entry = &ofdm_timing[mode->phy_mode.ofdm.option - 1][mode->rate.ofdm_mcs][0];
+            }
+            break;
+#endif
+#ifdef SUPPORT_OQPSK
+        case OQPSK:
+            if ((mode->phy_mode.oqpsk.chip_rate < OQPSK_TIMING_TABLE_CHIP_RATE_SIZE) &&
+                (mode->rate.oqpsk_rate_mod < OQPSK_TIMING_TABLE_RATE_MODE_SIZE))
+            {
+                entry = &oqpsk_timing[mode->phy_mode.oqpsk.chip_rate][mode->rate.oqpsk_rate_mod];
             }
             break;
 #endif
@@ -888,8 +958,55 @@ float get_data_rate(trx_id_t trx_id)
             break;
     }
 
-    return rate;
+    if (entry == NULL)
+    {
+        return 0;
+    }
+
+    return (uint16_t)PGM_READ_WORD(&entry->data_rate_kbps);
+}
+
+
+/**
+ * @brief Gets the duration of a PPDU
+ *
+ * The duration is derived from the PHY settings of the PIB rather than
+ * the cached symbol and octet durations, so the PHY can be changed
+ * temporarily to evaluate another mode.
+ *
+ * @param trx_id Transceiver identifier
+ * @param psdu_len PSDU length incl. FCS
+ *
+ * @return PPDU duration in us, 0 if the PHY is not supported
+ */
+uint32_t get_ppdu_duration_us(trx_id_t trx_id, uint16_t psdu_len)
+{
+    phy_timing_t timing;
+    uint32_t hdr_us;
+
+    if ((get_phy_timing(trx_id, &timing) != MAC_SUCCESS) || (timing.data_rate_kbps == 0))
+    {
+        return 0;
+    }
+    uint32_t kbps = timing.data_rate_kbps;
+
+    hdr_us = shr_duration_sym(trx_id) + phr_duration_sym(trx_id);
+#ifdef SUPPORT_FSK
+    if (tal_pib[trx_id].phy.modulation == FSK)
+    {
+        /* SHR and PHR are given in bits; table contains ksymbol/s / 10 */
+        hdr_us = (hdr_us * 100) /
+                 (uint8_t)PGM_READ_BYTE(&fsk_sym_rate_table[tal_pib[trx_id].phy.phy_mode.fsk.sym_rate]);
+    }
+    else
+#endif
+    {
+        hdr_us *= tal_get_symbol_duration_us(trx_id);
+    }
+
+    return hdr_us + ((uint32_t)psdu_len * 8 * 1000 + kbps - 1) / kbps;
 }
+#endif /* #ifdef SUPPORT_MODE_SWITCH */
 
 
 /**
@@ -0,0 +1,559 @@
+/**
+ * @file tal_aggr.c
+ *
+ * @brief This file implements the aggregation of short data frames into
+ *        large SUN PSDUs and the de-aggregation of received aggregates.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "pal.h"
+#include "return_val.h"
+#include "tal.h"
+#include "ieee_const.h"
+#include "ieee_154g.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "stack_config.h"
+#include "bmm.h"
+#include "tal_internal.h"
+#include <signal.h>
+
+#ifdef SUPPORT_AGGREGATION
+
+/* === TYPES =============================================================== */
+
+/** State of an aggregation slot */
+typedef enum aggr_state_tag
+{
+    AGGR_FREE,
+    AGGR_COLLECTING,
+    AGGR_PENDING
+} SHORTENUM aggr_state_t;
+
+/**
+ * Aggregate under construction or in transmission
+ */
+typedef struct aggr_slot_tag
+{
+    aggr_state_t state;
+    /** Frame handed to the TX path */
+    frame_info_t frame;
+    /** Aggregated MPDU, FCS excluded */
+    uint8_t mpdu[aMaxPHYPacketSize_4g];
+    /** MHR length of the sub-frames */
+    uint8_t mhr_len;
+    /** Sub-frames contained in the aggregate */
+    frame_info_t *sub[TAL_AGGR_MAX_SUBFRAMES];
+    uint8_t num_sub;
+    /** Time the first sub-frame has been added */
+    uint32_t start_time;
+} aggr_slot_t;
+
+/* === MACROS ============================================================== */
+
+/**
+ * Reserved FCF bit marking an aggregated frame (bit 7 of octet one).
+ * The MHR of an aggregate is the MHR of its first sub-frame.
+ */
+#define AGGR_FCF_FLAG           (1 << 7)
+
+/** Sub-frame header: sequence number and 1 or 2 length octets */
+#define AGGR_SUB_HDR_MAX_LEN    (3)
+
+/** Length values above this are encoded in two octets */
+#define AGGR_SHORT_LEN_MAX      (0x7F)
+
+/* === GLOBALS ============================================================= */
+
+static aggr_slot_t aggr_slot[NUM_TRX][TAL_AGGR_NUM_BUFFERS];
+/* Slot currently collecting sub-frames; NULL if none */
+static aggr_slot_t *collecting[NUM_TRX];
+static tal_aggr_stats_t aggr_stats[NUM_TRX];
+
+/* === PROTOTYPES ========================================================== */
+
+static uint8_t get_mhr_len(frame_info_t *frm);
+static uint8_t sub_hdr_len(uint16_t payload_len);
+static bool fits_into(trx_id_t trx_id, aggr_slot_t *slot, frame_info_t *frm,
+                      uint8_t mhr_len);
+static void add_sub_frame(aggr_slot_t *slot, frame_info_t *frm);
+static retval_t send_slot(trx_id_t trx_id, aggr_slot_t *slot);
+static uint32_t ppdu_duration_us(trx_id_t trx_id, uint16_t len_no_crc);
+static void aggr_timer_cb(union sigval v);
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Gets the MHR length of an aggregatable frame
+ *
+ * Only unsecured 2003/2006 data frames without IEs are aggregated.
+ *
+ * @param frm Frame to be checked
+ *
+ * @return MHR length, 0 if the frame cannot be aggregated
+ */
+static uint8_t get_mhr_len(frame_info_t *frm)
+{
+    uint8_t fcf0 = frm->mpdu[PL_POS_FCF_1];
+    mhr_info_t mhr;
+
+    if ((FCF_GET_FRAMETYPE(fcf0) != FCF_FRAMETYPE_DATA) || (fcf0 & AGGR_FCF_FLAG) ||
+        !parse_mhr(frm->mpdu, frm->len_no_crc, &mhr))
+    {
+        return 0;
+    }
+
+    return mhr.len;
+}
+
+
+/**
+ * @brief Gets the length of a sub-frame header
+ *
+ * @param payload_len Length of the sub-frame payload
+ *
+ * @return Sub-frame header length
+ */
+static uint8_t sub_hdr_len(uint16_t payload_len)
+{
+    return (payload_len > AGGR_SHORT_LEN_MAX) ? 3 : 2;
+}
+
+
+/**
+ * @brief Checks if a frame can be added to an aggregate
+ *
+ * @param trx_id Transceiver identifier
+ * @param slot Aggregate that is collecting
+ * @param frm Frame to be added
+ * @param mhr_len MHR length of the frame
+ *
+ * @return true if the frame has the same MHR and fits into the PSDU
+ */
+static bool fits_into(trx_id_t trx_id, aggr_slot_t *slot, frame_info_t *frm,
+                      uint8_t mhr_len)
+{
+    uint16_t payload_len = frm->len_no_crc - mhr_len;
+
+    if ((slot->num_sub >= TAL_AGGR_MAX_SUBFRAMES) || (slot->mhr_len != mhr_len))
+    {
+        return false;
+    }
+
+    /* Same MHR apart from the sequence number */
+    if ((memcmp(slot->sub[0]->mpdu, frm->mpdu, PL_POS_SEQ_NUM) != 0) ||
+        (memcmp(&slot->sub[0]->mpdu[PL_POS_SEQ_NUM + 1], &frm->mpdu[PL_POS_SEQ_NUM + 1],
+                mhr_len - PL_POS_SEQ_NUM - 1) != 0))
+    {
+        return false;
+    }
+
+    uint16_t new_len = slot->frame.len_no_crc + sub_hdr_len(payload_len) + payload_len;
+
+    return ((new_len + tal_pib[trx_id].FCSLen) <= tal_pib[trx_id].MaxPHYPacketSize);
+}
+
+
+/**
+ * @brief Appends a frame to an aggregate
+ *
+ * @param slot Aggregate that is collecting
+ * @param frm Frame to be added
+ */
+static void add_sub_frame(aggr_slot_t *slot, frame_info_t *frm)
+{
+    uint16_t payload_len = frm->len_no_crc - slot->mhr_len;
+    uint8_t *ptr = &slot->mpdu[slot->frame.len_no_crc];
+
+    *ptr++ = frm->mpdu[PL_POS_SEQ_NUM];
+    if (payload_len > AGGR_SHORT_LEN_MAX)
+    {
+        *ptr++ = 0x80 | (uint8_t)(payload_len >> 8);
+    }
+    *ptr++ = (uint8_t)payload_len;
+    memcpy(ptr, &frm->mpdu[slot->mhr_len], payload_len);
+
+    slot->frame.len_no_crc += sub_hdr_len(payload_len) + payload_len;
+    slot->sub[slot->num_sub++] = frm;
+}
+
+
+/**
+ * @brief Calculates the duration of a PPDU
+ *
+ * @param trx_id Transceiver identifier
+ * @param len_no_crc MPDU length without FCS
+ *
+ * @return PPDU duration in us
+ */
+static uint32_t ppdu_duration_us(trx_id_t trx_id, uint16_t len_no_crc)
+{
+    uint32_t sym = shr_duration_sym(trx_id) + phr_duration_sym(trx_id);
+
+    return (sym * tal_pib[trx_id].SymbolDuration_us) +
+           ((uint32_t)(len_no_crc + tal_pib[trx_id].FCSLen) * tal_pib[trx_id].OctetDuration_us);
+}
+
+
+/**
+ * @brief Hands a collected aggregate to the TX queue
+ *
+ * An aggregate with a single sub-frame is sent as the original frame.
+ * If the frame or aggregate cannot be queued, its sub-frames are reported
+ * via tal_tx_frame_done_cb() right away.
+ *
+ * @param trx_id Transceiver identifier
+ * @param slot Aggregate to be sent
+ *
+ * @return Status of tal_tx_enqueue()
+ */
+static retval_t send_slot(trx_id_t trx_id, aggr_slot_t *slot)
+{
+    retval_t status;
+
+    if (collecting[trx_id] == slot)
+    {
+        collecting[trx_id] = NULL;
+    }
+
+    if (slot->num_sub == 1)
+    {
+        frame_info_t *frm = slot->sub[0];
+        slot->state = AGGR_FREE;
+        aggr_stats[trx_id].single++;
+        status = tal_tx_enqueue(trx_id, frm, CSMA_UNSLOTTED, true);
+        if (status != MAC_SUCCESS)
+        {
+            tal_tx_frame_done_cb(trx_id, status, frm);
+        }
+        return status;
+    }
+
+    slot->state = AGGR_PENDING;
+    status = tal_tx_enqueue(trx_id, &slot->frame, CSMA_UNSLOTTED, true);
+    if (status != MAC_SUCCESS)
+    {
+        /* Report the sub-frames as if the aggregate had failed. */
+        aggr_tx_done(trx_id, status, &slot->frame);
+        return status;
+    }
+
+    uint32_t single_us = 0;
+    for (uint8_t i = 0; i < slot->num_sub; i++)
+    {
+        single_us += ppdu_duration_us(trx_id, slot->sub[i]->len_no_crc);
+    }
+    uint32_t aggr_us = ppdu_duration_us(trx_id, slot->frame.len_no_crc);
+    if (single_us > aggr_us)
+    {
+        aggr_stats[trx_id].airtime_saved_us += single_us - aggr_us;
+    }
+    aggr_stats[trx_id].aggregates++;
+    aggr_stats[trx_id].subframes += slot->num_sub;
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Requests to TAL to transmit a frame via the aggregation layer
+ *
+ * Unsecured data frames without IEs are collected as long as their MHR
+ * (apart from the sequence number) is identical and the resulting PSDU fits
+ * into phyMaxPHYPacketSize. The aggregate is transmitted with CSMA-CA and
+ * frame retries when it is full or when TAL_AGGR_DELAY_BUDGET_US has
+ * expired since its first sub-frame. Other frames are queued unchanged.
+ *
+ * tal_tx_frame_done_cb() is called for each provided frame with the status
+ * of the frame or aggregate it has been sent with.
+ *
+ * @param trx_id Transceiver identifier
+ * @param tx_frame Frame to be transmitted; needs to be contiguous
+ *
+ * @return MAC_SUCCESS, TAL_TRX_ASLEEP, MAC_INVALID_PARAMETER or the status
+ *         of tal_tx_enqueue()
+ * @ingroup apiTalApi
+ */
+retval_t tal_aggr_tx_frame(trx_id_t trx_id, frame_info_t *tx_frame)
+{
+    ASSERT((trx_id >= 0) && (trx_id < NUM_TRX));
+
+    if (tal_state[trx_id] == TAL_SLEEP)
+    {
+        return TAL_TRX_ASLEEP;
+    }
+
+    if ((tx_frame == NULL) || (tx_frame->iov != NULL) ||
+        (tx_frame->len_no_crc < (PL_POS_SEQ_NUM + 1)))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    uint8_t mhr_len = get_mhr_len(tx_frame);
+    if (mhr_len == 0)
+    {
+        /* Keep the order with respect to frames already collected */
+        tal_aggr_flush(trx_id);
+        aggr_stats[trx_id].passthrough++;
+        return tal_tx_enqueue(trx_id, tx_frame, CSMA_UNSLOTTED, true);
+    }
+
+    ENTER_CRITICAL_REGION();
+
+    aggr_slot_t *slot = collecting[trx_id];
+    if ((slot != NULL) && !fits_into(trx_id, slot, tx_frame, mhr_len))
+    {
+        send_slot(trx_id, slot);
+        slot = NULL;
+    }
+
+    if (slot == NULL)
+    {
+        for (uint8_t i = 0; i < TAL_AGGR_NUM_BUFFERS; i++)
+        {
+            if (aggr_slot[trx_id][i].state == AGGR_FREE)
+            {
+                slot = &aggr_slot[trx_id][i];
+                break;
+            }
+        }
+        if (slot == NULL)
+        {
+            /* All aggregates are in transmission */
+            LEAVE_CRITICAL_REGION();
+            aggr_stats[trx_id].passthrough++;
+            return tal_tx_enqueue(trx_id, tx_frame, CSMA_UNSLOTTED, true);
+        }
+
+        /* The aggregate uses the MHR of its first sub-frame. */
+        memcpy(slot->mpdu, tx_frame->mpdu, mhr_len);
+        slot->mpdu[PL_POS_FCF_1] |= AGGR_FCF_FLAG;
+        slot->mhr_len = mhr_len;
+        slot->num_sub = 0;
+        slot->frame = *tx_frame;
+        slot->frame.mpdu = slot->mpdu;
+        slot->frame.len_no_crc = mhr_len;
+        slot->state = AGGR_COLLECTING;
+        pal_get_current_time(&slot->start_time);
+        collecting[trx_id] = slot;
+
+        pal_timer_start(TAL_T_AGGR, trx_id, TAL_AGGR_DELAY_BUDGET_US,
+                        TIMEOUT_RELATIVE, (FUNC_PTR())aggr_timer_cb, NULL);
+    }
+
+    add_sub_frame(slot, tx_frame);
+
+    /* Send without waiting if no further sub-frame can be added. */
+    uint16_t space = tal_pib[trx_id].MaxPHYPacketSize - tal_pib[trx_id].FCSLen -
+                     slot->frame.len_no_crc;
+    if ((slot->num_sub >= TAL_AGGR_MAX_SUBFRAMES) || (space <= AGGR_SUB_HDR_MAX_LEN))
+    {
+        send_slot(trx_id, slot);
+    }
+
+    LEAVE_CRITICAL_REGION();
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Sends the aggregate collected so far without waiting
+ *
+ * @param trx_id Transceiver identifier
+ * @ingroup apiTalApi
+ */
+void tal_aggr_flush(trx_id_t trx_id)
+{
+    ENTER_CRITICAL_REGION();
+    if (collecting[trx_id] != NULL)
+    {
+        send_slot(trx_id, collecting[trx_id]);
+    }
+    LEAVE_CRITICAL_REGION();
+}
+
+
+/**
+ * @brief Handles the expiry of the aggregation delay budget
+ *
+ * Timers cannot be stopped; a timer of an aggregate that has already been
+ * sent finds a younger aggregate or none at all and is ignored.
+ *
+ * @param v Timer parameter carrying the transceiver identifier
+ */
+static void aggr_timer_cb(union sigval v)
+{
+    trx_id_t trx_id = (trx_id_t)v.sival_int;
+    uint32_t now;
+
+    ENTER_CRITICAL_REGION();
+    aggr_slot_t *slot = collecting[trx_id];
+    pal_get_current_time(&now);
+    if ((slot != NULL) && ((now - slot->start_time) >= TAL_AGGR_DELAY_BUDGET_US))
+    {
+        send_slot(trx_id, slot);
+    }
+    LEAVE_CRITICAL_REGION();
+}
+
+
+/**
+ * @brief Reports the result of an aggregate transmission for its sub-frames
+ *
+ * @param trx_id Transceiver identifier
+ * @param status Status of the aggregate transmission
+ * @param frame Frame reported by the TX path
+ *
+ * @return true if the frame was an aggregate, else false
+ */
+bool aggr_tx_done(trx_id_t trx_id, retval_t status, frame_info_t *frame)
+{
+    for (uint8_t i = 0; i < TAL_AGGR_NUM_BUFFERS; i++)
+    {
+        aggr_slot_t *slot = &aggr_slot[trx_id][i];
+        if ((slot->state == AGGR_PENDING) && (frame == &slot->frame))
+        {
+            frame_info_t *sub[TAL_AGGR_MAX_SUBFRAMES];
+            uint8_t num_sub = slot->num_sub;
+
+            /* Release the slot before the upper layer may send again. */
+            memcpy(sub, slot->sub, num_sub * sizeof(frame_info_t *));
+            slot->state = AGGR_FREE;
+
+            for (uint8_t k = 0; k < num_sub; k++)
+            {
+                tal_tx_frame_done_cb(trx_id, status, sub[k]);
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+/**
+ * @brief Splits a received aggregate into its sub-frames
+ *
+ * Each sub-frame is rebuilt with the MHR of the aggregate and its own
+ * sequence number and is processed as a separately received frame.
+ *
+ * @param trx_id Transceiver identifier
+ * @param buf_ptr Buffer containing the received frame
+ *
+ * @return true if the buffer has been consumed, false if it is no aggregate
+ */
+bool aggr_rx_frame(trx_id_t trx_id, buffer_t *buf_ptr)
+{
+    frame_info_t *aggr = (frame_info_t *)BMM_BUFFER_POINTER(buf_ptr);
+
+    if ((aggr->len_no_crc <= PL_POS_FCF_1) || ((aggr->mpdu[PL_POS_FCF_1] & AGGR_FCF_FLAG) == 0))
+    {
+        return false;
+    }
+
+    /* Raw ED value stored behind the LQI */
+    uint8_t ed = aggr->mpdu[aggr->len_no_crc + tal_pib[trx_id].FCSLen + LQI_LEN];
+
+    aggr->mpdu[PL_POS_FCF_1] &= (uint8_t)~AGGR_FCF_FLAG;
+    uint8_t mhr_len = get_mhr_len(aggr);
+    uint16_t pos = mhr_len;
+
+    while ((mhr_len != 0) && ((pos + 2) <= aggr->len_no_crc))
+    {
+        uint8_t seq = aggr->mpdu[pos++];
+        uint16_t payload_len = aggr->mpdu[pos++];
+        if (payload_len & 0x80)
+        {
+            if (pos >= aggr->len_no_crc)
+            {
+                break;
+            }
+            payload_len = ((payload_len & AGGR_SHORT_LEN_MAX) << 8) | aggr->mpdu[pos++];
+        }
+        if ((pos + payload_len) > aggr->len_no_crc)
+        {
+            break;
+        }
+
+        buffer_t *sub_buf = bmm_buffer_alloc(LARGE_BUFFER_SIZE);
+        if (sub_buf == NULL)
+        {
+            aggr_stats[trx_id].rx_dropped++;
+        }
+        else
+        {
+            frame_info_t *sub = (frame_info_t *)BMM_BUFFER_POINTER(sub_buf);
+            uint16_t phy_len = mhr_len + payload_len + tal_pib[trx_id].FCSLen;
+
+            *sub = *aggr;
+            sub->len_no_crc = mhr_len + payload_len;
+            sub->mpdu = (uint8_t *)sub + LARGE_BUFFER_SIZE - phy_len - ED_VAL_LEN - LQI_LEN;
+            memcpy(sub->mpdu, aggr->mpdu, mhr_len);
+            sub->mpdu[PL_POS_SEQ_NUM] = seq;
+            memcpy(&sub->mpdu[mhr_len], &aggr->mpdu[pos], payload_len);
+            /* The FCS has been checked for the aggregate; LQI is scaled again. */
+            memset(&sub->mpdu[sub->len_no_crc], 0, tal_pib[trx_id].FCSLen);
+            sub->mpdu[phy_len + LQI_LEN] = ed;
+
+            aggr_stats[trx_id].deaggregated++;
+            process_incoming_frame(trx_id, sub_buf);
+        }
+        pos += payload_len;
+    }
+
+    if (pos != aggr->len_no_crc)
+    {
+        aggr_stats[trx_id].rx_errors++;
+    }
+
+    bmm_buffer_free(buf_ptr);
+
+    return true;
+}
+
+
+/**
+ * @brief Gets the aggregation statistics
+ *
+ * @param trx_id Transceiver identifier
+ * @param stats Pointer to the statistics to be filled
+ * @ingroup apiTalApi
+ */
+void tal_aggr_get_stats(trx_id_t trx_id, tal_aggr_stats_t *stats)
+{
+    *stats = aggr_stats[trx_id];
+}
+
+
+/**
+ * @brief Releases all aggregates, e.g. after a TAL reset
+ *
+ * @param trx_id Transceiver identifier
+ */
+void reset_aggregation(trx_id_t trx_id)
+{
+    for (uint8_t i = 0; i < TAL_AGGR_NUM_BUFFERS; i++)
+    {
+        aggr_slot[trx_id][i].state = AGGR_FREE;
+    }
+    collecting[trx_id] = NULL;
+}
+
+#endif /* #ifdef SUPPORT_AGGREGATION */
+
+/* EOF */
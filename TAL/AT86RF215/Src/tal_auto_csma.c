@@ -33,10 +33,24 @@
 
 /* === MACROS ============================================================== */
 
+#ifdef SUPPORT_ADAPTIVE_CSMA
+#define CSMA_MIN_BE(trx_id)         (csma_params[trx_id].min_be)
+#define CSMA_MAX_BE(trx_id)         (csma_params[trx_id].max_be)
+#define CSMA_MAX_BACKOFFS(trx_id)   (csma_params[trx_id].max_backoffs)
+#else
+#define CSMA_MIN_BE(trx_id)         (tal_pib[trx_id].MinBE)
+#define CSMA_MAX_BE(trx_id)         (tal_pib[trx_id].MaxBE)
+#define CSMA_MAX_BACKOFFS(trx_id)   (tal_pib[trx_id].MaxCSMABackoffs)
+#endif
+
 /* === GLOBALS ============================================================= */
 
 static uint8_t NB[NUM_TRX];
 static uint8_t BE[NUM_TRX];
+#ifdef SUPPORT_ADAPTIVE_CSMA
+/** Parameters of the current transaction; see tal_csma_adapt.c */
+static tal_csma_params_t csma_params[NUM_TRX];
+#endif
 
 /* === PROTOTYPES ========================================================== */
 
@@ -59,14 +73,17 @@ static void trigger_cca_meaurement(trx_id_t trx_id);
 void csma_start(trx_id_t trx_id)
 {
     /* Initialize CSMA variables */
+#ifdef SUPPORT_ADAPTIVE_CSMA
+    get_csma_params(trx_id, &csma_params[trx_id]);
+#endif
     NB[trx_id] = 0;
-    BE[trx_id] = tal_pib[trx_id].MinBE;
+    BE[trx_id] = CSMA_MIN_BE(trx_id);
 
     if (BE[trx_id] == 0)
     {
         /* Collision avoidance is disabled during first iteration */
 #ifdef SUPPORT_MODE_SWITCH
-        if (tal_pib[trx_id].ModeSwitchEnabled)
+        if (ms_tx[trx_id])
         {
             tx_ms_ppdu(trx_id);
         }
@@ -93,7 +110,7 @@ static void start_backoff(trx_id_t trx_id)
 {
     /* Start backoff timer to trigger CCA */
     uint8_t backoff_8;
-    backoff_8  = (uint8_t)(rand() & (((uint16_t)1 << BE[trx_id]) - 1));
+    backoff_8  = (uint8_t)(TAL_RAND(trx_id) & (((uint16_t)1 << BE[trx_id]) - 1));
     if (backoff_8 > 0)
     {
         uint16_t backoff_16;
@@ -133,6 +150,16 @@ static void start_backoff(trx_id_t trx_id)
             {
                 /* Stay in Rx */
             }
+
+#if (TAL_PRELOAD_DURING_BACKOFF == 1)
+#ifdef SUPPORT_MODE_SWITCH
+            if (!ms_tx[trx_id])
+#endif
+            {
+                /* Use the backoff period to fill the frame buffer */
+                preload_tx_frame(trx_id);
+            }
+#endif
         }
     }
     else // no backoff required
@@ -183,7 +210,7 @@ static void cca_start(union sigval v)
         else
         {
 #ifdef SUPPORT_MODE_SWITCH
-            if (tal_pib[trx_id].ModeSwitchEnabled)
+            if (ms_tx[trx_id])
             {
                 trigger_cca_meaurement(trx_id);
             }
@@ -197,7 +224,7 @@ static void cca_start(union sigval v)
     else
     {
 #ifdef SUPPORT_MODE_SWITCH
-        if (tal_pib[trx_id].ModeSwitchEnabled)
+        if (ms_tx[trx_id])
         {
             trigger_cca_meaurement(trx_id);
         }
@@ -266,6 +293,10 @@ void cca_done_handling(trx_id_t trx_id)
     CALC_REG_OFFSET(trx_id);
     pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_BBC0_PC_BBEN), 1);
 
+#ifdef SUPPORT_ADAPTIVE_CCA
+    cca_ctrl_result(trx_id, tal_current_ed_val[trx_id] >= tal_pib[trx_id].CCAThreshold);
+#endif
+
     /* Determine if channel is idle */
     if (tal_current_ed_val[trx_id] < tal_pib[trx_id].CCAThreshold)
     {
@@ -290,20 +321,35 @@ void csma_continue(trx_id_t trx_id)
 {
     NB[trx_id]++;
     
-    if (NB[trx_id] > tal_pib[trx_id].MaxCSMABackoffs)
+    if (NB[trx_id] > CSMA_MAX_BACKOFFS(trx_id))
     {
         tx_done_handling(trx_id, MAC_CHANNEL_ACCESS_FAILURE);
     }
     else
     {
         BE[trx_id]++;
-        if (BE[trx_id] > tal_pib[trx_id].MaxBE)
+        if (BE[trx_id] > CSMA_MAX_BE(trx_id))
         {
-            BE[trx_id] = tal_pib[trx_id].MaxBE;
+            BE[trx_id] = CSMA_MAX_BE(trx_id);
         }
         /* Start backoff timer to trigger CCA */
         start_backoff(trx_id);
     }
 }
 
+
+#ifdef SUPPORT_ADAPTIVE_CSMA
+/**
+ * @brief Gets the number of busy CCAs of the current CSMA attempt
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return Number of busy CCAs
+ */
+uint8_t get_csma_busy_cca(trx_id_t trx_id)
+{
+    return NB[trx_id];
+}
+#endif
+
 /* EOF */
@@ -41,6 +41,11 @@
 
 frame_info_t *rx_frm_info[NUM_TRX];
 
+/**
+ * Additional consumers of received frames
+ */
+static tal_rx_consumer_t rx_consumer[NUM_TRX][TAL_MAX_RX_CONSUMERS];
+
 /* === PROTOTYPES ========================================================== */
 
 static void handle_incoming_frame(trx_id_t trx_id);
@@ -91,6 +96,11 @@ void handle_rx_end_irq(trx_id_t trx_id)
         return;
     }
 
+#ifdef SUPPORT_TSCH
+    /* Synchronize the slot timing to the frame start */
+    tsch_rx_frame(trx_id);
+#endif
+
     if (tx_state[trx_id] == TX_BACKOFF)
     {
         /* Stop backoff timer */
@@ -204,6 +214,8 @@ static void handle_incoming_frame(trx_id_t trx_id)
     if (ack_transmitting[trx_id])
     {
         trx_state[trx_id] = RF_TX; // Sync with trx state; automatic state switch
+        /* The ACK uses the TX frame buffer; a pending frame needs to be downloaded again. */
+        frame_buf_filled[trx_id] = false;
 #ifdef SUPPORT_FSK
         if (tal_pib[trx_id].RPCEnabled && tal_pib[trx_id].phy.modulation == FSK)
         {
@@ -252,10 +264,13 @@ static bool upload_frame(trx_id_t trx_id)
     /* Update payload pointer to store received frame. */
     rx_frm_info[trx_id]->mpdu = (uint8_t *)rx_frm_info[trx_id] + LARGE_BUFFER_SIZE -
                                 phy_frame_len - ED_VAL_LEN - LQI_LEN;
+    /* Received frames are always contiguous */
+    rx_frm_info[trx_id]->iov = NULL;
+    rx_frm_info[trx_id]->iov_cnt = 0;
 
 #ifdef ENABLE_TSTAMP
     /* Store the timestamp. */
-    rx_frm_info[trx_id]->time_stamp = fs_tstamp[trx_id];
+    rx_frm_info[trx_id]->time_stamp = get_frame_tstamp(trx_id);
 #endif
 
     /* Upload received frame to buffer */
@@ -286,9 +301,11 @@ void complete_rx_transaction(trx_id_t trx_id)
     rx_frm_info[trx_id]->mpdu[ed_pos] = ed; // PSDU, LQI, ED
 
     /* Append received frame to incoming_frame_queue and get new rx buffer. */
+    BMM_SET_OWNER(tal_rx_buffer[trx_id], BMM_OWNER_TAL_QUEUE);
     qmm_queue_append(&tal_incoming_frame_queue[trx_id], tal_rx_buffer[trx_id]);
     /* The previous buffer is eaten up and a new buffer is not assigned yet. */
     tal_rx_buffer[trx_id] = bmm_buffer_alloc(LARGE_BUFFER_SIZE);
+    BMM_SET_OWNER(tal_rx_buffer[trx_id], BMM_OWNER_TAL_RX);
     /* Fill trx_id in new buffer */
     if (tal_rx_buffer[trx_id] != NULL)
     {
@@ -312,14 +329,112 @@ void process_incoming_frame(trx_id_t trx_id, buffer_t *buf_ptr)
     frame_info_t *receive_frame = (frame_info_t *)BMM_BUFFER_POINTER(buf_ptr);
     receive_frame->buffer_header = buf_ptr;
 
+#ifdef SUPPORT_AGGREGATION
+    /* Deliver the sub-frames of an aggregate as separate frames */
+    if (aggr_rx_frame(trx_id, buf_ptr))
+    {
+        return;
+    }
+#endif
+#ifdef SUPPORT_BULK_TRANSFER
+    /* Block ACK handling; BAR and BA are not delivered */
+    if (bulk_rx_frame(trx_id, buf_ptr))
+    {
+        return;
+    }
+#endif
+
     /* Scale ED value to a LQI value: 0x00 - 0xFF */
     uint16_t lqi_pos = receive_frame->len_no_crc + tal_pib[trx_id].FCSLen;
     receive_frame->mpdu[lqi_pos] =
         scale_ed_value((int8_t)receive_frame->mpdu[lqi_pos + 1]);
 
+#ifdef SUPPORT_RATE_CONTROL
+    rate_ctrl_rx_frame(trx_id, receive_frame, (int8_t)receive_frame->mpdu[lqi_pos + 1]);
+#endif
+
+    /* Hand the same buffer to all registered consumers. */
+    for (uint8_t i = 0; i < TAL_MAX_RX_CONSUMERS; i++)
+    {
+        if (rx_consumer[trx_id][i] != NULL)
+        {
+            /* Each consumer owns one reference and releases it itself. */
+            if (bmm_buffer_retain(buf_ptr) != NULL)
+            {
+                rx_consumer[trx_id][i](trx_id, receive_frame);
+            }
+        }
+    }
+
     /* The callback function implemented by MAC is invoked. */
+    BMM_SET_OWNER(buf_ptr, BMM_OWNER_APP);
     tal_rx_frame_cb(trx_id, receive_frame);
 
 } /* process_incoming_frame() */
 
+
+/**
+ * @brief Registers an additional consumer for received frames
+ *
+ * @param trx_id Transceiver identifier
+ * @param consumer Consumer callback function
+ *
+ * @return MAC_SUCCESS, MAC_INVALID_PARAMETER or MAC_LIMIT_REACHED
+ */
+retval_t tal_rx_consumer_register(trx_id_t trx_id, tal_rx_consumer_t consumer)
+{
+    if ((trx_id >= NUM_TRX) || (consumer == NULL))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    for (uint8_t i = 0; i < TAL_MAX_RX_CONSUMERS; i++)
+    {
+        if (rx_consumer[trx_id][i] == consumer)
+        {
+            /* Already registered */
+            return MAC_SUCCESS;
+        }
+    }
+
+    for (uint8_t i = 0; i < TAL_MAX_RX_CONSUMERS; i++)
+    {
+        if (rx_consumer[trx_id][i] == NULL)
+        {
+            rx_consumer[trx_id][i] = consumer;
+            return MAC_SUCCESS;
+        }
+    }
+
+    return MAC_LIMIT_REACHED;
+}
+
+
+/**
+ * @brief Removes a previously registered consumer for received frames
+ *
+ * @param trx_id Transceiver identifier
+ * @param consumer Consumer callback function
+ *
+ * @return MAC_SUCCESS or MAC_INVALID_PARAMETER
+ */
+retval_t tal_rx_consumer_unregister(trx_id_t trx_id, tal_rx_consumer_t consumer)
+{
+    if (trx_id >= NUM_TRX)
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    for (uint8_t i = 0; i < TAL_MAX_RX_CONSUMERS; i++)
+    {
+        if ((consumer != NULL) && (rx_consumer[trx_id][i] == consumer))
+        {
+            rx_consumer[trx_id][i] = NULL;
+            return MAC_SUCCESS;
+        }
+    }
+
+    return MAC_INVALID_PARAMETER;
+}
+
 /*  EOF */
@@ -37,6 +37,33 @@
 
 /* === TYPES =============================================================== */
 
+/**
+ * Frame waiting in the TX queue
+ */
+typedef struct tx_queue_entry_tag
+{
+    frame_info_t *frame;
+    csma_mode_t csma_mode;
+    bool perform_frame_retry;
+} tx_queue_entry_t;
+
+/**
+ * Ongoing frame burst, see tal_tx_burst()
+ */
+typedef struct tx_burst_tag
+{
+    /** Frames of the burst; NULL if no burst is ongoing */
+    frame_info_t **frames;
+    /** Number of frames of the burst */
+    uint8_t num_frames;
+    /** Index of the frame currently transmitted */
+    uint8_t current;
+    /** Next frame has already been downloaded to the frame buffer */
+    bool next_preloaded;
+    /** Start time of the burst */
+    uint32_t start_time;
+} tx_burst_t;
+
 /* === MACROS ============================================================== */
 
 /* === GLOBALS ============================================================= */
@@ -47,10 +74,34 @@ static bool ack_requested[NUM_TRX];
 /* Last frame length for IFS handling. */
 uint16_t last_txframe_length[NUM_TRX];
 bool frame_buf_filled[NUM_TRX];
+/* Frames accepted by tal_tx_enqueue() while TAL was busy */
+static tx_queue_entry_t tx_queue[NUM_TRX][TAL_TX_QUEUE_LEN];
+static uint8_t tx_queue_head[NUM_TRX];
+static uint8_t tx_queue_cnt[NUM_TRX];
+static tal_tx_queue_stats_t tx_queue_stats[NUM_TRX];
+static tal_tx_stats_t tx_stats[NUM_TRX];
+static tx_burst_t tx_burst[NUM_TRX];
+static tal_tx_burst_stats_t burst_stats[NUM_TRX];
+/* Start time of the current transaction for the goodput statistics */
+static uint32_t tx_start_time[NUM_TRX];
 
 /* === PROTOTYPES ========================================================== */
 
 static void handle_ifs(trx_id_t trx_id);
+static retval_t check_tx_frame(trx_id_t trx_id, frame_info_t *tx_frame,
+                               csma_mode_t csma_mode);
+static void setup_tx_transaction(trx_id_t trx_id, frame_info_t *tx_frame,
+                                 csma_mode_t csma_mode, bool perform_frame_retry,
+                                 bool preloaded);
+static void start_tx_transaction(trx_id_t trx_id, frame_info_t *tx_frame,
+                                 csma_mode_t csma_mode, bool perform_frame_retry,
+                                 bool preloaded);
+static void write_frame_length(trx_id_t trx_id, frame_info_t *frm);
+static void download_mpdu(trx_id_t trx_id, frame_info_t *frm, uint16_t from, uint16_t to);
+static void preload_burst_frame(trx_id_t trx_id);
+static bool continue_burst(trx_id_t trx_id, retval_t status);
+static void report_tx_done(trx_id_t trx_id, retval_t status, frame_info_t *frame);
+static uint8_t end_burst(trx_id_t trx_id, retval_t status, frame_info_t ***pending);
 #ifdef MEASURE_TIME_OF_FLIGHT
 #   ifdef SUPPORT_LEGACY_OQPSK
 static uint32_t calc_tof(trx_id_t trx_id);
@@ -96,19 +147,32 @@ retval_t tal_tx_frame(trx_id_t trx_id,
         return TAL_BUSY;
     }
 
-    if ((csma_mode == CSMA_SLOTTED) || (tx_frame == NULL))
+    if (check_tx_frame(trx_id, tx_frame, csma_mode) != MAC_SUCCESS)
     {
         return MAC_INVALID_PARAMETER;
     }
 
-    /*
-     * In case the frame is too large, return immediately indicating
-     * invalid status.
-     */
-    if ((tx_frame->len_no_crc + tal_pib[trx_id].FCSLen) > tal_pib[trx_id].MaxPHYPacketSize)
-    {
-        return MAC_INVALID_PARAMETER;
-    }
+    start_tx_transaction(trx_id, tx_frame, csma_mode, perform_frame_retry, false);
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Sets up the transaction for a checked frame
+ *
+ * @param trx_id Transceiver identifier
+ * @param tx_frame Pointer to the frame_info_t structure
+ * @param csma_mode Mode of csma-ca to be performed for this frame
+ * @param perform_frame_retry Indicates whether retries are to be performed
+ * @param preloaded true if the frame has already been downloaded to the
+ *                  frame buffer
+ */
+static void setup_tx_transaction(trx_id_t trx_id, frame_info_t *tx_frame,
+                                 csma_mode_t csma_mode, bool perform_frame_retry,
+                                 bool preloaded)
+{
+    pal_get_current_time(&tx_start_time[trx_id]);
 
     /*
      * Store the pointer to the provided frame structure.
@@ -130,7 +194,7 @@ retval_t tal_tx_frame(trx_id_t trx_id,
     }
 
     tal_state[trx_id] = TAL_TX;
-    frame_buf_filled[trx_id] = false;
+    frame_buf_filled[trx_id] = preloaded;
     global_csma_mode[trx_id] = csma_mode;
     tal_pib[trx_id].NumRxFramesDuringBackoff = 0;
 
@@ -146,12 +210,42 @@ retval_t tal_tx_frame(trx_id_t trx_id,
     }
 
 #ifdef SUPPORT_MODE_SWITCH
+    ms_tx[trx_id] = false;
     if (tal_pib[trx_id].ModeSwitchEnabled)
     {
+        ms_tx_mode[trx_id] = tal_pib[trx_id].ModeSwitchNewMode;
+#ifdef SUPPORT_RATE_CONTROL
+        /* Select the rate of the new mode for the destination */
+        rate_ctrl_tx_start(trx_id, tx_frame);
+#endif
         save_current_phy(trx_id);
         set_csm(trx_id);
+        /* Short frames are sent within the CSM directly */
+        ms_tx[trx_id] = use_mode_switch(trx_id, tx_frame);
+        if (ms_tx[trx_id])
+        {
+            prepare_ms_image(trx_id);
+        }
     }
 #endif
+}
+
+
+/**
+ * @brief Starts the transmission of a checked frame
+ *
+ * @param trx_id Transceiver identifier
+ * @param tx_frame Pointer to the frame_info_t structure
+ * @param csma_mode Mode of csma-ca to be performed for this frame
+ * @param perform_frame_retry Indicates whether retries are to be performed
+ * @param preloaded true if the frame has already been downloaded to the
+ *                  frame buffer
+ */
+static void start_tx_transaction(trx_id_t trx_id, frame_info_t *tx_frame,
+                                 csma_mode_t csma_mode, bool perform_frame_retry,
+                                 bool preloaded)
+{
+    setup_tx_transaction(trx_id, tx_frame, csma_mode, perform_frame_retry, preloaded);
 
     if (csma_mode == CSMA_UNSLOTTED)
     {
@@ -163,22 +257,498 @@ retval_t tal_tx_frame(trx_id_t trx_id,
         {
             handle_ifs(trx_id);
         }
+        start_prepared_tx(trx_id);
+    }
+}
+
+
+/**
+ * @brief Prepares a transmission without CSMA-CA and retries
+ *
+ * The frame is downloaded to the frame buffer, so that start_prepared_tx()
+ * needs a single command only. The TAL is busy until the transmission has
+ * been completed.
+ *
+ * @param trx_id Transceiver identifier
+ * @param tx_frame Pointer to the frame_info_t structure
+ *
+ * @return
+ *      - @ref MAC_SUCCESS if the frame has been prepared
+ *      - @ref TAL_BUSY if the TAL is not idle
+ *      - @ref MAC_INVALID_PARAMETER if the frame is invalid
+ */
+retval_t prepare_tx_transaction(trx_id_t trx_id, frame_info_t *tx_frame)
+{
+    if (tal_state[trx_id] != TAL_IDLE)
+    {
+        return TAL_BUSY;
+    }
+
+    if (check_tx_frame(trx_id, tx_frame, NO_CSMA_NO_IFS) != MAC_SUCCESS)
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    setup_tx_transaction(trx_id, tx_frame, NO_CSMA_NO_IFS, false, false);
+
+#ifdef SUPPORT_MODE_SWITCH
+    /* The mode switch PPDU is sent ahead of the frame */
+    if (!ms_tx[trx_id])
+#endif
+    {
+        preload_tx_frame(trx_id);
+    }
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Starts a set up transmission without CCA
+ *
+ * @param trx_id Transceiver identifier
+ */
+void start_prepared_tx(trx_id_t trx_id)
+{
+#ifdef SUPPORT_MODE_SWITCH
+    if (ms_tx[trx_id])
+    {
+        tx_ms_ppdu(trx_id);
+    }
+    else
+#endif
+    {
+        transmit_frame(trx_id, NO_CCA);
+    }
+}
+
+
+/**
+ * @brief Cancels a transmission set up by prepare_tx_transaction()
+ *
+ * The PHY is restored, the trx is switched off and the TAL becomes idle
+ * again. The frame is not reported.
+ *
+ * @param trx_id Transceiver identifier
+ */
+void cancel_prepared_tx(trx_id_t trx_id)
+{
 #ifdef SUPPORT_MODE_SWITCH
-        if (tal_pib[trx_id].ModeSwitchEnabled)
+    if (tal_pib[trx_id].ModeSwitchEnabled)
+    {
+        restore_previous_phy(trx_id);
+    }
+    ms_tx[trx_id] = false;
+#endif
+
+    CALC_REG_OFFSET(trx_id);
+    pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_RF09_CMD), RF_TRXOFF);
+    trx_state[trx_id] = RF_TRXOFF;
+
+    frame_buf_filled[trx_id] = false;
+    tx_state[trx_id] = TX_IDLE;
+    tal_state[trx_id] = TAL_IDLE;
+}
+
+
+/**
+ * @brief Checks a frame provided for transmission
+ *
+ * @param trx_id Transceiver identifier
+ * @param tx_frame Pointer to the frame_info_t structure
+ * @param csma_mode Requested csma-ca mode
+ *
+ * @return MAC_SUCCESS if the frame can be transmitted, else MAC_INVALID_PARAMETER
+ */
+static retval_t check_tx_frame(trx_id_t trx_id, frame_info_t *tx_frame,
+                               csma_mode_t csma_mode)
+{
+    if ((csma_mode == CSMA_SLOTTED) || (tx_frame == NULL))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    /*
+     * In case the frame is too large, return immediately indicating
+     * invalid status.
+     */
+    if ((tx_frame->len_no_crc + tal_pib[trx_id].FCSLen) > tal_pib[trx_id].MaxPHYPacketSize)
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    /* A scattered MPDU has to match the provided length. */
+    if (tx_frame->iov != NULL)
+    {
+        uint16_t iov_len = 0;
+
+        if ((tx_frame->iov_cnt == 0) || (tx_frame->iov_cnt > PAL_TRX_MAX_IOV) ||
+            (tx_frame->iov[0].len < (PL_POS_SEQ_NUM + 1)))
+        {
+            return MAC_INVALID_PARAMETER;
+        }
+        for (uint8_t i = 0; i < tx_frame->iov_cnt; i++)
+        {
+            iov_len += tx_frame->iov[i].len;
+        }
+        if (iov_len != tx_frame->len_no_crc)
+        {
+            return MAC_INVALID_PARAMETER;
+        }
+        /* Header fields (FCF, sequence number) are taken from the first segment. */
+        tx_frame->mpdu = tx_frame->iov[0].base;
+    }
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Requests to TAL to transmit a frame, queueing it if TAL is busy
+ *
+ * @param trx_id Transceiver identifier
+ * @param tx_frame Pointer to the frame_info_t structure updated by the MAC layer
+ * @param csma_mode Indicates mode of csma-ca to be performed for this frame
+ * @param perform_frame_retry Indicates whether to retries are to be performed for
+ *                            this frame
+ *
+ * @return MAC_SUCCESS, MAC_TRANSACTION_OVERFLOW, TAL_TRX_ASLEEP or
+ *         MAC_INVALID_PARAMETER
+ * @ingroup apiTalApi
+ */
+retval_t tal_tx_enqueue(trx_id_t trx_id,
+                        frame_info_t *tx_frame,
+                        csma_mode_t csma_mode,
+                        bool perform_frame_retry)
+{
+    ASSERT((trx_id >= 0) && (trx_id < NUM_TRX));
+
+    if (tal_state[trx_id] == TAL_SLEEP)
+    {
+        return TAL_TRX_ASLEEP;
+    }
+
+    /* Check the frame now, so that it can be started without delay later. */
+    if (check_tx_frame(trx_id, tx_frame, csma_mode) != MAC_SUCCESS)
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    ENTER_CRITICAL_REGION();
+
+    if ((tal_state[trx_id] == TAL_IDLE) && (tx_queue_cnt[trx_id] == 0))
+    {
+        LEAVE_CRITICAL_REGION();
+        retval_t status = tal_tx_frame(trx_id, tx_frame, csma_mode, perform_frame_retry);
+        if (status == MAC_SUCCESS)
+        {
+            tx_queue_stats[trx_id].enqueued++;
+        }
+        return status;
+    }
+
+    if (tx_queue_cnt[trx_id] >= TAL_TX_QUEUE_LEN)
+    {
+        tx_queue_stats[trx_id].overflows++;
+        LEAVE_CRITICAL_REGION();
+        return MAC_TRANSACTION_OVERFLOW;
+    }
+
+    uint8_t pos = (tx_queue_head[trx_id] + tx_queue_cnt[trx_id]) % TAL_TX_QUEUE_LEN;
+    tx_queue[trx_id][pos].frame = tx_frame;
+    tx_queue[trx_id][pos].csma_mode = csma_mode;
+    tx_queue[trx_id][pos].perform_frame_retry = perform_frame_retry;
+    tx_queue_cnt[trx_id]++;
+
+    tx_queue_stats[trx_id].enqueued++;
+    if (tx_queue_cnt[trx_id] > tx_queue_stats[trx_id].max_depth)
+    {
+        tx_queue_stats[trx_id].max_depth = tx_queue_cnt[trx_id];
+    }
+
+    LEAVE_CRITICAL_REGION();
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Gets the TX queue statistics
+ *
+ * @param trx_id Transceiver identifier
+ * @param stats Pointer to the statistics to be filled
+ * @ingroup apiTalApi
+ */
+void tal_tx_queue_get_stats(trx_id_t trx_id, tal_tx_queue_stats_t *stats)
+{
+    *stats = tx_queue_stats[trx_id];
+}
+
+
+/**
+ * @brief Starts the next queued frame if TAL is idle
+ *
+ * Called wherever the TAL returns to TAL_IDLE, so that frames queued
+ * during an ED scan, a channel switch, a sweep or a TSCH run do not wait
+ * for the next transmission to complete.
+ *
+ * @param trx_id Transceiver identifier
+ */
+void start_next_queued_frame(trx_id_t trx_id)
+{
+    while ((tal_state[trx_id] == TAL_IDLE) && (tx_queue_cnt[trx_id] > 0))
+    {
+        tx_queue_entry_t entry = tx_queue[trx_id][tx_queue_head[trx_id]];
+        tx_queue_head[trx_id] = (tx_queue_head[trx_id] + 1) % TAL_TX_QUEUE_LEN;
+        tx_queue_cnt[trx_id]--;
+
+        retval_t status = tal_tx_frame(trx_id, entry.frame, entry.csma_mode,
+                                       entry.perform_frame_retry);
+        if (status == MAC_SUCCESS)
         {
-            tx_ms_ppdu(trx_id);
+            tx_queue_stats[trx_id].pipelined++;
         }
         else
+        {
+            /* Report the frame that could not be started and try the next one. */
+            report_tx_done(trx_id, status, entry.frame);
+        }
+    }
+}
+
+
+/**
+ * @brief Gets the transmission statistics
+ *
+ * @param trx_id Transceiver identifier
+ * @param stats Pointer to the statistics to be filled
+ * @ingroup apiTalApi
+ */
+void tal_tx_get_stats(trx_id_t trx_id, tal_tx_stats_t *stats)
+{
+    *stats = tx_stats[trx_id];
+}
+
+
+/**
+ * @brief Requests to TAL to transmit a burst of frames
+ *
+ * CSMA-CA is performed for the first frame only. The following frames are
+ * separated by SIFS/LIFS only (NO_CSMA_WITH_IFS). Each frame is downloaded to
+ * the frame buffer while the ACK of the previous frame is awaited. No frame
+ * retries are performed; the burst stops at the first frame that is not
+ * acknowledged.
+ *
+ * tal_tx_frame_done_cb() is called for each frame. Frames that have not been
+ * transmitted due to an earlier failure are reported with
+ * MAC_TRANSACTION_EXPIRED. The frame array has to be valid until the last
+ * callback of the burst.
+ *
+ * @param trx_id Transceiver identifier
+ * @param frames Array of frames to be transmitted
+ * @param num_frames Number of frames in the array
+ *
+ * @return
+ *      - @ref MAC_SUCCESS if the burst has been started
+ *      - @ref TAL_BUSY if the TAL is busy servicing the previous MAC request
+ *      - @ref TAL_TRX_ASLEEP if the device is in sleep mode
+ *      - @ref MAC_INVALID_PARAMETER if a provided parameter or frame is invalid
+ * @ingroup apiTalApi
+ */
+retval_t tal_tx_burst(trx_id_t trx_id, frame_info_t **frames, uint8_t num_frames)
+{
+    ASSERT((trx_id >= 0) && (trx_id < NUM_TRX));
+
+    if (tal_state[trx_id] == TAL_SLEEP)
+    {
+        return TAL_TRX_ASLEEP;
+    }
+
+    if (tal_state[trx_id] != TAL_IDLE)
+    {
+        return TAL_BUSY;
+    }
+
+    if ((frames == NULL) || (num_frames == 0))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+#ifdef SUPPORT_MODE_SWITCH
+    /* The mode switch PPDU uses the frame buffer between the frames. */
+    if (tal_pib[trx_id].ModeSwitchEnabled)
+    {
+        return MAC_INVALID_PARAMETER;
+    }
 #endif
+
+    for (uint8_t i = 0; i < num_frames; i++)
+    {
+        if (check_tx_frame(trx_id, frames[i], CSMA_UNSLOTTED) != MAC_SUCCESS)
         {
-            transmit_frame(trx_id, NO_CCA);
+            return MAC_INVALID_PARAMETER;
         }
     }
 
+    tx_burst[trx_id].frames = frames;
+    tx_burst[trx_id].num_frames = num_frames;
+    tx_burst[trx_id].current = 0;
+    tx_burst[trx_id].next_preloaded = false;
+    pal_get_current_time(&tx_burst[trx_id].start_time);
+    burst_stats[trx_id].bursts++;
+
+    start_tx_transaction(trx_id, frames[0], CSMA_UNSLOTTED, false, false);
+
     return MAC_SUCCESS;
 }
 
 
+/**
+ * @brief Gets the burst and goodput statistics
+ *
+ * @param trx_id Transceiver identifier
+ * @param stats Pointer to the statistics to be filled
+ * @ingroup apiTalApi
+ */
+void tal_tx_burst_get_stats(trx_id_t trx_id, tal_tx_burst_stats_t *stats)
+{
+    *stats = burst_stats[trx_id];
+}
+
+
+/**
+ * @brief Downloads the next frame of the burst to the frame buffer
+ *
+ * This function is called while the ACK of the current frame is awaited
+ * or, if no ACK is requested, right after the transmission.
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void preload_burst_frame(trx_id_t trx_id)
+{
+    tx_burst_t *burst = &tx_burst[trx_id];
+
+    if ((burst->frames == NULL) || burst->next_preloaded ||
+        ((burst->current + 1) >= burst->num_frames))
+    {
+        return;
+    }
+
+    frame_info_t *next = burst->frames[burst->current + 1];
+    write_frame_length(trx_id, next);
+    download_mpdu(trx_id, next, 0, next->len_no_crc);
+
+    CALC_REG_OFFSET(trx_id);
+    pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_BBC0_PC_TXAFCS), 1);
+
+    burst->next_preloaded = true;
+}
+
+
+/**
+ * @brief Continues an ongoing burst with the next frame
+ *
+ * @param trx_id Transceiver identifier
+ * @param status Status of the frame transmitted last
+ *
+ * @return true if the next frame has been started, false if the burst is over
+ */
+static bool continue_burst(trx_id_t trx_id, retval_t status)
+{
+    tx_burst_t *burst = &tx_burst[trx_id];
+    frame_info_t *done_frame = mac_frame_ptr[trx_id];
+
+    if (status == MAC_SUCCESS)
+    {
+        burst_stats[trx_id].burst_frames++;
+        burst_stats[trx_id].burst_bytes += done_frame->len_no_crc;
+    }
+
+    if ((status != MAC_SUCCESS) || ((burst->current + 1) >= burst->num_frames))
+    {
+        return false;
+    }
+
+    preload_burst_frame(trx_id);
+    burst->current++;
+    burst->next_preloaded = false;
+
+    start_tx_transaction(trx_id, burst->frames[burst->current],
+                         NO_CSMA_WITH_IFS, false, true);
+
+    /* Report the previous frame while the next one is on air. */
+    report_tx_done(trx_id, status, done_frame);
+
+    return true;
+}
+
+
+/**
+ * @brief Terminates the ongoing burst
+ *
+ * @param trx_id Transceiver identifier
+ * @param status Status of the frame transmitted last
+ * @param pending Returns the frames that have not been transmitted
+ *
+ * @return Number of frames that have not been transmitted
+ */
+static uint8_t end_burst(trx_id_t trx_id, retval_t status, frame_info_t ***pending)
+{
+    tx_burst_t *burst = &tx_burst[trx_id];
+    uint32_t now;
+
+    pal_get_current_time(&now);
+    burst_stats[trx_id].burst_time_us += now - burst->start_time;
+    if (status != MAC_SUCCESS)
+    {
+        burst_stats[trx_id].aborted++;
+    }
+
+    *pending = &burst->frames[burst->current + 1];
+    uint8_t num_pending = burst->num_frames - (burst->current + 1);
+
+    burst->frames = NULL;
+
+    return num_pending;
+}
+
+
+/**
+ * @brief Drops all frames waiting in the TX queue and an ongoing burst
+ *
+ * The queued frames and the frames of the burst that have not been started
+ * yet, including a frame already downloaded to the frame buffer, are
+ * reported with FAILURE.
+ *
+ * @param trx_id Transceiver identifier
+ */
+void flush_tx_queue(trx_id_t trx_id)
+{
+    tx_burst_t *burst = &tx_burst[trx_id];
+
+    while (tx_queue_cnt[trx_id] > 0)
+    {
+        frame_info_t *frame = tx_queue[trx_id][tx_queue_head[trx_id]].frame;
+        tx_queue_head[trx_id] = (tx_queue_head[trx_id] + 1) % TAL_TX_QUEUE_LEN;
+        tx_queue_cnt[trx_id]--;
+        report_tx_done(trx_id, FAILURE, frame);
+    }
+    tx_queue_head[trx_id] = 0;
+
+    if (burst->frames != NULL)
+    {
+        frame_info_t **frames = burst->frames;
+        uint8_t num_frames = burst->num_frames;
+
+        burst->frames = NULL;
+        for (uint8_t i = burst->current + 1; i < num_frames; i++)
+        {
+            report_tx_done(trx_id, FAILURE, frames[i]);
+        }
+    }
+}
+
+
 /**
  * @brief Transmits frame
  *
@@ -207,17 +777,15 @@ void transmit_frame(trx_id_t trx_id, cca_use_t cca)
     /* Other auto mode settings can be set to 0 */
     pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_BBC0_AMCS), amcs);
 
+    uint16_t len = mac_frame_ptr[trx_id]->len_no_crc;
+    uint16_t preload = len;
     if (frame_buf_filled[trx_id] == false)
     {
-        /* fill length field */
-        uint16_t len = mac_frame_ptr[trx_id]->len_no_crc + tal_pib[trx_id].FCSLen;
-        pal_dev_write(RF215_TRX, GET_REG_ADDR(RG_BBC0_TXFLL), (uint8_t *)&len, 2);
+        write_frame_length(trx_id, mac_frame_ptr[trx_id]);
 
-        /* Store tx frame length to handle IFS next time */
-        last_txframe_length[trx_id] = mac_frame_ptr[trx_id]->len_no_crc;
-
-        /* Disable automatic FCS appending */
-        pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_BBC0_PC_TXAFCS), 0);
+        /* Download as much as needed to stream the rest without underrun */
+        preload = get_tx_preload_len(trx_id, len, cca);
+        download_mpdu(trx_id, mac_frame_ptr[trx_id], 0, preload);
     }
 
     if (cca == WITH_CCA)
@@ -245,19 +813,38 @@ void transmit_frame(trx_id_t trx_id, cca_use_t cca)
     pal_get_current_time(&fs_tstamp[trx_id]);
 #endif
 
-    /* Download frame content during CCA or during preamble transmission */
+    /* Stream remaining frame content during CCA or during preamble transmission */
     if (frame_buf_filled[trx_id] == false)
     {
-        /* fill frame buffer; do not provide FCS values */
-        uint16_t tx_frm_buf_offset = BB_TX_FRM_BUF_OFFSET * trx_id;
-        pal_dev_write(RF215_TRX, tx_frm_buf_offset + RG_BBC0_FBTXS,
-                      (uint8_t *)mac_frame_ptr[trx_id]->mpdu,
-                      mac_frame_ptr[trx_id]->len_no_crc);
+        uint16_t start = preload;
+        bool underrun;
+
+        if (preload < len)
+        {
+            tx_stats[trx_id].streamed++;
+        }
+        do
+        {
+            if (start < len)
+            {
+                uint16_t chunk = len - start;
+                if (chunk > TAL_TX_STREAM_CHUNK)
+                {
+                    chunk = TAL_TX_STREAM_CHUNK;
+                }
+                download_mpdu(trx_id, mac_frame_ptr[trx_id], start, start + chunk);
+                start += chunk;
+                tx_stats[trx_id].chunks++;
+            }
+
+            /* Check if under-run has occurred */
+            underrun = pal_dev_bit_read(RF215_TRX, GET_REG_ADDR(SR_BBC0_PS_TXUR));
+        } while ((start < len) && !underrun);
 
-       /*Check if under-run has occurred */
-        bool underrun = pal_dev_bit_read(RF215_TRX, GET_REG_ADDR(SR_BBC0_PS_TXUR));
         if (underrun)
         {
+            tx_stats[trx_id].underruns++;
+
             /* Abort ongoing transmission */
             pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_RF09_CMD), RF_TRXOFF);
             trx_state[trx_id] = RF_TRXOFF;
@@ -298,6 +885,99 @@ void transmit_frame(trx_id_t trx_id, cca_use_t cca)
 }
 
 
+/**
+ * @brief Writes the frame length and prepares the frame buffer download
+ *
+ * @param trx_id Transceiver identifier
+ * @param frm Frame to be downloaded
+ */
+static void write_frame_length(trx_id_t trx_id, frame_info_t *frm)
+{
+    CALC_REG_OFFSET(trx_id);
+
+    /* fill length field */
+    uint16_t len = frm->len_no_crc + tal_pib[trx_id].FCSLen;
+    pal_dev_write(RF215_TRX, GET_REG_ADDR(RG_BBC0_TXFLL), (uint8_t *)&len, 2);
+
+    /* Disable automatic FCS appending */
+    pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_BBC0_PC_TXAFCS), 0);
+}
+
+
+/**
+ * @brief Downloads a part of the MPDU to the TX frame buffer; FCS is not provided
+ *
+ * @param trx_id Transceiver identifier
+ * @param frm Frame to be downloaded
+ * @param from Offset of the first MPDU byte to be downloaded
+ * @param to Offset behind the last MPDU byte to be downloaded
+ */
+static void download_mpdu(trx_id_t trx_id, frame_info_t *frm, uint16_t from, uint16_t to)
+{
+    uint16_t addr = (BB_TX_FRM_BUF_OFFSET * trx_id) + RG_BBC0_FBTXS + from;
+
+    if (from >= to)
+    {
+        return;
+    }
+
+    if (frm->iov != NULL)
+    {
+        /* Scattered MPDU: all affected segments within a single SPI access */
+        pal_iov_t seg[PAL_TRX_MAX_IOV];
+        uint8_t seg_cnt = 0;
+        uint16_t seg_start = 0;
+
+        for (uint8_t i = 0; i < frm->iov_cnt; i++)
+        {
+            uint16_t seg_end = seg_start + frm->iov[i].len;
+            if ((seg_end > from) && (seg_start < to))
+            {
+                uint16_t s = (from > seg_start) ? from : seg_start;
+                uint16_t e = (to < seg_end) ? to : seg_end;
+                seg[seg_cnt].base = frm->iov[i].base + (s - seg_start);
+                seg[seg_cnt].len = e - s;
+                seg_cnt++;
+            }
+            seg_start = seg_end;
+        }
+        pal_dev_writev(RF215_TRX, addr, seg, seg_cnt);
+    }
+    else
+    {
+        pal_dev_write(RF215_TRX, addr, (uint8_t *)frm->mpdu + from, to - from);
+    }
+}
+
+
+/**
+ * @brief Fills the TX frame buffer ahead of the transmission
+ *
+ * This function is called while the backoff timer is running. The frame
+ * buffer is filled completely, so that the CCA or transmission needs a single
+ * command only and no underrun can occur.
+ *
+ * @param trx_id Transceiver identifier
+ */
+void preload_tx_frame(trx_id_t trx_id)
+{
+    if (frame_buf_filled[trx_id])
+    {
+        return;
+    }
+
+    write_frame_length(trx_id, mac_frame_ptr[trx_id]);
+    download_mpdu(trx_id, mac_frame_ptr[trx_id], 0, mac_frame_ptr[trx_id]->len_no_crc);
+
+    /* Enable automatic FCS appending for the frame and ACK transmissions */
+    CALC_REG_OFFSET(trx_id);
+    pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_BBC0_PC_TXAFCS), 1);
+
+    frame_buf_filled[trx_id] = true;
+    tx_stats[trx_id].preloads++;
+}
+
+
 /**
  * @brief Handles interrupts issued due to end of transmission
  *
@@ -319,6 +999,9 @@ void handle_tx_end_irq(trx_id_t trx_id)
                 /* Check channel */
                 CALC_REG_OFFSET(trx_id);
                 uint8_t ccaed = pal_dev_bit_read(RF215_TRX, GET_REG_ADDR(SR_BBC0_AMCS_CCAED));
+#ifdef SUPPORT_ADAPTIVE_CCA
+                cca_ctrl_result(trx_id, ccaed != BB_CH_CLEAR);
+#endif
                 if (ccaed == BB_CH_CLEAR)
                 {
                     
@@ -378,10 +1061,13 @@ void handle_tx_end_irq(trx_id_t trx_id)
             break;
     }
 
+    /* Store tx frame length to handle IFS next time */
+    last_txframe_length[trx_id] = mac_frame_ptr[trx_id]->len_no_crc;
+
     if (ack_requested[trx_id])
     {
 #ifdef SUPPORT_MODE_SWITCH
-        if (tal_pib[trx_id].ModeSwitchEnabled)
+        if (ms_tx[trx_id])
         {
             switch_to_rx(trx_id);
         }
@@ -392,6 +1078,9 @@ void handle_tx_end_irq(trx_id_t trx_id)
             trx_state[trx_id] = RF_RX;
         }
         start_ack_wait_timer(trx_id);
+
+        /* Use the ACK turnaround to download the next frame of a burst */
+        preload_burst_frame(trx_id);
     }
     else // No ACK requested
     {
@@ -412,13 +1101,36 @@ void handle_tx_end_irq(trx_id_t trx_id)
  */
 void tx_done_handling(trx_id_t trx_id, retval_t status)
 {
+#ifdef SUPPORT_ADAPTIVE_CSMA
+    if (global_csma_mode[trx_id] == CSMA_UNSLOTTED)
+    {
+        csma_adapt_attempt_done(trx_id, status, get_csma_busy_cca(trx_id));
+    }
+#endif
+
     if (status == MAC_NO_ACK)
     {
         if (number_of_tx_retries[trx_id] < tal_pib[trx_id].MaxFrameRetries)
         {
             number_of_tx_retries[trx_id]++;
+            tx_stats[trx_id].retries++;
+#ifdef SUPPORT_RATE_CONTROL
+            if (ms_tx[trx_id])
+            {
+                rate_ctrl_tx_retry(trx_id);
+                /* The retry may use another rate of the new mode */
+                prepare_ms_image(trx_id);
+            }
+#endif
             if (global_csma_mode[trx_id] == CSMA_UNSLOTTED)
             {
+#ifdef SUPPORT_MODE_SWITCH
+                if (tal_pib[trx_id].ModeSwitchEnabled)
+                {
+                    /* CCA and mode switch PPDU use the CSM again */
+                    set_csm(trx_id);
+                }
+#endif
                 csma_start(trx_id);
             }
             else
@@ -428,7 +1140,7 @@ void tx_done_handling(trx_id_t trx_id, retval_t status)
                     handle_ifs(trx_id);
                 }
 #ifdef SUPPORT_MODE_SWITCH
-                if (tal_pib[trx_id].ModeSwitchEnabled)
+                if (ms_tx[trx_id])
                 {
                     set_csm(trx_id);
                     tx_ms_ppdu(trx_id);
@@ -447,6 +1159,13 @@ void tx_done_handling(trx_id_t trx_id, retval_t status)
         /* do nothing */
     }
 
+#ifdef SUPPORT_RATE_CONTROL
+    if (ms_tx[trx_id])
+    {
+        rate_ctrl_tx_done(trx_id, status);
+    }
+#endif
+
 #ifdef SUPPORT_MODE_SWITCH
     if (tal_pib[trx_id].ModeSwitchEnabled)
     {
@@ -455,7 +1174,7 @@ void tx_done_handling(trx_id_t trx_id, retval_t status)
 #endif
 
 #ifdef ENABLE_TSTAMP
-    mac_frame_ptr[trx_id]->time_stamp = fs_tstamp[trx_id];
+    mac_frame_ptr[trx_id]->time_stamp = get_frame_tstamp(trx_id);
 #endif
 
 #ifdef MEASURE_TIME_OF_FLIGHT
@@ -481,6 +1200,26 @@ void tx_done_handling(trx_id_t trx_id, retval_t status)
 #   endif  /* SUPPORT_LEGACY_OQPSK */
 #endif  /* #ifdef MEASURE_TIME_OF_FLIGHT */
 
+    frame_info_t **pending = NULL;
+    uint8_t num_pending = 0;
+    if (tx_burst[trx_id].frames != NULL)
+    {
+        if (continue_burst(trx_id, status))
+        {
+            return;
+        }
+        num_pending = end_burst(trx_id, status, &pending);
+    }
+    else if ((status == MAC_SUCCESS) && (global_csma_mode[trx_id] == CSMA_UNSLOTTED))
+    {
+        /* Reference for the burst goodput: a single frame incl. CSMA-CA */
+        uint32_t now;
+        pal_get_current_time(&now);
+        burst_stats[trx_id].single_frames++;
+        burst_stats[trx_id].single_bytes += mac_frame_ptr[trx_id]->len_no_crc;
+        burst_stats[trx_id].single_time_us += now - tx_start_time[trx_id];
+    }
+
     CALC_REG_OFFSET(trx_id);
 
     /* Enable AACK again and disable CCA / TX procedure */
@@ -508,11 +1247,59 @@ void tx_done_handling(trx_id_t trx_id, retval_t status)
     tal_state[trx_id] = TAL_IDLE;
 
     /* Regular handling */
-    tal_tx_frame_done_cb(trx_id, status, mac_frame_ptr[trx_id]);
+    report_tx_done(trx_id, status, mac_frame_ptr[trx_id]);
+
+    /* Frames of an aborted burst */
+    for (uint8_t i = 0; i < num_pending; i++)
+    {
+        report_tx_done(trx_id, MAC_TRANSACTION_EXPIRED, pending[i]);
+    }
+
+    /* Continue with the next queued frame without waiting for the upper layer. */
+    start_next_queued_frame(trx_id);
+
+#ifdef SUPPORT_CH_HOPPING
+    /* Return to the own hop sequence if the TAL is still idle */
+    ch_hop_resync(trx_id);
+#endif
 
 } /* tx_done_handling() */
 
 
+/**
+ * @brief Reports a completed frame to the upper layer
+ *
+ * @param trx_id Transceiver identifier
+ * @param status Status of the transmission
+ * @param frame Completed frame
+ */
+static void report_tx_done(trx_id_t trx_id, retval_t status, frame_info_t *frame)
+{
+#ifdef SUPPORT_BULK_TRANSFER
+    /* Bulk frames are reported once they are block acknowledged */
+    if (bulk_tx_done(trx_id, status, frame))
+    {
+        return;
+    }
+#endif
+#ifdef SUPPORT_AGGREGATION
+    /* Aggregates are reported per sub-frame */
+    if (aggr_tx_done(trx_id, status, frame))
+    {
+        return;
+    }
+#endif
+#ifdef SUPPORT_TSCH
+    /* Frames of the slot schedule are retried in the next TX cell */
+    if (tsch_tx_done(trx_id, status, frame))
+    {
+        return;
+    }
+#endif
+    tal_tx_frame_done_cb(trx_id, status, frame);
+}
+
+
 /**
  * @brief Handles interframe spacing (IFS)
  *
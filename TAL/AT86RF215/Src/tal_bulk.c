@@ -0,0 +1,807 @@
+/**
+ * @file tal_bulk.c
+ *
+ * @brief This file implements the block-acknowledged bulk transfer mode.
+ *
+ * A window of data frames is sent as a burst without ACK requests. A block
+ * ACK request (BAR) command frame follows; the receiver answers with a
+ * block ACK (BA) command frame carrying a bitmap of the received sequence
+ * numbers. Missing frames are retransmitted in the next window.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "pal.h"
+#include "return_val.h"
+#include "tal.h"
+#include "ieee_const.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "stack_config.h"
+#include "bmm.h"
+#include "tal_internal.h"
+#include <signal.h>
+
+#ifdef SUPPORT_BULK_TRANSFER
+
+/* === TYPES =============================================================== */
+
+/** State of the sending side */
+typedef enum bulk_state_tag
+{
+    BULK_IDLE,
+    BULK_SENDING,
+    BULK_WAIT_BA
+} SHORTENUM bulk_state_t;
+
+/**
+ * Ongoing bulk transmission
+ */
+typedef struct bulk_tx_tag
+{
+    bulk_state_t state;
+    frame_info_t **frames;
+    uint8_t num_frames;
+    /** Sequence number of frames[0] */
+    uint8_t seq0;
+    /** Index of the first frame that is not completed */
+    uint8_t base;
+    /** Current window size */
+    uint8_t window;
+    /** Frames of the current round */
+    frame_info_t *round[TAL_BULK_MAX_WINDOW];
+    uint8_t round_idx[TAL_BULK_MAX_WINDOW];
+    uint8_t round_cnt;
+    /** Frames of the current round that are not reported by the TX path yet */
+    uint8_t round_pending;
+    /** Frames of the current round that have actually been transmitted */
+    uint8_t round_sent;
+    /** The round could not be started because TAL was busy */
+    bool round_deferred;
+    /** Consecutive rounds without channel access */
+    uint8_t cca_failures;
+    uint8_t bar_tries;
+    uint32_t bar_time;
+    uint32_t start_time;
+    frame_info_t bar_frame;
+    uint8_t bar_mpdu[TAL_BULK_CTRL_MAX_LEN];
+} bulk_tx_t;
+
+/**
+ * Received sequence numbers of a sending peer
+ */
+typedef struct bulk_peer_tag
+{
+    uint8_t addr[EXT_ADDR_LEN];
+    uint8_t addr_len;
+    /** Received frames of the current block, inside the window of the last BAR */
+    uint8_t seen[256 / 8];
+    /** Received sequence numbers since the last BAR */
+    uint8_t round[256 / 8];
+    /** Start of the window of the last BAR */
+    uint8_t win_start;
+    bool win_valid;
+} bulk_peer_t;
+
+/* === MACROS ============================================================== */
+
+/* Payload positions of BAR and BA, relative to the MHR */
+#define BULK_POS_CMD            (0)
+#define BULK_POS_START          (1)
+#define BULK_POS_SPAN           (2)
+#define BULK_POS_BITMAP         (3)
+
+#define BIT_IS_SET(map, n)      (((map)[(n) >> 3] >> ((n) & 7)) & 1)
+#define SET_BIT(map, n)         ((map)[(n) >> 3] |= (uint8_t)(1 << ((n) & 7)))
+#define CLR_BIT(map, n)         ((map)[(n) >> 3] &= (uint8_t)~(1 << ((n) & 7)))
+
+/* === GLOBALS ============================================================= */
+
+static bulk_tx_t bulk_tx[NUM_TRX];
+/* Number of transmissions per frame of the ongoing bulk transfer */
+static uint8_t bulk_tries[NUM_TRX][UINT8_MAX];
+/* Completed frames of the ongoing bulk transfer */
+static uint8_t bulk_completed[NUM_TRX][(UINT8_MAX + 7) / 8];
+static bulk_peer_t bulk_peer[NUM_TRX][TAL_BULK_MAX_PEERS];
+static uint8_t bulk_peer_next[NUM_TRX];
+static frame_info_t ba_frame[NUM_TRX];
+static uint8_t ba_mpdu[NUM_TRX][TAL_BULK_CTRL_MAX_LEN];
+static bool ba_busy[NUM_TRX];
+static tal_bulk_stats_t bulk_stats[NUM_TRX];
+
+/* === PROTOTYPES ========================================================== */
+
+static uint8_t *frame_mhr(frame_info_t *frm);
+static void start_round(trx_id_t trx_id);
+static void send_bar(trx_id_t trx_id);
+static void handle_block_ack(trx_id_t trx_id, uint8_t *bitmap);
+static void complete_frame(trx_id_t trx_id, uint8_t idx, retval_t status);
+static void finish_bulk(trx_id_t trx_id, retval_t status);
+static bulk_peer_t *get_peer(trx_id_t trx_id, uint8_t *addr, uint8_t addr_len,
+                             bool create);
+static void send_block_ack(trx_id_t trx_id, frame_info_t *bar, mhr_info_t *mhr);
+static void bulk_timer_cb(union sigval v);
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Gets the first MPDU segment of a frame
+ *
+ * @param frm Frame
+ *
+ * @return Pointer to the MHR
+ */
+static uint8_t *frame_mhr(frame_info_t *frm)
+{
+    return (frm->iov != NULL) ? frm->iov[0].base : frm->mpdu;
+}
+
+
+/**
+ * @brief Requests to TAL to transmit frames in bulk transfer mode
+ *
+ * All frames need to be unsecured 2003/2006 data frames to the same unicast
+ * destination. The TAL assigns consecutive sequence numbers starting with
+ * the sequence number of the first frame and clears the ACK request bits.
+ * tal_tx_frame_done_cb() is called for each frame once it has been
+ * acknowledged by a block ACK or has finally failed. The frame array has to
+ * be valid until the last callback.
+ *
+ * @param trx_id Transceiver identifier
+ * @param frames Array of frames to be transmitted
+ * @param num_frames Number of frames in the array
+ *
+ * @return
+ *      - @ref MAC_SUCCESS if the transfer has been started
+ *      - @ref TAL_BUSY if TAL or a previous bulk transfer is busy
+ *      - @ref TAL_TRX_ASLEEP if the device is in sleep mode
+ *      - @ref MAC_INVALID_PARAMETER if a provided parameter or frame is invalid
+ * @ingroup apiTalApi
+ */
+retval_t tal_bulk_tx_start(trx_id_t trx_id, frame_info_t **frames, uint8_t num_frames)
+{
+    ASSERT((trx_id >= 0) && (trx_id < NUM_TRX));
+
+    if (tal_state[trx_id] == TAL_SLEEP)
+    {
+        return TAL_TRX_ASLEEP;
+    }
+
+    if ((tal_state[trx_id] != TAL_IDLE) || (bulk_tx[trx_id].state != BULK_IDLE))
+    {
+        return TAL_BUSY;
+    }
+
+    if ((frames == NULL) || (num_frames == 0))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    mhr_info_t mhr0;
+    uint8_t *mhr_ptr0 = NULL;
+    for (uint8_t i = 0; i < num_frames; i++)
+    {
+        mhr_info_t mhr;
+        frame_info_t *frm = frames[i];
+
+        if ((frm == NULL) || ((frm->iov != NULL) && ((frm->iov_cnt == 0) ||
+                                                     (frm->iov[0].len < (PL_POS_SEQ_NUM + 1)))))
+        {
+            return MAC_INVALID_PARAMETER;
+        }
+
+        uint8_t *mhr_ptr = frame_mhr(frm);
+        uint16_t len = (frm->iov != NULL) ? frm->iov[0].len : frm->len_no_crc;
+        if ((FCF_GET_FRAMETYPE(mhr_ptr[PL_POS_FCF_1]) != FCF_FRAMETYPE_DATA) ||
+            !parse_mhr(mhr_ptr, len, &mhr) || (mhr.dst_addr_len == 0) ||
+            (mhr.src_addr_len == 0))
+        {
+            return MAC_INVALID_PARAMETER;
+        }
+        if (i == 0)
+        {
+            mhr0 = mhr;
+            mhr_ptr0 = mhr_ptr;
+        }
+        else if ((mhr.dst_addr_len != mhr0.dst_addr_len) ||
+                 (memcmp(&mhr_ptr[mhr.dst_addr_pos], &mhr_ptr0[mhr0.dst_addr_pos],
+                         mhr.dst_addr_len) != 0))
+        {
+            return MAC_INVALID_PARAMETER;
+        }
+    }
+    /* Broadcast frames are not acknowledged */
+    if ((mhr0.dst_addr_len == SHORT_ADDR_LEN) &&
+        (mhr_ptr0[mhr0.dst_addr_pos] == 0xFF) && (mhr_ptr0[mhr0.dst_addr_pos + 1] == 0xFF))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    bulk_tx_t *bulk = &bulk_tx[trx_id];
+    bulk->frames = frames;
+    bulk->num_frames = num_frames;
+    bulk->seq0 = mhr_ptr0[PL_POS_SEQ_NUM];
+    bulk->base = 0;
+    if ((bulk->window == 0) || (bulk->window > TAL_BULK_MAX_WINDOW))
+    {
+        bulk->window = TAL_BULK_INIT_WINDOW;
+    }
+    bulk->cca_failures = 0;
+    pal_get_current_time(&bulk->start_time);
+    memset(bulk_tries[trx_id], 0, sizeof(bulk_tries[trx_id]));
+    memset(bulk_completed[trx_id], 0, sizeof(bulk_completed[trx_id]));
+
+    for (uint8_t i = 0; i < num_frames; i++)
+    {
+        uint8_t *mhr_ptr = frame_mhr(frames[i]);
+        mhr_ptr[PL_POS_FCF_1] &= (uint8_t)~FCF_ACK_REQUEST;
+        mhr_ptr[PL_POS_SEQ_NUM] = (uint8_t)(bulk->seq0 + i);
+    }
+
+    /* The BAR uses the addressing of the data frames. */
+    memcpy(bulk->bar_mpdu, mhr_ptr0, mhr0.len);
+    bulk->bar_mpdu[PL_POS_FCF_1] = (bulk->bar_mpdu[PL_POS_FCF_1] & ~FCF_FRAMETYPE_MASK) |
+                                   FCF_FRAMETYPE_MAC_CMD;
+    memset(&bulk->bar_frame, 0, sizeof(frame_info_t));
+    bulk->bar_frame.trx_id = trx_id;
+    bulk->bar_frame.mpdu = bulk->bar_mpdu;
+    bulk->bar_frame.len_no_crc = mhr0.len + BULK_POS_BITMAP;
+
+    bulk_stats[trx_id].transfers++;
+    bulk->state = BULK_SENDING;
+    start_round(trx_id);
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Sends the next window of frames that are not completed
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void start_round(trx_id_t trx_id)
+{
+    bulk_tx_t *bulk = &bulk_tx[trx_id];
+
+    while ((bulk->base < bulk->num_frames) && BIT_IS_SET(bulk_completed[trx_id], bulk->base))
+    {
+        bulk->base++;
+    }
+    if (bulk->base >= bulk->num_frames)
+    {
+        finish_bulk(trx_id, MAC_SUCCESS);
+        return;
+    }
+
+    /* Select up to window frames; the BA bitmap covers TAL_BULK_MAX_WINDOW frames. */
+    bulk->round_cnt = 0;
+    for (uint8_t i = bulk->base;
+         (i < bulk->num_frames) && ((i - bulk->base) < TAL_BULK_MAX_WINDOW) &&
+         (bulk->round_cnt < bulk->window);
+         i++)
+    {
+        if (!BIT_IS_SET(bulk_completed[trx_id], i))
+        {
+            bulk->round[bulk->round_cnt] = bulk->frames[i];
+            bulk->round_idx[bulk->round_cnt] = i;
+            bulk->round_cnt++;
+        }
+    }
+
+    if (tal_state[trx_id] != TAL_IDLE)
+    {
+        /* Retry as soon as TAL is idle again */
+        bulk->round_deferred = true;
+        pal_timer_start(TAL_T_BULK, trx_id, TAL_BULK_RETRY_DELAY_US,
+                        TIMEOUT_RELATIVE, (FUNC_PTR())bulk_timer_cb, NULL);
+        return;
+    }
+    bulk->round_deferred = false;
+    bulk->round_pending = bulk->round_cnt;
+    bulk->round_sent = 0;
+    bulk->state = BULK_SENDING;
+
+    for (uint8_t i = 0; i < bulk->round_cnt; i++)
+    {
+        bulk_tries[trx_id][bulk->round_idx[i]]++;
+        if (bulk_tries[trx_id][bulk->round_idx[i]] > 1)
+        {
+            bulk_stats[trx_id].retransmissions++;
+        }
+    }
+
+    if (tal_tx_burst(trx_id, bulk->round, bulk->round_cnt) != MAC_SUCCESS)
+    {
+        for (uint8_t i = 0; i < bulk->round_cnt; i++)
+        {
+            complete_frame(trx_id, bulk->round_idx[i], FAILURE);
+        }
+        finish_bulk(trx_id, FAILURE);
+    }
+}
+
+
+/**
+ * @brief Sends the block ACK request for the current round
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void send_bar(trx_id_t trx_id)
+{
+    bulk_tx_t *bulk = &bulk_tx[trx_id];
+    uint8_t *payload = &bulk->bar_mpdu[bulk->bar_frame.len_no_crc - BULK_POS_BITMAP];
+    uint8_t first = bulk->round_idx[0];
+    uint8_t last = bulk->round_idx[bulk->round_cnt - 1];
+
+    bulk->bar_mpdu[PL_POS_SEQ_NUM] = (uint8_t)(bulk->seq0 + last);
+    payload[BULK_POS_CMD] = TAL_BULK_CMD_BAR;
+    payload[BULK_POS_START] = (uint8_t)(bulk->seq0 + first);
+    payload[BULK_POS_SPAN] = (uint8_t)(last - first + 1);
+
+    bulk->state = BULK_WAIT_BA;
+    bulk->bar_tries++;
+    pal_get_current_time(&bulk->bar_time);
+    bulk_stats[trx_id].bars++;
+
+    /* A failed request is repeated by the BA timeout. */
+    tal_tx_frame(trx_id, &bulk->bar_frame, NO_CSMA_WITH_IFS, false);
+    pal_timer_start(TAL_T_BULK, trx_id, TAL_BULK_BA_TIMEOUT_US,
+                    TIMEOUT_RELATIVE, (FUNC_PTR())bulk_timer_cb, NULL);
+}
+
+
+/**
+ * @brief Handles the block ACK bitmap of the current round
+ *
+ * @param trx_id Transceiver identifier
+ * @param bitmap Received bitmap, NULL if no BA has been received
+ */
+static void handle_block_ack(trx_id_t trx_id, uint8_t *bitmap)
+{
+    bulk_tx_t *bulk = &bulk_tx[trx_id];
+    uint8_t first = bulk->round_idx[0];
+    uint8_t lost = 0;
+
+    for (uint8_t i = 0; i < bulk->round_cnt; i++)
+    {
+        uint8_t idx = bulk->round_idx[i];
+        uint8_t bit = idx - first;
+
+        if ((bitmap != NULL) && BIT_IS_SET(bitmap, bit))
+        {
+            bulk_stats[trx_id].bytes_acked += bulk->frames[idx]->len_no_crc;
+            complete_frame(trx_id, idx, MAC_SUCCESS);
+        }
+        else
+        {
+            lost++;
+            if (bulk_tries[trx_id][idx] > tal_pib[trx_id].MaxFrameRetries)
+            {
+                complete_frame(trx_id, idx, MAC_NO_ACK);
+            }
+        }
+    }
+
+    /* Adapt the window to the observed loss */
+    if (lost == 0)
+    {
+        uint16_t window = (uint16_t)bulk->window * 2;
+        bulk->window = (window > TAL_BULK_MAX_WINDOW) ? TAL_BULK_MAX_WINDOW : (uint8_t)window;
+    }
+    else if ((lost * TAL_BULK_LOSS_THRES_DIV) > bulk->round_cnt)
+    {
+        bulk->window = (bulk->window > 1) ? (bulk->window / 2) : 1;
+    }
+
+    start_round(trx_id);
+}
+
+
+/**
+ * @brief Completes a frame of the bulk transfer
+ *
+ * @param trx_id Transceiver identifier
+ * @param idx Frame index
+ * @param status Status reported to the upper layer
+ */
+static void complete_frame(trx_id_t trx_id, uint8_t idx, retval_t status)
+{
+    SET_BIT(bulk_completed[trx_id], idx);
+    if (status != MAC_SUCCESS)
+    {
+        bulk_stats[trx_id].failed++;
+    }
+    tal_tx_frame_done_cb(trx_id, status, bulk_tx[trx_id].frames[idx]);
+}
+
+
+/**
+ * @brief Terminates the bulk transfer
+ *
+ * @param trx_id Transceiver identifier
+ * @param status MAC_SUCCESS, or the status reported for all open frames
+ */
+static void finish_bulk(trx_id_t trx_id, retval_t status)
+{
+    bulk_tx_t *bulk = &bulk_tx[trx_id];
+    uint32_t now;
+
+    bulk->state = BULK_IDLE;
+    pal_get_current_time(&now);
+    bulk_stats[trx_id].time_us += now - bulk->start_time;
+
+    for (uint8_t i = bulk->base; i < bulk->num_frames; i++)
+    {
+        if (!BIT_IS_SET(bulk_completed[trx_id], i))
+        {
+            complete_frame(trx_id, i, status);
+        }
+    }
+    bulk->frames = NULL;
+}
+
+
+/**
+ * @brief Handles the bulk timer
+ *
+ * Timers cannot be stopped; an outdated expiry is detected by the state
+ * and the time of the last BAR.
+ *
+ * @param v Timer parameter carrying the transceiver identifier
+ */
+static void bulk_timer_cb(union sigval v)
+{
+    trx_id_t trx_id = (trx_id_t)v.sival_int;
+    bulk_tx_t *bulk = &bulk_tx[trx_id];
+    uint32_t now;
+
+    ENTER_CRITICAL_REGION();
+    pal_get_current_time(&now);
+    if ((bulk->state == BULK_SENDING) && bulk->round_deferred)
+    {
+        start_round(trx_id);
+    }
+    else if ((bulk->state == BULK_WAIT_BA) &&
+             ((now - bulk->bar_time) >= TAL_BULK_BA_TIMEOUT_US))
+    {
+        bulk_stats[trx_id].ba_timeouts++;
+        if ((bulk->bar_tries < TAL_BULK_MAX_BAR_TRIES) && (tal_state[trx_id] == TAL_IDLE))
+        {
+            send_bar(trx_id);
+        }
+        else
+        {
+            handle_block_ack(trx_id, NULL);
+        }
+    }
+    LEAVE_CRITICAL_REGION();
+}
+
+
+/**
+ * @brief Handles the completion of frames sent by the bulk transfer
+ *
+ * @param trx_id Transceiver identifier
+ * @param status Status of the transmission
+ * @param frame Completed frame
+ *
+ * @return true if the frame belongs to the bulk transfer mode
+ */
+bool bulk_tx_done(trx_id_t trx_id, retval_t status, frame_info_t *frame)
+{
+    bulk_tx_t *bulk = &bulk_tx[trx_id];
+
+    if (frame == &ba_frame[trx_id])
+    {
+        ba_busy[trx_id] = false;
+        return true;
+    }
+    if (frame == &bulk->bar_frame)
+    {
+        return true;
+    }
+    if ((bulk->state != BULK_SENDING) || (bulk->round_pending == 0))
+    {
+        return false;
+    }
+
+    bool in_round = false;
+    for (uint8_t i = 0; i < bulk->round_cnt; i++)
+    {
+        if (bulk->round[i] == frame)
+        {
+            in_round = true;
+            break;
+        }
+    }
+    if (!in_round)
+    {
+        return false;
+    }
+
+    if ((status == MAC_SUCCESS) || (status == TAL_FRAME_PENDING))
+    {
+        bulk->round_sent++;
+        bulk_stats[trx_id].frames_sent++;
+    }
+
+    if (--bulk->round_pending == 0)
+    {
+        if (bulk->round_sent > 0)
+        {
+            bulk->cca_failures = 0;
+            bulk->bar_tries = 0;
+            send_bar(trx_id);
+        }
+        else
+        {
+            /* Nothing has been sent; do not count this round as a try. */
+            for (uint8_t i = 0; i < bulk->round_cnt; i++)
+            {
+                bulk_tries[trx_id][bulk->round_idx[i]]--;
+            }
+            if (++bulk->cca_failures > tal_pib[trx_id].MaxFrameRetries)
+            {
+                finish_bulk(trx_id, status);
+            }
+            else
+            {
+                start_round(trx_id);
+            }
+        }
+    }
+
+    return true;
+}
+
+
+/**
+ * @brief Gets the receive state of a peer
+ *
+ * @param trx_id Transceiver identifier
+ * @param addr Source address of the peer
+ * @param addr_len Length of the address
+ * @param create Replace the oldest entry if the peer is unknown
+ *
+ * @return Peer entry or NULL
+ */
+static bulk_peer_t *get_peer(trx_id_t trx_id, uint8_t *addr, uint8_t addr_len,
+                             bool create)
+{
+    for (uint8_t i = 0; i < TAL_BULK_MAX_PEERS; i++)
+    {
+        bulk_peer_t *peer = &bulk_peer[trx_id][i];
+        if ((peer->addr_len == addr_len) && (memcmp(peer->addr, addr, addr_len) == 0))
+        {
+            return peer;
+        }
+    }
+
+    if (!create)
+    {
+        return NULL;
+    }
+
+    bulk_peer_t *peer = &bulk_peer[trx_id][bulk_peer_next[trx_id]];
+    bulk_peer_next[trx_id] = (bulk_peer_next[trx_id] + 1) % TAL_BULK_MAX_PEERS;
+    memset(peer, 0, sizeof(bulk_peer_t));
+    memcpy(peer->addr, addr, addr_len);
+    peer->addr_len = addr_len;
+
+    return peer;
+}
+
+
+/**
+ * @brief Answers a block ACK request
+ *
+ * The sender's window start only advances within the window; a BAR starting
+ * elsewhere opens a new block and the receive state of the peer is reset.
+ * Sequence numbers received since the last BAR count only if they are
+ * inside the announced window.
+ *
+ * @param trx_id Transceiver identifier
+ * @param bar Received BAR
+ * @param mhr Parsed MHR of the BAR
+ */
+static void send_block_ack(trx_id_t trx_id, frame_info_t *bar, mhr_info_t *mhr)
+{
+    uint8_t *payload = &bar->mpdu[mhr->len];
+    uint8_t start = payload[BULK_POS_START];
+    uint8_t span = payload[BULK_POS_SPAN];
+
+    if ((span == 0) || (span > TAL_BULK_MAX_WINDOW) || ba_busy[trx_id])
+    {
+        return;
+    }
+
+    bulk_peer_t *peer = get_peer(trx_id, &bar->mpdu[mhr->src_addr_pos], mhr->src_addr_len, true);
+    uint8_t *ba = ba_mpdu[trx_id];
+
+    if (!peer->win_valid || ((uint8_t)(start - peer->win_start) > TAL_BULK_MAX_WINDOW))
+    {
+        memset(peer->seen, 0, sizeof(peer->seen));
+    }
+    else
+    {
+        /* Forget the completed frames, so that the numbers can be used again */
+        for (uint16_t i = 1; i <= (256 - TAL_BULK_MAX_WINDOW); i++)
+        {
+            CLR_BIT(peer->seen, (uint8_t)(start - i));
+        }
+    }
+    peer->win_start = start;
+    peer->win_valid = true;
+
+    for (uint8_t i = 0; i < span; i++)
+    {
+        if (BIT_IS_SET(peer->round, (uint8_t)(start + i)))
+        {
+            SET_BIT(peer->seen, (uint8_t)(start + i));
+        }
+    }
+    memset(peer->round, 0, sizeof(peer->round));
+
+    /* MHR of the BAR with swapped addresses */
+    ba[PL_POS_FCF_1] = (bar->mpdu[PL_POS_FCF_1] & ~FCF_ACK_REQUEST);
+    ba[PL_POS_FCF_2] = (bar->mpdu[PL_POS_FCF_2] & ~((0x03 << FCF_2_DEST_ADDR_OFFSET) |
+                                                   (0x03 << FCF_2_SOURCE_ADDR_OFFSET))) |
+                       (((bar->mpdu[PL_POS_FCF_2] >> FCF_2_SOURCE_ADDR_OFFSET) & 0x03) << FCF_2_DEST_ADDR_OFFSET) |
+                       (((bar->mpdu[PL_POS_FCF_2] >> FCF_2_DEST_ADDR_OFFSET) & 0x03) << FCF_2_SOURCE_ADDR_OFFSET);
+    ba[PL_POS_SEQ_NUM] = bar->mpdu[PL_POS_SEQ_NUM];
+
+    uint8_t pos = PL_POS_SEQ_NUM + 1;
+    uint8_t dst_pan_pos = (mhr->src_pan_pos != 0) ? mhr->src_pan_pos : mhr->dst_pan_pos;
+    memcpy(&ba[pos], &bar->mpdu[dst_pan_pos], PAN_ID_LEN);
+    pos += PAN_ID_LEN;
+    memcpy(&ba[pos], &bar->mpdu[mhr->src_addr_pos], mhr->src_addr_len);
+    pos += mhr->src_addr_len;
+    if (mhr->src_pan_pos != 0)
+    {
+        /* No PAN ID compression: own PAN ID follows */
+        memcpy(&ba[pos], &bar->mpdu[mhr->dst_pan_pos], PAN_ID_LEN);
+        pos += PAN_ID_LEN;
+    }
+    memcpy(&ba[pos], &bar->mpdu[mhr->dst_addr_pos], mhr->dst_addr_len);
+    pos += mhr->dst_addr_len;
+
+    ba[pos + BULK_POS_CMD] = TAL_BULK_CMD_BA;
+    ba[pos + BULK_POS_START] = start;
+    ba[pos + BULK_POS_SPAN] = span;
+    uint8_t *bitmap = &ba[pos + BULK_POS_BITMAP];
+    memset(bitmap, 0, (span + 7) / 8);
+    for (uint8_t i = 0; i < span; i++)
+    {
+        if (BIT_IS_SET(peer->seen, (uint8_t)(start + i)))
+        {
+            SET_BIT(bitmap, i);
+        }
+    }
+
+    memset(&ba_frame[trx_id], 0, sizeof(frame_info_t));
+    ba_frame[trx_id].trx_id = trx_id;
+    ba_frame[trx_id].mpdu = ba;
+    ba_frame[trx_id].len_no_crc = pos + BULK_POS_BITMAP + ((span + 7) / 8);
+
+    if (tal_tx_enqueue(trx_id, &ba_frame[trx_id], NO_CSMA_WITH_IFS, false) == MAC_SUCCESS)
+    {
+        ba_busy[trx_id] = true;
+        bulk_stats[trx_id].bas_sent++;
+    }
+}
+
+
+/**
+ * @brief Handles received frames for the bulk transfer mode
+ *
+ * Sequence numbers of unacknowledged data frames are recorded per sender
+ * until the next BAR, see send_block_ack(). BAR and BA command frames are consumed.
+ *
+ * @param trx_id Transceiver identifier
+ * @param buf_ptr Buffer containing the received frame
+ *
+ * @return true if the buffer has been consumed
+ */
+bool bulk_rx_frame(trx_id_t trx_id, buffer_t *buf_ptr)
+{
+    frame_info_t *frm = (frame_info_t *)BMM_BUFFER_POINTER(buf_ptr);
+    uint8_t frame_type = FCF_GET_FRAMETYPE(frm->mpdu[PL_POS_FCF_1]);
+    mhr_info_t mhr;
+
+    if (((frame_type != FCF_FRAMETYPE_DATA) && (frame_type != FCF_FRAMETYPE_MAC_CMD)) ||
+        !parse_mhr(frm->mpdu, frm->len_no_crc, &mhr) || (mhr.src_addr_len == 0) ||
+        (mhr.dst_addr_len == 0))
+    {
+        return false;
+    }
+
+    if (frame_type == FCF_FRAMETYPE_DATA)
+    {
+        if ((frm->mpdu[PL_POS_FCF_1] & FCF_ACK_REQUEST) == 0)
+        {
+            bulk_peer_t *peer = get_peer(trx_id, &frm->mpdu[mhr.src_addr_pos],
+                                         mhr.src_addr_len, true);
+            SET_BIT(peer->round, frm->mpdu[PL_POS_SEQ_NUM]);
+        }
+        return false;
+    }
+
+    uint8_t *payload = &frm->mpdu[mhr.len];
+    if ((frm->len_no_crc < (mhr.len + BULK_POS_BITMAP)) ||
+        ((payload[BULK_POS_CMD] != TAL_BULK_CMD_BAR) && (payload[BULK_POS_CMD] != TAL_BULK_CMD_BA)))
+    {
+        return false;
+    }
+
+    if (payload[BULK_POS_CMD] == TAL_BULK_CMD_BAR)
+    {
+        send_block_ack(trx_id, frm, &mhr);
+    }
+    else
+    {
+        bulk_tx_t *bulk = &bulk_tx[trx_id];
+        uint8_t *bar_mhr = bulk->bar_mpdu;
+        mhr_info_t bar;
+        uint8_t span = payload[BULK_POS_SPAN];
+
+        /* Check that the BA answers the outstanding BAR */
+        if ((bulk->state == BULK_WAIT_BA) &&
+            parse_mhr(bar_mhr, bulk->bar_frame.len_no_crc, &bar) &&
+            (mhr.src_addr_len == bar.dst_addr_len) &&
+            (memcmp(&frm->mpdu[mhr.src_addr_pos], &bar_mhr[bar.dst_addr_pos], bar.dst_addr_len) == 0) &&
+            (payload[BULK_POS_START] == (uint8_t)(bulk->seq0 + bulk->round_idx[0])) &&
+            (frm->len_no_crc >= (mhr.len + BULK_POS_BITMAP + ((span + 7) / 8))))
+        {
+            bulk_stats[trx_id].bas_received++;
+            handle_block_ack(trx_id, &payload[BULK_POS_BITMAP]);
+        }
+    }
+
+    bmm_buffer_free(buf_ptr);
+
+    return true;
+}
+
+
+/**
+ * @brief Gets the bulk transfer statistics
+ *
+ * @param trx_id Transceiver identifier
+ * @param stats Pointer to the statistics to be filled
+ * @ingroup apiTalApi
+ */
+void tal_bulk_get_stats(trx_id_t trx_id, tal_bulk_stats_t *stats)
+{
+    *stats = bulk_stats[trx_id];
+    stats->window = bulk_tx[trx_id].window;
+}
+
+
+/**
+ * @brief Aborts the bulk transfer, e.g. after a TAL reset
+ *
+ * @param trx_id Transceiver identifier
+ */
+void reset_bulk_transfer(trx_id_t trx_id)
+{
+    bulk_tx[trx_id].state = BULK_IDLE;
+    bulk_tx[trx_id].frames = NULL;
+    ba_busy[trx_id] = false;
+}
+
+#endif /* #ifdef SUPPORT_BULK_TRANSFER */
+
+/* EOF */
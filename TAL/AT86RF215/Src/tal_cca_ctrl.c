@@ -0,0 +1,417 @@
+/**
+ * @file tal_cca_ctrl.c
+ *
+ * @brief This file implements the adaptive CCA threshold.
+ *
+ * The noise floor is estimated from energy samples taken while the trx is
+ * idle in RX and from the energy of failed CCA measurements. The samples
+ * are collected in windows of which at most one half are failed CCAs;
+ * failed CCAs alone would drive the threshold up in a channel that is busy
+ * indeed. The lower quartile of a window is robust against frames and
+ * interferers and is averaged exponentially. The CCA threshold (AMEDT)
+ * follows the noise floor plus a margin within the configured bounds; it
+ * is only changed if the difference exceeds the hysteresis.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include "pal.h"
+#include "return_val.h"
+#include "tal.h"
+#include "ieee_const.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include <signal.h>
+
+#ifdef SUPPORT_ADAPTIVE_CCA
+
+/* === MACROS ============================================================== */
+
+/** EDV value of an invalid measurement */
+#define ED_INVALID                  (127)
+
+/** Time in us in addition to the CCA duration a single ED measurement takes */
+#define ED_SINGLE_MARGIN_US         (20)
+
+/* === TYPES =============================================================== */
+
+/**
+ * Controller state of a transceiver
+ */
+typedef struct cca_ctrl_tag
+{
+    bool active;
+    tal_cca_ctrl_cfg_t cfg;
+    /** Threshold last written to AMEDT */
+    int8_t thres;
+    /** Noise floor average in 1/256 dBm */
+    int16_t noise;
+    bool noise_valid;
+    /** Samples of the current window */
+    int8_t window[TAL_CCA_CTRL_WINDOW];
+    uint8_t num_samples;
+    uint8_t num_idle;
+    /** CCA results since the last window */
+    uint16_t win_cca;
+    uint16_t win_busy;
+    /** Ring buffer of threshold changes */
+    tal_cca_ctrl_hist_t hist[TAL_CCA_CTRL_HISTORY];
+    uint8_t hist_next;
+    uint8_t hist_len;
+    tal_cca_ctrl_stats_t stats;
+} cca_ctrl_t;
+
+/* === GLOBALS ============================================================= */
+
+static cca_ctrl_t cca_ctrl[NUM_TRX];
+
+/* === PROTOTYPES ========================================================== */
+
+static void add_sample(trx_id_t trx_id, int8_t ed, bool idle);
+static void close_window(trx_id_t trx_id);
+static void set_threshold(trx_id_t trx_id, int8_t thres);
+static void cca_ctrl_timer_cb(union sigval v);
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Starts the adaptive CCA threshold
+ *
+ * The current threshold is the starting point.
+ *
+ * @param trx_id Transceiver identifier
+ * @param cfg Controller configuration
+ *
+ * @return
+ *      - @ref MAC_SUCCESS if the controller has been started
+ *      - @ref MAC_INVALID_PARAMETER if the configuration is invalid
+ * @ingroup apiTalApi
+ */
+retval_t tal_cca_ctrl_start(trx_id_t trx_id, const tal_cca_ctrl_cfg_t *cfg)
+{
+    cca_ctrl_t *c = &cca_ctrl[trx_id];
+
+    ASSERT((trx_id >= 0) && (trx_id < NUM_TRX));
+
+    if ((cfg == NULL) || (cfg->min_dbm > cfg->max_dbm) || (cfg->hysteresis_db == 0) ||
+        (cfg->sample_interval_ms == 0))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    pal_timer_stop(TAL_T_CCA_CTRL, trx_id);
+
+    memset(c, 0, sizeof(cca_ctrl_t));
+    c->cfg = *cfg;
+    c->thres = tal_pib[trx_id].CCAThreshold;
+    c->stats.thres_dbm = c->thres;
+    c->active = true;
+
+    pal_timer_start(TAL_T_CCA_CTRL, trx_id, (uint32_t)cfg->sample_interval_ms * 1000,
+                    TIMEOUT_RELATIVE, (FUNC_PTR())cca_ctrl_timer_cb, NULL);
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Stops the adaptive CCA threshold
+ *
+ * The threshold is restored to the value given by the PHY.
+ *
+ * @param trx_id Transceiver identifier
+ * @ingroup apiTalApi
+ */
+void tal_cca_ctrl_stop(trx_id_t trx_id)
+{
+    pal_timer_stop(TAL_T_CCA_CTRL, trx_id);
+    if (cca_ctrl[trx_id].active)
+    {
+        cca_ctrl[trx_id].active = false;
+        tal_pib[trx_id].CCAThreshold = get_cca_thres(trx_id);
+        CALC_REG_OFFSET(trx_id);
+        pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_BBC0_AMEDT), tal_pib[trx_id].CCAThreshold);
+    }
+}
+
+
+/**
+ * @brief Gets the adaptive CCA threshold statistics
+ *
+ * @param trx_id Transceiver identifier
+ * @param stats Pointer to the statistics to be filled
+ * @ingroup apiTalApi
+ */
+void tal_cca_ctrl_get_stats(trx_id_t trx_id, tal_cca_ctrl_stats_t *stats)
+{
+    *stats = cca_ctrl[trx_id].stats;
+}
+
+
+/**
+ * @brief Gets the history of threshold changes
+ *
+ * @param trx_id Transceiver identifier
+ * @param hist Storage for the entries; the oldest entry comes first
+ * @param max_entries Number of entries the storage can hold
+ *
+ * @return Number of entries filled
+ * @ingroup apiTalApi
+ */
+uint8_t tal_cca_ctrl_get_history(trx_id_t trx_id, tal_cca_ctrl_hist_t *hist,
+                                 uint8_t max_entries)
+{
+    cca_ctrl_t *c = &cca_ctrl[trx_id];
+    uint8_t n = c->hist_len;
+    uint8_t idx;
+
+    if (n > max_entries)
+    {
+        n = max_entries;
+    }
+
+    /* Newest n entries */
+    idx = (uint8_t)((c->hist_next + TAL_CCA_CTRL_HISTORY - n) % TAL_CCA_CTRL_HISTORY);
+    for (uint8_t i = 0; i < n; i++)
+    {
+        hist[i] = c->hist[idx];
+        idx = (uint8_t)((idx + 1) % TAL_CCA_CTRL_HISTORY);
+    }
+
+    return n;
+}
+
+
+/**
+ * @brief Accounts for the result of a CCA measurement
+ *
+ * Called once the CCA has been completed; the energy of a failed CCA is
+ * still held by EDV.
+ *
+ * @param trx_id Transceiver identifier
+ * @param busy true if the channel has been busy
+ */
+void cca_ctrl_result(trx_id_t trx_id, bool busy)
+{
+    cca_ctrl_t *c = &cca_ctrl[trx_id];
+
+    if (!c->active)
+    {
+        return;
+    }
+
+    c->stats.cca++;
+    c->win_cca++;
+    if (busy)
+    {
+        c->stats.cca_busy++;
+        c->win_busy++;
+
+        CALC_REG_OFFSET(trx_id);
+        int8_t ed = (int8_t)pal_dev_reg_read(RF215_TRX, GET_REG_ADDR(RG_RF09_EDV));
+        if (ed != ED_INVALID)
+        {
+            add_sample(trx_id, ed, false);
+        }
+    }
+}
+
+
+/**
+ * @brief Adds an energy sample to the current window
+ *
+ * @param trx_id Transceiver identifier
+ * @param ed Energy in dBm
+ * @param idle true if the sample has been taken while the trx was idle
+ */
+static void add_sample(trx_id_t trx_id, int8_t ed, bool idle)
+{
+    cca_ctrl_t *c = &cca_ctrl[trx_id];
+
+    if (idle)
+    {
+        c->num_idle++;
+        c->stats.idle_samples++;
+    }
+    else if ((c->num_samples - c->num_idle) < (TAL_CCA_CTRL_WINDOW / 2))
+    {
+        c->stats.cca_samples++;
+    }
+    else
+    {
+        return;
+    }
+    c->window[c->num_samples++] = ed;
+
+    if (c->num_samples >= TAL_CCA_CTRL_WINDOW)
+    {
+        close_window(trx_id);
+    }
+}
+
+
+/**
+ * @brief Updates the noise floor and the threshold from a full window
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void close_window(trx_id_t trx_id)
+{
+    cca_ctrl_t *c = &cca_ctrl[trx_id];
+    int8_t *w = c->window;
+    uint8_t n = c->num_samples;
+
+    c->num_samples = 0;
+    c->num_idle = 0;
+
+    if (c->win_cca > 0)
+    {
+        c->stats.busy_permille = (uint16_t)(((uint32_t)c->win_busy * 1000) / c->win_cca);
+    }
+    c->win_cca = 0;
+    c->win_busy = 0;
+    c->stats.windows++;
+
+    /* Insertion sort; the window is small */
+    for (uint8_t i = 1; i < n; i++)
+    {
+        int8_t v = w[i];
+        uint8_t j = i;
+        while ((j > 0) && (w[j - 1] > v))
+        {
+            w[j] = w[j - 1];
+            j--;
+        }
+        w[j] = v;
+    }
+
+    int16_t quartile = (int16_t)w[n / 4] * 256;
+    if (c->noise_valid)
+    {
+        c->noise = (int16_t)(c->noise + ((quartile - c->noise) >> TAL_CCA_CTRL_EWMA_SHIFT));
+    }
+    else
+    {
+        c->noise = quartile;
+        c->noise_valid = true;
+    }
+    c->stats.noise_dbm = (int8_t)(c->noise / 256);
+
+    int16_t target = c->stats.noise_dbm + c->cfg.margin_db;
+    if (target < c->cfg.min_dbm)
+    {
+        target = c->cfg.min_dbm;
+    }
+    else if (target > c->cfg.max_dbm)
+    {
+        target = c->cfg.max_dbm;
+    }
+
+    if ((target >= (c->thres + c->cfg.hysteresis_db)) ||
+        (target <= (c->thres - c->cfg.hysteresis_db)))
+    {
+        set_threshold(trx_id, (int8_t)target);
+    }
+}
+
+
+/**
+ * @brief Writes a new threshold and records it in the history
+ *
+ * @param trx_id Transceiver identifier
+ * @param thres Threshold in dBm
+ */
+static void set_threshold(trx_id_t trx_id, int8_t thres)
+{
+    cca_ctrl_t *c = &cca_ctrl[trx_id];
+    tal_cca_ctrl_hist_t *h = &c->hist[c->hist_next];
+
+    c->thres = thres;
+    tal_pib[trx_id].CCAThreshold = thres;
+    CALC_REG_OFFSET(trx_id);
+    pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_BBC0_AMEDT), (uint8_t)thres);
+
+    c->stats.thres_dbm = thres;
+    c->stats.changes++;
+
+    pal_get_current_time(&h->time_us);
+    h->thres_dbm = thres;
+    h->noise_dbm = c->stats.noise_dbm;
+    h->busy_permille = c->stats.busy_permille;
+    c->hist_next = (uint8_t)((c->hist_next + 1) % TAL_CCA_CTRL_HISTORY);
+    if (c->hist_len < TAL_CCA_CTRL_HISTORY)
+    {
+        c->hist_len++;
+    }
+}
+
+
+/**
+ * @brief Takes an idle energy sample
+ *
+ * A single ED measurement is started if the trx listens without receiving
+ * a frame.
+ *
+ * @param v Timer parameter; transceiver identifier
+ */
+static void cca_ctrl_timer_cb(union sigval v)
+{
+    trx_id_t trx_id = (trx_id_t)v.sival_int;
+    cca_ctrl_t *c = &cca_ctrl[trx_id];
+
+    ENTER_CRITICAL_REGION();
+    if (!c->active)
+    {
+        LEAVE_CRITICAL_REGION();
+        return;
+    }
+
+    /* The threshold has been set by a PIB write or a PHY change */
+    if (tal_pib[trx_id].CCAThreshold != c->thres)
+    {
+        c->thres = tal_pib[trx_id].CCAThreshold;
+        c->stats.thres_dbm = c->thres;
+        c->num_samples = 0;
+        c->num_idle = 0;
+        c->noise_valid = false;
+        c->stats.restarts++;
+    }
+
+    if ((tal_state[trx_id] == TAL_IDLE) && (tx_state[trx_id] == TX_IDLE) &&
+        !ack_transmitting[trx_id] && (trx_state[trx_id] == RF_RX))
+    {
+        CALC_REG_OFFSET(trx_id);
+        /* The AGC is frozen while a frame is received */
+        if (pal_dev_bit_read(RF215_TRX, GET_REG_ADDR(SR_RF09_AGCC_FRZS)) == 0)
+        {
+            pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_RF09_EDC_EDM), RF_EDSINGLE);
+            pal_timer_delay(tal_pib[trx_id].CCADuration_us + ED_SINGLE_MARGIN_US);
+            int8_t ed = (int8_t)pal_dev_reg_read(RF215_TRX, GET_REG_ADDR(RG_RF09_EDV));
+            pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_RF09_EDC_EDM), RF_EDAUTO);
+            if (ed != ED_INVALID)
+            {
+                add_sample(trx_id, ed, true);
+            }
+        }
+    }
+    LEAVE_CRITICAL_REGION();
+
+    pal_timer_start(TAL_T_CCA_CTRL, trx_id, (uint32_t)c->cfg.sample_interval_ms * 1000,
+                    TIMEOUT_RELATIVE, (FUNC_PTR())cca_ctrl_timer_cb, NULL);
+}
+
+#endif /* #ifdef SUPPORT_ADAPTIVE_CCA */
+
+/* EOF */
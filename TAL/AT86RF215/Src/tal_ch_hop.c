@@ -0,0 +1,644 @@
+/**
+ * @file tal_ch_hop.c
+ *
+ * @brief This file implements unslotted channel hopping.
+ *
+ * The unicast hop sequence of a node is derived from its EUI-64 using the
+ * Wi-SUN DH1CF channel function: the channel of slot n is the
+ * usable channel with the index hashword(n, EUI-64) modulo the number of
+ * usable channels, where hashword() is the lookup3 hash of Bob Jenkins. The
+ * slot advances every dwell interval; a sequence consists of 65536 slots.
+ *
+ * The receiver follows its own sequence driven by the dwell timer. The own
+ * channels are taken from a table that is refilled per block of
+ * TAL_CH_HOP_SEQ_LEN slots. For unicast transmissions the current channel
+ * of the neighbor is computed from its sequence position (UFSI) and the
+ * frame is sent there; the own sequence is resumed afterwards. Channels are
+ * changed using the fast channel switch, see tal_channel_switch().
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include "pal.h"
+#include "return_val.h"
+#include "tal.h"
+#include "ieee_const.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include <signal.h>
+
+#ifdef SUPPORT_CH_HOPPING
+
+/* === TYPES =============================================================== */
+
+/**
+ * Hopping state of a transceiver
+ */
+typedef struct ch_hop_tag
+{
+    bool active;
+    /** DH1CF key words of the own EUI-64 */
+    uint32_t key[2];
+    uint32_t dwell_us;
+    /** Usable channels of the channel plan; index -> channel */
+    uint16_t channels[TAL_CH_HOP_MAX_CHANNELS];
+    uint16_t num_channels;
+    /** Current slot and its start time */
+    uint16_t slot;
+    uint32_t slot_start;
+    /** Own channels of the slots seq_base ... seq_base + TAL_CH_HOP_SEQ_LEN - 1 */
+    uint16_t seq[TAL_CH_HOP_SEQ_LEN];
+    uint16_t seq_base;
+    bool seq_valid;
+    /** A channel switch of the hopping engine is ongoing */
+    bool switching;
+    /** Frame to be sent once the neighbor's channel is reached */
+    frame_info_t *tx_frame;
+    csma_mode_t tx_csma_mode;
+    bool tx_retry;
+    tal_ch_hop_stats_t stats;
+} ch_hop_t;
+
+/* === MACROS ============================================================== */
+
+#define ROT(x, k)               (((x) << (k)) | ((x) >> (32 - (k))))
+
+/* === GLOBALS ============================================================= */
+
+static ch_hop_t ch_hop[NUM_TRX];
+
+/* === PROTOTYPES ========================================================== */
+
+static void get_dh1cf_key(const uint8_t *eui64, uint32_t *key);
+static uint32_t dh1cf_hash(uint16_t slot, const uint32_t *key);
+static void fill_sequence(ch_hop_t *hop, const uint32_t *key, uint16_t first,
+                          uint16_t *ch, uint16_t len);
+static uint16_t get_own_channel(trx_id_t trx_id, uint16_t slot);
+static void update_own_slot(trx_id_t trx_id);
+static bool hop_to_own_channel(trx_id_t trx_id);
+static void ch_hop_timer_cb(union sigval v);
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Starts channel hopping
+ *
+ * The trx follows its own hop sequence starting with slot 0.
+ *
+ * @param trx_id Transceiver identifier
+ * @param cfg Hopping configuration
+ *
+ * @return
+ *      - @ref MAC_SUCCESS if hopping has been started
+ *      - @ref MAC_INVALID_PARAMETER if the configuration is invalid
+ *      - @ref TAL_TRX_ASLEEP if the device is in sleep mode
+ * @ingroup apiTalApi
+ */
+retval_t tal_ch_hop_start(trx_id_t trx_id, const tal_ch_hop_cfg_t *cfg)
+{
+    ch_hop_t *hop = &ch_hop[trx_id];
+
+    ASSERT((trx_id >= 0) && (trx_id < NUM_TRX));
+
+    if (tal_state[trx_id] == TAL_SLEEP)
+    {
+        return TAL_TRX_ASLEEP;
+    }
+
+    if ((cfg == NULL) || (cfg->dwell_ms == 0) || (cfg->num_channels == 0) ||
+        (cfg->num_channels > TAL_CH_HOP_MAX_CHANNELS))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    tal_ch_hop_stop(trx_id);
+
+    hop->num_channels = 0;
+    for (uint16_t i = 0; i < cfg->num_channels; i++)
+    {
+        if ((cfg->excluded == NULL) || !((cfg->excluded[i >> 3] >> (i & 7)) & 1))
+        {
+            hop->channels[hop->num_channels++] = cfg->ch_first + i;
+        }
+    }
+    if (hop->num_channels == 0)
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    get_dh1cf_key(cfg->eui64, hop->key);
+    hop->dwell_us = (uint32_t)cfg->dwell_ms * 1000;
+    hop->seq_valid = false;
+    memset(&hop->stats, 0, sizeof(hop->stats));
+
+    hop->slot = 0;
+    pal_get_current_time(&hop->slot_start);
+    hop->active = true;
+
+    uint32_t delay = hop_to_own_channel(trx_id) ? hop->dwell_us : TAL_CH_HOP_RETRY_US;
+    if (delay > hop->dwell_us)
+    {
+        delay = hop->dwell_us;
+    }
+
+    pal_timer_start(TAL_T_CH_HOP, trx_id, delay,
+                    TIMEOUT_RELATIVE, (FUNC_PTR())ch_hop_timer_cb, NULL);
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Stops channel hopping
+ *
+ * The trx stays on the current channel.
+ *
+ * @param trx_id Transceiver identifier
+ * @ingroup apiTalApi
+ */
+void tal_ch_hop_stop(trx_id_t trx_id)
+{
+    ch_hop[trx_id].active = false;
+    pal_timer_stop(TAL_T_CH_HOP, trx_id);
+}
+
+
+/**
+ * @brief Gets the own unicast fractional sequence interval (UFSI)
+ *
+ * The UFSI is the elapsed fraction of the hop sequence in units of
+ * 1/2^24; it is advertised to the neighbors, e.g. within the UTT-IE.
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return UFSI
+ * @ingroup apiTalApi
+ */
+uint32_t tal_ch_hop_get_ufsi(trx_id_t trx_id)
+{
+    ch_hop_t *hop = &ch_hop[trx_id];
+    uint32_t now;
+
+    if (!hop->active)
+    {
+        return 0;
+    }
+
+    update_own_slot(trx_id);
+    pal_get_current_time(&now);
+
+    /* 2^24 / 65536 slots = 256 units per slot */
+    return ((uint32_t)hop->slot << 8) + (((now - hop->slot_start) << 8) / hop->dwell_us);
+}
+
+
+/**
+ * @brief Initializes the hopping information of a neighbor
+ *
+ * The neighbor uses the own channel plan. Its information has to be
+ * refreshed, e.g. by received frames or tal_ch_hop_nbr_channel(), at least
+ * every 70 minutes.
+ *
+ * @param nbr Neighbor to be initialized
+ * @param eui64 EUI-64 of the neighbor, most significant byte first
+ * @param dwell_ms Unicast dwell interval of the neighbor in ms
+ * @param ufsi UFSI advertised by the neighbor
+ * @param rx_time Time the UFSI has been valid at, e.g. the frame timestamp
+ * @ingroup apiTalApi
+ */
+void tal_ch_hop_nbr_init(tal_ch_hop_nbr_t *nbr, const uint8_t *eui64,
+                         uint8_t dwell_ms, uint32_t ufsi, uint32_t rx_time)
+{
+    get_dh1cf_key(eui64, nbr->key);
+    nbr->dwell_us = (uint32_t)dwell_ms * 1000;
+    nbr->slot = (uint16_t)(ufsi >> 8);
+    nbr->slot_start = rx_time - (((ufsi & 0xFF) * nbr->dwell_us) >> 8);
+}
+
+
+/**
+ * @brief Gets the current channel of a neighbor
+ *
+ * @param trx_id Transceiver identifier
+ * @param nbr Neighbor; its slot reference is advanced to the current slot
+ * @param ch Storage for the channel
+ *
+ * @return MAC_SUCCESS or MAC_INVALID_PARAMETER if hopping is not configured
+ * @ingroup apiTalApi
+ */
+retval_t tal_ch_hop_nbr_channel(trx_id_t trx_id, tal_ch_hop_nbr_t *nbr, uint16_t *ch)
+{
+    ch_hop_t *hop = &ch_hop[trx_id];
+    uint32_t now;
+
+    if ((hop->num_channels == 0) || (nbr->dwell_us == 0))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    pal_get_current_time(&now);
+    uint32_t slots = (now - nbr->slot_start) / nbr->dwell_us;
+    nbr->slot += (uint16_t)slots;
+    nbr->slot_start += slots * nbr->dwell_us;
+
+    fill_sequence(hop, nbr->key, nbr->slot, ch, 1);
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Transmits a frame on the current channel of a neighbor
+ *
+ * The trx switches to the channel of the neighbor and the frame is sent
+ * like with tal_tx_frame(); tal_tx_frame_done_cb() is called. The own hop
+ * sequence is resumed after the transmission.
+ *
+ * @param trx_id Transceiver identifier
+ * @param tx_frame Pointer to the frame_info_t structure
+ * @param csma_mode Indicates mode of csma-ca to be performed for this frame
+ * @param perform_frame_retry Indicates whether to retries are to be performed
+ * @param nbr Destination of the frame
+ *
+ * @return
+ *      - @ref MAC_SUCCESS if the transmission has been started
+ *      - @ref TAL_BUSY if the TAL is not in TAL_IDLE state
+ *      - @ref TAL_TRX_ASLEEP if the device is in sleep mode
+ *      - @ref MAC_INVALID_PARAMETER if hopping is not active or the frame is
+ *             invalid
+ * @ingroup apiTalApi
+ */
+retval_t tal_ch_hop_tx_frame(trx_id_t trx_id, frame_info_t *tx_frame,
+                             csma_mode_t csma_mode, bool perform_frame_retry,
+                             tal_ch_hop_nbr_t *nbr)
+{
+    ch_hop_t *hop = &ch_hop[trx_id];
+    uint16_t ch;
+    retval_t status;
+
+    if (tal_state[trx_id] == TAL_SLEEP)
+    {
+        return TAL_TRX_ASLEEP;
+    }
+
+    if (tal_state[trx_id] != TAL_IDLE)
+    {
+        return TAL_BUSY;
+    }
+
+    if (!hop->active || (tal_ch_hop_nbr_channel(trx_id, nbr, &ch) != MAC_SUCCESS))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    if (ch == tal_pib[trx_id].CurrentChannel)
+    {
+        return tal_tx_frame(trx_id, tx_frame, csma_mode, perform_frame_retry);
+    }
+
+    hop->tx_frame = tx_frame;
+    hop->tx_csma_mode = csma_mode;
+    hop->tx_retry = perform_frame_retry;
+    hop->switching = true;
+    status = tal_channel_switch(trx_id, ch);
+    if (status != MAC_SUCCESS)
+    {
+        hop->tx_frame = NULL;
+        hop->switching = false;
+        return status;
+    }
+    hop->stats.tx_switches++;
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Gets channels of a hop sequence
+ *
+ * The channels are computed using the channel plan of the transceiver.
+ *
+ * @param trx_id Transceiver identifier
+ * @param eui64 EUI-64 of the node the sequence belongs to
+ * @param first First slot
+ * @param ch Storage for the channels
+ * @param len Number of slots
+ *
+ * @return MAC_SUCCESS or MAC_INVALID_PARAMETER if hopping is not configured
+ * @ingroup apiTalApi
+ */
+retval_t tal_ch_hop_get_sequence(trx_id_t trx_id, const uint8_t *eui64,
+                                 uint16_t first, uint16_t *ch, uint16_t len)
+{
+    uint32_t key[2];
+
+    if (ch_hop[trx_id].num_channels == 0)
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    get_dh1cf_key(eui64, key);
+    fill_sequence(&ch_hop[trx_id], key, first, ch, len);
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Gets the channel hopping statistics
+ *
+ * @param trx_id Transceiver identifier
+ * @param stats Pointer to the statistics to be filled
+ * @ingroup apiTalApi
+ */
+void tal_ch_hop_get_stats(trx_id_t trx_id, tal_ch_hop_stats_t *stats)
+{
+    *stats = ch_hop[trx_id].stats;
+    stats->slot = ch_hop[trx_id].slot;
+    stats->channel = tal_pib[trx_id].CurrentChannel;
+}
+
+
+/**
+ * @brief Handles a completed channel switch
+ *
+ * @param trx_id Transceiver identifier
+ * @param status Status of the switch
+ *
+ * @return true if the switch has been initiated by the hopping engine
+ */
+bool ch_hop_switch_done(trx_id_t trx_id, retval_t status)
+{
+    ch_hop_t *hop = &ch_hop[trx_id];
+
+    if (!hop->switching)
+    {
+        return false;
+    }
+    hop->switching = false;
+
+    if (hop->tx_frame != NULL)
+    {
+        frame_info_t *frame = hop->tx_frame;
+        hop->tx_frame = NULL;
+        if (status == MAC_SUCCESS)
+        {
+            status = tal_tx_frame(trx_id, frame, hop->tx_csma_mode, hop->tx_retry);
+        }
+        if (status != MAC_SUCCESS)
+        {
+            tal_tx_frame_done_cb(trx_id, FAILURE, frame);
+            ch_hop_resync(trx_id);
+        }
+    }
+    else if (status == MAC_SUCCESS)
+    {
+        hop->stats.hops++;
+    }
+    else
+    {
+        hop->stats.hops_failed++;
+    }
+
+    return true;
+}
+
+
+/**
+ * @brief Returns to the own hop sequence, e.g. after a transmission
+ *
+ * @param trx_id Transceiver identifier
+ */
+void ch_hop_resync(trx_id_t trx_id)
+{
+    if (ch_hop[trx_id].active && (tal_state[trx_id] == TAL_IDLE))
+    {
+        update_own_slot(trx_id);
+        hop_to_own_channel(trx_id);
+    }
+}
+
+
+/**
+ * @brief Stops channel hopping, e.g. after a TAL reset
+ *
+ * @param trx_id Transceiver identifier
+ */
+void reset_ch_hopping(trx_id_t trx_id)
+{
+    ch_hop[trx_id].active = false;
+    ch_hop[trx_id].switching = false;
+    ch_hop[trx_id].tx_frame = NULL;
+}
+
+
+/**
+ * @brief Gets the DH1CF key words of an EUI-64
+ *
+ * @param eui64 EUI-64, most significant byte first
+ * @param key Storage for the two key words
+ */
+static void get_dh1cf_key(const uint8_t *eui64, uint32_t *key)
+{
+    key[0] = ((uint32_t)eui64[4] << 24) | ((uint32_t)eui64[5] << 16) |
+             ((uint32_t)eui64[6] << 8) | eui64[7];
+    key[1] = ((uint32_t)eui64[0] << 24) | ((uint32_t)eui64[1] << 16) |
+             ((uint32_t)eui64[2] << 8) | eui64[3];
+}
+
+
+/**
+ * @brief DH1CF hash of a slot
+ *
+ * hashword() of lookup3 for the three words slot, key[0], key[1] and an
+ * initial value of 0.
+ *
+ * @param slot Slot number
+ * @param key Key words of the node
+ *
+ * @return Hash value
+ */
+static uint32_t dh1cf_hash(uint16_t slot, const uint32_t *key)
+{
+    uint32_t a = 0xDEADBEEF + (3 << 2) + slot;
+    uint32_t b = 0xDEADBEEF + (3 << 2) + key[0];
+    uint32_t c = 0xDEADBEEF + (3 << 2) + key[1];
+
+    c ^= b; c -= ROT(b, 14);
+    a ^= c; a -= ROT(c, 11);
+    b ^= a; b -= ROT(a, 25);
+    c ^= b; c -= ROT(b, 16);
+    a ^= c; a -= ROT(c, 4);
+    b ^= a; b -= ROT(a, 14);
+    c ^= b; c -= ROT(b, 24);
+
+    return c;
+}
+
+
+/**
+ * @brief Computes the channels of consecutive slots
+ *
+ * @param hop Hopping state providing the channel plan
+ * @param key Key words of the node
+ * @param first First slot
+ * @param ch Storage for the channels
+ * @param len Number of slots
+ */
+static void fill_sequence(ch_hop_t *hop, const uint32_t *key, uint16_t first,
+                          uint16_t *ch, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++)
+    {
+        ch[i] = hop->channels[dh1cf_hash((uint16_t)(first + i), key) % hop->num_channels];
+    }
+}
+
+
+/**
+ * @brief Gets the own channel of a slot from the sequence table
+ *
+ * @param trx_id Transceiver identifier
+ * @param slot Slot number
+ *
+ * @return Channel
+ */
+static uint16_t get_own_channel(trx_id_t trx_id, uint16_t slot)
+{
+    ch_hop_t *hop = &ch_hop[trx_id];
+
+    if (!hop->seq_valid || ((uint16_t)(slot - hop->seq_base) >= TAL_CH_HOP_SEQ_LEN))
+    {
+        uint32_t start;
+        uint32_t now;
+
+        pal_get_current_time(&start);
+        hop->seq_base = slot & (uint16_t)~(TAL_CH_HOP_SEQ_LEN - 1);
+        fill_sequence(hop, hop->key, hop->seq_base, hop->seq, TAL_CH_HOP_SEQ_LEN);
+        hop->seq_valid = true;
+        pal_get_current_time(&now);
+        hop->stats.seq_refills++;
+        hop->stats.seq_refill_us = now - start;
+    }
+
+    return hop->seq[slot - hop->seq_base];
+}
+
+
+/**
+ * @brief Advances the own slot to the current time
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void update_own_slot(trx_id_t trx_id)
+{
+    ch_hop_t *hop = &ch_hop[trx_id];
+    uint32_t now;
+
+    pal_get_current_time(&now);
+    uint32_t slots = (now - hop->slot_start) / hop->dwell_us;
+    hop->slot += (uint16_t)slots;
+    hop->slot_start += slots * hop->dwell_us;
+}
+
+
+/**
+ * @brief Switches to the own channel of the current slot
+ *
+ * If the TAL is busy, the switch is deferred until the ongoing transaction
+ * has been completed. A frame being received or an ACK being sent is not
+ * cut off either; the dwell timer retries the switch shortly.
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return false if the switch has been deferred
+ */
+static bool hop_to_own_channel(trx_id_t trx_id)
+{
+    ch_hop_t *hop = &ch_hop[trx_id];
+    uint16_t ch = get_own_channel(trx_id, hop->slot);
+
+    if (ch == tal_pib[trx_id].CurrentChannel)
+    {
+        return true;
+    }
+
+    if ((tal_state[trx_id] != TAL_IDLE) || ack_transmitting[trx_id] ||
+        (tal_bb_irqs[trx_id] != BB_IRQ_NO_IRQ))
+    {
+        hop->stats.hops_deferred++;
+        return false;
+    }
+
+    if (trx_state[trx_id] == RF_RX)
+    {
+        /* The AGC is frozen while a frame is received */
+        CALC_REG_OFFSET(trx_id);
+        if (pal_dev_bit_read(RF215_TRX, GET_REG_ADDR(SR_RF09_AGCC_FRZS)))
+        {
+            hop->stats.hops_deferred++;
+            return false;
+        }
+    }
+
+    hop->switching = true;
+    if (tal_channel_switch(trx_id, ch) != MAC_SUCCESS)
+    {
+        hop->switching = false;
+        hop->stats.hops_failed++;
+    }
+
+    return true;
+}
+
+
+/**
+ * @brief Handles the end of a dwell interval
+ *
+ * @param v Timer parameter; transceiver identifier
+ */
+static void ch_hop_timer_cb(union sigval v)
+{
+    trx_id_t trx_id = (trx_id_t)v.sival_int;
+    ch_hop_t *hop = &ch_hop[trx_id];
+    uint32_t now;
+
+    ENTER_CRITICAL_REGION();
+    if (hop->active)
+    {
+        update_own_slot(trx_id);
+        bool hopped = hop_to_own_channel(trx_id);
+
+        /* The next slot boundary is derived from the slot start; no drift. */
+        pal_get_current_time(&now);
+        uint32_t remaining = hop->dwell_us - (now - hop->slot_start);
+        if ((remaining == 0) || (remaining > hop->dwell_us))
+        {
+            remaining = 1;
+        }
+        /* A transaction resyncs when done; an RX or ACK is waited for here */
+        if (!hopped && (tal_state[trx_id] == TAL_IDLE) && (remaining > TAL_CH_HOP_RETRY_US))
+        {
+            remaining = TAL_CH_HOP_RETRY_US;
+        }
+        pal_timer_start(TAL_T_CH_HOP, trx_id, remaining,
+                        TIMEOUT_RELATIVE, (FUNC_PTR())ch_hop_timer_cb, NULL);
+    }
+    LEAVE_CRITICAL_REGION();
+}
+
+#endif /* #ifdef SUPPORT_CH_HOPPING */
+
+/* EOF */
@@ -0,0 +1,489 @@
+/**
+ * @file tal_ch_switch.c
+ *
+ * @brief This file implements the fast channel switch.
+ *
+ * The channel registers CS, CCF0L, CCF0H, CNL and CNM are consecutive. The
+ * band dependent values and the valid channel range are computed once per
+ * band; a switch then consists of a single burst write starting at the
+ * command register, i.e. the trx is set to TRXOFF and the channel is
+ * written within one SPI access. The completion is signalled by the TRXRDY
+ * interrupt once the PLL has locked on the new channel.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include "pal.h"
+#include "return_val.h"
+#include "tal.h"
+#include "ieee_const.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include <signal.h>
+
+/* === TYPES =============================================================== */
+
+/**
+ * Channel register values of the current band
+ */
+typedef struct ch_band_tag
+{
+    bool valid;
+    /** Band parameters the values have been computed for */
+    uint32_t freq_f0;
+    uint32_t ch_spacing;
+    /** CS, CCF0L, CCF0H */
+    uint8_t regs[3];
+    uint16_t ch_min;
+    uint16_t ch_max;
+} ch_band_t;
+
+/* === MACROS ============================================================== */
+
+/** Number of consecutive registers from RG_RF09_CS up to RG_RF09_CNM */
+#define CH_REGS_LEN         (RG_RF09_CNM - RG_RF09_CS + 1)
+
+/** Highest channel number supported by CNL / CNM.CNH */
+#define CH_NUMBER_MAX       (0x1FF)
+
+/** RF IRQs enabled outside of a channel switch, see trx_config() */
+#define RF_IRQM_DEFAULT     (RF_IRQ_BATLOW | RF_IRQ_WAKEUP)
+
+/* === GLOBALS ============================================================= */
+
+static ch_band_t ch_band[NUM_TRX];
+static uint32_t ch_switch_start[NUM_TRX];
+/** State to be reached after the PLL has locked */
+static rf_cmd_state_t ch_switch_target[NUM_TRX];
+static tal_ch_switch_stats_t ch_switch_stats[NUM_TRX];
+static uint32_t ch_switch_samples[NUM_TRX][TAL_CH_SWITCH_LAT_SAMPLES];
+static uint8_t ch_switch_sample_idx[NUM_TRX];
+
+/* === PROTOTYPES ========================================================== */
+
+static bool update_ch_band(trx_id_t trx_id);
+static void finish_ch_switch(trx_id_t trx_id, retval_t status);
+static void ch_switch_timer_cb(union sigval v);
+static uint32_t get_percentile(const uint32_t *sorted, uint8_t cnt, uint8_t pct);
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Switches the channel without waiting for the PLL
+ *
+ * @param trx_id Transceiver identifier
+ * @param ch Channel number
+ *
+ * @return MAC_SUCCESS, MAC_INVALID_PARAMETER, TAL_BUSY or TAL_TRX_ASLEEP
+ */
+retval_t tal_channel_switch(trx_id_t trx_id, uint16_t ch)
+{
+    rf_cmd_state_t prev_state = trx_state[trx_id];
+    uint32_t start;
+
+    if (tal_state[trx_id] == TAL_SLEEP)
+    {
+        return TAL_TRX_ASLEEP;
+    }
+
+    if (tal_state[trx_id] != TAL_IDLE)
+    {
+        return TAL_BUSY;
+    }
+
+    pal_get_current_time(&start);
+
+    if (tune_channel(trx_id, ch) != MAC_SUCCESS)
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    ch_switch_start[trx_id] = start;
+    ch_switch_target[trx_id] = prev_state;
+    tal_state[trx_id] = TAL_CH_SWITCH;
+
+    if (prev_state == RF_TRXOFF)
+    {
+        /* The PLL locks when the trx is enabled next time. */
+        finish_ch_switch(trx_id, MAC_SUCCESS);
+        return MAC_SUCCESS;
+    }
+
+    CALC_REG_OFFSET(trx_id);
+
+    /* TRXRDY is issued once TXPREP is reached with the PLL locked. */
+    pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_RF09_IRQM), RF_IRQM_DEFAULT | RF_IRQ_TRXRDY);
+    pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_RF09_CMD), RF_TXPREP);
+
+    pal_timer_start(TAL_T_CH_SWITCH, trx_id, TAL_CH_SWITCH_TIMEOUT_US,
+                    TIMEOUT_RELATIVE, (FUNC_PTR())ch_switch_timer_cb, NULL);
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Gets the channel switch statistics
+ *
+ * The percentiles are derived from the last TAL_CH_SWITCH_LAT_SAMPLES
+ * switches.
+ *
+ * @param trx_id Transceiver identifier
+ * @param stats Pointer to the statistics to be filled
+ */
+void tal_channel_switch_get_stats(trx_id_t trx_id, tal_ch_switch_stats_t *stats)
+{
+    uint32_t sorted[TAL_CH_SWITCH_LAT_SAMPLES];
+    uint8_t cnt = TAL_CH_SWITCH_LAT_SAMPLES;
+
+    *stats = ch_switch_stats[trx_id];
+
+    if (stats->latency.count < TAL_CH_SWITCH_LAT_SAMPLES)
+    {
+        cnt = (uint8_t)stats->latency.count;
+    }
+    if (cnt == 0)
+    {
+        return;
+    }
+
+    /* Insertion sort; the number of samples is small. */
+    for (uint8_t i = 0; i < cnt; i++)
+    {
+        uint32_t val = ch_switch_samples[trx_id][i];
+        uint8_t j = i;
+        while ((j > 0) && (sorted[j - 1] > val))
+        {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = val;
+    }
+
+    stats->p50_us = get_percentile(sorted, cnt, 50);
+    stats->p90_us = get_percentile(sorted, cnt, 90);
+    stats->p99_us = get_percentile(sorted, cnt, 99);
+}
+
+
+/**
+ * @brief Sets the trx to TRXOFF and writes the channel
+ *
+ * The command and the channel registers are written within a single burst;
+ * the PLL locks when the trx is enabled next time.
+ *
+ * @param trx_id Transceiver identifier
+ * @param ch Channel number
+ *
+ * @return MAC_SUCCESS or MAC_INVALID_PARAMETER if the channel is not within
+ *         the band
+ */
+retval_t tune_channel(trx_id_t trx_id, uint16_t ch)
+{
+    uint8_t regs[1 + CH_REGS_LEN];
+
+    if (!update_ch_band(trx_id) ||
+        (ch < ch_band[trx_id].ch_min) || (ch > ch_band[trx_id].ch_max))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    CALC_REG_OFFSET(trx_id);
+
+    if (tal_pib[trx_id].CurrentChannel != ch)
+    {
+        tal_pib[trx_id].CurrentChannel = ch;
+        /* Register images contain the channel */
+        flush_phy_profiles(trx_id);
+#ifdef SUPPORT_MODE_SWITCH
+        flush_ms_images(trx_id);
+#endif
+    }
+
+    /* CMD, CS, CCF0L, CCF0H, CNL, CNM; CNM triggers the frequency update */
+    regs[0] = RF_TRXOFF;
+    get_channel_regs(trx_id, ch, &regs[1]);
+    pal_dev_write(RF215_TRX, GET_REG_ADDR(RG_RF09_CMD), regs, sizeof(regs));
+    trx_state[trx_id] = RF_TRXOFF;
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Gets the channel register values
+ *
+ * @param trx_id Transceiver identifier
+ * @param ch Channel number
+ * @param regs Storage for the values of RG_RF09_CS up to RG_RF09_CNM
+ */
+void get_channel_regs(trx_id_t trx_id, uint16_t ch, uint8_t *regs)
+{
+    update_ch_band(trx_id);
+
+    memcpy(regs, ch_band[trx_id].regs, sizeof(ch_band[trx_id].regs));
+    /* CNM: IEEE compliant channel scheme */
+    regs[3] = (uint8_t)ch;
+    regs[4] = (uint8_t)(ch >> 8);
+}
+
+
+/**
+ * @brief Handles the TRXRDY IRQ during a channel switch
+ *
+ * @param trx_id Transceiver identifier
+ */
+void handle_ch_switch_irq(trx_id_t trx_id)
+{
+    CALC_REG_OFFSET(trx_id);
+
+    if (ch_switch_target[trx_id] == RF_RX)
+    {
+        if (tal_rx_buffer[trx_id] != NULL)
+        {
+            /* RPC settings are kept by the BBC; no need to restart it. */
+            pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_RF09_CMD), RF_RX);
+            trx_state[trx_id] = RF_RX;
+        }
+        else
+        {
+            trx_state[trx_id] = RF_TXPREP;
+            tal_buf_shortage[trx_id] = true;
+        }
+    }
+    else
+    {
+        trx_state[trx_id] = RF_TXPREP;
+    }
+
+    finish_ch_switch(trx_id, MAC_SUCCESS);
+}
+
+
+/**
+ * @brief Aborts an ongoing channel switch, e.g. due to TRXERR
+ *
+ * @param trx_id Transceiver identifier
+ */
+void stop_ch_switch(trx_id_t trx_id)
+{
+    CALC_REG_OFFSET(trx_id);
+
+    pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_RF09_CMD), RF_TRXOFF);
+    trx_state[trx_id] = RF_TRXOFF;
+    ch_switch_stats[trx_id].failures++;
+
+    finish_ch_switch(trx_id, FAILURE);
+}
+
+
+/**
+ * @brief Computes the channel register values and range of the current band
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return true if the band can be used
+ */
+static bool update_ch_band(trx_id_t trx_id)
+{
+    ch_band_t *band = &ch_band[trx_id];
+    uint32_t freq = tal_pib[trx_id].phy.freq_f0;
+    uint32_t spacing = tal_pib[trx_id].phy.ch_spacing;
+
+    if ((band->freq_f0 == freq) && (band->ch_spacing == spacing) &&
+        (band->freq_f0 != 0))
+    {
+        return band->valid;
+    }
+
+    band->freq_f0 = freq;
+    band->ch_spacing = spacing;
+
+    /* Offset handling for 2.4GHz only */
+    uint32_t ccf0 = freq;
+    if (trx_id == RF24)
+    {
+        ccf0 -= 1500000000;
+    }
+    ccf0 /= 25000;
+    band->regs[0] = (uint8_t)(spacing / 25000);
+    band->regs[1] = (uint8_t)ccf0;
+    band->regs[2] = (uint8_t)(ccf0 >> 8);
+
+    band->ch_min = 0;
+    band->ch_max = CH_NUMBER_MAX;
+    band->valid = true;
+
+#ifndef REDUCED_PARAM_CHECK
+    uint32_t lo;
+    uint32_t hi;
+
+    /* Frequency range of the trx, see check_valid_freq_range() */
+    if (trx_id == RF24)
+    {
+        lo = 2400000000;
+        hi = 2483500000;
+    }
+    else if (freq < 779000000)
+    {
+        lo = 389500000;
+        hi = 510000000;
+    }
+    else
+    {
+        lo = 779000000;
+        hi = 1020000000;
+    }
+
+    if (((spacing % 25000) > 0) || (freq > hi) || ((spacing == 0) && (freq < lo)))
+    {
+        band->valid = false;
+        return false;
+    }
+
+    if (spacing > 0)
+    {
+        if (freq < lo)
+        {
+            band->ch_min = (uint16_t)((lo - freq + spacing - 1) / spacing);
+        }
+        if (((hi - freq) / spacing) < CH_NUMBER_MAX)
+        {
+            band->ch_max = (uint16_t)((hi - freq) / spacing);
+        }
+    }
+
+    /* The channel range is known for legacy O-QPSK only */
+    uint32_t tuple;
+    if (get_supported_channels_tuple(trx_id, &tuple) == MAC_SUCCESS)
+    {
+        if ((tuple & 0xFFFF) > band->ch_min)
+        {
+            band->ch_min = (uint16_t)(tuple & 0xFFFF);
+        }
+        if ((tuple >> 16) < band->ch_max)
+        {
+            band->ch_max = (uint16_t)(tuple >> 16);
+        }
+    }
+
+    if (band->ch_min > band->ch_max)
+    {
+        band->valid = false;
+    }
+#endif
+
+    return band->valid;
+}
+
+
+/**
+ * @brief Completes a channel switch
+ *
+ * @param trx_id Transceiver identifier
+ * @param status Status of the switch
+ */
+static void finish_ch_switch(trx_id_t trx_id, retval_t status)
+{
+    if (ch_switch_target[trx_id] != RF_TRXOFF)
+    {
+        CALC_REG_OFFSET(trx_id);
+        pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_RF09_IRQM), RF_IRQM_DEFAULT);
+    }
+
+    if (status == MAC_SUCCESS)
+    {
+        tal_latency_t *lat = &ch_switch_stats[trx_id].latency;
+        add_latency(lat, ch_switch_start[trx_id]);
+        ch_switch_samples[trx_id][ch_switch_sample_idx[trx_id]] = lat->last_us;
+        ch_switch_sample_idx[trx_id] = (ch_switch_sample_idx[trx_id] + 1) % TAL_CH_SWITCH_LAT_SAMPLES;
+    }
+
+    tal_state[trx_id] = TAL_IDLE;
+
+#ifdef SUPPORT_CH_HOPPING
+    /* Switches of the hopping engine are not reported */
+    if (ch_hop_switch_done(trx_id, status))
+    {
+        start_next_queued_frame(trx_id);
+        return;
+    }
+#endif
+    tal_channel_switch_done_cb(trx_id, status);
+
+    /* Frames queued during the switch */
+    start_next_queued_frame(trx_id);
+}
+
+
+/**
+ * @brief Handles a channel switch that has not completed in time
+ *
+ * The PLL lock is checked once; if the TRXRDY IRQ has been missed, the
+ * switch is completed, otherwise it is aborted.
+ *
+ * @param v Timer parameter; transceiver identifier
+ */
+static void ch_switch_timer_cb(union sigval v)
+{
+    trx_id_t trx_id = (trx_id_t)v.sival_int;
+
+    ENTER_CRITICAL_REGION();
+    if (tal_state[trx_id] == TAL_CH_SWITCH)
+    {
+        uint32_t now;
+        pal_get_current_time(&now);
+        /* Timers of completed switches expire early for the current one. */
+        if ((now - ch_switch_start[trx_id]) >= TAL_CH_SWITCH_TIMEOUT_US)
+        {
+            CALC_REG_OFFSET(trx_id);
+            ch_switch_stats[trx_id].timeouts++;
+            if (pal_dev_reg_read(RF215_TRX, GET_REG_ADDR(RG_RF09_STATE)) == RF_TXPREP)
+            {
+                handle_ch_switch_irq(trx_id);
+            }
+            else
+            {
+                stop_ch_switch(trx_id);
+            }
+        }
+    }
+    LEAVE_CRITICAL_REGION();
+}
+
+
+/**
+ * @brief Gets a percentile of sorted samples (nearest rank)
+ *
+ * @param sorted Samples in ascending order
+ * @param cnt Number of samples
+ * @param pct Percentile
+ *
+ * @return Sample value
+ */
+static uint32_t get_percentile(const uint32_t *sorted, uint8_t cnt, uint8_t pct)
+{
+    uint16_t rank = ((uint16_t)cnt * pct + 99) / 100;
+
+    if (rank == 0)
+    {
+        rank = 1;
+    }
+
+    return sorted[rank - 1];
+}
+
+
+/* EOF */
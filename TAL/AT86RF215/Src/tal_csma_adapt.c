@@ -0,0 +1,324 @@
+/**
+ * @file tal_csma_adapt.c
+ *
+ * @brief This file implements the adaptive CSMA-CA parameters.
+ *
+ * MinBE, MaxBE and MaxCSMABackoffs are tuned per channel from the outcome
+ * of the CSMA-CA attempts. Each attempt ends with a clear CCA followed by
+ * an ACK or a missing ACK, or with a channel access failure; the busy CCAs
+ * before are counted as well. After TAL_CSMA_ADAPT_PERIOD attempts the
+ * rates of the period decide about a single step of each parameter:
+ *
+ * - A missing ACK after a clear CCA is taken as collision. Collisions
+ *   mean that too many nodes pick the same backoff slot, so a high
+ *   collision rate increases MinBE; a low one decreases it again.
+ * - Channel access failures drop frames although the channel becomes free
+ *   later, so they increase MaxCSMABackoffs and then MaxBE. Both return
+ *   to the PIB values once neither failures nor many busy CCAs occur.
+ *
+ * The values stay within the bounds of IEEE 802.15.4 and MaxBE within
+ * TAL_CSMA_ADAPT_MAX_BE. The table holds the channels used last.
+ *
+ * The adaptation trades access delay for delivery. Test/Src/sim_csma_adapt.c
+ * ("make sim") simulates saturated nodes on one channel against the fixed
+ * MinBE 3, MaxBE 5 and 4 backoffs; with 20 nodes it yields 55% instead of
+ * 32% goodput and 8% instead of 89% drops, and a node needs 128 instead of
+ * 220 ms per delivered frame. The delay of a delivered frame grows from
+ * 18 to 107 ms though, since frames that the fixed setup drops after a few
+ * backoffs now wait in windows of up to 2^8 backoff periods. A lower
+ * TAL_CSMA_ADAPT_MAX_BE bounds that delay at the cost of more drops.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include "pal.h"
+#include "return_val.h"
+#include "tal.h"
+#include "ieee_const.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+
+#ifdef SUPPORT_ADAPTIVE_CSMA
+
+/* === MACROS ============================================================== */
+
+/** Bounds of IEEE 802.15.4 */
+#define MIN_MAX_BE                  (3)
+#define MAX_CSMA_BACKOFFS_LIMIT     (5)
+
+/* === TYPES =============================================================== */
+
+/**
+ * Table entry of a channel
+ */
+typedef struct csma_adapt_entry_tag
+{
+    tal_csma_adapt_info_t info;
+    /** Counters of the current period */
+    uint16_t attempts;
+    uint16_t cca;
+    uint16_t busy;
+    uint16_t collisions;
+    uint16_t failures;
+    /** Use order; the entry with the lowest value is replaced */
+    uint32_t last_use;
+} csma_adapt_entry_t;
+
+/* === GLOBALS ============================================================= */
+
+static bool csma_adapt_enabled[NUM_TRX];
+static csma_adapt_entry_t csma_adapt_table[NUM_TRX][TAL_CSMA_ADAPT_CHANNELS];
+static uint32_t csma_adapt_use[NUM_TRX];
+
+/* === PROTOTYPES ========================================================== */
+
+static csma_adapt_entry_t *get_entry(trx_id_t trx_id);
+static void adapt_params(trx_id_t trx_id, csma_adapt_entry_t *e);
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Enables or disables the adaptive CSMA-CA parameters
+ *
+ * The table is cleared; new entries start from the PIB values.
+ *
+ * @param trx_id Transceiver identifier
+ * @param enable true to enable the adaptation
+ * @ingroup apiTalApi
+ */
+void tal_csma_adapt_enable(trx_id_t trx_id, bool enable)
+{
+    ASSERT((trx_id >= 0) && (trx_id < NUM_TRX));
+
+    memset(csma_adapt_table[trx_id], 0, sizeof(csma_adapt_table[trx_id]));
+    csma_adapt_use[trx_id] = 0;
+    csma_adapt_enabled[trx_id] = enable;
+}
+
+
+/**
+ * @brief Gets the table of the adapted parameters
+ *
+ * @param trx_id Transceiver identifier
+ * @param info Storage for the entries
+ * @param max_entries Number of entries the storage can hold
+ *
+ * @return Number of entries filled
+ * @ingroup apiTalApi
+ */
+uint8_t tal_csma_adapt_get_table(trx_id_t trx_id, tal_csma_adapt_info_t *info,
+                                 uint8_t max_entries)
+{
+    uint8_t n = 0;
+
+    for (uint8_t i = 0; (i < TAL_CSMA_ADAPT_CHANNELS) && (n < max_entries); i++)
+    {
+        if (csma_adapt_table[trx_id][i].last_use != 0)
+        {
+            info[n++] = csma_adapt_table[trx_id][i].info;
+        }
+    }
+
+    return n;
+}
+
+
+/**
+ * @brief Gets the CSMA-CA parameters for the current channel
+ *
+ * @param trx_id Transceiver identifier
+ * @param params Storage for the parameters
+ */
+void get_csma_params(trx_id_t trx_id, tal_csma_params_t *params)
+{
+    if (csma_adapt_enabled[trx_id])
+    {
+        *params = get_entry(trx_id)->info.params;
+    }
+    else
+    {
+        params->min_be = tal_pib[trx_id].MinBE;
+        params->max_be = tal_pib[trx_id].MaxBE;
+        params->max_backoffs = tal_pib[trx_id].MaxCSMABackoffs;
+    }
+}
+
+
+/**
+ * @brief Accounts for the end of a CSMA-CA attempt
+ *
+ * @param trx_id Transceiver identifier
+ * @param status MAC_SUCCESS, TAL_FRAME_PENDING, MAC_NO_ACK or
+ *               MAC_CHANNEL_ACCESS_FAILURE; others are ignored
+ * @param busy_cca Number of busy CCAs of the attempt
+ */
+void csma_adapt_attempt_done(trx_id_t trx_id, retval_t status, uint8_t busy_cca)
+{
+    csma_adapt_entry_t *e;
+
+    if (!csma_adapt_enabled[trx_id])
+    {
+        return;
+    }
+
+    e = get_entry(trx_id);
+    switch (status)
+    {
+        case MAC_NO_ACK:
+            e->collisions++;
+            /* fall through */
+        case MAC_SUCCESS:
+        case TAL_FRAME_PENDING:
+            /* The attempt ended with a clear CCA */
+            e->cca++;
+            break;
+
+        case MAC_CHANNEL_ACCESS_FAILURE:
+            e->failures++;
+            break;
+
+        default:
+            return;
+    }
+    e->cca += busy_cca;
+    e->busy += busy_cca;
+    e->info.attempts++;
+
+    if (++e->attempts >= TAL_CSMA_ADAPT_PERIOD)
+    {
+        adapt_params(trx_id, e);
+    }
+}
+
+
+/**
+ * @brief Gets the table entry of the current channel
+ *
+ * A missing entry replaces the least recently used one.
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return Table entry
+ */
+static csma_adapt_entry_t *get_entry(trx_id_t trx_id)
+{
+    uint16_t ch = tal_pib[trx_id].CurrentChannel;
+    csma_adapt_entry_t *lru = &csma_adapt_table[trx_id][0];
+    csma_adapt_entry_t *e;
+
+    for (uint8_t i = 0; i < TAL_CSMA_ADAPT_CHANNELS; i++)
+    {
+        e = &csma_adapt_table[trx_id][i];
+        if ((e->last_use != 0) && (e->info.channel == ch))
+        {
+            e->last_use = ++csma_adapt_use[trx_id];
+            return e;
+        }
+        if (e->last_use < lru->last_use)
+        {
+            lru = e;
+        }
+    }
+
+    e = lru;
+    memset(e, 0, sizeof(csma_adapt_entry_t));
+    e->info.channel = ch;
+    e->info.params.min_be = tal_pib[trx_id].MinBE;
+    e->info.params.max_be = tal_pib[trx_id].MaxBE;
+    e->info.params.max_backoffs = tal_pib[trx_id].MaxCSMABackoffs;
+    e->last_use = ++csma_adapt_use[trx_id];
+
+    return e;
+}
+
+
+/**
+ * @brief Adapts the parameters of a channel at the end of a period
+ *
+ * @param trx_id Transceiver identifier
+ * @param e Table entry
+ */
+static void adapt_params(trx_id_t trx_id, csma_adapt_entry_t *e)
+{
+    tal_csma_params_t *p = &e->info.params;
+    tal_csma_params_t prev = *p;
+    uint16_t clear = e->attempts - e->failures;
+
+    e->info.busy_permille = (e->cca > 0) ?
+                            (uint16_t)(((uint32_t)e->busy * 1000) / e->cca) : 0;
+    e->info.collision_permille = (clear > 0) ?
+                                 (uint16_t)(((uint32_t)e->collisions * 1000) / clear) : 0;
+    e->info.failure_permille = (uint16_t)(((uint32_t)e->failures * 1000) / e->attempts);
+
+    /* Collisions: spread the first backoff */
+    if (e->info.collision_permille > TAL_CSMA_ADAPT_COLL_HIGH)
+    {
+        if (p->min_be < p->max_be)
+        {
+            p->min_be++;
+        }
+        else if (p->max_be < TAL_CSMA_ADAPT_MAX_BE)
+        {
+            p->max_be++;
+            p->min_be++;
+        }
+    }
+    else if ((e->info.collision_permille < TAL_CSMA_ADAPT_COLL_LOW) &&
+             (p->min_be > TAL_CSMA_ADAPT_MIN_BE_LOW))
+    {
+        p->min_be--;
+    }
+
+    /* Access failures: wait longer for the channel before giving up */
+    if (e->info.failure_permille > TAL_CSMA_ADAPT_FAIL_HIGH)
+    {
+        if (p->max_backoffs < MAX_CSMA_BACKOFFS_LIMIT)
+        {
+            p->max_backoffs++;
+        }
+        else if (p->max_be < TAL_CSMA_ADAPT_MAX_BE)
+        {
+            p->max_be++;
+        }
+    }
+    else if ((e->failures == 0) && (e->info.busy_permille < TAL_CSMA_ADAPT_BUSY_LOW))
+    {
+        if ((p->max_be > tal_pib[trx_id].MaxBE) && (p->max_be > p->min_be) &&
+            (p->max_be > MIN_MAX_BE))
+        {
+            p->max_be--;
+        }
+        else if (p->max_backoffs > tal_pib[trx_id].MaxCSMABackoffs)
+        {
+            p->max_backoffs--;
+        }
+    }
+
+    if ((p->min_be != prev.min_be) || (p->max_be != prev.max_be) ||
+        (p->max_backoffs != prev.max_backoffs))
+    {
+        e->info.adjustments++;
+    }
+
+    e->attempts = 0;
+    e->cca = 0;
+    e->busy = 0;
+    e->collisions = 0;
+    e->failures = 0;
+}
+
+#endif /* #ifdef SUPPORT_ADAPTIVE_CSMA */
+
+/* EOF */
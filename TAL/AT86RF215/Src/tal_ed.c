@@ -195,6 +195,9 @@ void handle_ed_end_irq(trx_id_t trx_id)
             pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_RF09_IRQM_EDC), 0);
 
             tal_ed_end_cb(trx_id, ed);
+
+            /* Frames queued during the scan */
+            start_next_queued_frame(trx_id);
         }
         else
         {
@@ -104,6 +104,9 @@ printf("Check if RF215 is connected\n");
     /* Initialize trx */
     trx_init();
 
+    /* Measure SPI throughput while both trx are off */
+    calibrate_spi_model();
+
     /* Initialize the buffer management */
     bmm_buffer_init();
 
@@ -129,6 +132,7 @@ printf("Check if RF215 is connected\n");
         config_phy(trx_id);
 
         tal_rx_buffer[trx_id] = bmm_buffer_alloc(LARGE_BUFFER_SIZE);
+        BMM_SET_OWNER(tal_rx_buffer[trx_id], BMM_OWNER_TAL_RX);
         if (tal_rx_buffer[trx_id] == NULL)
         {
             return FAILURE;
@@ -199,6 +203,14 @@ void trx_config(trx_id_t trx_id)
     pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_BBC0_CNTC), cnt_cfg);
 #endif /* #if (defined MEASURE_TIME_OF_FLIGHT) */
 
+#ifdef SUPPORT_HW_TSTAMP
+    /* Free running counter capturing the frame starts */
+    init_hw_tstamp(trx_id);
+#endif
+#ifdef SUPPORT_ENTROPY_POOL
+    init_entropy_pool(trx_id);
+#endif
+
 #ifndef USE_TXPREP_DURING_BACKOFF
     /* Keep analog voltage regulator on during TRXOFF */
     pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_RF09_AUXS_AVEN), 1);
@@ -385,6 +397,15 @@ printf("trx_reset run\n");
         pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_RF09_CMD), RF_RESET);
     }
 
+    /* The registers are back to their reset values */
+    for (uint8_t i = (trx_id_t)0; i < NUM_TRX; i++)
+    {
+        if ((trx_id == RFBOTH) || (trx_id == i))
+        {
+            reg_image_invalidate((trx_id_t)i);
+        }
+    }
+
     /* Wait for IRQ line */
     while (1)
     {
@@ -477,6 +498,29 @@ static void cleanup_tal(trx_id_t trx_id)
 
     LEAVE_CRITICAL_REGION();
 
+#ifdef SUPPORT_BULK_TRANSFER
+    /* Before the flush, so that no BAR is started for flushed frames */
+    reset_bulk_transfer(trx_id);
+#endif
+    /* Drop frames waiting for transmission. */
+    flush_tx_queue(trx_id);
+#ifdef SUPPORT_AGGREGATION
+    reset_aggregation(trx_id);
+#endif
+#ifdef SUPPORT_CH_HOPPING
+    reset_ch_hopping(trx_id);
+#endif
+#ifdef SUPPORT_TSCH
+    reset_tsch(trx_id);
+#endif
+#ifdef SUPPORT_RATE_CONTROL
+    reset_rate_control(trx_id);
+#endif
+#ifdef SUPPORT_MODE_SWITCH
+    flush_ms_images(trx_id);
+#endif
+    flush_phy_profiles(trx_id);
+
     /* Clear TAL Incoming Frame queue and free used buffers. */
     while (tal_incoming_frame_queue[trx_id].size > 0)
     {
@@ -490,6 +534,7 @@ static void cleanup_tal(trx_id_t trx_id)
     if (tal_rx_buffer[trx_id] == NULL)
     {
         tal_rx_buffer[trx_id] = bmm_buffer_alloc(LARGE_BUFFER_SIZE);
+        BMM_SET_OWNER(tal_rx_buffer[trx_id], BMM_OWNER_TAL_RX);
     }
     /* Handle buffer shortage */
     if (tal_rx_buffer[trx_id] == NULL)
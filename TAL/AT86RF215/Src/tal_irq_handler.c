@@ -100,6 +100,9 @@ void trx_irq_handler_cb(void)
 #ifdef ENABLE_TSTAMP
                 pal_get_current_time(&fs_tstamp[trx_id]);
 #endif
+#ifdef SUPPORT_HW_TSTAMP
+                capture_frame_cnt(trx_id);
+#endif
 #if ((defined RF215v1) || (defined RF215v2)) && (defined SUPPORT_LEGACY_OQPSK)
                 /* Workaround for errata reference #4908 */
                 /* Keep flag set to trigger workaround; see tal.c */
@@ -129,6 +132,10 @@ void trx_irq_handler_cb(void)
             {
                 /* used for IFS and for MEASURE_ON_AIR_DURATION */
                 pal_get_current_time(&rxe_txe_tstamp[trx_id]);
+#ifdef SUPPORT_HW_TSTAMP
+                /* The counter has been captured at the TX start */
+                capture_frame_cnt(trx_id);
+#endif
             }
 
             /*
@@ -151,7 +158,7 @@ void trx_irq_handler_cb(void)
 
         if (irqs != RF_IRQ_NO_IRQ)
         {
-            if (irqs & RF_IRQ_TRXRDY)
+            if ((irqs & RF_IRQ_TRXRDY) && (tal_state[trx_id] != TAL_CH_SWITCH))
             {
                 irqs &= (uint8_t)(~((uint32_t)RF_IRQ_TRXRDY)); // avoid Pa091
             }
@@ -61,6 +61,22 @@ typedef struct ms_phr_tag
     uint16_t pc : 1;
 } ms_phr_t;
 
+/**
+ * Precomputed register images of a mode switch target mode
+ */
+typedef struct ms_image_tag
+{
+    bool valid;
+    /** Target mode the images belong to */
+    new_phy_t mode;
+    /** From the CSM with raw mode, i.e. after the mode switch PPDU, to the new mode */
+    reg_image_t new_mode;
+    /** From the new mode back to the CSM */
+    reg_image_t csm;
+    reg_image_fx_t new_fx;
+    reg_image_fx_t csm_fx;
+} ms_image_t;
+
 /* === MACROS ============================================================== */
 
 #define MS(x)   (x & 0x0001)
@@ -101,6 +117,22 @@ typedef struct ms_phr_tag
 static temp_phy_t previous_phy[NUM_TRX];
 static phy_t csm_phy;
 bool csm_active[NUM_TRX] = {false, false};
+/* Current transmission uses a mode switch PPDU */
+bool ms_tx[NUM_TRX] = {false, false};
+/* New mode of the current transmission; phyModeSwitchNewMode or the rate chosen by rate control */
+new_phy_t ms_tx_mode[NUM_TRX];
+static bool ms_policy_enabled[NUM_TRX];
+static uint16_t ms_policy_min_saving_us[NUM_TRX];
+static tal_ms_policy_stats_t ms_policy_stats[NUM_TRX];
+static ms_image_t ms_image[NUM_TRX][TAL_MS_IMAGE_CACHE_SIZE];
+static uint8_t ms_image_next[NUM_TRX];
+/* Images of the current transmission; NULL if not available */
+static ms_image_t *ms_image_cur[NUM_TRX];
+/* New mode has been configured from ms_image_cur */
+static bool ms_image_applied[NUM_TRX];
+static tal_ms_switch_stats_t ms_switch_stats[NUM_TRX];
+/* Scratch shadows used while compiling: CSM, CSM with raw mode, new mode */
+static pal_trx_shadow_t ms_shadow[3];
 #ifdef SUPPORT_OQPSK
 FLASH_DECLARE(OQPSK_CHIP_RATE_REGION_TABLE_DATA_TYPE
               oqpsk_chip_rate_region_table[OQPSK_CHIP_RATE_REGION_TABLE_ROW_SIZE][OQPSK_CHIP_RATE_REGION_TABLE_COL_SIZE]) =
@@ -115,14 +147,18 @@ static void configure_new_tx_mode(trx_id_t trx_id);
 //static void cancel_new_mode_reception(timer_element_t *cb_timer_element);
 static void cancel_new_mode_reception(union sigval v);
 
-static retval_t convert_fsk_op_mode_to_data_rate(fsk_op_mode_t op_mode,
-                                                 sun_freq_band_t band, fsk_sym_rate_t *rate, fsk_mod_type_t *type);
 static inline uint16_t create_mode_switch_phr(trx_id_t trx_id);
 #ifdef SUPPORT_OQPSK
 static uint16_t oqpsk_get_chip_rate_region(trx_id_t trx_id);
 static oqpsk_chip_rate_t convert_oqpsk_chip_rate_to_register(uint16_t chip_rate);
 #endif
 static inline void download_ms_ppdu(trx_id_t trx_id);
+static void set_new_mode_pib(trx_id_t trx_id);
+static void set_csm_pib(trx_id_t trx_id);
+static retval_t conf_csm(trx_id_t trx_id);
+static retval_t conf_ms_raw_mode(trx_id_t trx_id);
+static retval_t conf_new_mode(trx_id_t trx_id);
+static retval_t compile_ms_image(trx_id_t trx_id, ms_image_t *img);
 
 /* === IMPLEMENTATION ====================================================== */
 
@@ -140,6 +176,12 @@ void init_mode_switch(void)
     csm_phy.phy_mode.fsk.mod_type = F2FSK;
     csm_phy.phy_mode.fsk.mod_idx = MOD_IDX_1_0;
     csm_phy.phy_mode.fsk.sym_rate = FSK_SYM_RATE_50;
+
+    for (uint8_t trx_id = 0; trx_id < NUM_TRX; trx_id++)
+    {
+        ms_policy_enabled[trx_id] = TAL_MS_POLICY_DEFAULT_ENABLE;
+        ms_policy_min_saving_us[trx_id] = TAL_MS_POLICY_MIN_SAVING_US;
+    }
 }
 
 
@@ -160,25 +202,62 @@ void set_csm(trx_id_t trx_id)
             switch_to_txprep(trx_id);
         }
 
-        /* Configure phy for CSM */
-        memcpy(&tal_pib[trx_id].phy, &csm_phy, sizeof(phy_t));
+        set_csm_pib(trx_id);
+
+        if (ms_image_applied[trx_id])
+        {
+            /* New mode was configured from an image; revert it the same way */
+            uint32_t start;
+            pal_get_current_time(&start);
+            reg_image_apply(&ms_image_cur[trx_id]->csm);
+            reg_image_set_fx(trx_id, &ms_image_cur[trx_id]->csm_fx);
+            ms_image_applied[trx_id] = false;
+            add_latency(&ms_switch_stats[trx_id].restore, start);
+        }
+        else
+        {
+            /* Apply new settings */
+            conf_csm(trx_id);
+        }
+        csm_active[trx_id] = true;
+    }
+}
 
-        tal_pib[trx_id].FSKFECEnabled = false;
-        tal_pib[trx_id].FSKFECInterleavingRSC = false;
-        tal_pib[trx_id].FSKFECScheme = FEC_SCHEME_NRNSC;
-        tal_pib[trx_id].FSKPreambleLength = 8;
-        tal_pib[trx_id].MRFSKSFD = 0;
-        tal_pib[trx_id].FSKScramblePSDU = false;
 
-        /* Apply new settings */
-        set_fsk_pibs(trx_id);
+/**
+ * @brief Sets the PHY related PIB values to the CSM
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void set_csm_pib(trx_id_t trx_id)
+{
+    /* Configure phy for CSM */
+    memcpy(&tal_pib[trx_id].phy, &csm_phy, sizeof(phy_t));
+
+    tal_pib[trx_id].FSKFECEnabled = false;
+    tal_pib[trx_id].FSKFECInterleavingRSC = false;
+    tal_pib[trx_id].FSKFECScheme = FEC_SCHEME_NRNSC;
+    tal_pib[trx_id].FSKPreambleLength = 8;
+    tal_pib[trx_id].MRFSKSFD = 0;
+    tal_pib[trx_id].FSKScramblePSDU = false;
+}
 
-        /* Disable raw mode */
-        configure_raw_mode(trx_id, false);
 
-        conf_fsk(trx_id);
-        csm_active[trx_id] = true;
-    }
+/**
+ * @brief Configures the CSM registers according to the PIB
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return Status of the FSK configuration
+ */
+static retval_t conf_csm(trx_id_t trx_id)
+{
+    set_fsk_pibs(trx_id);
+
+    /* Disable raw mode */
+    configure_raw_mode(trx_id, false);
+
+    return conf_fsk(trx_id);
 }
 
 
@@ -199,13 +278,13 @@ void save_current_phy(trx_id_t trx_id)
     previous_phy[trx_id].pib.FSKScramblePSDU = tal_pib[trx_id].FSKScramblePSDU;
 
 #ifdef SUPPORT_OFDM
-    if (tal_pib[trx_id].ModeSwitchNewMode.modulation == OFDM)
+    if (ms_tx_mode[trx_id].modulation == OFDM)
     {
         previous_phy[trx_id].rate.ofdm_mcs = tal_pib[trx_id].OFDMMCS;
     }
 #endif
 #ifdef SUPPORT_OQPSK
-    if (tal_pib[trx_id].ModeSwitchNewMode.modulation == OQPSK)
+    if (ms_tx_mode[trx_id].modulation == OQPSK)
     {
         previous_phy[trx_id].rate.oqpsk_rate_mod = tal_pib[trx_id].OQPSKRateMode;
     }
@@ -284,26 +363,26 @@ static inline uint16_t create_mode_switch_phr(trx_id_t trx_id)
     /* Mode switch parameter entry */
 
     /* New mode fec */
-    if (tal_pib[trx_id].ModeSwitchNewMode.fec_enabled)
+    if (ms_tx_mode[trx_id].fec_enabled)
     {
         ms_phr->new_fec = 1;
     }
 
     /* New mode field; Page field is kept to 0. */
-    uint8_t modu = tal_pib[trx_id].ModeSwitchNewMode.modulation;
+    uint8_t modu = ms_tx_mode[trx_id].modulation;
     modu = ((modu & 0x01) << 1) | (modu >> 1); // MSB instead of LSB
     ms_phr->new_mode = modu << 1;
     /* Mode field */
     uint8_t op = 0;
-    switch (tal_pib[trx_id].ModeSwitchNewMode.modulation)
+    switch (ms_tx_mode[trx_id].modulation)
     {
         case FSK:
-            op = tal_pib[trx_id].ModeSwitchNewMode.phy_mode.fsk.op_mode;
+            op = ms_tx_mode[trx_id].phy_mode.fsk.op_mode;
             break;
 #ifdef SUPPORT_OFDM
         case OFDM:
             /* For over-the-air encoding see table 68i */
-            op = tal_pib[trx_id].ModeSwitchNewMode.phy_mode.ofdm.option - 1;
+            op = ms_tx_mode[trx_id].phy_mode.ofdm.option - 1;
             break;
 #endif
 #ifdef SUPPORT_OQPSK
@@ -335,26 +414,164 @@ static inline uint16_t create_mode_switch_phr(trx_id_t trx_id)
  */
 void prepare_actual_transmission(trx_id_t trx_id)
 {
+    configure_new_tx_mode(trx_id);
+    tx_state[trx_id] = TX_WAIT_FOR_NEW_MODE_TRANSMITTING;
+
+    /* Wait for the remainder of the settling delay only */
     uint32_t now;
     pal_get_current_time(&now);
-    uint32_t diff = tal_pib[trx_id].ModeSwitchSettlingDelay - (now - rxe_txe_tstamp[trx_id]);
+    uint32_t elapsed = now - rxe_txe_tstamp[trx_id];
+    if (elapsed >= tal_pib[trx_id].ModeSwitchSettlingDelay)
+    {
+        /* Configuration took longer than the settling delay */
+        ms_switch_stats[trx_id].late++;
+
+        union sigval v;
+        v.sival_int = trx_id;
+        tx_actual_frame(v);
+        return;
+    }
+
     retval_t status =
         pal_timer_start(TAL_T,
                         trx_id,
-                        diff,
+                        tal_pib[trx_id].ModeSwitchSettlingDelay - elapsed,
                         TIMEOUT_RELATIVE,
                         (FUNC_PTR())tx_actual_frame,
                         NULL);
 
-    if (status == MAC_SUCCESS)
+    if (status != MAC_SUCCESS)
+    {
+        tx_done_handling(trx_id, status);
+    }
+}
+
+
+/**
+ * @brief Decides whether a frame is sent using a mode switch
+ *
+ * The PPDU duration within the CSM is compared with the duration of the
+ * mode switch PPDU, the settling delay and the PPDU within the new mode.
+ * Called while the PIB contains the CSM settings.
+ *
+ * @param trx_id Transceiver identifier
+ * @param frame Frame to be transmitted
+ *
+ * @return true if the mode switch saves more than the minimum saving
+ */
+bool use_mode_switch(trx_id_t trx_id, frame_info_t *frame)
+{
+    if (!ms_policy_enabled[trx_id])
+    {
+        ms_policy_stats[trx_id].switched++;
+        return true;
+    }
+
+    uint16_t psdu_len = frame->len_no_crc + tal_pib[trx_id].FCSLen;
+    uint32_t csm_us = get_ppdu_duration_us(trx_id, psdu_len);
+    /* The mode switch PPDU carries the 2 octet PHR only */
+    uint32_t ms_us = get_ppdu_duration_us(trx_id, 0) +
+                     tal_pib[trx_id].ModeSwitchSettlingDelay;
+
+    /* Evaluate the new mode on the PIB; no transceiver access */
+    phy_t phy = tal_pib[trx_id].phy;
+    bool fec = tal_pib[trx_id].FSKFECEnabled;
+#ifdef SUPPORT_OFDM
+    ofdm_mcs_t mcs = tal_pib[trx_id].OFDMMCS;
+#endif
+#ifdef SUPPORT_OQPSK
+    oqpsk_rate_mode_t rate_mode = tal_pib[trx_id].OQPSKRateMode;
+#endif
+
+    set_new_mode_pib(trx_id);
+    uint32_t new_us = get_ppdu_duration_us(trx_id, psdu_len);
+
+    tal_pib[trx_id].phy = phy;
+    tal_pib[trx_id].FSKFECEnabled = fec;
+#ifdef SUPPORT_OFDM
+    tal_pib[trx_id].OFDMMCS = mcs;
+#endif
+#ifdef SUPPORT_OQPSK
+    tal_pib[trx_id].OQPSKRateMode = rate_mode;
+#endif
+
+    if (new_us == 0)
     {
-        configure_new_tx_mode(trx_id);
-        tx_state[trx_id] = TX_WAIT_FOR_NEW_MODE_TRANSMITTING;
+        /* Unsupported new mode */
+        ms_policy_stats[trx_id].csm_frames++;
+        return false;
     }
-    else
+
+    ms_us += new_us;
+    if (csm_us > (ms_us + ms_policy_min_saving_us[trx_id]))
     {
-        tx_done_handling(trx_id, status);
+        ms_policy_stats[trx_id].switched++;
+        ms_policy_stats[trx_id].saved_us += csm_us - ms_us;
+        return true;
+    }
+
+    ms_policy_stats[trx_id].csm_frames++;
+    if (ms_us > csm_us)
+    {
+        ms_policy_stats[trx_id].avoided_us += ms_us - csm_us;
     }
+    return false;
+}
+
+
+/**
+ * @brief Configures the mode switch policy
+ *
+ * @param trx_id Transceiver identifier
+ * @param enable true to decide per frame, false to switch for every frame
+ * @param min_saving_us Airtime a mode switch has to save at least
+ */
+void tal_ms_policy_set(trx_id_t trx_id, bool enable, uint16_t min_saving_us)
+{
+    ms_policy_enabled[trx_id] = enable;
+    ms_policy_min_saving_us[trx_id] = min_saving_us;
+}
+
+
+/**
+ * @brief Gets the mode switch policy statistics
+ *
+ * @param trx_id Transceiver identifier
+ * @param stats Pointer to the statistics to be filled
+ */
+void tal_ms_policy_get_stats(trx_id_t trx_id, tal_ms_policy_stats_t *stats)
+{
+    *stats = ms_policy_stats[trx_id];
+}
+
+
+/**
+ * @brief Sets the PHY related PIB values to the new mode
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void set_new_mode_pib(trx_id_t trx_id)
+{
+    tal_pib[trx_id].phy.modulation = ms_tx_mode[trx_id].modulation;
+    memcpy(&tal_pib[trx_id].phy.phy_mode, &ms_tx_mode[trx_id].phy_mode, sizeof(phy_mode_t));
+
+    if (ms_tx_mode[trx_id].modulation == FSK)
+    {
+        /* FEC as signaled within the mode switch PPDU */
+        tal_pib[trx_id].FSKFECEnabled = ms_tx_mode[trx_id].fec_enabled;
+    }
+#ifdef SUPPORT_OFDM
+    if (ms_tx_mode[trx_id].modulation == OFDM)
+    {
+        tal_pib[trx_id].OFDMMCS = ms_tx_mode[trx_id].rate.ofdm_mcs;
+    }
+#endif
+#ifdef SUPPORT_OQPSK
+    if (ms_tx_mode[trx_id].modulation == OQPSK)
+    {
+        tal_pib[trx_id].OQPSKRateMode = ms_tx_mode[trx_id].rate.oqpsk_rate_mod;
+    }
+#endif
 }
 
 
@@ -365,12 +582,12 @@ void prepare_actual_transmission(trx_id_t trx_id)
  */
 static void configure_new_tx_mode(trx_id_t trx_id)
 {
+    uint32_t start;
+    pal_get_current_time(&start);
+
     /* Configure new mode */
     csm_active[trx_id] = false;
 
-    /* Disable raw mode */
-    configure_raw_mode(trx_id, false);
-
     /* Check if ACK is requested */
     if (*mac_frame_ptr[trx_id]->mpdu & FCF_ACK_REQUEST)
     {
@@ -378,23 +595,200 @@ static void configure_new_tx_mode(trx_id_t trx_id)
         pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_BBC0_AMCS_TX2RX), 1);
     }
 
-    tal_pib[trx_id].phy.modulation = tal_pib[trx_id].ModeSwitchNewMode.modulation;
-    memcpy(&tal_pib[trx_id].phy.phy_mode, &tal_pib[trx_id].ModeSwitchNewMode.phy_mode, sizeof(phy_t));
+    set_new_mode_pib(trx_id);
 
-#ifdef SUPPORT_OFDM
-    if (tal_pib[trx_id].ModeSwitchNewMode.modulation == OFDM)
+    ms_image_t *img = ms_image_cur[trx_id];
+    if ((img != NULL) && (trx_state[trx_id] == RF_TXPREP) &&
+        (memcmp(&img->mode, &ms_tx_mode[trx_id], sizeof(new_phy_t)) == 0))
     {
-        tal_pib[trx_id].OFDMMCS = tal_pib[trx_id].ModeSwitchNewMode.rate.ofdm_mcs;
+        /*
+         * The PHY may be changed within TXPREP, see conf_trx_modulation();
+         * the detour via TRXOFF is not required.
+         */
+        reg_image_apply(&img->new_mode);
+        reg_image_set_fx(trx_id, &img->new_fx);
+        ms_image_applied[trx_id] = true;
+
+        ms_switch_stats[trx_id].writes = img->new_mode.writes;
+        ms_switch_stats[trx_id].image_len = img->new_mode.len;
+        add_latency(&ms_switch_stats[trx_id].image, start);
+        return;
     }
-#endif
-#ifdef SUPPORT_OQPSK
-    if (tal_pib[trx_id].ModeSwitchNewMode.modulation == OQPSK)
+
+    /* Disable raw mode */
+    configure_raw_mode(trx_id, false);
+
+    if (ms_tx_mode[trx_id].modulation == FSK)
     {
-        tal_pib[trx_id].OQPSKRateMode = tal_pib[trx_id].ModeSwitchNewMode.rate.oqpsk_rate_mod;
+        set_fsk_pibs(trx_id);
     }
-#endif
 
     conf_trx_modulation(trx_id);
+    add_latency(&ms_switch_stats[trx_id].conf, start);
+}
+
+
+/**
+ * @brief Enables the raw mode used by the mode switch PPDU
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return MAC_SUCCESS
+ */
+static retval_t conf_ms_raw_mode(trx_id_t trx_id)
+{
+    configure_raw_mode(trx_id, true);
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Configures the new mode registers according to the PIB
+ *
+ * Same register settings as configure_new_tx_mode() without changing
+ * the transceiver state.
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return Status of the modulation configuration
+ */
+static retval_t conf_new_mode(trx_id_t trx_id)
+{
+    /* Disable raw mode */
+    configure_raw_mode(trx_id, false);
+
+    if (ms_tx_mode[trx_id].modulation == FSK)
+    {
+        set_fsk_pibs(trx_id);
+    }
+
+    return conf_modulation(trx_id);
+}
+
+
+/**
+ * @brief Compiles the register images of the current target mode
+ *
+ * The CSM, the CSM with raw mode as left by the mode switch PPDU and the
+ * new mode are captured into shadows; the images contain the differences
+ * between them. The PIB is restored afterwards.
+ *
+ * @param trx_id Transceiver identifier
+ * @param img Images to be compiled
+ *
+ * @return MAC_SUCCESS if both images could be compiled
+ */
+static retval_t compile_ms_image(trx_id_t trx_id, ms_image_t *img)
+{
+    static tal_pib_t pib;
+    pal_trx_shadow_t *csm = &ms_shadow[0];
+    pal_trx_shadow_t *raw = &ms_shadow[1];
+    pal_trx_shadow_t *nm = &ms_shadow[2];
+    retval_t status;
+
+    memcpy(&pib, &tal_pib[trx_id], sizeof(tal_pib_t));
+    memcpy(&img->mode, &ms_tx_mode[trx_id], sizeof(new_phy_t));
+    ms_switch_stats[trx_id].compiles++;
+
+    reg_image_seed(trx_id, csm);
+    set_csm_pib(trx_id);
+    status = reg_image_capture(csm, conf_csm, trx_id);
+    reg_image_get_fx(trx_id, &img->csm_fx);
+
+    memcpy(raw, csm, sizeof(pal_trx_shadow_t));
+    if (status == MAC_SUCCESS)
+    {
+        status = reg_image_capture(raw, conf_ms_raw_mode, trx_id);
+    }
+
+    memcpy(nm, raw, sizeof(pal_trx_shadow_t));
+    set_new_mode_pib(trx_id);
+    if (status == MAC_SUCCESS)
+    {
+        status = reg_image_capture(nm, conf_new_mode, trx_id);
+    }
+    reg_image_get_fx(trx_id, &img->new_fx);
+    /* The CSM keeps the transmit power of the new mode, see conf_modulation() */
+    img->csm_fx.TransmitPower = img->new_fx.TransmitPower;
+
+    memcpy(&tal_pib[trx_id], &pib, sizeof(tal_pib_t));
+
+    if (status == MAC_SUCCESS)
+    {
+        status = reg_image_diff(raw, nm, &img->new_mode);
+    }
+    if (status == MAC_SUCCESS)
+    {
+        status = reg_image_diff(nm, csm, &img->csm);
+    }
+
+    img->valid = (status == MAC_SUCCESS);
+
+    return status;
+}
+
+
+/**
+ * @brief Selects the register images of the current target mode
+ *
+ * Images not found within the cache are compiled; the oldest entry
+ * is replaced. Called before the channel access of a mode switch
+ * transmission, i.e. outside of the time critical path.
+ *
+ * @param trx_id Transceiver identifier
+ */
+void prepare_ms_image(trx_id_t trx_id)
+{
+    ms_image_cur[trx_id] = NULL;
+
+    for (uint8_t i = 0; i < TAL_MS_IMAGE_CACHE_SIZE; i++)
+    {
+        ms_image_t *img = &ms_image[trx_id][i];
+        if (img->valid &&
+            (memcmp(&img->mode, &ms_tx_mode[trx_id], sizeof(new_phy_t)) == 0))
+        {
+            ms_image_cur[trx_id] = img;
+            return;
+        }
+    }
+
+    ms_image_t *img = &ms_image[trx_id][ms_image_next[trx_id]];
+    ms_image_next[trx_id] = (ms_image_next[trx_id] + 1) % TAL_MS_IMAGE_CACHE_SIZE;
+    if (compile_ms_image(trx_id, img) == MAC_SUCCESS)
+    {
+        ms_image_cur[trx_id] = img;
+    }
+}
+
+
+/**
+ * @brief Invalidates all register images of a trx
+ *
+ * Called if the PIB changes, since the images depend on it.
+ *
+ * @param trx_id Transceiver identifier
+ */
+void flush_ms_images(trx_id_t trx_id)
+{
+    for (uint8_t i = 0; i < TAL_MS_IMAGE_CACHE_SIZE; i++)
+    {
+        ms_image[trx_id][i].valid = false;
+    }
+    ms_image_cur[trx_id] = NULL;
+    ms_image_applied[trx_id] = false;
+}
+
+
+/**
+ * @brief Gets the mode switch latency statistics
+ *
+ * @param trx_id Transceiver identifier
+ * @param stats Pointer to the statistics to be filled
+ */
+void tal_ms_get_switch_stats(trx_id_t trx_id, tal_ms_switch_stats_t *stats)
+{
+    *stats = ms_switch_stats[trx_id];
 }
 
 
@@ -435,13 +829,13 @@ void restore_previous_phy(trx_id_t trx_id)
     set_fsk_pibs(trx_id);
 
 #ifdef SUPPORT_OFDM
-    if (tal_pib[trx_id].ModeSwitchNewMode.modulation == OFDM)
+    if (ms_tx_mode[trx_id].modulation == OFDM)
     {
         tal_pib[trx_id].OFDMMCS = previous_phy[trx_id].rate.ofdm_mcs;
     }
 #endif
 #ifdef SUPPORT_OQPSK
-    if (tal_pib[trx_id].ModeSwitchNewMode.modulation == OQPSK)
+    if (ms_tx_mode[trx_id].modulation == OQPSK)
     {
         tal_pib[trx_id].OQPSKRateMode = previous_phy[trx_id].rate.oqpsk_rate_mod;
     }
@@ -451,6 +845,7 @@ void restore_previous_phy(trx_id_t trx_id)
 
     conf_fsk(trx_id);
     csm_active[trx_id] = false;
+    ms_image_applied[trx_id] = false;
 }
 
 
@@ -467,8 +862,8 @@ void restore_previous_phy(trx_id_t trx_id)
  *
  * @return Status
  */
-static retval_t convert_fsk_op_mode_to_data_rate(fsk_op_mode_t op_mode, sun_freq_band_t band,
-                                                 fsk_sym_rate_t *rate, fsk_mod_type_t *type)
+retval_t convert_fsk_op_mode_to_data_rate(fsk_op_mode_t op_mode, sun_freq_band_t band,
+                                          fsk_sym_rate_t *rate, fsk_mod_type_t *type)
 {
     retval_t ret = MAC_SUCCESS;
     *type = F2FSK;
@@ -659,7 +1054,7 @@ void handle_rx_ms_packet(trx_id_t trx_id)
 static void cancel_new_mode_reception(union sigval v)
 {
     /* Immediately store trx id from callback. */
-    trx_id_t trx_id = (trx_id_t)(cb_timer_element->timer_instance_id);
+    trx_id_t trx_id = (trx_id_t)(v.sival_int);
     ASSERT((trx_id >= 0) && (trx_id < NUM_TRX));
 
     /* Restore previous PHY, i.e. CSM */
@@ -667,6 +1062,9 @@ static void cancel_new_mode_reception(union sigval v)
 
     tal_state[trx_id] = TAL_IDLE;
     switch_to_rx(trx_id);
+
+    /* Frames queued while waiting for the new mode frame */
+    start_next_queued_frame(trx_id);
 }
 
 
@@ -67,7 +67,28 @@ retval_t conf_trx_modulation(trx_id_t trx_id)
 {
     retval_t status;
 
-    /* Change PHY only in TRXOFF or TXPREP. Since TXPREP is not possible here, check for TRXOFF */
+    rf_cmd_state_t previous_trx_state = enter_phy_change(trx_id);
+
+    status = conf_modulation(trx_id);
+
+    leave_phy_change(trx_id, previous_trx_state);
+
+    return status;
+}
+
+
+/**
+ * @brief Switches the transceiver to TRXOFF before changing the PHY
+ *
+ * Change PHY only in TRXOFF or TXPREP. Since TXPREP is not possible here,
+ * check for TRXOFF.
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return Previous trx state, to be passed to leave_phy_change()
+ */
+rf_cmd_state_t enter_phy_change(trx_id_t trx_id)
+{
     CALC_REG_OFFSET(trx_id);
     rf_cmd_state_t previous_trx_state = (rf_cmd_state_t)pal_dev_reg_read(RF215_TRX, GET_REG_ADDR(RG_RF09_STATE));
     if (previous_trx_state != RF_TRXOFF)
@@ -80,6 +101,54 @@ retval_t conf_trx_modulation(trx_id_t trx_id)
 #endif
     }
 
+    return previous_trx_state;
+}
+
+
+/**
+ * @brief Restores the trx state after changing the PHY
+ *
+ * @param trx_id Transceiver identifier
+ * @param previous_trx_state State returned by enter_phy_change()
+ */
+void leave_phy_change(trx_id_t trx_id, rf_cmd_state_t previous_trx_state)
+{
+    switch (previous_trx_state)
+    {
+        case RF_RX:
+            switch_to_txprep(trx_id);
+            switch_to_rx(trx_id);
+#if (defined SUPPORT_FSK) || (defined SUPPORT_OQPSK)
+            start_rpc(trx_id);
+#endif
+            break;
+
+        case RF_TXPREP:
+            switch_to_txprep(trx_id);
+            break;
+
+        default:
+            /* stay in TRXOFF */
+            break;
+    }
+}
+
+
+/**
+ * @brief Configures the modulation specific registers
+ *
+ * The transceiver state is not changed, i.e. the transceiver has to be
+ * in TRXOFF or TXPREP already. The function accesses the RF and baseband
+ * registers of trx_id only, see reg_image_capture().
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return MAC_SUCCESS if setting could be executed, else MAC_INVALID_PARAMETER
+ */
+retval_t conf_modulation(trx_id_t trx_id)
+{
+    retval_t status;
+
     switch (tal_pib[trx_id].phy.modulation)
     {
 #ifdef SUPPORT_FSK
@@ -113,6 +182,7 @@ retval_t conf_trx_modulation(trx_id_t trx_id)
 
 #if ((defined RF215v1) || (defined RF215v2)) && (defined SUPPORT_LEGACY_OQPSK)
     /* Workaround for errata #10 */
+    CALC_REG_OFFSET(trx_id);
     bb_irq_t irqm = (bb_irq_t)pal_dev_reg_read(RF215_TRX, GET_REG_ADDR(RG_BBC0_IRQM));
     bb_irq_t previous_irqm = irqm;
     if (tal_pib[trx_id].phy.modulation == LEG_OQPSK)
@@ -136,26 +206,6 @@ retval_t conf_trx_modulation(trx_id_t trx_id)
 
     tal_pib[trx_id].TransmitPower = - 17 + (int8_t)DEFAULT_TX_PWR_REG;
 
-    /* Restore previous state */
-    switch (previous_trx_state)
-    {
-        case RF_RX:
-            switch_to_txprep(trx_id);
-            switch_to_rx(trx_id);
-#if (defined SUPPORT_FSK) || (defined SUPPORT_OQPSK)
-            start_rpc(trx_id);
-#endif
-            break;
-
-        case RF_TXPREP:
-            switch_to_txprep(trx_id);
-            break;
-
-        default:
-            /* stay in TRXOFF */
-            break;
-    }
-
     return status;
 }
 
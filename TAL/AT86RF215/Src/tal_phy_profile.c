@@ -0,0 +1,262 @@
+/**
+ * @file tal_phy_profile.c
+ *
+ * @brief This file implements compiled PHY profiles.
+ *
+ * A PHY profile describes modulation, channel, transmit power and the
+ * modulation specific options. When a profile is used first, the complete
+ * RF and baseband configuration is compiled into a register image, see
+ * tal_reg_image.c. Further changes to this profile download the cached
+ * image using a few burst writes.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include "pal.h"
+#include "return_val.h"
+#include "tal.h"
+#include "ieee_const.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+
+/* === TYPES =============================================================== */
+
+/**
+ * Compiled PHY profile
+ */
+typedef struct phy_profile_entry_tag
+{
+    bool valid;
+    tal_phy_profile_t profile;
+    /** Complete PHY configuration, independent of the previous one */
+    reg_image_t image;
+    reg_image_fx_t fx;
+} phy_profile_entry_t;
+
+/* === GLOBALS ============================================================= */
+
+static phy_profile_entry_t phy_profile[NUM_TRX][TAL_PHY_PROFILE_CACHE_SIZE];
+static uint8_t phy_profile_next[NUM_TRX];
+static tal_phy_profile_stats_t phy_profile_stats[NUM_TRX];
+/* Scratch shadows used while compiling: trx registers, configured registers */
+static pal_trx_shadow_t phy_profile_shadow[2];
+
+/* === PROTOTYPES ========================================================== */
+
+static retval_t set_profile_pib(trx_id_t trx_id, const tal_phy_profile_t *profile);
+static retval_t compile_phy_profile(trx_id_t trx_id, const tal_phy_profile_t *profile,
+                                    phy_profile_entry_t *entry);
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Changes the PHY configuration to a profile
+ *
+ * @param trx_id Transceiver identifier
+ * @param profile PHY profile to be applied; profiles are compared bytewise,
+ *        i.e. unused fields should be cleared
+ *
+ * @return MAC_SUCCESS, MAC_INVALID_PARAMETER, TAL_BUSY, TAL_TRX_ASLEEP or FAILURE
+ */
+retval_t tal_phy_profile_apply(trx_id_t trx_id, const tal_phy_profile_t *profile)
+{
+    phy_profile_entry_t *entry = NULL;
+    tal_latency_t *lat = &phy_profile_stats[trx_id].cached;
+    uint32_t start;
+
+    if (tal_state[trx_id] == TAL_SLEEP)
+    {
+        return TAL_TRX_ASLEEP;
+    }
+
+    if (tal_state[trx_id] != TAL_IDLE)
+    {
+        return TAL_BUSY;
+    }
+
+    pal_get_current_time(&start);
+
+    for (uint8_t i = 0; i < TAL_PHY_PROFILE_CACHE_SIZE; i++)
+    {
+        if (phy_profile[trx_id][i].valid &&
+            (memcmp(&phy_profile[trx_id][i].profile, profile, sizeof(tal_phy_profile_t)) == 0))
+        {
+            entry = &phy_profile[trx_id][i];
+            break;
+        }
+    }
+
+    if (entry == NULL)
+    {
+        entry = &phy_profile[trx_id][phy_profile_next[trx_id]];
+        retval_t status = compile_phy_profile(trx_id, profile, entry);
+        if (status != MAC_SUCCESS)
+        {
+            return status;
+        }
+        phy_profile_next[trx_id] = (phy_profile_next[trx_id] + 1) % TAL_PHY_PROFILE_CACHE_SIZE;
+        lat = &phy_profile_stats[trx_id].cold;
+    }
+
+    rf_cmd_state_t previous_trx_state = enter_phy_change(trx_id);
+
+    reg_image_apply(&entry->image);
+    set_profile_pib(trx_id, profile);
+    reg_image_set_fx(trx_id, &entry->fx);
+
+    leave_phy_change(trx_id, previous_trx_state);
+
+#ifdef SUPPORT_MODE_SWITCH
+    /* Mode switch images depend on the PIB */
+    flush_ms_images(trx_id);
+#endif
+
+    phy_profile_stats[trx_id].writes = entry->image.writes;
+    phy_profile_stats[trx_id].image_len = entry->image.len;
+    add_latency(lat, start);
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Gets the PHY profile statistics
+ *
+ * @param trx_id Transceiver identifier
+ * @param stats Pointer to the statistics to be filled
+ */
+void tal_phy_profile_get_stats(trx_id_t trx_id, tal_phy_profile_stats_t *stats)
+{
+    *stats = phy_profile_stats[trx_id];
+}
+
+
+/**
+ * @brief Invalidates all compiled PHY profiles of a trx
+ *
+ * @param trx_id Transceiver identifier
+ */
+void flush_phy_profiles(trx_id_t trx_id)
+{
+    for (uint8_t i = 0; i < TAL_PHY_PROFILE_CACHE_SIZE; i++)
+    {
+        phy_profile[trx_id][i].valid = false;
+    }
+}
+
+
+/**
+ * @brief Sets the PIB attributes of a profile
+ *
+ * @param trx_id Transceiver identifier
+ * @param profile PHY profile
+ *
+ * * @return MAC_SUCCESS or MAC_INVALID_PARAMETER if the channel is not supported
+ */
+static retval_t set_profile_pib(trx_id_t trx_id, const tal_phy_profile_t *profile)
+{
+    uint32_t ch;
+
+    memcpy(&tal_pib[trx_id].phy, &profile->phy, sizeof(phy_t));
+    /* The channel range is known for legacy O-QPSK only */
+    if (get_supported_channels_tuple(trx_id, &ch) == MAC_SUCCESS)
+    {
+#ifndef REDUCED_PARAM_CHECK
+        if ((profile->channel < (ch & 0xFFFF)) || (profile->channel > (ch >> 16)))
+        {
+            return MAC_INVALID_PARAMETER;
+        }
+#endif
+    }
+    else
+    {
+        ch = 0;
+    }
+
+    tal_pib[trx_id].SupportedChannels = ch;
+    tal_pib[trx_id].CurrentChannel = profile->channel;
+    tal_pib[trx_id].TransmitPower = profile->tx_pwr;
+#if (defined SUPPORT_FSK) || (defined SUPPORT_OQPSK)
+    tal_pib[trx_id].RPCEnabled = profile->rpc;
+#endif
+#ifdef SUPPORT_FSK
+    tal_pib[trx_id].FSKPreambleLength = profile->fsk_preamble_len;
+    tal_pib[trx_id].FSKFECEnabled = profile->fsk_fec;
+    tal_pib[trx_id].FSKScramblePSDU = profile->fsk_scramble;
+#endif
+#ifdef SUPPORT_OFDM
+    tal_pib[trx_id].OFDMMCS = profile->ofdm_mcs;
+    tal_pib[trx_id].OFDMInterleaving = profile->ofdm_interleaving;
+#endif
+#ifdef SUPPORT_OQPSK
+    tal_pib[trx_id].OQPSKRateMode = profile->oqpsk_rate_mode;
+#endif
+    calculate_pib_values(trx_id);
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Compiles a PHY profile into a register image
+ *
+ * The PHY configuration is run against a shadow of the trx registers;
+ * all registers written by it form the image. The PIB is left unchanged.
+ *
+ * @param trx_id Transceiver identifier
+ * @param profile PHY profile
+ * @param entry Cache entry to be filled
+ *
+ * @return MAC_SUCCESS, MAC_INVALID_PARAMETER or FAILURE if the image is too large
+ */
+static retval_t compile_phy_profile(trx_id_t trx_id, const tal_phy_profile_t *profile,
+                                    phy_profile_entry_t *entry)
+{
+    static tal_pib_t pib;
+    pal_trx_shadow_t *trx = &phy_profile_shadow[0];
+    pal_trx_shadow_t *conf = &phy_profile_shadow[1];
+    retval_t status;
+
+    entry->valid = false;
+    memcpy(&pib, &tal_pib[trx_id], sizeof(tal_pib_t));
+
+    status = set_profile_pib(trx_id, profile);
+    if (status == MAC_SUCCESS)
+    {
+        reg_image_seed(trx_id, trx);
+        memcpy(conf, trx, sizeof(pal_trx_shadow_t));
+        status = reg_image_capture(conf, write_phy_pib_to_trx, trx_id);
+        reg_image_get_fx(trx_id, &entry->fx);
+    }
+
+    memcpy(&tal_pib[trx_id], &pib, sizeof(tal_pib_t));
+
+    if (status == MAC_SUCCESS)
+    {
+        /* Nothing is written in trx, i.e. every configured register is part of the image */
+        status = reg_image_diff(trx, conf, &entry->image);
+    }
+    if (status == MAC_SUCCESS)
+    {
+        memcpy(&entry->profile, profile, sizeof(tal_phy_profile_t));
+        entry->valid = true;
+        phy_profile_stats[trx_id].compiles++;
+    }
+
+    return status;
+}
+
+
+/* EOF */
@@ -33,11 +33,31 @@
 
 /* === MACROS ============================================================== */
 
+/** Derived PIB values staged explicitly within a PIB transaction */
+#define TXN_KEEP_FCS_TYPE       (1 << 0)
+#define TXN_KEEP_CCA_THRES      (1 << 1)
+
 /* === GLOBALS ============================================================= */
 
+/* Staged attributes of an open PIB transaction, see tal_pib_begin() */
+static tal_pib_t pib_txn[NUM_TRX];
+static bool pib_txn_open[NUM_TRX];
+/* Staged attributes change the PHY configuration, i.e. require TRXOFF */
+static bool pib_txn_phy[NUM_TRX];
+/* Staged attributes require the derived values to be recalculated */
+static bool pib_txn_calc[NUM_TRX];
+/* phySetting has been staged without a channel; use the lowest channel */
+static bool pib_txn_ch_reset[NUM_TRX];
+/* Derived values staged after the last recalculating attribute, TXN_KEEP_x */
+static uint8_t pib_txn_keep[NUM_TRX];
+/* Scratch shadows used by tal_pib_commit(): trx registers, staged configuration */
+static pal_trx_shadow_t pib_txn_shadow[2];
+static reg_image_t pib_txn_image;
+
 /* === PROTOTYPES ========================================================== */
 
 static retval_t apply_channel_settings(trx_id_t trx_id);
+static void write_channel_regs(trx_id_t trx_id);
 #ifndef REDUCED_PARAM_CHECK
 static retval_t check_valid_freq_range(trx_id_t trx_id);
 #endif
@@ -46,6 +66,8 @@ static retval_t set_channel(trx_id_t trx_id, uint16_t ch);
 static retval_t set_phy_based_on_channel_page(trx_id_t trx_id, ch_pg_t pg);
 static ch_pg_t calc_ch_page(trx_id_t trx_id);
 static void wait_for_freq_settling(trx_id_t trx_id);
+static retval_t validate_txn(trx_id_t trx_id);
+static retval_t write_txn_to_trx(trx_id_t trx_id);
 
 /* === IMPLEMENTATION ====================================================== */
 
@@ -292,8 +314,15 @@ retval_t config_phy(trx_id_t trx_id)
  */
 void calculate_pib_values(trx_id_t trx_id)
 {
+    phy_timing_t timing;
+
+    if (get_phy_timing(trx_id, &timing) != MAC_SUCCESS)
+    {
+        return;
+    }
+
     /* Do not change the following order; some values are used to calculate others. */
-    tal_pib[trx_id].SymbolDuration_us = tal_get_symbol_duration_us(trx_id);
+    tal_pib[trx_id].SymbolDuration_us = timing.symbol_duration_us;
 
 #ifdef SUPPORT_LEGACY_OQPSK
     if (tal_pib[trx_id].phy.modulation == LEG_OQPSK)
@@ -310,19 +339,35 @@ void calculate_pib_values(trx_id_t trx_id)
         tal_pib[trx_id].MaxPHYPacketSize = aMaxPHYPacketSize_4g;
     }
     tal_pib[trx_id].CurrentPage = calc_ch_page(trx_id);
-    //float rate = get_data_rate(trx_id);
-    
-    tal_pib[trx_id].OctetDuration_us = (uint16_t)(((float)1000 * 8) / get_data_rate(trx_id));
-    
-    tal_pib[trx_id].CCADuration_us = get_cca_duration_us(trx_id);
-   
+    tal_pib[trx_id].OctetDuration_us = timing.octet_duration_us;
+
+    if (tal_pib[trx_id].phy.freq_band == JAPAN_920)
+    {
+        tal_pib[trx_id].CCADuration_us = calculate_cca_duration_us(trx_id);
+    }
+    else
+    {
+        tal_pib[trx_id].CCADuration_us = timing.cca_duration_sym * timing.symbol_duration_us;
+    }
     tal_pib[trx_id].CCADuration_sym = tal_pib[trx_id].CCADuration_us / tal_pib[trx_id].SymbolDuration_us;
-   
-    tal_pib[trx_id].CCAThreshold = get_cca_thres(trx_id);
-    tal_pib[trx_id].ACKWaitDuration = get_AckWaitDuration_us(trx_id);
-   
+    tal_pib[trx_id].CCAThreshold = timing.cca_thres;
 
-    tal_pib[trx_id].ACKTiming = get_AckTiming_us(trx_id);
+    uint16_t ack_wait_sym = timing.ack_wait_sym;
+#ifdef SUPPORT_LEGACY_OQPSK
+    if (tal_pib[trx_id].phy.modulation != LEG_OQPSK)
+#endif
+    {
+        ack_wait_sym += tal_pib[trx_id].CCADuration_sym;
+    }
+#ifdef SUPPORT_FSK
+    if (tal_pib[trx_id].phy.modulation == FSK)
+    {
+        /* SHR duration depends on the preamble length */
+        ack_wait_sym += shr_duration_sym(trx_id);
+    }
+#endif
+    tal_pib[trx_id].ACKWaitDuration = ack_wait_sym * tal_pib[trx_id].SymbolDuration_us;
+    tal_pib[trx_id].ACKTiming = timing.ack_timing_us;
 
 #ifdef MEASURE_ON_AIR_DURATION
     tal_pib[trx_id].ACKDuration_us = tal_pib[trx_id].SymbolDuration_us * get_ack_duration_sym(trx_id);
@@ -392,6 +437,60 @@ void write_all_tal_pib_to_trx(trx_id_t trx_id)
 }
 
 
+/**
+ * @brief Writes the PHY related shadow PIB variables to the transceiver
+ *
+ * This function writes modulation, channel, CCA and transmit power settings
+ * without changing the trx state, i.e. the trx is expected to be in TRXOFF.
+ * It is used to compile PHY profiles, see tal_phy_profile.c.
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return MAC_SUCCESS if the configuration was successful
+ */
+retval_t write_phy_pib_to_trx(trx_id_t trx_id)
+{
+    /* conf_modulation() sets the default transmit power */
+    int8_t tx_pwr = tal_pib[trx_id].TransmitPower;
+    retval_t status;
+    CALC_REG_OFFSET(trx_id);
+
+#ifdef SUPPORT_OQPSK
+    pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_BBC0_OQPSKPHRTX_MOD),
+                      tal_pib[trx_id].OQPSKRateMode);
+#endif
+#ifdef SUPPORT_FSK
+    set_fsk_pibs(trx_id);
+#endif
+#ifdef SUPPORT_OFDM
+    pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_BBC0_OFDMPHRTX_MCS),
+                      tal_pib[trx_id].OFDMMCS);
+    pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_BBC0_OFDMC_POI),
+                      tal_pib[trx_id].OFDMInterleaving);
+#endif
+
+    status = conf_modulation(trx_id);
+#ifndef REDUCED_PARAM_CHECK
+    if (status == MAC_SUCCESS)
+    {
+        status = check_valid_freq_range(trx_id);
+    }
+#endif
+    if (status == MAC_SUCCESS)
+    {
+        write_channel_regs(trx_id);
+        set_ed_sample_duration(trx_id, tal_pib[trx_id].CCADuration_us);
+        pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_BBC0_PC_FCST), tal_pib[trx_id].FCSType);
+        pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_BBC0_AMEDT), tal_pib[trx_id].CCAThreshold);
+        pal_dev_write(RF215_TRX, GET_REG_ADDR(RG_BBC0_AMAACKTL),
+                      (uint8_t *)&tal_pib[trx_id].ACKTiming, 2);
+        set_tx_pwr(trx_id, tx_pwr);
+    }
+
+    return status;
+}
+
+
 #ifdef SUPPORT_FSK
 /**
  * @brief Sets FSK related PIBs
@@ -547,29 +646,7 @@ static retval_t apply_channel_settings(trx_id_t trx_id)
 #endif
     if (status == MAC_SUCCESS)
     {
-        uint32_t freq = tal_pib[trx_id].phy.freq_f0;
-        uint32_t spacing = tal_pib[trx_id].phy.ch_spacing;
-        CALC_REG_OFFSET(trx_id);
-        uint16_t reg_val;
-
-        /* Offset handling for 2.4GHz only */
-        if (trx_id == RF24)
-        {
-            freq -= 1500000000;
-        }
-        reg_val = (uint16_t)(freq / 25000);
-        pal_dev_write(RF215_TRX, GET_REG_ADDR(RG_RF09_CCF0L), (uint8_t *)&reg_val, 2);
-
-        /* Set channel spacing */
-        spacing /= 25000; // adjust to register scaling
-        pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_RF09_CS), (uint8_t)spacing);
-
-        /*
-         * Set channel and channel mode.
-         * Touching the CNM register forces the calculation of the actual frequency.
-         */
-        pal_dev_write(RF215_TRX, GET_REG_ADDR(RG_RF09_CNL),
-                      (uint8_t *)&tal_pib[trx_id].CurrentChannel, 2);
+        write_channel_regs(trx_id);
 
         /* Wait until channel set is completed */
         if (trx_state[trx_id] == RF_TXPREP)
@@ -582,6 +659,26 @@ static retval_t apply_channel_settings(trx_id_t trx_id)
 }
 
 
+/**
+ * @brief Writes center frequency, channel spacing and channel number
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void write_channel_regs(trx_id_t trx_id)
+{
+    CALC_REG_OFFSET(trx_id);
+    uint8_t regs[RG_RF09_CNM - RG_RF09_CS + 1];
+
+    /*
+     * Channel spacing, center frequency, channel and channel mode.
+     * Touching the CNM register (last one) forces the calculation of the
+     * actual frequency.
+     */
+    get_channel_regs(trx_id, tal_pib[trx_id].CurrentChannel, regs);
+    pal_dev_write(RF215_TRX, GET_REG_ADDR(RG_RF09_CS), regs, sizeof(regs));
+}
+
+
 /**
  * @brief Gets a TAL PIB attribute
  *
@@ -867,11 +964,17 @@ retval_t tal_pib_set(trx_id_t trx_id, uint8_t attribute, pib_value_t *value)
         return TAL_TRX_ASLEEP;
     }
 
-    if (tal_state[trx_id] != TAL_IDLE)
+    if ((tal_state[trx_id] != TAL_IDLE) || pib_txn_open[trx_id])
     {
         return TAL_BUSY;
     }
 
+    /* Register images depend on the PIB */
+#ifdef SUPPORT_MODE_SWITCH
+    flush_ms_images(trx_id);
+#endif
+    flush_phy_profiles(trx_id);
+
     CALC_REG_OFFSET(trx_id);
 
     switch (attribute)
@@ -1283,6 +1386,405 @@ retval_t tal_pib_set_all(uint8_t attribute, pib_value_t *value)
 }
 
 
+/**
+ * @brief Starts a PIB transaction
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return MAC_SUCCESS, TAL_BUSY or TAL_TRX_ASLEEP
+ */
+retval_t tal_pib_begin(trx_id_t trx_id)
+{
+    if (tal_state[trx_id] == TAL_SLEEP)
+    {
+        return TAL_TRX_ASLEEP;
+    }
+
+    if (tal_state[trx_id] != TAL_IDLE)
+    {
+        return TAL_BUSY;
+    }
+
+    memcpy(&pib_txn[trx_id], &tal_pib[trx_id], sizeof(tal_pib_t));
+    pib_txn_phy[trx_id] = false;
+    pib_txn_calc[trx_id] = false;
+    pib_txn_ch_reset[trx_id] = false;
+    pib_txn_keep[trx_id] = 0;
+    pib_txn_open[trx_id] = true;
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Stages a TAL PIB attribute within a transaction
+ *
+ * Attributes that make tal_pib_set() recalculate the derived PIB values
+ * override an FCS type or CCA threshold staged before.
+ *
+ * @param trx_id Transceiver identifier
+ * @param attribute TAL infobase attribute ID
+ * @param value TAL infobase attribute value to be staged
+ *
+ * @return MAC_SUCCESS, MAC_UNSUPPORTED_ATTRIBUTE, MAC_INVALID_PARAMETER or FAILURE
+ */
+retval_t tal_pib_set_deferred(trx_id_t trx_id, uint8_t attribute, pib_value_t *value)
+{
+    tal_pib_t *pib = &pib_txn[trx_id];
+    retval_t status = MAC_SUCCESS;
+    bool phy = true;
+    bool calc = false;
+
+    if (!pib_txn_open[trx_id])
+    {
+        return FAILURE;
+    }
+
+    switch (attribute)
+    {
+        case phySetting:
+            memcpy(&pib->phy, value, sizeof(phy_t));
+            pib_txn_ch_reset[trx_id] = true;
+            calc = true;
+            break;
+
+        case phyCurrentChannel:
+            pib->CurrentChannel = value->pib_value_16bit;
+            pib_txn_ch_reset[trx_id] = false;
+            break;
+
+        case phyTransmitPower:
+            /* Limited to the trx range by set_tx_pwr() */
+            pib->TransmitPower = (int8_t)value->pib_value_8bit;
+            phy = false;
+            break;
+
+        case phyCCAThreshold:
+            pib->CCAThreshold = value->pib_value_8bit;
+            pib_txn_keep[trx_id] |= TXN_KEEP_CCA_THRES;
+            phy = false;
+            break;
+
+        case macFCSType:
+            pib->FCSType = value->pib_value_bool;
+            pib->FCSLen = (pib->FCSType == FCS_TYPE_4_OCTETS) ? 4 : 2;
+            pib_txn_keep[trx_id] |= TXN_KEEP_FCS_TYPE;
+            phy = false;
+            break;
+
+#ifdef SUPPORT_OQPSK
+        case phyOQPSKRateMode:
+            pib->OQPSKRateMode = (oqpsk_rate_mode_t)value->pib_value_8bit;
+            calc = true;
+            break;
+#endif
+
+#ifdef SUPPORT_FSK
+        case phyFSKFECEnabled:
+            pib->FSKFECEnabled = value->pib_value_bool;
+            calc = true;
+            break;
+
+        case phyFSKFECInterleavingRSC:
+            pib->FSKFECInterleavingRSC = value->pib_value_bool;
+            break;
+
+        case phyFSKFECScheme:
+            pib->FSKFECScheme = value->pib_value_bool;
+            break;
+
+        case phyFSKPreambleLength:
+            pib->FSKPreambleLength = value->pib_value_16bit;
+            calc = true;
+            break;
+
+        case phyFSKScramblePSDU:
+            pib->FSKScramblePSDU = value->pib_value_bool;
+            break;
+
+#ifdef SUPPORT_MODE_SWITCH
+        case phyFSKModeSwitchEnabled:
+            pib->ModeSwitchEnabled = value->pib_value_bool;
+            break;
+#endif
+#endif /* #ifdef SUPPORT_FSK */
+
+#ifdef SUPPORT_OFDM
+        case phyOFDMMCS:
+            pib->OFDMMCS = (ofdm_mcs_t)value->pib_value_8bit;
+            calc = true;
+            break;
+
+        case phyOFDMInterleaving:
+            pib->OFDMInterleaving = value->pib_value_bool;
+            calc = true;
+            break;
+#endif /* #ifdef SUPPORT_OFDM */
+
+#if (defined SUPPORT_FSK) || (defined SUPPORT_OQPSK)
+        case phyRPCEnabled:
+            pib->RPCEnabled = value->pib_value_bool;
+            break;
+#endif
+
+        case macMaxNumRxFramesDuringBackoff:
+            pib->MaxNumRxFramesDuringBackoff = value->pib_value_8bit;
+            phy = false;
+            break;
+
+        case macMaxCSMABackoffs:
+            pib->MaxCSMABackoffs = value->pib_value_8bit;
+            phy = false;
+            break;
+
+        /* MinBE <= MaxBE is checked by tal_pib_commit() */
+        case macMinBE:
+            pib->MinBE = value->pib_value_8bit;
+            phy = false;
+            break;
+
+        case macMaxBE:
+            if (value->pib_value_8bit > 8)
+            {
+                status = MAC_INVALID_PARAMETER;
+            }
+            else
+            {
+                pib->MaxBE = value->pib_value_8bit;
+            }
+            phy = false;
+            break;
+
+        case macMaxFrameRetries:
+            pib->MaxFrameRetries = value->pib_value_8bit;
+            phy = false;
+            break;
+
+        case macPANId:
+            pib->PANId = value->pib_value_16bit;
+            phy = false;
+            break;
+
+        case macShortAddress:
+            pib->ShortAddress = value->pib_value_16bit;
+            phy = false;
+            break;
+
+        case macIeeeAddress:
+            pib->IeeeAddress = value->pib_value_64bit;
+            phy = false;
+            break;
+
+        case mac_i_pan_coordinator:
+            pib->PrivatePanCoordinator = value->pib_value_bool;
+            phy = false;
+            break;
+
+        default:
+            status = MAC_UNSUPPORTED_ATTRIBUTE;
+            phy = false;
+            break;
+    }
+
+    if (phy)
+    {
+        pib_txn_phy[trx_id] = true;
+    }
+    if (calc)
+    {
+        pib_txn_calc[trx_id] = true;
+        pib_txn_keep[trx_id] = 0;
+    }
+
+    return status;
+}
+
+
+/**
+ * @brief Applies the staged attributes of a transaction
+ *
+ * The staged PIB is run against a shadow of the trx registers; the
+ * registers that differ from the current trx content form a register
+ * image, which is downloaded using one burst write per run.
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return MAC_SUCCESS, MAC_INVALID_PARAMETER, TAL_BUSY, TAL_TRX_ASLEEP or FAILURE
+ */
+retval_t tal_pib_commit(trx_id_t trx_id)
+{
+    static tal_pib_t pib;
+    pal_trx_shadow_t *trx = &pib_txn_shadow[0];
+    pal_trx_shadow_t *conf = &pib_txn_shadow[1];
+    retval_t status;
+
+    if (!pib_txn_open[trx_id])
+    {
+        return FAILURE;
+    }
+    pib_txn_open[trx_id] = false;
+
+    if (tal_state[trx_id] == TAL_SLEEP)
+    {
+        return TAL_TRX_ASLEEP;
+    }
+
+    if (tal_state[trx_id] != TAL_IDLE)
+    {
+        return TAL_BUSY;
+    }
+
+    /* Keep previous PIB for the case the staged attributes are rejected */
+    memcpy(&pib, &tal_pib[trx_id], sizeof(tal_pib_t));
+    memcpy(&tal_pib[trx_id], &pib_txn[trx_id], sizeof(tal_pib_t));
+
+    status = validate_txn(trx_id);
+    if (status == MAC_SUCCESS)
+    {
+        reg_image_seed(trx_id, trx);
+        memcpy(conf, trx, sizeof(pal_trx_shadow_t));
+        /* All trx registers are known, i.e. the image contains changed registers only */
+        memset(trx->written, 0xFF, sizeof(trx->written));
+        status = reg_image_capture(conf, write_txn_to_trx, trx_id);
+    }
+    if (status != MAC_SUCCESS)
+    {
+        memcpy(&tal_pib[trx_id], &pib, sizeof(tal_pib_t));
+        return status;
+    }
+
+    /* A new channel takes effect by writing CNM; see write_channel_regs() */
+    CALC_REG_OFFSET(trx_id);
+    reg_image_force_block(trx, conf, GET_REG_ADDR(RG_RF09_CS),
+                          RG_RF09_CNM - RG_RF09_CS + 1);
+
+    /* Register images depend on the PIB */
+#ifdef SUPPORT_MODE_SWITCH
+    flush_ms_images(trx_id);
+#endif
+    flush_phy_profiles(trx_id);
+
+    bool fits = (reg_image_diff(trx, conf, &pib_txn_image) == MAC_SUCCESS);
+    if (fits && (pib_txn_image.len == 0))
+    {
+        /* Trx registers are up to date already */
+        return MAC_SUCCESS;
+    }
+
+    rf_cmd_state_t previous_trx_state = RF_TRXOFF;
+    if (pib_txn_phy[trx_id])
+    {
+        previous_trx_state = enter_phy_change(trx_id);
+    }
+
+    if (fits)
+    {
+        reg_image_apply(&pib_txn_image);
+    }
+    else
+    {
+        /* Too many changes for an image; write register by register */
+        write_txn_to_trx(trx_id);
+    }
+
+    if (pib_txn_phy[trx_id])
+    {
+        leave_phy_change(trx_id, previous_trx_state);
+    }
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Validates the staged attributes and calculates the derived values
+ *
+ * The staged attributes have been copied to tal_pib[trx_id] already.
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return MAC_SUCCESS or MAC_INVALID_PARAMETER
+ */
+static retval_t validate_txn(trx_id_t trx_id)
+{
+    uint32_t ch;
+
+    if (tal_pib[trx_id].MinBE > tal_pib[trx_id].MaxBE)
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    if (pib_txn_calc[trx_id])
+    {
+        bool fcs_type = tal_pib[trx_id].FCSType;
+        uint8_t fcs_len = tal_pib[trx_id].FCSLen;
+        uint8_t cca_thres = tal_pib[trx_id].CCAThreshold;
+
+        calculate_pib_values(trx_id);
+
+        if (pib_txn_keep[trx_id] & TXN_KEEP_FCS_TYPE)
+        {
+            tal_pib[trx_id].FCSType = fcs_type;
+            tal_pib[trx_id].FCSLen = fcs_len;
+        }
+        if (pib_txn_keep[trx_id] & TXN_KEEP_CCA_THRES)
+        {
+            tal_pib[trx_id].CCAThreshold = cca_thres;
+        }
+    }
+
+    if (get_supported_channels_tuple(trx_id, &ch) == MAC_SUCCESS)
+    {
+        if (pib_txn_ch_reset[trx_id])
+        {
+            tal_pib[trx_id].CurrentChannel = (uint16_t)(ch & 0xFFFF);
+        }
+#ifndef REDUCED_PARAM_CHECK
+        else if ((tal_pib[trx_id].CurrentChannel < (ch & 0xFFFF)) ||
+                 (tal_pib[trx_id].CurrentChannel > (ch >> 16)))
+        {
+            return MAC_INVALID_PARAMETER;
+        }
+#endif
+        tal_pib[trx_id].SupportedChannels = ch;
+    }
+    else
+    {
+        if (pib_txn_ch_reset[trx_id])
+        {
+            tal_pib[trx_id].CurrentChannel = 0;
+        }
+        tal_pib[trx_id].SupportedChannels = 0;
+    }
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Writes the attributes supported by tal_pib_set_deferred() to the trx
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return MAC_SUCCESS if the PHY configuration is supported
+ */
+static retval_t write_txn_to_trx(trx_id_t trx_id)
+{
+    CALC_REG_OFFSET(trx_id);
+
+    pal_dev_write(RF215_TRX, GET_REG_ADDR(RG_BBC0_MACPID0F0),
+                  (uint8_t *)&tal_pib[trx_id].PANId, 2);
+    pal_dev_write(RF215_TRX, GET_REG_ADDR(RG_BBC0_MACSHA0F0),
+                  (uint8_t *)&tal_pib[trx_id].ShortAddress, 2);
+    pal_dev_write(RF215_TRX, GET_REG_ADDR(RG_BBC0_MACEA0),
+                  (uint8_t *)&tal_pib[trx_id].IeeeAddress, 8);
+    pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_BBC0_AFC1_PANC0),
+                      (uint8_t)tal_pib[trx_id].PrivatePanCoordinator);
+
+    return write_phy_pib_to_trx(trx_id);
+}
+
+
 
 /**
  * @brief Sets the provided channel
@@ -192,6 +192,7 @@ retval_t tal_trx_wakeup(trx_id_t trx_id)
      * The previous buffer got freed with entering sleep mode.
      */
     tal_rx_buffer[trx_id] = bmm_buffer_alloc(LARGE_BUFFER_SIZE);
+    BMM_SET_OWNER(tal_rx_buffer[trx_id], BMM_OWNER_TAL_RX);
 
     /* Fill trx_id in new buffer */
     if (tal_rx_buffer[trx_id] != NULL)
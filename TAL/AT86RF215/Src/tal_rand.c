@@ -1,7 +1,22 @@
 /**
  * @file tal_rand.c
  *
- * @brief This file implements the random seed function.
+ * @brief This file implements the random seed function and the entropy pool.
+ *
+ * With SUPPORT_ENTROPY_POOL the RNDV register of each transceiver is read
+ * periodically in bursts of TAL_ENTROPY_BURST values while the transceiver
+ * is idle in RX. A burst is issued as a single SPI message. The values are
+ * absorbed into a 256-bit pool using the ARX rounds of SipHash, and each
+ * read is credited with TAL_ENTROPY_BITS_PER_READ bits. Random octets are
+ * squeezed out of the pool once 128 bits have been credited.
+ *
+ * Backoffs use a xoshiro128** generator per transceiver instead of rand(),
+ * which is shared by all threads and seeded with 16 bits only. The
+ * generators are reseeded from the pool whenever 128 new bits have been
+ * credited. Each generator is reseeded by its own transceiver's next backoff,
+ * so it is only ever touched from the calling context of that transceiver.
+ * The pool and the generators are shared with the harvest timer threads and
+ * are protected by a mutex.
  *
  * $Id: tal_rand.c 37069 2015-03-16 11:59:31Z uwalter $
  *
@@ -20,18 +35,82 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
 #include "pal.h"
 #include "return_val.h"
 #include "tal.h"
 #include "tal_config.h"
 #include "tal_internal.h"
+#include <signal.h>
 
 /* === MACROS ============================================================== */
 
+#ifdef SUPPORT_ENTROPY_POOL
+#if ((TAL_ENTROPY_BURST < 8) || (TAL_ENTROPY_BURST > PAL_TRX_MAX_REPEAT))
+#   error "Invalid entropy burst size"
+#endif
+
+/** Entropy in bits the pool holds at most */
+#define ENTROPY_POOL_BITS           (256)
+
+/** Entropy in bits required for output and for a reseed */
+#define ENTROPY_SEED_BITS           (128)
+
+/** Time in ms until a burst is retried if the trx was busy */
+#define ENTROPY_RETRY_MS            (10)
+
+#define ROTL64(x, b)                (uint64_t)(((x) << (b)) | ((x) >> (64 - (b))))
+#define ROTL32(x, b)                (uint32_t)(((x) << (b)) | ((x) >> (32 - (b))))
+#endif
+
+/* === TYPES =============================================================== */
+
+#ifdef SUPPORT_ENTROPY_POOL
+/**
+ * Entropy pool shared by both transceivers
+ */
+typedef struct entropy_pool_tag
+{
+    uint64_t v[4];
+    /** Credited bits */
+    uint16_t bits;
+    /** Credited bits since the last reseed of each backoff generator */
+    uint16_t fresh_bits[NUM_TRX];
+    tal_entropy_stats_t stats;
+} entropy_pool_t;
+#endif
+
 /* === GLOBALS ============================================================= */
 
+#ifdef SUPPORT_ENTROPY_POOL
+/* SipHash initialization constants */
+static entropy_pool_t pool =
+{
+    .v = { 0x736f6d6570736575ULL, 0x646f72616e646f6dULL,
+           0x6c7967656e657261ULL, 0x7465646279746573ULL }
+};
+
+/** State of the backoff generators */
+static uint32_t prng_state[NUM_TRX][4];
+
+/** Protects the pool and the backoff generators */
+static pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
 /* === PROTOTYPES ========================================================== */
 
+#ifdef SUPPORT_ENTROPY_POOL
+static void sip_round(uint64_t *v);
+static void pool_absorb(uint64_t m);
+static uint64_t pool_squeeze(void);
+static void pool_add(const uint8_t *data, uint8_t len, uint16_t credit);
+static void reseed_prng(trx_id_t trx_id);
+static bool is_rx_idle(trx_id_t trx_id);
+static void harvest(trx_id_t trx_id);
+static void entropy_timer_cb(union sigval v);
+#endif
+
 /* === IMPLEMENTATION ====================================================== */
 
 /**
@@ -121,8 +200,350 @@ retval_t tal_generate_rand_seed(void)
     /* Set the seed for the random number generator. */
     srand(seed);
 
+#ifdef SUPPORT_ENTROPY_POOL
+    /* The backoff generators must not wait for the first burst */
+    pthread_mutex_lock(&pool_mutex);
+    pool_add((uint8_t *)&seed, sizeof(seed), 0);
+    for (trx_id = RF09; trx_id < NUM_TRX; trx_id++)
+    {
+        reseed_prng(trx_id);
+    }
+    pthread_mutex_unlock(&pool_mutex);
+#endif
+
+    return MAC_SUCCESS;
+}
+
+#ifdef SUPPORT_ENTROPY_POOL
+/**
+ * @brief Gets random octets from the entropy pool
+ *
+ * @param data Storage for the random octets
+ * @param len Number of octets
+ *
+ * @return MAC_SUCCESS or MAC_NO_DATA if the pool has not been filled yet
+ * @ingroup apiTalApi
+ */
+retval_t tal_get_random_bytes(uint8_t *data, uint16_t len)
+{
+    pthread_mutex_lock(&pool_mutex);
+    if (!pool.stats.ready)
+    {
+        pthread_mutex_unlock(&pool_mutex);
+        return MAC_NO_DATA;
+    }
+
+    pool.stats.bytes_out += len;
+    while (len > 0)
+    {
+        uint64_t r = pool_squeeze();
+        uint8_t n = (len < sizeof(r)) ? (uint8_t)len : sizeof(r);
+
+        memcpy(data, &r, n);
+        data += n;
+        len -= n;
+    }
+    pthread_mutex_unlock(&pool_mutex);
+
     return MAC_SUCCESS;
 }
 
 
+/**
+ * @brief Gets the entropy pool statistics
+ *
+ * @param stats Pointer to the statistics to be filled
+ * @ingroup apiTalApi
+ */
+void tal_get_entropy_stats(tal_entropy_stats_t *stats)
+{
+    pthread_mutex_lock(&pool_mutex);
+    *stats = pool.stats;
+    stats->pool_bits = pool.bits;
+    pthread_mutex_unlock(&pool_mutex);
+}
+
+
+/**
+ * @brief Starts harvesting the RNDV register
+ *
+ * Called whenever the trx has been configured, since a reset stops the
+ * timer.
+ *
+ * @param trx_id Transceiver identifier
+ */
+void init_entropy_pool(trx_id_t trx_id)
+{
+    pal_timer_start(TAL_T_ENTROPY, trx_id, 1,
+                    TIMEOUT_RELATIVE, (FUNC_PTR())entropy_timer_cb, NULL);
+}
+
+
+/**
+ * @brief Gets the next random number of the backoff generator
+ *
+ * xoshiro128**; the generator is reseeded first if enough new entropy has
+ * been credited since its last reseed.
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return 32-bit random number
+ */
+uint32_t prng_next(trx_id_t trx_id)
+{
+    uint32_t *s = prng_state[trx_id];
+    uint32_t result;
+    uint32_t t;
+
+    pthread_mutex_lock(&pool_mutex);
+    if (pool.fresh_bits[trx_id] >= ENTROPY_SEED_BITS)
+    {
+        reseed_prng(trx_id);
+    }
+
+    result = ROTL32(s[1] * 5, 7) * 9;
+    t = s[1] << 9;
+
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = ROTL32(s[3], 11);
+    pthread_mutex_unlock(&pool_mutex);
+
+    return result;
+}
+
+
+/**
+ * @brief Applies a SipHash round to the pool
+ *
+ * @param v Pool state
+ */
+static void sip_round(uint64_t *v)
+{
+    v[0] += v[1];
+    v[1] = ROTL64(v[1], 13);
+    v[1] ^= v[0];
+    v[0] = ROTL64(v[0], 32);
+    v[2] += v[3];
+    v[3] = ROTL64(v[3], 16);
+    v[3] ^= v[2];
+    v[0] += v[3];
+    v[3] = ROTL64(v[3], 21);
+    v[3] ^= v[0];
+    v[2] += v[1];
+    v[1] = ROTL64(v[1], 17);
+    v[1] ^= v[2];
+    v[2] = ROTL64(v[2], 32);
+}
+
+
+/**
+ * @brief Absorbs a word into the pool
+ *
+ * @param m Word
+ */
+static void pool_absorb(uint64_t m)
+{
+    pool.v[3] ^= m;
+    sip_round(pool.v);
+    sip_round(pool.v);
+    pool.v[0] ^= m;
+}
+
+
+/**
+ * @brief Squeezes a word out of the pool
+ *
+ * The finalization of SipHash is applied to the pool itself, so each word
+ * leaves the pool in a new state.
+ *
+ * @return Random word
+ */
+static uint64_t pool_squeeze(void)
+{
+    pool.v[2] ^= 0xff;
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        sip_round(pool.v);
+    }
+
+    return pool.v[0] ^ pool.v[1] ^ pool.v[2] ^ pool.v[3];
+}
+
+
+/**
+ * @brief Adds raw data to the pool
+ *
+ * Called with the pool mutex held.
+ *
+ * @param data Raw data
+ * @param len Number of octets
+ * @param credit Entropy of the data in bits
+ */
+static void pool_add(const uint8_t *data, uint8_t len, uint16_t credit)
+{
+    while (len > 0)
+    {
+        uint64_t m = 0;
+        uint8_t n = (len < sizeof(m)) ? len : sizeof(m);
+
+        memcpy(&m, data, n);
+        /* The length separates a partial word from a full one */
+        m ^= (uint64_t)n << 56;
+        pool_absorb(m);
+        data += n;
+        len -= n;
+    }
+
+    pool.bits += credit;
+    if (pool.bits > ENTROPY_POOL_BITS)
+    {
+        pool.bits = ENTROPY_POOL_BITS;
+    }
+    for (uint8_t trx_id = 0; trx_id < NUM_TRX; trx_id++)
+    {
+        if (pool.fresh_bits[trx_id] < ENTROPY_POOL_BITS)
+        {
+            pool.fresh_bits[trx_id] += credit;
+        }
+    }
+    if (pool.bits >= ENTROPY_SEED_BITS)
+    {
+        pool.stats.ready = true;
+    }
+}
+
+
+/**
+ * @brief Reseeds the backoff generator of a transceiver from the pool
+ *
+ * Called with the pool mutex held.
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void reseed_prng(trx_id_t trx_id)
+{
+    uint32_t *s = prng_state[trx_id];
+    uint64_t a = pool_squeeze();
+    uint64_t b = pool_squeeze();
+
+    s[0] ^= (uint32_t)a;
+    s[1] ^= (uint32_t)(a >> 32);
+    s[2] ^= (uint32_t)b;
+    s[3] ^= (uint32_t)(b >> 32);
+    /* The all-zero state is a fixed point */
+    if ((s[0] | s[1] | s[2] | s[3]) == 0)
+    {
+        s[0] = 1;
+    }
+
+    pool.fresh_bits[trx_id] = 0;
+    pool.stats.reseeds++;
+}
+
+
+/**
+ * @brief Checks whether the trx is idle in RX
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return true if neither a transaction nor a frame reception is ongoing
+ */
+static bool is_rx_idle(trx_id_t trx_id)
+{
+    if ((tal_state[trx_id] != TAL_IDLE) || (tx_state[trx_id] != TX_IDLE) ||
+        (trx_state[trx_id] != RF_RX) || ack_transmitting[trx_id] ||
+        (tal_bb_irqs[trx_id] != BB_IRQ_NO_IRQ))
+    {
+        return false;
+    }
+
+    /* The AGC is frozen while a frame is received */
+    CALC_REG_OFFSET(trx_id);
+    return (pal_dev_bit_read(RF215_TRX, GET_REG_ADDR(SR_RF09_AGCC_FRZS)) == 0);
+}
+
+
+/**
+ * @brief Reads a burst of RNDV values into the pool
+ *
+ * A burst with a single repeated value indicates a stuck register or a
+ * failed access and is rejected.
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void harvest(trx_id_t trx_id)
+{
+    uint8_t raw[TAL_ENTROPY_BURST];
+    uint64_t now;
+    uint8_t i;
+
+    CALC_REG_OFFSET(trx_id);
+    pal_dev_read_repeat(RF215_TRX, GET_REG_ADDR(RG_RF09_RNDV), raw, TAL_ENTROPY_BURST);
+    pal_get_current_time_ns(&now);
+
+    pthread_mutex_lock(&pool_mutex);
+    pool.stats.raw_bytes += TAL_ENTROPY_BURST;
+    for (i = 1; (i < TAL_ENTROPY_BURST) && (raw[i] == raw[0]); i++)
+    {
+    }
+    if (i == TAL_ENTROPY_BURST)
+    {
+        pool.stats.rejected++;
+        pthread_mutex_unlock(&pool_mutex);
+        return;
+    }
+
+    /* The time of the burst adds some jitter, but is not credited */
+    pool_absorb(now);
+    pool_add(raw, TAL_ENTROPY_BURST,
+             (uint16_t)TAL_ENTROPY_BURST * TAL_ENTROPY_BITS_PER_READ);
+    pool.stats.bursts++;
+    pthread_mutex_unlock(&pool_mutex);
+}
+
+
+/**
+ * @brief Harvests the RNDV register periodically
+ *
+ * @param v Timer parameter; transceiver identifier
+ */
+static void entropy_timer_cb(union sigval v)
+{
+    trx_id_t trx_id = (trx_id_t)v.sival_int;
+    uint32_t delay;
+
+    ENTER_CRITICAL_REGION();
+    if (tal_state[trx_id] == TAL_SLEEP)
+    {
+        /* Restarted by trx_config() after wake-up */
+        LEAVE_CRITICAL_REGION();
+        return;
+    }
+
+    if (is_rx_idle(trx_id))
+    {
+        harvest(trx_id);
+        pthread_mutex_lock(&pool_mutex);
+        delay = (pool.bits < ENTROPY_POOL_BITS) ? TAL_ENTROPY_INTERVAL_MS :
+                TAL_ENTROPY_FULL_INTERVAL_MS;
+    }
+    else
+    {
+        pthread_mutex_lock(&pool_mutex);
+        pool.stats.busy++;
+        delay = ENTROPY_RETRY_MS;
+    }
+    pthread_mutex_unlock(&pool_mutex);
+    LEAVE_CRITICAL_REGION();
+
+    pal_timer_start(TAL_T_ENTROPY, trx_id, delay * 1000,
+                    TIMEOUT_RELATIVE, (FUNC_PTR())entropy_timer_cb, NULL);
+}
+#endif /* #ifdef SUPPORT_ENTROPY_POOL */
+
+
 /* EOF */
@@ -0,0 +1,801 @@
+/**
+ * @file tal_rate_ctrl.c
+ *
+ * @brief This file implements the per-neighbor rate control.
+ *
+ * The rate of the mode switch target mode (OFDM MCS, O-QPSK rate mode or
+ * FSK operating mode and FEC) is selected per destination address in the
+ * style of Minstrel: the success probability of each rate is tracked as
+ * an EWMA, the rate with the best expected throughput is used and other
+ * rates are sampled from time to time. Retries fall back along a chain
+ * of more robust rates. The energy of frames received from a neighbor
+ * seeds the first rate and invalidates fast rates if the link degrades.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include "pal.h"
+#include "return_val.h"
+#include "tal.h"
+#include "ieee_const.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include "ieee_154g.h"
+
+#ifdef SUPPORT_RATE_CONTROL
+
+/* === TYPES =============================================================== */
+
+/**
+ * Rate state of a neighbor
+ */
+typedef struct rc_rate_tag
+{
+    /** EWMA of the success probability in 1/1000 */
+    uint16_t prob;
+    /** true if prob is based on at least one update interval */
+    bool sampled;
+    /** Attempts and successes of the current update interval */
+    uint16_t attempts;
+    uint16_t successes;
+    uint32_t total_attempts;
+    uint32_t total_successes;
+} rc_rate_t;
+
+/**
+ * Neighbor entry
+ */
+typedef struct rc_neighbor_tag
+{
+    uint8_t addr[EXT_ADDR_LEN];
+    /** Address length; 0 for an unused entry */
+    uint8_t addr_len;
+    uint8_t best_tp;
+    uint8_t second_tp;
+    uint8_t best_prob;
+    /** EWMA of the energy of received frames in dBm */
+    int8_t ed;
+    bool ed_valid;
+    /** Energy at the last statistics update */
+    int8_t ed_ref;
+    uint8_t sample_cnt;
+    uint32_t last_update;
+    uint32_t last_used;
+    uint32_t frames;
+    uint32_t samples;
+    rc_rate_t rate[TAL_RC_MAX_RATES];
+} rc_neighbor_t;
+
+/**
+ * Ongoing transmission
+ */
+typedef struct rc_tx_tag
+{
+    /** Neighbor of the frame; NULL if the frame is not rate controlled */
+    rc_neighbor_t *nb;
+    /** Rate of the current attempt */
+    uint8_t rate;
+    uint8_t attempt;
+    bool sample;
+} rc_tx_t;
+
+/* === MACROS ============================================================== */
+
+#define RC_PROB_MAX             (1000)
+
+/* Throughput estimate of a rate of a neighbor: kbit/s * 1/1000 */
+#define RC_TP(trx_id, nb, i)    \
+    ((nb)->rate[i].sampled ? (uint32_t)rc_mode_kbps[trx_id][i] * (nb)->rate[i].prob : 0)
+
+/* Supported MCS range per OFDM option, see table 148 */
+#define OFDM_MCS_MIN_TABLE      { MCS0, MCS0, MCS1, MCS2 }
+#define OFDM_MCS_MAX_TABLE      { MCS3, MCS5, MCS6, MCS6 }
+
+/* === GLOBALS ============================================================= */
+
+/* Rates of the mode switch target mode, ordered by increasing data rate */
+static new_phy_t rc_mode[NUM_TRX][TAL_RC_MAX_RATES];
+static uint16_t rc_mode_kbps[NUM_TRX][TAL_RC_MAX_RATES];
+static uint8_t rc_num_rates[NUM_TRX];
+/* Target mode the rate table has been built for */
+static new_phy_t rc_table_mode[NUM_TRX];
+static sun_freq_band_t rc_table_band[NUM_TRX];
+static rc_neighbor_t rc_nb[NUM_TRX][TAL_RC_MAX_NEIGHBORS];
+static rc_tx_t rc_tx[NUM_TRX];
+/* Attempts and successes per rate over all neighbors */
+static uint32_t rc_attempts[NUM_TRX][TAL_RC_MAX_RATES];
+static uint32_t rc_successes[NUM_TRX][TAL_RC_MAX_RATES];
+
+#ifdef SUPPORT_OFDM
+static const uint8_t ofdm_mcs_min[4] = OFDM_MCS_MIN_TABLE;
+static const uint8_t ofdm_mcs_max[4] = OFDM_MCS_MAX_TABLE;
+#endif
+
+/* === PROTOTYPES ========================================================== */
+
+static bool table_valid(trx_id_t trx_id);
+static void add_rate(trx_id_t trx_id, new_phy_t *mode);
+static void build_rate_table(trx_id_t trx_id);
+static rc_neighbor_t *get_neighbor(trx_id_t trx_id, uint8_t *addr,
+                                   uint8_t addr_len, bool create);
+static uint8_t seed_rate(trx_id_t trx_id, rc_neighbor_t *nb);
+static void select_best_rates(trx_id_t trx_id, rc_neighbor_t *nb);
+static void update_stats(trx_id_t trx_id, rc_neighbor_t *nb);
+static uint8_t get_sample_rate(trx_id_t trx_id, rc_neighbor_t *nb);
+static void apply_rate(trx_id_t trx_id, uint8_t rate);
+static void account_attempt(trx_id_t trx_id, bool success);
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Checks if the rate table matches the current target mode
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return true if the table can be used
+ */
+static bool table_valid(trx_id_t trx_id)
+{
+    new_phy_t *mode = &tal_pib[trx_id].ModeSwitchNewMode;
+
+    if ((rc_num_rates[trx_id] == 0) ||
+        (rc_table_band[trx_id] != tal_pib[trx_id].phy.freq_band) ||
+        (rc_table_mode[trx_id].modulation != mode->modulation))
+    {
+        return false;
+    }
+
+    switch (mode->modulation)
+    {
+#ifdef SUPPORT_OFDM
+        case OFDM:
+            return (rc_table_mode[trx_id].phy_mode.ofdm.option == mode->phy_mode.ofdm.option);
+#endif
+#ifdef SUPPORT_OQPSK
+        case OQPSK:
+            return (rc_table_mode[trx_id].phy_mode.oqpsk.chip_rate == mode->phy_mode.oqpsk.chip_rate);
+#endif
+        default:
+            return true;
+    }
+}
+
+
+/**
+ * @brief Inserts a rate into the rate table, ordered by data rate
+ *
+ * @param trx_id Transceiver identifier
+ * @param mode Target mode incl. rate
+ */
+static void add_rate(trx_id_t trx_id, new_phy_t *mode)
+{
+    uint16_t kbps = get_mode_data_rate(mode);
+    uint8_t i = rc_num_rates[trx_id];
+
+    if ((kbps == 0) || (i >= TAL_RC_MAX_RATES))
+    {
+        return;
+    }
+
+    while ((i > 0) && (rc_mode_kbps[trx_id][i - 1] > kbps))
+    {
+        rc_mode[trx_id][i] = rc_mode[trx_id][i - 1];
+        rc_mode_kbps[trx_id][i] = rc_mode_kbps[trx_id][i - 1];
+        i--;
+    }
+    rc_mode[trx_id][i] = *mode;
+    rc_mode_kbps[trx_id][i] = kbps;
+    rc_num_rates[trx_id]++;
+}
+
+
+/**
+ * @brief Builds the rate table for the current mode switch target mode
+ *
+ * The rate statistics are reset; neighbors and their energy are kept.
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void build_rate_table(trx_id_t trx_id)
+{
+    new_phy_t mode = tal_pib[trx_id].ModeSwitchNewMode;
+
+    for (uint8_t i = 0; i < TAL_RC_MAX_NEIGHBORS; i++)
+    {
+        rc_neighbor_t *nb = &rc_nb[trx_id][i];
+        memset(nb->rate, 0, sizeof(nb->rate));
+        nb->frames = 0;
+        nb->samples = 0;
+        nb->sample_cnt = 0;
+    }
+    memset(rc_attempts[trx_id], 0, sizeof(rc_attempts[trx_id]));
+    memset(rc_successes[trx_id], 0, sizeof(rc_successes[trx_id]));
+    rc_tx[trx_id].nb = NULL;
+    rc_num_rates[trx_id] = 0;
+
+    switch (mode.modulation)
+    {
+        case FSK:
+            for (uint8_t op = FSK_OP_MOD_1; op <= FSK_OP_MOD_4; op++)
+            {
+                fsk_sym_rate_t rate;
+                fsk_mod_type_t type;
+
+                if (convert_fsk_op_mode_to_data_rate((fsk_op_mode_t)op,
+                                                     tal_pib[trx_id].phy.freq_band,
+                                                     &rate, &type) != MAC_SUCCESS)
+                {
+                    continue;
+                }
+                mode.phy_mode.fsk.op_mode = (fsk_op_mode_t)op;
+                mode.phy_mode.fsk.sym_rate = rate;
+                mode.phy_mode.fsk.mod_type = type;
+                mode.phy_mode.fsk.mod_idx = MOD_IDX_1_0;
+                mode.rate.fsk_rate = rate;
+                mode.fec_enabled = false;
+                add_rate(trx_id, &mode);
+#if (TAL_RC_FSK_FEC == 1)
+                mode.fec_enabled = true;
+                add_rate(trx_id, &mode);
+#endif
+            }
+            break;
+
+#ifdef SUPPORT_OFDM
+        case OFDM:
+            {
+                uint8_t opt = mode.phy_mode.ofdm.option - 1;
+                if (opt > 3)
+                {
+                    break;
+                }
+                for (uint8_t mcs = ofdm_mcs_min[opt]; mcs <= ofdm_mcs_max[opt]; mcs++)
+                {
+                    mode.rate.ofdm_mcs = (ofdm_mcs_t)mcs;
+                    add_rate(trx_id, &mode);
+                }
+            }
+            break;
+#endif
+
+#ifdef SUPPORT_OQPSK
+        case OQPSK:
+            for (uint8_t rm = OQPSK_RATE_MOD_0; rm <= TAL_RC_OQPSK_MAX_RATE_MODE; rm++)
+            {
+                mode.rate.oqpsk_rate_mod = (oqpsk_rate_mode_t)rm;
+                add_rate(trx_id, &mode);
+            }
+            break;
+#endif
+
+        default:
+            break;
+    }
+
+    rc_table_mode[trx_id] = tal_pib[trx_id].ModeSwitchNewMode;
+    rc_table_band[trx_id] = tal_pib[trx_id].phy.freq_band;
+}
+
+
+/**
+ * @brief Looks up a neighbor; the least recently used entry is replaced
+ *
+ * @param trx_id Transceiver identifier
+ * @param addr Address of the neighbor
+ * @param addr_len Address length
+ * @param create true if a missing entry should be created
+ *
+ * @return Neighbor entry or NULL
+ */
+static rc_neighbor_t *get_neighbor(trx_id_t trx_id, uint8_t *addr,
+                                   uint8_t addr_len, bool create)
+{
+    rc_neighbor_t *lru = &rc_nb[trx_id][0];
+    uint32_t now;
+
+    pal_get_current_time(&now);
+
+    for (uint8_t i = 0; i < TAL_RC_MAX_NEIGHBORS; i++)
+    {
+        rc_neighbor_t *nb = &rc_nb[trx_id][i];
+        if ((nb->addr_len == addr_len) && (memcmp(nb->addr, addr, addr_len) == 0))
+        {
+            nb->last_used = now;
+            return nb;
+        }
+        if ((lru->addr_len != 0) &&
+            ((nb->addr_len == 0) || ((now - nb->last_used) > (now - lru->last_used))))
+        {
+            lru = nb;
+        }
+    }
+
+    if (!create)
+    {
+        return NULL;
+    }
+
+    memset(lru, 0, sizeof(rc_neighbor_t));
+    memcpy(lru->addr, addr, addr_len);
+    lru->addr_len = addr_len;
+    lru->last_used = now;
+    lru->last_update = now;
+
+    return lru;
+}
+
+
+/**
+ * @brief Gets the start rate of a neighbor from the received energy
+ *
+ * @param trx_id Transceiver identifier
+ * @param nb Neighbor
+ *
+ * @return Rate index
+ */
+static uint8_t seed_rate(trx_id_t trx_id, rc_neighbor_t *nb)
+{
+    if ((rc_num_rates[trx_id] == 0) || (!nb->ed_valid) || (nb->ed < TAL_RC_ED_SEED_DBM))
+    {
+        return 0;
+    }
+
+    uint8_t rate = (uint8_t)((nb->ed - TAL_RC_ED_SEED_DBM) / TAL_RC_ED_STEP_DB);
+    if (rate >= rc_num_rates[trx_id])
+    {
+        rate = rc_num_rates[trx_id] - 1;
+    }
+
+    return rate;
+}
+
+
+/**
+ * @brief Selects the rates of the retry chain of a neighbor
+ *
+ * @param trx_id Transceiver identifier
+ * @param nb Neighbor
+ */
+static void select_best_rates(trx_id_t trx_id, rc_neighbor_t *nb)
+{
+    bool any = false;
+
+    nb->best_tp = 0;
+    nb->second_tp = 0;
+    nb->best_prob = 0;
+
+    for (uint8_t i = 0; i < rc_num_rates[trx_id]; i++)
+    {
+        if (!nb->rate[i].sampled)
+        {
+            continue;
+        }
+        if (!any)
+        {
+            nb->best_tp = i;
+            nb->second_tp = i;
+            nb->best_prob = i;
+            any = true;
+            continue;
+        }
+        if (RC_TP(trx_id, nb, i) > RC_TP(trx_id, nb, nb->best_tp))
+        {
+            nb->second_tp = nb->best_tp;
+            nb->best_tp = i;
+        }
+        else if ((nb->second_tp == nb->best_tp) ||
+                 (RC_TP(trx_id, nb, i) > RC_TP(trx_id, nb, nb->second_tp)))
+        {
+            nb->second_tp = i;
+        }
+        /* Rates are ordered, i.e. equal probability prefers the faster rate */
+        if (nb->rate[i].prob >= nb->rate[nb->best_prob].prob)
+        {
+            nb->best_prob = i;
+        }
+    }
+
+    if (!any)
+    {
+        /* Nothing known yet: start from the received energy */
+        nb->best_tp = seed_rate(trx_id, nb);
+        nb->second_tp = (nb->best_tp > 0) ? (nb->best_tp - 1) : 0;
+        nb->best_prob = 0;
+    }
+}
+
+
+/**
+ * @brief Updates the success probabilities of a neighbor
+ *
+ * @param trx_id Transceiver identifier
+ * @param nb Neighbor
+ */
+static void update_stats(trx_id_t trx_id, rc_neighbor_t *nb)
+{
+    for (uint8_t i = 0; i < rc_num_rates[trx_id]; i++)
+    {
+        rc_rate_t *r = &nb->rate[i];
+
+        if (r->attempts == 0)
+        {
+            continue;
+        }
+
+        uint16_t cur = (uint16_t)(((uint32_t)r->successes * RC_PROB_MAX) / r->attempts);
+        if (r->sampled)
+        {
+            r->prob = (uint16_t)(((uint32_t)r->prob * (100 - TAL_RC_EWMA_WEIGHT) +
+                                  (uint32_t)cur * TAL_RC_EWMA_WEIGHT) / 100);
+        }
+        else
+        {
+            r->prob = cur;
+            r->sampled = true;
+        }
+        r->attempts = 0;
+        r->successes = 0;
+    }
+
+    pal_get_current_time(&nb->last_update);
+    nb->ed_ref = nb->ed;
+    select_best_rates(trx_id, nb);
+}
+
+
+/**
+ * @brief Selects a rate to be sampled
+ *
+ * Only rates that could beat the current best throughput are sampled.
+ *
+ * @param trx_id Transceiver identifier
+ * @param nb Neighbor
+ *
+ * @return Rate index; best_tp if there is nothing to sample
+ */
+static uint8_t get_sample_rate(trx_id_t trx_id, rc_neighbor_t *nb)
+{
+    uint32_t best = RC_TP(trx_id, nb, nb->best_tp);
+    uint8_t candidates[TAL_RC_MAX_RATES];
+    uint8_t num = 0;
+
+    for (uint8_t i = 0; i < rc_num_rates[trx_id]; i++)
+    {
+        if ((i != nb->best_tp) &&
+            (((uint32_t)rc_mode_kbps[trx_id][i] * RC_PROB_MAX) > best))
+        {
+            candidates[num++] = i;
+        }
+    }
+
+    if (num == 0)
+    {
+        return nb->best_tp;
+    }
+
+    return candidates[(uint8_t)TAL_RAND(trx_id) % num];
+}
+
+
+/**
+ * @brief Configures a rate as mode switch target mode of the current frame
+ *
+ * phyModeSwitchNewMode is left unchanged; it selects the rate table.
+ *
+ * @param trx_id Transceiver identifier
+ * @param rate Rate index
+ */
+static void apply_rate(trx_id_t trx_id, uint8_t rate)
+{
+    ms_tx_mode[trx_id] = rc_mode[trx_id][rate];
+}
+
+
+/**
+ * @brief Accounts the current attempt of a rate controlled frame
+ *
+ * @param trx_id Transceiver identifier
+ * @param success true if the attempt has been acknowledged
+ */
+static void account_attempt(trx_id_t trx_id, bool success)
+{
+    rc_neighbor_t *nb = rc_tx[trx_id].nb;
+    rc_rate_t *r = &nb->rate[rc_tx[trx_id].rate];
+
+    r->attempts++;
+    r->total_attempts++;
+    rc_attempts[trx_id][rc_tx[trx_id].rate]++;
+    if (success)
+    {
+        r->successes++;
+        r->total_successes++;
+        rc_successes[trx_id][rc_tx[trx_id].rate]++;
+    }
+}
+
+
+/**
+ * @brief Selects the rate of a frame to be transmitted
+ *
+ * Frames without ACK request or to the broadcast address use the most
+ * robust rate and are not accounted.
+ *
+ * @param trx_id Transceiver identifier
+ * @param frame Frame to be transmitted
+ */
+void rate_ctrl_tx_start(trx_id_t trx_id, frame_info_t *frame)
+{
+    uint8_t *mpdu = (frame->iov != NULL) ? frame->iov[0].base : frame->mpdu;
+    uint16_t len = (frame->iov != NULL) ? frame->iov[0].len : frame->len_no_crc;
+    mhr_info_t mhr;
+
+    rc_tx[trx_id].nb = NULL;
+
+    if (!table_valid(trx_id))
+    {
+        build_rate_table(trx_id);
+    }
+    if (rc_num_rates[trx_id] == 0)
+    {
+        return;
+    }
+
+    if ((!(mpdu[PL_POS_FCF_1] & FCF_ACK_REQUEST)) ||
+        (!parse_mhr(mpdu, len, &mhr)) || (mhr.dst_addr_len == 0) ||
+        ((mhr.dst_addr_len == SHORT_ADDR_LEN) &&
+         (mpdu[mhr.dst_addr_pos] == 0xFF) && (mpdu[mhr.dst_addr_pos + 1] == 0xFF)))
+    {
+        apply_rate(trx_id, 0);
+        return;
+    }
+
+    rc_neighbor_t *nb = get_neighbor(trx_id, &mpdu[mhr.dst_addr_pos],
+                                     mhr.dst_addr_len, true);
+
+    uint32_t now;
+    pal_get_current_time(&now);
+    if ((now - nb->last_update) >= TAL_RC_UPDATE_INTERVAL_US)
+    {
+        update_stats(trx_id, nb);
+    }
+    else if (nb->frames == 0)
+    {
+        select_best_rates(trx_id, nb);
+    }
+
+    nb->frames++;
+    rc_tx[trx_id].nb = nb;
+    rc_tx[trx_id].attempt = 0;
+    rc_tx[trx_id].rate = nb->best_tp;
+    rc_tx[trx_id].sample = false;
+
+    if (++nb->sample_cnt >= TAL_RC_SAMPLE_INTERVAL)
+    {
+        nb->sample_cnt = 0;
+        uint8_t rate = get_sample_rate(trx_id, nb);
+        if (rate != nb->best_tp)
+        {
+            rc_tx[trx_id].rate = rate;
+            rc_tx[trx_id].sample = true;
+            nb->samples++;
+        }
+    }
+
+    apply_rate(trx_id, rc_tx[trx_id].rate);
+}
+
+
+/**
+ * @brief Selects the rate of the next attempt after a missing ACK
+ *
+ * The retry chain is: best throughput (or sample), second best throughput
+ * (best throughput after a sample), best probability, most robust rate.
+ *
+ * @param trx_id Transceiver identifier
+ */
+void rate_ctrl_tx_retry(trx_id_t trx_id)
+{
+    rc_neighbor_t *nb = rc_tx[trx_id].nb;
+
+    if (nb == NULL)
+    {
+        return;
+    }
+
+    account_attempt(trx_id, false);
+
+    switch (++rc_tx[trx_id].attempt)
+    {
+        case 1:
+            rc_tx[trx_id].rate = rc_tx[trx_id].sample ? nb->best_tp : nb->second_tp;
+            break;
+
+        case 2:
+            rc_tx[trx_id].rate = nb->best_prob;
+            break;
+
+        default:
+            rc_tx[trx_id].rate = 0;
+            break;
+    }
+
+    apply_rate(trx_id, rc_tx[trx_id].rate);
+}
+
+
+/**
+ * @brief Accounts the last attempt of a completed frame
+ *
+ * @param trx_id Transceiver identifier
+ * @param status Status of the transmission
+ */
+void rate_ctrl_tx_done(trx_id_t trx_id, retval_t status)
+{
+    if (rc_tx[trx_id].nb == NULL)
+    {
+        return;
+    }
+
+    if (status == MAC_SUCCESS)
+    {
+        account_attempt(trx_id, true);
+    }
+    else if (status == MAC_NO_ACK)
+    {
+        account_attempt(trx_id, false);
+    }
+    /* No transmission for a channel access failure */
+
+    rc_tx[trx_id].nb = NULL;
+}
+
+
+/**
+ * @brief Tracks the energy of frames received from a neighbor
+ *
+ * A drop of the energy by TAL_RC_ED_DROP_DB invalidates the statistics of
+ * the rates above the energy based start rate.
+ *
+ * @param trx_id Transceiver identifier
+ * @param frame Received frame
+ * @param ed Energy of the frame in dBm
+ */
+void rate_ctrl_rx_frame(trx_id_t trx_id, frame_info_t *frame, int8_t ed)
+{
+    mhr_info_t mhr;
+
+    if ((!tal_pib[trx_id].ModeSwitchEnabled) ||
+        (!parse_mhr(frame->mpdu, frame->len_no_crc, &mhr)) ||
+        (mhr.src_addr_len == 0))
+    {
+        return;
+    }
+
+    rc_neighbor_t *nb = get_neighbor(trx_id, &frame->mpdu[mhr.src_addr_pos],
+                                     mhr.src_addr_len, true);
+
+    if (nb->ed_valid)
+    {
+        nb->ed = (int8_t)(((int16_t)nb->ed * 3 + ed) / 4);
+    }
+    else
+    {
+        nb->ed = ed;
+        nb->ed_ref = ed;
+        nb->ed_valid = true;
+    }
+
+    if ((nb->ed_ref - nb->ed) >= TAL_RC_ED_DROP_DB)
+    {
+        for (uint8_t i = seed_rate(trx_id, nb) + 1; i < rc_num_rates[trx_id]; i++)
+        {
+            nb->rate[i].sampled = false;
+        }
+        nb->ed_ref = nb->ed;
+        select_best_rates(trx_id, nb);
+    }
+}
+
+
+/**
+ * @brief Resets all neighbors and statistics of a transceiver
+ *
+ * @param trx_id Transceiver identifier
+ */
+void reset_rate_control(trx_id_t trx_id)
+{
+    memset(rc_nb[trx_id], 0, sizeof(rc_nb[trx_id]));
+    memset(rc_attempts[trx_id], 0, sizeof(rc_attempts[trx_id]));
+    memset(rc_successes[trx_id], 0, sizeof(rc_successes[trx_id]));
+    rc_tx[trx_id].nb = NULL;
+    rc_num_rates[trx_id] = 0;
+}
+
+
+/**
+ * @brief Gets the rate control statistics of a neighbor
+ *
+ * @param trx_id Transceiver identifier
+ * @param index Index of the neighbor table entry
+ * @param stats Pointer to the statistics to be filled
+ *
+ * @return MAC_SUCCESS, or MAC_INVALID_INDEX if the entry is not used
+ */
+retval_t tal_rc_get_neighbor_stats(trx_id_t trx_id, uint8_t index,
+                                   tal_rc_neighbor_stats_t *stats)
+{
+    if ((index >= TAL_RC_MAX_NEIGHBORS) || (rc_nb[trx_id][index].addr_len == 0))
+    {
+        return MAC_INVALID_INDEX;
+    }
+
+    rc_neighbor_t *nb = &rc_nb[trx_id][index];
+
+    memset(stats, 0, sizeof(tal_rc_neighbor_stats_t));
+    memcpy(stats->addr, nb->addr, nb->addr_len);
+    stats->addr_len = nb->addr_len;
+    stats->ed = nb->ed_valid ? nb->ed : INT8_MIN;
+    stats->num_rates = rc_num_rates[trx_id];
+    stats->best_tp = nb->best_tp;
+    stats->second_tp = nb->second_tp;
+    stats->best_prob = nb->best_prob;
+    stats->frames = nb->frames;
+    stats->samples = nb->samples;
+    for (uint8_t i = 0; i < rc_num_rates[trx_id]; i++)
+    {
+        stats->rate[i].mode = rc_mode[trx_id][i];
+        stats->rate[i].kbps = rc_mode_kbps[trx_id][i];
+        stats->rate[i].prob = nb->rate[i].sampled ? nb->rate[i].prob : 0;
+        stats->rate[i].sampled = nb->rate[i].sampled;
+        stats->rate[i].attempts = nb->rate[i].total_attempts;
+        stats->rate[i].successes = nb->rate[i].total_successes;
+    }
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Gets the statistics of a rate over all neighbors
+ *
+ * @param trx_id Transceiver identifier
+ * @param rate Index of the rate, ordered by increasing data rate
+ * @param stats Pointer to the statistics to be filled
+ *
+ * @return MAC_SUCCESS, or MAC_INVALID_INDEX if the rate does not exist
+ */
+retval_t tal_rc_get_rate_stats(trx_id_t trx_id, uint8_t rate,
+                               tal_rc_rate_stats_t *stats)
+{
+    if (rate >= rc_num_rates[trx_id])
+    {
+        return MAC_INVALID_INDEX;
+    }
+
+    stats->mode = rc_mode[trx_id][rate];
+    stats->kbps = rc_mode_kbps[trx_id][rate];
+    stats->attempts = rc_attempts[trx_id][rate];
+    stats->successes = rc_successes[trx_id][rate];
+    stats->prob = (stats->attempts > 0) ?
+                  (uint16_t)(((uint64_t)stats->successes * RC_PROB_MAX) / stats->attempts) : 0;
+    stats->sampled = (stats->attempts > 0);
+
+    return MAC_SUCCESS;
+}
+
+#endif /* #ifdef SUPPORT_RATE_CONTROL */
+
+/* EOF */
@@ -0,0 +1,347 @@
+/**
+ * @file tal_reg_image.c
+ *
+ * @brief This file implements precomputed register images.
+ *
+ * A PHY configuration is compiled ahead of time by running the regular
+ * configuration functions against a register shadow instead of the
+ * transceiver, see pal_trx_capture_start(). The registers that differ
+ * between two compiled configurations form a register image, which is
+ * applied later using a few burst writes.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include "pal.h"
+#include "return_val.h"
+#include "tal.h"
+#include "ieee_const.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+
+/* === MACROS ============================================================== */
+
+/** Octets of a run header: start address and number of registers */
+#define RUN_HDR_LEN     (3)
+
+/** Checks the bit of a register within a shadow bitmap */
+#define REG_BIT(map, idx)   (((map)[(idx) >> 3] >> ((idx) & 0x07)) & 0x01)
+
+/* === GLOBALS ============================================================= */
+
+/* Registers of each trx, read once and then tracked by the PAL */
+static pal_trx_shadow_t trx_regs[NUM_TRX];
+static bool trx_regs_valid[NUM_TRX];
+
+/* === PROTOTYPES ========================================================== */
+
+static inline bool reg_needed(const pal_trx_shadow_t *from, const pal_trx_shadow_t *to,
+                              uint8_t w, uint16_t idx);
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Loads the RF and baseband registers of a trx into a shadow
+ *
+ * The registers are read from the trx only the first time; the PAL keeps
+ * the copy up to date with all later accesses, see pal_trx_track_start().
+ *
+ * @param trx_id Transceiver identifier
+ * @param shadow Shadow to be filled
+ */
+void reg_image_seed(trx_id_t trx_id, pal_trx_shadow_t *shadow)
+{
+    pal_trx_shadow_t *regs = &trx_regs[trx_id];
+
+    if (!trx_regs_valid[trx_id])
+    {
+        CALC_REG_OFFSET(trx_id);
+
+        regs->base[0] = GET_REG_ADDR(RG_RF09_IRQM);
+        regs->base[1] = GET_REG_ADDR(RG_BBC0_IRQM);
+        for (uint8_t i = 0; i < PAL_TRX_SHADOW_WINDOWS; i++)
+        {
+            pal_dev_read(RF215_TRX, regs->base[i], regs->reg[i], PAL_TRX_SHADOW_SIZE);
+        }
+        memset(regs->written, 0, sizeof(regs->written));
+        regs->overflow = false;
+        /* Without a free tracking slot the registers are read each time */
+        trx_regs_valid[trx_id] = pal_trx_track_start(regs);
+    }
+    memcpy(shadow, regs, sizeof(pal_trx_shadow_t));
+
+    /*
+     * The baseband core is disabled only temporarily, e.g. during CCA;
+     * the configuration is always applied with the core enabled.
+     */
+    shadow->reg[1][RG_BBC0_PC - RG_BBC0_IRQM] |= PC_BBEN_MASK;
+}
+
+
+/**
+ * @brief Forgets the registers of a trx after they changed without SPI access
+ *
+ * Has to be called after a reset of the trx.
+ *
+ * @param trx_id Transceiver identifier
+ */
+void reg_image_invalidate(trx_id_t trx_id)
+{
+    pal_trx_track_stop(&trx_regs[trx_id]);
+    trx_regs_valid[trx_id] = false;
+}
+
+
+/**
+ * @brief Captures the register accesses of a configuration function
+ *
+ * @param shadow Shadow receiving the accesses
+ * @param conf Configuration function
+ * @param trx_id Transceiver identifier passed to conf
+ *
+ * @return Status of conf; FAILURE if conf accessed other registers
+ */
+retval_t reg_image_capture(pal_trx_shadow_t *shadow,
+                           retval_t (*conf)(trx_id_t trx_id), trx_id_t trx_id)
+{
+    pal_trx_capture_start(shadow);
+    retval_t status = conf(trx_id);
+    pal_trx_capture_stop();
+
+    if (shadow->overflow)
+    {
+        status = FAILURE;
+    }
+
+    return status;
+}
+
+
+/**
+ * @brief Checks if a register has to be part of an image
+ *
+ * A register configured by the target is needed if its value changes or
+ * if the source does not configure it, i.e. its current value is unknown.
+ *
+ * @param from Shadow containing the current configuration
+ * @param to Shadow containing the target configuration
+ * @param w Window index
+ * @param idx Register index within the window
+ *
+ * @return true if the register has to be written
+ */
+static inline bool reg_needed(const pal_trx_shadow_t *from, const pal_trx_shadow_t *to,
+                              uint8_t w, uint16_t idx)
+{
+    if (!REG_BIT(to->written[w], idx))
+    {
+        return false;
+    }
+
+    return ((from->reg[w][idx] != to->reg[w][idx]) || !REG_BIT(from->written[w], idx));
+}
+
+
+/**
+ * @brief Compiles the register image between two shadows
+ *
+ * The written flags of a shadow mark the registers configured by the
+ * captures since reg_image_seed(). The image contains the registers
+ * configured by the target that either change or are not configured by
+ * the source. Further registers configured by the target are included
+ * between them, so that a run needs only a single burst write; other
+ * registers are never touched.
+ *
+ * @param from Shadow containing the current configuration
+ * @param to Shadow containing the target configuration
+ * @param image Image to be compiled
+ *
+ * @return MAC_SUCCESS, or FAILURE if the image does not fit
+ */
+retval_t reg_image_diff(const pal_trx_shadow_t *from, const pal_trx_shadow_t *to,
+                        reg_image_t *image)
+{
+    image->len = 0;
+    image->writes = 0;
+
+    for (uint8_t w = 0; w < PAL_TRX_SHADOW_WINDOWS; w++)
+    {
+        uint16_t idx = 0;
+        while (idx < PAL_TRX_SHADOW_SIZE)
+        {
+            if (!reg_needed(from, to, w, idx))
+            {
+                idx++;
+                continue;
+            }
+
+            /* Extend the run across configured registers; end at the last needed one */
+            uint16_t end = idx + 1;
+            uint16_t last = idx;
+            while ((end < PAL_TRX_SHADOW_SIZE) && REG_BIT(to->written[w], end))
+            {
+                if (reg_needed(from, to, w, end))
+                {
+                    last = end;
+                }
+                end++;
+            }
+            uint8_t cnt = last - idx + 1;
+
+            if ((image->len + RUN_HDR_LEN + cnt) > TAL_REG_IMAGE_SIZE)
+            {
+                image->len = 0;
+                image->writes = 0;
+                return FAILURE;
+            }
+            uint16_t addr = to->base[w] + idx;
+            image->data[image->len++] = (uint8_t)addr;
+            image->data[image->len++] = (uint8_t)(addr >> 8);
+            image->data[image->len++] = cnt;
+            memcpy(&image->data[image->len], &to->reg[w][idx], cnt);
+            image->len += cnt;
+            image->writes++;
+
+            idx = last + 1;
+        }
+    }
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Forces a register block into an image if any of its registers changes
+ *
+ * Some blocks take effect only when their last register is written, e.g.
+ * the channel registers CS to CNM. If any register of the block differs
+ * between the shadows, the block is marked unknown in the source, so that
+ * reg_image_diff() writes it up to its last register.
+ *
+ * @param from Shadow containing the current configuration
+ * @param to Shadow containing the target configuration
+ * @param addr Address of the first register of the block
+ * @param len Number of registers of the block
+ */
+void reg_image_force_block(pal_trx_shadow_t *from, const pal_trx_shadow_t *to,
+                           uint16_t addr, uint8_t len)
+{
+    for (uint8_t w = 0; w < PAL_TRX_SHADOW_WINDOWS; w++)
+    {
+        uint16_t idx = addr - from->base[w];
+        if ((idx >= PAL_TRX_SHADOW_SIZE) || ((idx + len) > PAL_TRX_SHADOW_SIZE))
+        {
+            continue;
+        }
+
+        if (memcmp(&from->reg[w][idx], &to->reg[w][idx], len) != 0)
+        {
+            for (uint16_t i = idx; i < (idx + len); i++)
+            {
+                from->written[w][i >> 3] &= (uint8_t)~(1 << (i & 0x07));
+            }
+        }
+        return;
+    }
+}
+
+
+/**
+ * @brief Applies a register image to the transceiver
+ *
+ * Each run of the image is downloaded using a single burst write.
+ *
+ * @param image Image to be applied
+ */
+void reg_image_apply(const reg_image_t *image)
+{
+    uint16_t pos = 0;
+
+    while (pos < image->len)
+    {
+        uint16_t addr = image->data[pos] | ((uint16_t)image->data[pos + 1] << 8);
+        uint8_t cnt = image->data[pos + 2];
+        pos += RUN_HDR_LEN;
+        pal_dev_write(RF215_TRX, addr, (uint8_t *)&image->data[pos], cnt);
+        pos += cnt;
+    }
+}
+
+
+/**
+ * @brief Gets the PIB values set as side effect of a PHY configuration
+ *
+ * @param trx_id Transceiver identifier
+ * @param fx Values to be filled
+ */
+void reg_image_get_fx(trx_id_t trx_id, reg_image_fx_t *fx)
+{
+    fx->agc_settle_dur = tal_pib[trx_id].agc_settle_dur;
+#ifdef SUPPORT_FSK
+    fx->FSKPreambleLengthMin = tal_pib[trx_id].FSKPreambleLengthMin;
+#endif
+#if (defined SUPPORT_FSK) || (defined SUPPORT_OQPSK)
+    fx->RPCEnabled = tal_pib[trx_id].RPCEnabled;
+#endif
+    fx->TransmitPower = tal_pib[trx_id].TransmitPower;
+}
+
+
+/**
+ * @brief Sets the PIB values a PHY configuration would set
+ *
+ * @param trx_id Transceiver identifier
+ * @param fx Values to be set
+ */
+void reg_image_set_fx(trx_id_t trx_id, const reg_image_fx_t *fx)
+{
+    tal_pib[trx_id].agc_settle_dur = fx->agc_settle_dur;
+#ifdef SUPPORT_FSK
+    tal_pib[trx_id].FSKPreambleLengthMin = fx->FSKPreambleLengthMin;
+#endif
+#if (defined SUPPORT_FSK) || (defined SUPPORT_OQPSK)
+    tal_pib[trx_id].RPCEnabled = fx->RPCEnabled;
+#endif
+    tal_pib[trx_id].TransmitPower = fx->TransmitPower;
+}
+
+
+/**
+ * @brief Adds a latency sample
+ *
+ * @param lat Latency statistics
+ * @param start Start time of the measured step
+ */
+void add_latency(tal_latency_t *lat, uint32_t start)
+{
+    uint32_t now;
+    pal_get_current_time(&now);
+    uint32_t dur = now - start;
+
+    if ((lat->count == 0) || (dur < lat->min_us))
+    {
+        lat->min_us = dur;
+    }
+    if (dur > lat->max_us)
+    {
+        lat->max_us = dur;
+    }
+    lat->last_us = dur;
+    lat->total_us += dur;
+    lat->count++;
+}
+
+
+/* EOF */
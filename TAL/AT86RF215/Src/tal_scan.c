@@ -0,0 +1,789 @@
+/**
+ * @file tal_scan.c
+ *
+ * @brief This file implements the multi-channel energy scan and the
+ *        background spectrum monitor.
+ *
+ * A sweep measures the energy of a list of channels. Each channel is tuned
+ * using a single burst, the receiver is started and the energy detection
+ * runs in continuous mode with the baseband disabled. EDV is polled once
+ * per sample duration, paced by the host clock; there is neither an EDC
+ * interrupt nor a tal_task() cycle per sample. The channels are measured
+ * one by one from the scan timer, so other tasks may run between them;
+ * the dwell time of a channel blocks the TAL.
+ *
+ * For each channel the maximum, the mean and a histogram of the energy in
+ * dBm are provided; percentiles are derived from the histogram.
+ *
+ * With SUPPORT_SPECTRUM_MONITOR the same measurement is interleaved with
+ * the normal operation: whenever the TAL is idle and no frame is being
+ * received, a single channel is measured for a short dwell time. The share
+ * of busy samples and the mean energy of each channel are averaged
+ * exponentially. The gap to the next measurement is derived from the
+ * duration of the last one, so the monitor never takes more than the
+ * configured share of the time.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include "pal.h"
+#include "return_val.h"
+#include "tal.h"
+#include "ieee_const.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include <signal.h>
+
+#ifdef SUPPORT_SPECTRUM_SCAN
+
+/* === MACROS ============================================================== */
+
+/** EDV value of an invalid measurement */
+#define ED_INVALID                  (127)
+
+#ifdef SUPPORT_SPECTRUM_MONITOR
+/** Occupancy of a channel being busy all the time */
+#define OCCUPANCY_FULL              (0xFFFF)
+#endif
+
+/* === TYPES =============================================================== */
+
+/**
+ * Sweep state of a transceiver
+ */
+typedef struct scan_tag
+{
+    bool active;
+    tal_scan_cfg_t cfg;
+    tal_scan_result_t *results;
+    uint16_t current;
+    /** Number of channels of this sweep that could not be measured */
+    uint16_t unmeasured;
+    /** Channel to be restored after the sweep */
+    uint16_t prev_channel;
+    uint32_t start;
+    tal_scan_stats_t stats;
+} scan_t;
+
+#ifdef SUPPORT_SPECTRUM_MONITOR
+/**
+ * Background monitor state of a transceiver
+ */
+typedef struct scan_mon_tag
+{
+    bool active;
+    uint32_t dwell_us;
+    uint16_t sample_us;
+    int8_t busy_dbm;
+    uint16_t budget_permille;
+    /** Band the table belongs to */
+    uint32_t freq_f0;
+    uint32_t ch_spacing;
+    uint16_t num_channels;
+    uint16_t next;
+    /** Mean energy averages in 1/256 dBm */
+    int16_t energy[TAL_SCAN_MON_MAX_CHANNELS];
+    tal_scan_mon_entry_t table[TAL_SCAN_MON_MAX_CHANNELS];
+    tal_scan_mon_stats_t stats;
+} scan_mon_t;
+#endif
+
+/* === GLOBALS ============================================================= */
+
+static scan_t scan[NUM_TRX];
+
+#ifdef SUPPORT_SPECTRUM_MONITOR
+static scan_mon_t scan_mon[NUM_TRX];
+#endif
+
+/* === PROTOTYPES ========================================================== */
+
+static void begin_measurement(trx_id_t trx_id, uint16_t sample_us);
+static void end_measurement(trx_id_t trx_id, uint16_t channel);
+static retval_t measure_channel(trx_id_t trx_id, uint16_t channel,
+                                uint32_t dwell_us, uint16_t sample_us,
+                                int8_t busy_dbm, tal_scan_result_t *res,
+                                uint16_t *busy);
+static int8_t get_percentile(const tal_scan_result_t *res, uint8_t percent);
+static void finish_scan(trx_id_t trx_id, retval_t status);
+static void scan_timer_cb(union sigval v);
+#ifdef SUPPORT_SPECTRUM_MONITOR
+static void reset_mon_table(scan_mon_t *m);
+static bool is_trx_idle(trx_id_t trx_id);
+static void monitor_step(trx_id_t trx_id);
+static void scan_mon_timer_cb(union sigval v);
+#endif
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Starts an energy sweep over a list of channels
+ *
+ * tal_scan_done_cb() is called once all channels have been measured; the
+ * TAL is busy until then. The channel and the trx state are restored after
+ * the sweep.
+ *
+ * @param trx_id Transceiver identifier
+ * @param cfg Sweep configuration
+ * @param results Storage for one result per channel; valid until the
+ *                callback
+ *
+ * @return
+ *      - @ref MAC_SUCCESS if the sweep has been started
+ *      - @ref MAC_INVALID_PARAMETER if the configuration is invalid
+ *      - @ref TAL_BUSY if the TAL is not in TAL_IDLE state
+ *      - @ref TAL_TRX_ASLEEP if the trx is in SLEEP mode
+ * @ingroup apiTalApi
+ */
+retval_t tal_scan_start(trx_id_t trx_id, const tal_scan_cfg_t *cfg,
+                        tal_scan_result_t *results)
+{
+    scan_t *s = &scan[trx_id];
+
+    ASSERT((trx_id >= 0) && (trx_id < NUM_TRX));
+
+    if (tal_state[trx_id] == TAL_SLEEP)
+    {
+        return TAL_TRX_ASLEEP;
+    }
+
+    if (tal_state[trx_id] != TAL_IDLE)
+    {
+        return TAL_BUSY;
+    }
+
+    if ((cfg == NULL) || (results == NULL) || (cfg->channels == NULL) ||
+        (cfg->num_channels == 0) || (cfg->sample_us < 2) ||
+        (cfg->dwell_us < (2 * (uint32_t)cfg->sample_us)))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    s->cfg = *cfg;
+    s->results = results;
+    s->current = 0;
+    s->unmeasured = 0;
+    s->prev_channel = tal_pib[trx_id].CurrentChannel;
+    pal_get_current_time(&s->start);
+    s->active = true;
+
+    begin_measurement(trx_id, cfg->sample_us);
+
+    pal_timer_start(TAL_T_SCAN, trx_id, 1,
+                    TIMEOUT_RELATIVE, (FUNC_PTR())scan_timer_cb, NULL);
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Gets the energy scan statistics
+ *
+ * @param trx_id Transceiver identifier
+ * @param stats Pointer to the statistics to be filled
+ * @ingroup apiTalApi
+ */
+void tal_scan_get_stats(trx_id_t trx_id, tal_scan_stats_t *stats)
+{
+    *stats = scan[trx_id].stats;
+}
+
+
+/**
+ * @brief Stops an ongoing sweep
+ *
+ * The channels measured so far are reported.
+ *
+ * @param trx_id Transceiver identifier
+ */
+void stop_spectrum_scan(trx_id_t trx_id)
+{
+    pal_timer_stop(TAL_T_SCAN, trx_id);
+    if (scan[trx_id].active)
+    {
+        finish_scan(trx_id, FAILURE);
+    }
+}
+
+
+/**
+ * @brief Prepares the trx for energy measurements
+ *
+ * @param trx_id Transceiver identifier
+ * @param sample_us ED averaging duration in us
+ */
+static void begin_measurement(trx_id_t trx_id, uint16_t sample_us)
+{
+    tal_state[trx_id] = TAL_SPECTRUM_SCAN;
+
+    /* Store TRX state before leaving the current channel */
+    if ((trx_state[trx_id] == RF_RX) || (trx_state[trx_id] == RF_TXPREP))
+    {
+        trx_default_state[trx_id] = RF_RX;
+    }
+
+    CALC_REG_OFFSET(trx_id);
+    /* No frames are received during the measurement */
+    pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_BBC0_PC_BBEN), 0);
+    /* Ensure AGC is not hold */
+    pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_RF09_AGCC_FRZC), 0);
+    set_ed_sample_duration(trx_id, sample_us);
+}
+
+
+/**
+ * @brief Returns to normal operation after energy measurements
+ *
+ * @param trx_id Transceiver identifier
+ * @param channel Channel to be restored
+ */
+static void end_measurement(trx_id_t trx_id, uint16_t channel)
+{
+    CALC_REG_OFFSET(trx_id);
+    pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_RF09_EDC_EDM), RF_EDAUTO);
+    /* Restore ED average duration for CCA */
+    set_ed_sample_duration(trx_id, tal_pib[trx_id].CCADuration_us);
+    pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_BBC0_PC_BBEN), 1);
+
+    /* Leaves the trx in TRXOFF */
+    tune_channel(trx_id, channel);
+    if (trx_default_state[trx_id] == RF_RX)
+    {
+        switch_to_rx(trx_id);
+    }
+    tal_state[trx_id] = TAL_IDLE;
+}
+
+
+/**
+ * @brief Measures the energy of a single channel
+ *
+ * The trx is left in RX with continuous energy detection. If no sample
+ * has been taken, the energies of the result are set to ED_INVALID.
+ *
+ * @param trx_id Transceiver identifier
+ * @param channel Channel to be measured
+ * @param dwell_us Measurement time in us
+ * @param sample_us ED averaging duration in us
+ * @param busy_dbm Energy of a busy sample
+ * @param res Result to be filled
+ * @param busy Returns the number of samples at or above busy_dbm
+ *
+ * @return
+ *      - @ref MAC_SUCCESS if at least one sample has been taken
+ *      - @ref FAILURE if the channel could not be measured
+ */
+static retval_t measure_channel(trx_id_t trx_id, uint16_t channel,
+                                uint32_t dwell_us, uint16_t sample_us,
+                                int8_t busy_dbm, tal_scan_result_t *res,
+                                uint16_t *busy)
+{
+    uint32_t start;
+    uint32_t next;
+    uint32_t now;
+    int32_t sum = 0;
+    bool first = true;
+
+    res->channel = channel;
+    res->samples = 0;
+    res->max_dbm = ED_INVALID;
+    res->mean_dbm = ED_INVALID;
+    res->p50_dbm = ED_INVALID;
+    res->p90_dbm = ED_INVALID;
+    memset(res->hist, 0, sizeof(res->hist));
+    *busy = 0;
+
+    if (tune_channel(trx_id, channel) != MAC_SUCCESS)
+    {
+        return FAILURE;
+    }
+
+    CALC_REG_OFFSET(trx_id);
+    pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_RF09_CMD), RF_RX);
+    trx_state[trx_id] = RF_RX;
+    pal_timer_delay(TAL_SCAN_SETTLE_US + tal_pib[trx_id].agc_settle_dur);
+    pal_dev_bit_write(RF215_TRX, GET_REG_ADDR(SR_RF09_EDC_EDM), RF_EDCONT);
+
+    pal_get_current_time(&start);
+    next = start + sample_us;
+    do
+    {
+        do
+        {
+            pal_get_current_time(&now);
+        } while ((int32_t)(now - next) < 0);
+        next += sample_us;
+
+        int8_t ed = (int8_t)pal_dev_reg_read(RF215_TRX, GET_REG_ADDR(RG_RF09_EDV));
+
+        /* The first value may stem from the settling */
+        if (first || (ed == ED_INVALID))
+        {
+            first = false;
+            continue;
+        }
+
+        int16_t bin = (ed - TAL_SCAN_HIST_MIN_DBM) / TAL_SCAN_HIST_STEP_DB;
+        if (bin < 0)
+        {
+            bin = 0;
+        }
+        else if (bin >= TAL_SCAN_HIST_BINS)
+        {
+            bin = TAL_SCAN_HIST_BINS - 1;
+        }
+        res->hist[bin]++;
+        if ((res->samples == 0) || (ed > res->max_dbm))
+        {
+            res->max_dbm = ed;
+        }
+        if (ed >= busy_dbm)
+        {
+            (*busy)++;
+        }
+        sum += ed;
+        res->samples++;
+    } while ((now - start) < dwell_us);
+
+    if (res->samples == 0)
+    {
+        return FAILURE;
+    }
+
+    res->mean_dbm = (int8_t)(sum / (int32_t)res->samples);
+    res->p50_dbm = get_percentile(res, 50);
+    res->p90_dbm = get_percentile(res, 90);
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Gets a percentile of the energy from the histogram
+ *
+ * @param res Channel result
+ * @param percent Percentile
+ *
+ * @return Center of the histogram bin containing the percentile in dBm
+ */
+static int8_t get_percentile(const tal_scan_result_t *res, uint8_t percent)
+{
+    uint32_t target = ((uint32_t)res->samples * percent + 99) / 100;
+    uint32_t cnt = 0;
+    uint8_t bin;
+
+    for (bin = 0; bin < (TAL_SCAN_HIST_BINS - 1); bin++)
+    {
+        cnt += res->hist[bin];
+        if (cnt >= target)
+        {
+            break;
+        }
+    }
+
+    return (int8_t)(TAL_SCAN_HIST_MIN_DBM + (bin * TAL_SCAN_HIST_STEP_DB) +
+                    (TAL_SCAN_HIST_STEP_DB / 2));
+}
+
+
+/**
+ * @brief Completes a sweep
+ *
+ * @param trx_id Transceiver identifier
+ * @param status Status reported to the upper layer
+ */
+static void finish_scan(trx_id_t trx_id, retval_t status)
+{
+    scan_t *s = &scan[trx_id];
+    uint32_t now;
+
+    end_measurement(trx_id, s->prev_channel);
+    s->active = false;
+
+    pal_get_current_time(&now);
+    s->stats.sweeps++;
+    s->stats.last_channels = s->current;
+    s->stats.last_sweep_us = now - s->start;
+    s->stats.channels += s->current;
+    s->stats.unmeasured += s->unmeasured;
+    s->stats.total_us += now - s->start;
+
+    tal_scan_done_cb(trx_id, status, s->current);
+
+    /* Frames queued during the sweep */
+    start_next_queued_frame(trx_id);
+}
+
+
+/**
+ * @brief Measures the next channel of the sweep
+ *
+ * @param v Timer parameter; transceiver identifier
+ */
+static void scan_timer_cb(union sigval v)
+{
+    trx_id_t trx_id = (trx_id_t)v.sival_int;
+    scan_t *s = &scan[trx_id];
+
+    ENTER_CRITICAL_REGION();
+    if (s->active)
+    {
+        tal_scan_result_t *res = &s->results[s->current];
+        uint16_t busy;
+
+        if (measure_channel(trx_id, s->cfg.channels[s->current],
+                            s->cfg.dwell_us, s->cfg.sample_us, ED_INVALID,
+                            res, &busy) != MAC_SUCCESS)
+        {
+            s->unmeasured++;
+        }
+        s->stats.samples += res->samples;
+        s->current++;
+
+        if (s->current < s->cfg.num_channels)
+        {
+            pal_timer_start(TAL_T_SCAN, trx_id, 1,
+                            TIMEOUT_RELATIVE, (FUNC_PTR())scan_timer_cb, NULL);
+        }
+        else
+        {
+            finish_scan(trx_id, (s->unmeasured == 0) ? MAC_SUCCESS : FAILURE);
+        }
+    }
+    LEAVE_CRITICAL_REGION();
+}
+
+
+#ifdef SUPPORT_SPECTRUM_MONITOR
+/**
+ * @brief Starts the background spectrum monitor
+ *
+ * The occupancy table is kept if the channels and the band are unchanged
+ * since the last run.
+ *
+ * @param trx_id Transceiver identifier
+ * @param cfg Monitor configuration
+ *
+ * @return
+ *      - @ref MAC_SUCCESS if the monitor has been started
+ *      - @ref MAC_INVALID_PARAMETER if the configuration is invalid
+ * @ingroup apiTalApi
+ */
+retval_t tal_scan_monitor_start(trx_id_t trx_id, const tal_scan_mon_cfg_t *cfg)
+{
+    scan_mon_t *m = &scan_mon[trx_id];
+    bool keep;
+
+    ASSERT((trx_id >= 0) && (trx_id < NUM_TRX));
+
+    if ((cfg == NULL) || (cfg->channels == NULL) || (cfg->num_channels == 0) ||
+        (cfg->num_channels > TAL_SCAN_MON_MAX_CHANNELS) || (cfg->sample_us < 2) ||
+        (cfg->dwell_us < (2 * (uint32_t)cfg->sample_us)) ||
+        (cfg->budget_permille == 0) || (cfg->budget_permille > 1000))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    pal_timer_stop(TAL_T_SCAN_MON, trx_id);
+
+    keep = (cfg->num_channels == m->num_channels) &&
+           (m->freq_f0 == tal_pib[trx_id].phy.freq_f0) &&
+           (m->ch_spacing == tal_pib[trx_id].phy.ch_spacing);
+    for (uint16_t i = 0; keep && (i < cfg->num_channels); i++)
+    {
+        keep = (m->table[i].channel == cfg->channels[i]);
+    }
+
+    if (!keep)
+    {
+        m->num_channels = cfg->num_channels;
+        for (uint16_t i = 0; i < cfg->num_channels; i++)
+        {
+            m->table[i].channel = cfg->channels[i];
+        }
+        reset_mon_table(m);
+        m->next = 0;
+        m->freq_f0 = tal_pib[trx_id].phy.freq_f0;
+        m->ch_spacing = tal_pib[trx_id].phy.ch_spacing;
+    }
+
+    m->dwell_us = cfg->dwell_us;
+    m->sample_us = cfg->sample_us;
+    m->busy_dbm = cfg->busy_dbm;
+    m->budget_permille = cfg->budget_permille;
+    m->active = true;
+
+    pal_timer_start(TAL_T_SCAN_MON, trx_id, 1,
+                    TIMEOUT_RELATIVE, (FUNC_PTR())scan_mon_timer_cb, NULL);
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Stops the background spectrum monitor
+ *
+ * The occupancy table remains valid.
+ *
+ * @param trx_id Transceiver identifier
+ * @ingroup apiTalApi
+ */
+void tal_scan_monitor_stop(trx_id_t trx_id)
+{
+    pal_timer_stop(TAL_T_SCAN_MON, trx_id);
+    scan_mon[trx_id].active = false;
+}
+
+
+/**
+ * @brief Gets the least busy channel
+ *
+ * The channel with the lowest occupancy is selected; the mean energy
+ * decides between channels of equal occupancy.
+ *
+ * @param trx_id Transceiver identifier
+ * @param channel Storage for the channel
+ *
+ * @return
+ *      - @ref MAC_SUCCESS if a channel has been selected
+ *      - @ref MAC_NO_DATA if no channel has been measured yet
+ * @ingroup apiTalApi
+ */
+retval_t tal_scan_monitor_best_channel(trx_id_t trx_id, uint16_t *channel)
+{
+    scan_mon_t *m = &scan_mon[trx_id];
+    const tal_scan_mon_entry_t *best = NULL;
+
+    for (uint16_t i = 0; i < m->num_channels; i++)
+    {
+        const tal_scan_mon_entry_t *e = &m->table[i];
+
+        if (e->samples == 0)
+        {
+            continue;
+        }
+        if ((best == NULL) || (e->occupancy < best->occupancy) ||
+            ((e->occupancy == best->occupancy) && (e->energy_dbm < best->energy_dbm)))
+        {
+            best = e;
+        }
+    }
+
+    if (best == NULL)
+    {
+        return MAC_NO_DATA;
+    }
+
+    *channel = best->channel;
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Gets the occupancy table
+ *
+ * @param trx_id Transceiver identifier
+ * @param table Storage for the entries
+ * @param max_entries Number of entries the storage can hold
+ *
+ * @return Number of entries filled
+ * @ingroup apiTalApi
+ */
+uint16_t tal_scan_monitor_get_table(trx_id_t trx_id, tal_scan_mon_entry_t *table,
+                                    uint16_t max_entries)
+{
+    uint16_t n = scan_mon[trx_id].num_channels;
+
+    if (n > max_entries)
+    {
+        n = max_entries;
+    }
+    memcpy(table, scan_mon[trx_id].table, n * sizeof(tal_scan_mon_entry_t));
+
+    return n;
+}
+
+
+/**
+ * @brief Gets the background spectrum monitor statistics
+ *
+ * @param trx_id Transceiver identifier
+ * @param stats Pointer to the statistics to be filled
+ * @ingroup apiTalApi
+ */
+void tal_scan_monitor_get_stats(trx_id_t trx_id, tal_scan_mon_stats_t *stats)
+{
+    *stats = scan_mon[trx_id].stats;
+}
+
+
+/**
+ * @brief Clears the averages of the occupancy table
+ *
+ * @param m Monitor state
+ */
+static void reset_mon_table(scan_mon_t *m)
+{
+    for (uint16_t i = 0; i < m->num_channels; i++)
+    {
+        m->table[i].occupancy = 0;
+        m->table[i].energy_dbm = 0;
+        m->table[i].samples = 0;
+        m->energy[i] = 0;
+    }
+}
+
+
+/**
+ * @brief Checks whether a measurement may interrupt the normal operation
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return true if neither a transaction nor a frame reception is ongoing
+ */
+static bool is_trx_idle(trx_id_t trx_id)
+{
+    if ((tal_state[trx_id] != TAL_IDLE) || (tx_state[trx_id] != TX_IDLE) ||
+        ack_transmitting[trx_id] || (tal_incoming_frame_queue[trx_id].size > 0) ||
+        (tal_bb_irqs[trx_id] != BB_IRQ_NO_IRQ))
+    {
+        return false;
+    }
+
+    if (trx_state[trx_id] == RF_RX)
+    {
+        /* The AGC is frozen while a frame is received */
+        CALC_REG_OFFSET(trx_id);
+        if (pal_dev_bit_read(RF215_TRX, GET_REG_ADDR(SR_RF09_AGCC_FRZS)))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/**
+ * @brief Measures the next channel of the monitor and updates its entry
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void monitor_step(trx_id_t trx_id)
+{
+    scan_mon_t *m = &scan_mon[trx_id];
+    tal_scan_mon_entry_t *e = &m->table[m->next];
+    uint16_t home = tal_pib[trx_id].CurrentChannel;
+    tal_scan_result_t res;
+    uint16_t busy;
+    retval_t status;
+
+    begin_measurement(trx_id, m->sample_us);
+    status = measure_channel(trx_id, e->channel, m->dwell_us, m->sample_us,
+                             m->busy_dbm, &res, &busy);
+    end_measurement(trx_id, home);
+
+    if (status == MAC_SUCCESS)
+    {
+        int32_t occ = (int32_t)(((uint32_t)busy * OCCUPANCY_FULL) / res.samples);
+        int32_t energy = (int32_t)res.mean_dbm * 256;
+
+        if (e->samples == 0)
+        {
+            e->occupancy = (uint16_t)occ;
+            m->energy[m->next] = (int16_t)energy;
+        }
+        else
+        {
+            e->occupancy = (uint16_t)(e->occupancy +
+                                      ((occ - e->occupancy) >> TAL_SCAN_MON_EWMA_SHIFT));
+            m->energy[m->next] = (int16_t)(m->energy[m->next] +
+                                           ((energy - m->energy[m->next]) >> TAL_SCAN_MON_EWMA_SHIFT));
+        }
+        e->energy_dbm = (int8_t)(m->energy[m->next] / 256);
+        e->samples += res.samples;
+    }
+
+    m->next++;
+    if (m->next >= m->num_channels)
+    {
+        m->next = 0;
+    }
+}
+
+
+/**
+ * @brief Runs a monitor measurement if the trx is idle
+ *
+ * The gap to the next measurement keeps the share of the measurement time
+ * within the airtime budget.
+ *
+ * @param v Timer parameter; transceiver identifier
+ */
+static void scan_mon_timer_cb(union sigval v)
+{
+    trx_id_t trx_id = (trx_id_t)v.sival_int;
+    scan_mon_t *m = &scan_mon[trx_id];
+    uint32_t delay = (uint32_t)TAL_SCAN_MON_RETRY_MS * 1000;
+
+    ENTER_CRITICAL_REGION();
+    if (!m->active)
+    {
+        LEAVE_CRITICAL_REGION();
+        return;
+    }
+
+    /* The table belongs to the band it has been measured in */
+    if ((m->freq_f0 != tal_pib[trx_id].phy.freq_f0) ||
+        (m->ch_spacing != tal_pib[trx_id].phy.ch_spacing))
+    {
+        reset_mon_table(m);
+        m->freq_f0 = tal_pib[trx_id].phy.freq_f0;
+        m->ch_spacing = tal_pib[trx_id].phy.ch_spacing;
+        m->stats.resets++;
+    }
+
+    if (is_trx_idle(trx_id))
+    {
+        uint32_t start;
+        uint32_t end;
+
+        pal_get_current_time(&start);
+        monitor_step(trx_id);
+        pal_get_current_time(&end);
+
+        m->stats.steps++;
+        m->stats.airtime_us += end - start;
+        delay = (uint32_t)(((uint64_t)(end - start) * (1000 - m->budget_permille)) /
+                           m->budget_permille);
+
+        /* Frames queued during the measurement */
+        start_next_queued_frame(trx_id);
+    }
+    else
+    {
+        m->stats.deferred++;
+    }
+    LEAVE_CRITICAL_REGION();
+
+    pal_timer_start(TAL_T_SCAN_MON, trx_id, delay + 1,
+                    TIMEOUT_RELATIVE, (FUNC_PTR())scan_mon_timer_cb, NULL);
+}
+#endif /* #ifdef SUPPORT_SPECTRUM_MONITOR */
+
+#endif /* #ifdef SUPPORT_SPECTRUM_SCAN */
+
+/* EOF */
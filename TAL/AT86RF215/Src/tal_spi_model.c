@@ -0,0 +1,243 @@
+/**
+ * @file tal_spi_model.c
+ *
+ * @brief This file implements the SPI throughput model used to stream the
+ *        TX frame buffer without underrun.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "pal.h"
+#include "return_val.h"
+#include "tal.h"
+#include "ieee_const.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+
+/* === MACROS ============================================================== */
+
+/** Length of the short calibration access */
+#define SPI_CAL_SHORT_LEN       (16)
+/** Length of the long calibration access */
+#define SPI_CAL_LONG_LEN        (256)
+
+/**
+ * Number of SPI accesses per streamed chunk:
+ * the frame buffer write and the underrun check.
+ */
+#define SPI_ACCESSES_PER_CHUNK  (2)
+
+/* === GLOBALS ============================================================= */
+
+/* Calibrated SPI model; conservative defaults until calibrate_spi_model() ran */
+static tal_spi_model_t spi_model =
+{
+    .access_ns = 50000,
+    .byte_ns = 2000,
+    .jitter_ns = 100000
+};
+
+/* === PROTOTYPES ========================================================== */
+
+static uint32_t time_frame_buf_write(uint16_t len, uint32_t *max_us);
+static bool stream_in_time(trx_id_t trx_id, uint16_t len, uint16_t preload,
+                           uint64_t headroom_ns);
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Measures the duration of writes to the RF09 TX frame buffer
+ *
+ * @param len Number of bytes per write access
+ * @param max_us Returns the longest single access in us
+ *
+ * @return Sum of all access durations in us
+ */
+static uint32_t time_frame_buf_write(uint16_t len, uint32_t *max_us)
+{
+    static uint8_t dummy[SPI_CAL_LONG_LEN];
+    uint32_t sum = 0;
+
+    *max_us = 0;
+    for (uint8_t i = 0; i < TAL_SPI_CALIBRATION_ROUNDS; i++)
+    {
+        uint32_t start, end;
+
+        pal_get_current_time(&start);
+        pal_dev_write(RF215_TRX, RG_BBC0_FBTXS, dummy, len);
+        pal_get_current_time(&end);
+
+        uint32_t duration = end - start;
+        sum += duration;
+        if (duration > *max_us)
+        {
+            *max_us = duration;
+        }
+    }
+
+    return sum;
+}
+
+
+/**
+ * @brief Calibrates the SPI throughput model
+ *
+ * The RF09 TX frame buffer is written with a short and a long access
+ * several times. The per-access overhead and the per-byte duration are
+ * fitted from the averages; the jitter margin is the largest deviation of
+ * a long access from its average. The frame buffer content is meaningless
+ * at this point, so it can be overwritten.
+ */
+void calibrate_spi_model(void)
+{
+    uint32_t max_short, max_long;
+    uint32_t sum_short = time_frame_buf_write(SPI_CAL_SHORT_LEN, &max_short);
+    uint32_t sum_long = time_frame_buf_write(SPI_CAL_LONG_LEN, &max_long);
+
+    /* Averages in ns */
+    uint32_t t_short = (sum_short * 1000) / TAL_SPI_CALIBRATION_ROUNDS;
+    uint32_t t_long = (sum_long * 1000) / TAL_SPI_CALIBRATION_ROUNDS;
+
+    uint32_t byte_ns = 0;
+    if (t_long > t_short)
+    {
+        byte_ns = (t_long - t_short) / (SPI_CAL_LONG_LEN - SPI_CAL_SHORT_LEN);
+    }
+    uint32_t access_ns = 0;
+    if (t_short > (byte_ns * SPI_CAL_SHORT_LEN))
+    {
+        access_ns = t_short - (byte_ns * SPI_CAL_SHORT_LEN);
+    }
+
+    spi_model.access_ns = access_ns;
+    spi_model.byte_ns = byte_ns;
+    spi_model.jitter_ns = (max_long * 1000) - t_long;
+}
+
+
+/**
+ * @brief Gets the calibrated SPI throughput model
+ *
+ * @param model Pointer to the model to be filled
+ */
+void tal_spi_model_get(tal_spi_model_t *model)
+{
+    *model = spi_model;
+}
+
+
+/**
+ * @brief Checks if the frame buffer can be streamed without underrun
+ *
+ * Chunk j is written after the transmit command and covers the bytes
+ * starting at s_j = preload + j * TAL_TX_STREAM_CHUNK. It has to be complete
+ * before the transceiver sends byte s_j, i.e. at headroom + s_j octets.
+ *
+ * @param trx_id Transceiver identifier
+ * @param len Number of bytes to be downloaded
+ * @param preload Number of bytes downloaded before the transmit command
+ * @param headroom_ns Time from the transmit command until the first PSDU byte
+ *
+ * @return true if no underrun is expected
+ */
+static bool stream_in_time(trx_id_t trx_id, uint16_t len, uint16_t preload,
+                           uint64_t headroom_ns)
+{
+    uint64_t octet_ns = (uint64_t)tal_pib[trx_id].OctetDuration_us * 1000;
+    uint64_t spi_ns = spi_model.jitter_ns;
+    uint16_t start = preload;
+
+    while (start < len)
+    {
+        uint16_t chunk = len - start;
+        if (chunk > TAL_TX_STREAM_CHUNK)
+        {
+            chunk = TAL_TX_STREAM_CHUNK;
+        }
+        spi_ns += (SPI_ACCESSES_PER_CHUNK * spi_model.access_ns) +
+                  ((uint64_t)chunk * spi_model.byte_ns);
+        if (spi_ns > (headroom_ns + (start * octet_ns)))
+        {
+            return false;
+        }
+        start += chunk;
+    }
+
+    return true;
+}
+
+
+/**
+ * @brief Calculates the number of bytes to be downloaded before the TX command
+ *
+ * The remaining bytes are streamed in chunks of TAL_TX_STREAM_CHUNK bytes
+ * during CCA and SHR/PHR transmission.
+ *
+ * @param trx_id Transceiver identifier
+ * @param len Number of bytes to be downloaded, FCS excluded
+ * @param cca WITH_CCA if a CCA is performed before transmission
+ *
+ * @return Number of bytes to be preloaded; len if streaming cannot keep up
+ */
+uint16_t get_tx_preload_len(trx_id_t trx_id, uint16_t len, cca_use_t cca)
+{
+    uint64_t headroom_ns = (uint64_t)(shr_duration_sym(trx_id) + phr_duration_sym(trx_id)) *
+                           tal_pib[trx_id].SymbolDuration_us * 1000;
+    if (cca == WITH_CCA)
+    {
+        headroom_ns += (uint64_t)tal_pib[trx_id].CCADuration_us * 1000;
+    }
+
+    /* First chunk: bytes before it are sent while it is written */
+    uint64_t octet_ns = (uint64_t)tal_pib[trx_id].OctetDuration_us * 1000;
+    uint64_t first_ns = spi_model.jitter_ns +
+                        (SPI_ACCESSES_PER_CHUNK * spi_model.access_ns) +
+                        ((uint64_t)TAL_TX_STREAM_CHUNK * spi_model.byte_ns);
+    uint16_t preload = 0;
+    if ((first_ns > headroom_ns) && (octet_ns > 0))
+    {
+        uint64_t p = (first_ns - headroom_ns + octet_ns - 1) / octet_ns;
+        preload = (p > len) ? len : (uint16_t)p;
+    }
+
+    /* SPI slower than the air interface: later chunks need a larger preload */
+    while ((preload < len) && !stream_in_time(trx_id, len, preload, headroom_ns))
+    {
+        preload += TAL_TX_STREAM_CHUNK;
+    }
+    if (preload > len)
+    {
+        preload = len;
+    }
+
+    return preload;
+}
+
+
+/**
+ * @brief Predicts the preload length for a frame on the current PHY
+ *
+ * @param trx_id Transceiver identifier
+ * @param len MPDU length without FCS
+ * @param with_cca true if a CCA is performed before transmission
+ *
+ * @return Number of bytes downloaded before the transmit command
+ */
+uint16_t tal_tx_preload_len(trx_id_t trx_id, uint16_t len, bool with_cca)
+{
+    return get_tx_preload_len(trx_id, len, with_cca ? WITH_CCA : NO_CCA);
+}
+
+/* EOF */
@@ -0,0 +1,968 @@
+/**
+ * @file tal_tsch.c
+ *
+ * @brief This file implements time-slotted channel hopping (TSCH).
+ *
+ * The schedule consists of slotframes whose cells repeat every slotframe
+ * size timeslots. The channel of a cell is taken from the hopping sequence
+ * at (ASN + channel offset) modulo the sequence length. If cells of several
+ * slotframes fall into the same timeslot, the slotframe with the lowest
+ * handle is used; within a slotframe a TX cell takes precedence over an RX
+ * cell if a frame is queued.
+ *
+ * Each active slot is handled by a single timer:
+ * - TAL_TSCH_PREPARE_US ahead of the slot start the channel is tuned and
+ *   the frame of a TX slot is downloaded to the frame buffer, so that the
+ *   transmission needs a single command only.
+ * - The action timer expires TAL_TSCH_SPIN_US early; the remaining time is
+ *   spent polling the monotonic clock, so the timer latency does not add
+ *   to the lateness. RF_TX is issued at slot start plus TsTxOffset, RF_RX
+ *   at slot start plus TsRxOffset.
+ * - The receiver is switched off again if no frame has started within
+ *   TsRxWait; otherwise at the end of the slot. The frame start interrupt
+ *   is issued once the header has been received, so the header duration is
+ *   added to the guard window.
+ *
+ * The slots are derived from a reference (ASN, time) and the timeslot
+ * duration, so the timer latency does not accumulate. The reference is
+ * shifted by the offset of frames received within timekeeping cells and by
+ * corrections provided using tal_tsch_adjust_time(). The trx is kept in
+ * TRXOFF between the active slots.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include "pal.h"
+#include "return_val.h"
+#include "tal.h"
+#include "ieee_const.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include <signal.h>
+
+#ifdef SUPPORT_TSCH
+
+/* === TYPES =============================================================== */
+
+/**
+ * Pending step of the current slot
+ */
+typedef enum tsch_event_tag
+{
+    TSCH_NONE,
+    TSCH_PREPARE,
+    TSCH_ACTION,
+    TSCH_RX_GUARD,
+    TSCH_END
+} tsch_event_t;
+
+/**
+ * Slotframe
+ */
+typedef struct tsch_slotframe_tag
+{
+    /** Number of timeslots; 0 if unused */
+    uint16_t size;
+    uint8_t num_cells;
+    /** Cells sorted by slot offset */
+    tal_tsch_cell_t cells[TAL_TSCH_MAX_CELLS];
+} tsch_slotframe_t;
+
+/**
+ * Frame waiting for a TX cell
+ */
+typedef struct tsch_tx_entry_tag
+{
+    frame_info_t *frame;
+    uint8_t retries;
+} tsch_tx_entry_t;
+
+/**
+ * TSCH state of a transceiver
+ */
+typedef struct tsch_tag
+{
+    bool active;
+    tal_tsch_timing_t timing;
+    uint16_t hop_seq[TAL_TSCH_MAX_HOP_SEQ_LEN];
+    uint8_t hop_seq_len;
+    tsch_slotframe_t sf[TAL_TSCH_MAX_SLOTFRAMES];
+    /** Slot timing reference: slot ref_asn starts at ref_time */
+    uint64_t ref_asn;
+    uint32_t ref_time;
+    /** Current slot */
+    uint64_t asn;
+    uint32_t slot_start;
+    uint8_t options;
+    bool tx_slot;
+    uint32_t rx_open;
+    /** Pending step and its due time */
+    tsch_event_t event;
+    uint32_t event_time;
+    /** Default state of the trx before TSCH has been started */
+    rf_cmd_state_t default_state;
+    /** Queued frames */
+    tsch_tx_entry_t queue[TAL_TSCH_TX_QUEUE_LEN];
+    uint8_t queue_head;
+    uint8_t queue_cnt;
+    /** Backoff of the shared cells */
+    uint8_t be;
+    uint16_t backoff;
+    tal_tsch_stats_t stats;
+} tsch_t;
+
+/* === GLOBALS ============================================================= */
+
+static tsch_t tsch[NUM_TRX];
+
+/* === PROTOTYPES ========================================================== */
+
+static bool find_next_slot(tsch_t *t, uint64_t after, uint64_t *next);
+static const tal_tsch_cell_t *select_cell(tsch_t *t, bool *tx);
+static void schedule_next_slot(trx_id_t trx_id);
+static void start_event(trx_id_t trx_id, tsch_event_t event, uint32_t time);
+static void prepare_slot(trx_id_t trx_id);
+static void start_slot_action(trx_id_t trx_id);
+static void turn_off(trx_id_t trx_id);
+static void dequeue_frame(tsch_t *t);
+static uint32_t header_duration_us(trx_id_t trx_id);
+static void tsch_timer_cb(union sigval v);
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Starts time-slotted channel hopping
+ *
+ * The slot cfg->asn starts now; the first active slot is the next slot
+ * containing a cell.
+ *
+ * @param trx_id Transceiver identifier
+ * @param cfg TSCH configuration
+ *
+ * @return
+ *      - @ref MAC_SUCCESS if TSCH has been started
+ *      - @ref MAC_INVALID_PARAMETER if the configuration is invalid
+ *      - @ref TAL_BUSY if the TAL is not idle
+ *      - @ref TAL_TRX_ASLEEP if the device is in sleep mode
+ * @ingroup apiTalApi
+ */
+retval_t tal_tsch_start(trx_id_t trx_id, const tal_tsch_cfg_t *cfg)
+{
+    tsch_t *t = &tsch[trx_id];
+    static const tal_tsch_timing_t def_timing =
+    {
+        TAL_TSCH_TIMESLOT_US, TAL_TSCH_TX_OFFSET_US,
+        TAL_TSCH_RX_OFFSET_US, TAL_TSCH_RX_WAIT_US
+    };
+    const tal_tsch_timing_t *timing;
+
+    ASSERT((trx_id >= 0) && (trx_id < NUM_TRX));
+
+    if (tal_state[trx_id] == TAL_SLEEP)
+    {
+        return TAL_TRX_ASLEEP;
+    }
+
+    if ((cfg == NULL) || (cfg->hop_seq == NULL) || (cfg->hop_seq_len == 0) ||
+        (cfg->hop_seq_len > TAL_TSCH_MAX_HOP_SEQ_LEN))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    timing = (cfg->timing != NULL) ? cfg->timing : &def_timing;
+    if ((timing->tx_offset_us >= timing->timeslot_us) ||
+        ((timing->rx_offset_us + timing->rx_wait_us) >= timing->timeslot_us) ||
+        (timing->timeslot_us <= TAL_TSCH_PREPARE_US))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    if (t->active)
+    {
+        tal_tsch_stop(trx_id);
+    }
+
+    if (tal_state[trx_id] != TAL_IDLE)
+    {
+        return TAL_BUSY;
+    }
+
+    t->timing = *timing;
+    memcpy(t->hop_seq, cfg->hop_seq, cfg->hop_seq_len * sizeof(uint16_t));
+    t->hop_seq_len = cfg->hop_seq_len;
+    memset(&t->stats, 0, sizeof(t->stats));
+    t->be = tal_pib[trx_id].MinBE;
+    t->backoff = 0;
+    t->tx_slot = false;
+
+    /* The trx is off between the active slots */
+    t->default_state = trx_default_state[trx_id];
+    trx_default_state[trx_id] = RF_TRXOFF;
+    turn_off(trx_id);
+
+    t->asn = cfg->asn;
+    t->ref_asn = cfg->asn;
+    pal_get_current_time(&t->ref_time);
+    t->slot_start = t->ref_time;
+    t->active = true;
+
+    schedule_next_slot(trx_id);
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Stops time-slotted channel hopping
+ *
+ * Queued frames are reported with MAC_TRANSACTION_EXPIRED; an ongoing
+ * transmission is completed, a prepared one is cancelled. The previous default state of the trx is
+ * restored.
+ *
+ * @param trx_id Transceiver identifier
+ * @ingroup apiTalApi
+ */
+void tal_tsch_stop(trx_id_t trx_id)
+{
+    tsch_t *t = &tsch[trx_id];
+    tsch_event_t event = t->event;
+
+    if (!t->active)
+    {
+        return;
+    }
+
+    t->active = false;
+    t->event = TSCH_NONE;
+    pal_timer_stop(TAL_T_TSCH, trx_id);
+
+    if (t->tx_slot && (tal_state[trx_id] == TAL_TX))
+    {
+        if (event == TSCH_ACTION)
+        {
+            /* Prepared by prepare_slot(), but not started yet */
+            frame_info_t *frame = t->queue[t->queue_head].frame;
+            cancel_prepared_tx(trx_id);
+            dequeue_frame(t);
+            tal_tx_frame_done_cb(trx_id, MAC_TRANSACTION_EXPIRED, frame);
+        }
+        else
+        {
+            /* The frame of an ongoing transmission is reported by the TAL */
+            dequeue_frame(t);
+        }
+    }
+    t->tx_slot = false;
+
+    while (t->queue_cnt > 0)
+    {
+        frame_info_t *frame = t->queue[t->queue_head].frame;
+        dequeue_frame(t);
+        tal_tx_frame_done_cb(trx_id, MAC_TRANSACTION_EXPIRED, frame);
+    }
+
+    trx_default_state[trx_id] = t->default_state;
+    if ((tal_state[trx_id] == TAL_IDLE) && (trx_default_state[trx_id] == RF_RX))
+    {
+        switch_to_rx(trx_id);
+    }
+
+    /* Frames queued while the slots were running */
+    start_next_queued_frame(trx_id);
+}
+
+
+/**
+ * @brief Sets the size of a slotframe
+ *
+ * The cells of the slotframe are removed.
+ *
+ * @param trx_id Transceiver identifier
+ * @param handle Slotframe handle; lower handles take precedence
+ * @param size Number of timeslots; 0 removes the slotframe
+ *
+ * @return MAC_SUCCESS or MAC_INVALID_PARAMETER
+ * @ingroup apiTalApi
+ */
+retval_t tal_tsch_set_slotframe(trx_id_t trx_id, uint8_t handle, uint16_t size)
+{
+    if (handle >= TAL_TSCH_MAX_SLOTFRAMES)
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    tsch[trx_id].sf[handle].size = size;
+    tsch[trx_id].sf[handle].num_cells = 0;
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Adds a cell to a slotframe
+ *
+ * @param trx_id Transceiver identifier
+ * @param handle Slotframe handle
+ * @param cell Cell to be added
+ *
+ * @return
+ *      - @ref MAC_SUCCESS if the cell has been added
+ *      - @ref MAC_TRANSACTION_OVERFLOW if the slotframe is full
+ *      - @ref MAC_INVALID_PARAMETER if the cell is invalid
+ * @ingroup apiTalApi
+ */
+retval_t tal_tsch_add_cell(trx_id_t trx_id, uint8_t handle, const tal_tsch_cell_t *cell)
+{
+    tsch_t *t = &tsch[trx_id];
+    tsch_slotframe_t *sf;
+    uint8_t pos;
+
+    if ((handle >= TAL_TSCH_MAX_SLOTFRAMES) || (cell == NULL) ||
+        ((cell->options & (TAL_TSCH_OPT_TX | TAL_TSCH_OPT_RX)) == 0))
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    sf = &t->sf[handle];
+    if (cell->slot_offset >= sf->size)
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+    if (sf->num_cells >= TAL_TSCH_MAX_CELLS)
+    {
+        return MAC_TRANSACTION_OVERFLOW;
+    }
+
+    /* Keep the cells sorted by slot offset */
+    pos = sf->num_cells;
+    while ((pos > 0) && (sf->cells[pos - 1].slot_offset > cell->slot_offset))
+    {
+        sf->cells[pos] = sf->cells[pos - 1];
+        pos--;
+    }
+    sf->cells[pos] = *cell;
+    sf->num_cells++;
+
+    /* Resume the schedule if there has not been any cell */
+    if (t->active && (t->event == TSCH_NONE))
+    {
+        schedule_next_slot(trx_id);
+    }
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Removes a cell from a slotframe
+ *
+ * @param trx_id Transceiver identifier
+ * @param handle Slotframe handle
+ * @param slot_offset Timeslot of the cell
+ * @param channel_offset Channel offset of the cell
+ *
+ * @return MAC_SUCCESS or MAC_INVALID_PARAMETER if the cell does not exist
+ * @ingroup apiTalApi
+ */
+retval_t tal_tsch_remove_cell(trx_id_t trx_id, uint8_t handle,
+                              uint16_t slot_offset, uint16_t channel_offset)
+{
+    tsch_slotframe_t *sf;
+
+    if (handle >= TAL_TSCH_MAX_SLOTFRAMES)
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    sf = &tsch[trx_id].sf[handle];
+    for (uint8_t i = 0; i < sf->num_cells; i++)
+    {
+        if ((sf->cells[i].slot_offset == slot_offset) &&
+            (sf->cells[i].channel_offset == channel_offset))
+        {
+            sf->num_cells--;
+            memmove(&sf->cells[i], &sf->cells[i + 1],
+                    (sf->num_cells - i) * sizeof(tal_tsch_cell_t));
+            return MAC_SUCCESS;
+        }
+    }
+
+    return MAC_INVALID_PARAMETER;
+}
+
+
+/**
+ * @brief Queues a frame for the next TX cell
+ *
+ * @param trx_id Transceiver identifier
+ * @param tx_frame Pointer to the frame_info_t structure
+ *
+ * @return
+ *      - @ref MAC_SUCCESS if the frame has been queued
+ *      - @ref MAC_TRANSACTION_OVERFLOW if the queue is full
+ *      - @ref MAC_INVALID_PARAMETER if the frame is invalid
+ * @ingroup apiTalApi
+ */
+retval_t tal_tsch_tx_frame(trx_id_t trx_id, frame_info_t *tx_frame)
+{
+    tsch_t *t = &tsch[trx_id];
+
+    if (tx_frame == NULL)
+    {
+        return MAC_INVALID_PARAMETER;
+    }
+
+    ENTER_CRITICAL_REGION();
+    if (t->queue_cnt >= TAL_TSCH_TX_QUEUE_LEN)
+    {
+        LEAVE_CRITICAL_REGION();
+        return MAC_TRANSACTION_OVERFLOW;
+    }
+
+    uint8_t tail = (t->queue_head + t->queue_cnt) % TAL_TSCH_TX_QUEUE_LEN;
+    t->queue[tail].frame = tx_frame;
+    t->queue[tail].retries = 0;
+    t->queue_cnt++;
+    LEAVE_CRITICAL_REGION();
+
+    return MAC_SUCCESS;
+}
+
+
+/**
+ * @brief Corrects the slot timing
+ *
+ * A positive correction delays the following slots.
+ *
+ * @param trx_id Transceiver identifier
+ * @param correction_us Time the slots are shifted by
+ * @ingroup apiTalApi
+ */
+void tal_tsch_adjust_time(trx_id_t trx_id, int32_t correction_us)
+{
+    tsch[trx_id].ref_time += (uint32_t)correction_us;
+    tsch[trx_id].stats.corrections++;
+}
+
+
+/**
+ * @brief Gets the TSCH statistics
+ *
+ * @param trx_id Transceiver identifier
+ * @param stats Pointer to the statistics to be filled
+ * @ingroup apiTalApi
+ */
+void tal_tsch_get_stats(trx_id_t trx_id, tal_tsch_stats_t *stats)
+{
+    *stats = tsch[trx_id].stats;
+    stats->asn = tsch[trx_id].asn;
+}
+
+
+/**
+ * @brief Handles a completed transmission
+ *
+ * A failed frame is kept in the queue for the next TX cell until
+ * macMaxFrameRetries is reached. Shared cells use an exponential backoff.
+ *
+ * @param trx_id Transceiver identifier
+ * @param status Status of the transmission
+ * @param frame Completed frame
+ *
+ * @return true if the frame belongs to the slot schedule
+ */
+bool tsch_tx_done(trx_id_t trx_id, retval_t status, frame_info_t *frame)
+{
+    tsch_t *t = &tsch[trx_id];
+    tsch_tx_entry_t *entry = &t->queue[t->queue_head];
+
+    if (!t->active || !t->tx_slot || (t->queue_cnt == 0) || (entry->frame != frame))
+    {
+        return false;
+    }
+    t->tx_slot = false;
+
+    if ((status == MAC_SUCCESS) || (status == TAL_FRAME_PENDING))
+    {
+        t->be = tal_pib[trx_id].MinBE;
+        t->backoff = 0;
+    }
+    else
+    {
+        if (t->options & TAL_TSCH_OPT_SHARED)
+        {
+            if (t->be < tal_pib[trx_id].MaxBE)
+            {
+                t->be++;
+            }
+            t->backoff = (uint16_t)(TAL_RAND(trx_id) & (((uint16_t)1 << t->be) - 1));
+        }
+        if (entry->retries < tal_pib[trx_id].MaxFrameRetries)
+        {
+            entry->retries++;
+            t->stats.tx_retries++;
+            return true;
+        }
+    }
+
+    dequeue_frame(t);
+    if (t->queue_cnt == 0)
+    {
+        t->be = tal_pib[trx_id].MinBE;
+        t->backoff = 0;
+    }
+    tal_tx_frame_done_cb(trx_id, status, frame);
+
+    return true;
+}
+
+
+/**
+ * @brief Synchronizes the slot timing to a received frame
+ *
+ * The frame start is expected at TsTxOffset plus the SHR and PHR duration
+ * after the slot start. The offset is applied to the slot timing if the
+ * frame has been received within a timekeeping cell.
+ *
+ * @param trx_id Transceiver identifier
+ */
+void tsch_rx_frame(trx_id_t trx_id)
+{
+    tsch_t *t = &tsch[trx_id];
+    uint32_t expected;
+    int32_t offset;
+
+    if (!t->active || t->tx_slot ||
+        ((t->event != TSCH_RX_GUARD) && (t->event != TSCH_END)))
+    {
+        return;
+    }
+
+    expected = t->slot_start + t->timing.tx_offset_us + header_duration_us(trx_id);
+    offset = (int32_t)((uint32_t)(rx_frm_info[trx_id]->time_stamp / 1000) - expected);
+
+    t->stats.rx_frames++;
+    t->stats.last_rx_offset_us = offset;
+
+    if ((t->options & TAL_TSCH_OPT_TIMEKEEPING) &&
+        ((uint32_t)abs(offset) <= t->timing.rx_wait_us))
+    {
+        t->ref_time += (uint32_t)offset;
+        t->stats.corrections++;
+    }
+}
+
+
+/**
+ * @brief Resets the TSCH state
+ *
+ * @param trx_id Transceiver identifier
+ */
+void reset_tsch(trx_id_t trx_id)
+{
+    tsch[trx_id].active = false;
+    tsch[trx_id].event = TSCH_NONE;
+    tsch[trx_id].tx_slot = false;
+    tsch[trx_id].queue_cnt = 0;
+}
+
+
+/**
+ * @brief Finds the next slot containing a cell
+ *
+ * @param t TSCH state
+ * @param after The slot after this ASN is searched
+ * @param next Storage for the ASN of the found slot
+ *
+ * @return false if there is no cell at all
+ */
+static bool find_next_slot(tsch_t *t, uint64_t after, uint64_t *next)
+{
+    bool found = false;
+
+    for (uint8_t h = 0; h < TAL_TSCH_MAX_SLOTFRAMES; h++)
+    {
+        tsch_slotframe_t *sf = &t->sf[h];
+        uint16_t offset;
+        uint16_t delta;
+        uint8_t i = 0;
+
+        if ((sf->size == 0) || (sf->num_cells == 0))
+        {
+            continue;
+        }
+
+        offset = (uint16_t)((after + 1) % sf->size);
+        while ((i < sf->num_cells) && (sf->cells[i].slot_offset < offset))
+        {
+            i++;
+        }
+        if (i < sf->num_cells)
+        {
+            delta = sf->cells[i].slot_offset - offset;
+        }
+        else
+        {
+            /* Wrap to the first cell of the next slotframe cycle */
+            delta = sf->size - offset + sf->cells[0].slot_offset;
+        }
+
+        if (!found || ((after + 1 + delta) < *next))
+        {
+            *next = after + 1 + delta;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+
+/**
+ * @brief Selects the cell used within the current slot
+ *
+ * @param t TSCH state
+ * @param tx Storage for true if the cell is used for transmission
+ *
+ * @return Cell or NULL if the slot is not used
+ */
+static const tal_tsch_cell_t *select_cell(tsch_t *t, bool *tx)
+{
+    for (uint8_t h = 0; h < TAL_TSCH_MAX_SLOTFRAMES; h++)
+    {
+        tsch_slotframe_t *sf = &t->sf[h];
+        const tal_tsch_cell_t *rx_cell = NULL;
+
+        if (sf->size == 0)
+        {
+            continue;
+        }
+
+        uint16_t offset = (uint16_t)(t->asn % sf->size);
+        for (uint8_t i = 0; (i < sf->num_cells) && (sf->cells[i].slot_offset <= offset); i++)
+        {
+            const tal_tsch_cell_t *cell = &sf->cells[i];
+
+            if (cell->slot_offset != offset)
+            {
+                continue;
+            }
+            if ((cell->options & TAL_TSCH_OPT_TX) && (t->queue_cnt > 0))
+            {
+                if (!(cell->options & TAL_TSCH_OPT_SHARED) || (t->backoff == 0))
+                {
+                    *tx = true;
+                    return cell;
+                }
+                /* Shared cell within the backoff */
+                t->backoff--;
+            }
+            if ((cell->options & TAL_TSCH_OPT_RX) && (rx_cell == NULL))
+            {
+                rx_cell = cell;
+            }
+        }
+
+        if (rx_cell != NULL)
+        {
+            *tx = false;
+            return rx_cell;
+        }
+    }
+
+    return NULL;
+}
+
+
+/**
+ * @brief Schedules the preparation of the next active slot
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void schedule_next_slot(trx_id_t trx_id)
+{
+    tsch_t *t = &tsch[trx_id];
+    uint64_t after = t->asn;
+    uint64_t next;
+    uint32_t now;
+
+    /* Continue with the current slot if slots have passed */
+    pal_get_current_time(&now);
+    if ((int32_t)(now - t->ref_time) > 0)
+    {
+        uint64_t cur = t->ref_asn + (now - t->ref_time) / t->timing.timeslot_us;
+        if (cur > after)
+        {
+            after = cur;
+        }
+    }
+
+    if (!find_next_slot(t, after, &next))
+    {
+        t->event = TSCH_NONE;
+        return;
+    }
+
+    t->asn = next;
+    t->slot_start = t->ref_time + (uint32_t)(next - t->ref_asn) * t->timing.timeslot_us;
+    start_event(trx_id, TSCH_PREPARE, t->slot_start - TAL_TSCH_PREPARE_US);
+}
+
+
+/**
+ * @brief Starts the timer of the next step
+ *
+ * @param trx_id Transceiver identifier
+ * @param event Next step
+ * @param time Due time of the step
+ */
+static void start_event(trx_id_t trx_id, tsch_event_t event, uint32_t time)
+{
+    tsch_t *t = &tsch[trx_id];
+    uint32_t now;
+    int32_t delay;
+
+    t->event = event;
+    t->event_time = time;
+
+    pal_get_current_time(&now);
+    delay = (int32_t)(time - now);
+    if (event == TSCH_ACTION)
+    {
+        delay -= TAL_TSCH_SPIN_US;
+    }
+    if (delay < 1)
+    {
+        delay = 1;
+    }
+
+    pal_timer_start(TAL_T_TSCH, trx_id, (uint32_t)delay,
+                    TIMEOUT_RELATIVE, (FUNC_PTR())tsch_timer_cb, NULL);
+}
+
+
+/**
+ * @brief Tunes the channel and prepares the frame of an active slot
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void prepare_slot(trx_id_t trx_id)
+{
+    tsch_t *t = &tsch[trx_id];
+    const tal_tsch_cell_t *cell;
+    uint32_t action;
+    uint32_t now;
+    bool tx;
+
+    /* Re-base the slot timing; keeps the slot arithmetic within 32 bit */
+    t->ref_asn = t->asn;
+    t->ref_time = t->slot_start;
+
+    cell = select_cell(t, &tx);
+    if (cell == NULL)
+    {
+        schedule_next_slot(trx_id);
+        return;
+    }
+
+    action = t->slot_start + (tx ? t->timing.tx_offset_us : t->timing.rx_offset_us);
+    pal_get_current_time(&now);
+    if ((tal_state[trx_id] != TAL_IDLE) || ack_transmitting[trx_id] ||
+        ((int32_t)(action - now) < TAL_TSCH_SPIN_US))
+    {
+        t->stats.skipped_slots++;
+        schedule_next_slot(trx_id);
+        return;
+    }
+
+    if (tune_channel(trx_id, t->hop_seq[(t->asn + cell->channel_offset) % t->hop_seq_len]) !=
+        MAC_SUCCESS)
+    {
+        t->stats.skipped_slots++;
+        schedule_next_slot(trx_id);
+        return;
+    }
+
+    /* Lock the PLL ahead of the slot action */
+    CALC_REG_OFFSET(trx_id);
+    pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_RF09_CMD), RF_TXPREP);
+    trx_state[trx_id] = RF_TXPREP;
+
+    t->options = cell->options;
+    if (tx)
+    {
+        frame_info_t *frame = t->queue[t->queue_head].frame;
+        if (prepare_tx_transaction(trx_id, frame) != MAC_SUCCESS)
+        {
+            dequeue_frame(t);
+            turn_off(trx_id);
+            tal_tx_frame_done_cb(trx_id, MAC_INVALID_PARAMETER, frame);
+            schedule_next_slot(trx_id);
+            return;
+        }
+    }
+    t->tx_slot = tx;
+
+    start_event(trx_id, TSCH_ACTION, action);
+}
+
+
+/**
+ * @brief Starts the transmission or reception at the slot timing
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void start_slot_action(trx_id_t trx_id)
+{
+    tsch_t *t = &tsch[trx_id];
+    uint32_t now;
+
+    /* Wait for the exact time; the timer expires TAL_TSCH_SPIN_US early */
+    do
+    {
+        pal_get_current_time(&now);
+    } while ((int32_t)(now - t->event_time) < 0);
+
+    if (t->tx_slot)
+    {
+        start_prepared_tx(trx_id);
+        add_latency(&t->stats.slot_lateness, t->event_time);
+        t->stats.tx_slots++;
+    }
+    else
+    {
+        switch_to_rx(trx_id);
+        add_latency(&t->stats.slot_lateness, t->event_time);
+        t->stats.rx_slots++;
+        t->rx_open = t->event_time;
+    }
+
+    if (t->stats.slot_lateness.last_us > TAL_TSCH_LATE_US)
+    {
+        t->stats.late_slots++;
+    }
+
+    if (t->tx_slot)
+    {
+        /* The trx is switched off by the TAL after the transmission */
+        schedule_next_slot(trx_id);
+    }
+    else
+    {
+        start_event(trx_id, TSCH_RX_GUARD,
+                    t->event_time + t->timing.rx_wait_us + header_duration_us(trx_id));
+    }
+}
+
+
+/**
+ * @brief Switches the trx off between the slots
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void turn_off(trx_id_t trx_id)
+{
+    if ((tal_state[trx_id] != TAL_IDLE) || ack_transmitting[trx_id] ||
+        (trx_state[trx_id] == RF_TRXOFF))
+    {
+        return;
+    }
+
+    CALC_REG_OFFSET(trx_id);
+#if (defined SUPPORT_FSK) || (defined SUPPORT_OQPSK)
+    stop_rpc(trx_id);
+#endif
+    pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_RF09_CMD), RF_TRXOFF);
+    trx_state[trx_id] = RF_TRXOFF;
+}
+
+
+/**
+ * @brief Removes the head of the TX queue
+ *
+ * @param t TSCH state
+ */
+static void dequeue_frame(tsch_t *t)
+{
+    t->queue_head = (t->queue_head + 1) % TAL_TSCH_TX_QUEUE_LEN;
+    t->queue_cnt--;
+}
+
+
+/**
+ * @brief Gets the duration of SHR and PHR
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return Time from the frame start until the frame start interrupt in us
+ */
+static uint32_t header_duration_us(trx_id_t trx_id)
+{
+    return (uint32_t)(shr_duration_sym(trx_id) + phr_duration_sym(trx_id)) *
+           tal_pib[trx_id].SymbolDuration_us;
+}
+
+
+/**
+ * @brief Handles the steps of an active slot
+ *
+ * @param v Timer parameter; transceiver identifier
+ */
+static void tsch_timer_cb(union sigval v)
+{
+    trx_id_t trx_id = (trx_id_t)v.sival_int;
+    tsch_t *t = &tsch[trx_id];
+
+    ENTER_CRITICAL_REGION();
+    if (t->active)
+    {
+        switch (t->event)
+        {
+            case TSCH_PREPARE:
+                prepare_slot(trx_id);
+                break;
+
+            case TSCH_ACTION:
+                start_slot_action(trx_id);
+                break;
+
+            case TSCH_RX_GUARD:
+                /* Keep the receiver on until the slot end if a frame has started */
+                if ((int32_t)(fs_tstamp[trx_id] - t->rx_open) >= 0)
+                {
+                    start_event(trx_id, TSCH_END,
+                                t->slot_start + t->timing.timeslot_us - TAL_TSCH_PREPARE_US);
+                    break;
+                }
+                turn_off(trx_id);
+                schedule_next_slot(trx_id);
+                break;
+
+            case TSCH_END:
+                turn_off(trx_id);
+                schedule_next_slot(trx_id);
+                break;
+
+            default:
+                break;
+        }
+    }
+    LEAVE_CRITICAL_REGION();
+}
+
+#endif /* #ifdef SUPPORT_TSCH */
+
+/* EOF */
@@ -0,0 +1,365 @@
+/**
+ * @file tal_tstamp.c
+ *
+ * @brief This file implements the frame time stamps.
+ *
+ * Frame time stamps are 64-bit values in ns using the time base of
+ * pal_get_current_time_ns().
+ *
+ * Without SUPPORT_HW_TSTAMP the time stamp is the host time the frame start
+ * interrupt has been serviced at.
+ *
+ * With SUPPORT_HW_TSTAMP the baseband counter runs freely at 32 MHz and
+ * captures its value at each RX frame start (RXFS) and TX start. The
+ * captured value is read within the interrupt handler at RXFS and TXFE and
+ * converted to host time using a correlation that is maintained by a
+ * periodic timer: the counter is read live within a short window bracketed
+ * by two host clock readings; the tightest of TAL_HW_TSTAMP_TRIES readings
+ * is used. The drift between the trx crystal and the host clock is
+ * estimated over a baseline of up to TSTAMP_MAX_BASELINE_NS; the offset is
+ * corrected by half of the phase error of each sample. The time stamps
+ * are independent of the interrupt latency.
+ *
+ * Capturing is disabled while the counter is read live; a frame starting
+ * within that window falls back to the host time stamp.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include "pal.h"
+#include "return_val.h"
+#include "tal.h"
+#include "ieee_const.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include <signal.h>
+
+#ifdef ENABLE_TSTAMP
+
+/* === MACROS ============================================================== */
+
+#ifdef SUPPORT_HW_TSTAMP
+/** Counter clock in MHz */
+#define BBC_CNT_FREQ_MHZ            (32)
+
+/** Free running counter capturing RX frame start and TX start */
+#define BBC_CNT_CFG                 (CNTC_EN_MASK | CNTC_CAPRXS_MASK | CNTC_CAPTXS_MASK)
+
+/** Time in ms until a sample is retried if the TAL was busy */
+#define TSTAMP_RETRY_MS             (10)
+
+/** Maximum drift baseline; half of the counter wrap period */
+#define TSTAMP_MAX_BASELINE_NS      (32000000000LL)
+
+/** Minimum drift baseline in samples */
+#define TSTAMP_MIN_BASELINE         (4)
+
+/** Time in us after a live read a captured value is not trusted */
+#define TSTAMP_SAMPLE_GUARD_US      (5000)
+#endif
+
+/* === TYPES =============================================================== */
+
+#ifdef SUPPORT_HW_TSTAMP
+/**
+ * Correlation of the counter to the host clock
+ */
+typedef struct tstamp_corr_tag
+{
+    bool valid;
+    /** Counter value at the host time ns */
+    uint32_t cnt;
+    uint64_t ns;
+    /** Correction of the nominal counter period in ppb */
+    int32_t drift_ppb;
+    /** Start of the drift baseline */
+    uint32_t base_cnt;
+    uint64_t base_ns;
+    bool base_valid;
+    /** Live read ongoing and the host time it has ended at */
+    volatile bool sampling;
+    uint32_t sample_end_us;
+    /** Counter value of the last frame and the host time it was read at */
+    uint32_t frame_cnt;
+    uint32_t frame_us;
+    bool frame_valid;
+    tal_hw_tstamp_stats_t stats;
+} tstamp_corr_t;
+#endif
+
+/* === GLOBALS ============================================================= */
+
+#ifdef SUPPORT_HW_TSTAMP
+static tstamp_corr_t tstamp_corr[NUM_TRX];
+#endif
+
+/* === PROTOTYPES ========================================================== */
+
+#ifdef SUPPORT_HW_TSTAMP
+static uint64_t cnt_to_ns(const tstamp_corr_t *c, uint32_t cnt);
+static void sample_counter(trx_id_t trx_id, uint32_t *cnt, uint64_t *ns);
+static void update_correlation(trx_id_t trx_id);
+static void tstamp_timer_cb(union sigval v);
+#endif
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Gets the time stamp of the current frame
+ *
+ * @param trx_id Transceiver identifier
+ *
+ * @return Start of the frame in ns
+ */
+uint64_t get_frame_tstamp(trx_id_t trx_id)
+{
+    uint64_t now;
+
+#ifdef SUPPORT_HW_TSTAMP
+    tstamp_corr_t *c = &tstamp_corr[trx_id];
+
+    /* The capture belongs to the frame if it has been read after its start */
+    if (c->valid && c->frame_valid &&
+        ((int32_t)(c->frame_us - fs_tstamp[trx_id]) >= 0))
+    {
+        c->frame_valid = false;
+        c->stats.hw_stamps++;
+        return cnt_to_ns(c, c->frame_cnt);
+    }
+    c->stats.host_stamps++;
+#endif
+
+    /* Extend the 32-bit host time stamp */
+    pal_get_current_time_ns(&now);
+    now /= 1000;
+    return (now - (uint32_t)((uint32_t)now - fs_tstamp[trx_id])) * 1000;
+}
+
+
+#ifdef SUPPORT_HW_TSTAMP
+/**
+ * @brief Gets the hardware time stamp statistics
+ *
+ * @param trx_id Transceiver identifier
+ * @param stats Pointer to the statistics to be filled
+ * @ingroup apiTalApi
+ */
+void tal_hw_tstamp_get_stats(trx_id_t trx_id, tal_hw_tstamp_stats_t *stats)
+{
+    *stats = tstamp_corr[trx_id].stats;
+    stats->drift_ppb = tstamp_corr[trx_id].drift_ppb;
+    stats->valid = tstamp_corr[trx_id].valid;
+}
+
+
+/**
+ * @brief Configures the counter and restarts the correlation
+ *
+ * Called whenever the trx has been configured, since a reset or deep sleep
+ * clears the counter.
+ *
+ * @param trx_id Transceiver identifier
+ */
+void init_hw_tstamp(trx_id_t trx_id)
+{
+    CALC_REG_OFFSET(trx_id);
+    pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_BBC0_CNTC), BBC_CNT_CFG);
+
+    tstamp_corr[trx_id].valid = false;
+    tstamp_corr[trx_id].base_valid = false;
+    tstamp_corr[trx_id].frame_valid = false;
+
+    pal_timer_start(TAL_T_TSTAMP, trx_id, 1,
+                    TIMEOUT_RELATIVE, (FUNC_PTR())tstamp_timer_cb, NULL);
+}
+
+
+/**
+ * @brief Reads the counter value captured at the frame start
+ *
+ * Called within the interrupt handler at RXFS and TXFE, before a later
+ * frame start overwrites the captured value.
+ *
+ * @param trx_id Transceiver identifier
+ */
+void capture_frame_cnt(trx_id_t trx_id)
+{
+    tstamp_corr_t *c = &tstamp_corr[trx_id];
+
+    CALC_REG_OFFSET(trx_id);
+    pal_dev_read(RF215_TRX, GET_REG_ADDR(RG_BBC0_CNT0), (uint8_t *)&c->frame_cnt, 4);
+    pal_get_current_time(&c->frame_us);
+
+    /* The frame start may have been missed during a live read */
+    c->frame_valid = !c->sampling &&
+                     ((uint32_t)(c->frame_us - c->sample_end_us) >= TSTAMP_SAMPLE_GUARD_US);
+}
+
+
+/**
+ * @brief Converts a counter value to host time
+ *
+ * The counter value has to be within +/- 67 s of the correlation point.
+ *
+ * @param c Correlation
+ * @param cnt Counter value
+ *
+ * @return Host time in ns
+ */
+static uint64_t cnt_to_ns(const tstamp_corr_t *c, uint32_t cnt)
+{
+    int64_t ns = ((int64_t)(int32_t)(cnt - c->cnt) * 1000) / BBC_CNT_FREQ_MHZ;
+
+    ns += (ns * c->drift_ppb) / 1000000000LL;
+
+    return c->ns + (uint64_t)ns;
+}
+
+
+/**
+ * @brief Reads the running counter together with the host time
+ *
+ * @param trx_id Transceiver identifier
+ * @param cnt Storage for the counter value
+ * @param ns Storage for the host time in the middle of the read window
+ */
+static void sample_counter(trx_id_t trx_id, uint32_t *cnt, uint64_t *ns)
+{
+    tstamp_corr_t *c = &tstamp_corr[trx_id];
+    uint64_t best = UINT64_MAX;
+
+    CALC_REG_OFFSET(trx_id);
+
+    /* The counter registers return the running value while capturing is disabled */
+    c->sampling = true;
+    pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_BBC0_CNTC), CNTC_EN_MASK);
+
+    for (uint8_t i = 0; i < TAL_HW_TSTAMP_TRIES; i++)
+    {
+        uint64_t t0, t1;
+        uint32_t val;
+
+        pal_get_current_time_ns(&t0);
+        pal_dev_read(RF215_TRX, GET_REG_ADDR(RG_BBC0_CNT0), (uint8_t *)&val, 4);
+        pal_get_current_time_ns(&t1);
+
+        if ((t1 - t0) < best)
+        {
+            best = t1 - t0;
+            *cnt = val;
+            *ns = t0 + (best / 2);
+        }
+    }
+
+    pal_dev_reg_write(RF215_TRX, GET_REG_ADDR(RG_BBC0_CNTC), BBC_CNT_CFG);
+    pal_get_current_time(&c->sample_end_us);
+    c->sampling = false;
+
+    c->stats.last_window_ns = (uint32_t)best;
+}
+
+
+/**
+ * @brief Updates the correlation using a new sample
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void update_correlation(trx_id_t trx_id)
+{
+    tstamp_corr_t *c = &tstamp_corr[trx_id];
+    uint32_t cnt;
+    uint64_t ns;
+
+    sample_counter(trx_id, &cnt, &ns);
+    c->stats.samples++;
+
+    if (c->valid)
+    {
+        uint64_t predicted = cnt_to_ns(c, cnt);
+        int64_t err = (int64_t)(ns - predicted);
+
+        c->stats.last_err_ns = (int32_t)err;
+        if ((err <= TAL_HW_TSTAMP_MAX_ERR_NS) && (err >= -TAL_HW_TSTAMP_MAX_ERR_NS))
+        {
+            int64_t nominal = ((int64_t)(cnt - c->base_cnt) * 1000) / BBC_CNT_FREQ_MHZ;
+
+            if (nominal >= TSTAMP_MAX_BASELINE_NS)
+            {
+                /* Restart the baseline before the counter difference wraps */
+                c->base_cnt = cnt;
+                c->base_ns = ns;
+            }
+            else if (nominal >= ((int64_t)TSTAMP_MIN_BASELINE * TAL_HW_TSTAMP_INTERVAL_MS * 1000000))
+            {
+                int64_t drift = ((int64_t)(ns - c->base_ns) - nominal) * 1000000000LL / nominal;
+                if (drift > TAL_HW_TSTAMP_MAX_DRIFT_PPB)
+                {
+                    drift = TAL_HW_TSTAMP_MAX_DRIFT_PPB;
+                }
+                else if (drift < -TAL_HW_TSTAMP_MAX_DRIFT_PPB)
+                {
+                    drift = -TAL_HW_TSTAMP_MAX_DRIFT_PPB;
+                }
+                c->drift_ppb = (int32_t)drift;
+            }
+            c->cnt = cnt;
+            c->ns = predicted + (uint64_t)(err / 2);
+            return;
+        }
+        c->stats.resyncs++;
+    }
+
+    c->cnt = cnt;
+    c->ns = ns;
+    c->base_cnt = cnt;
+    c->base_ns = ns;
+    c->valid = true;
+}
+
+
+/**
+ * @brief Samples the counter periodically
+ *
+ * @param v Timer parameter; transceiver identifier
+ */
+static void tstamp_timer_cb(union sigval v)
+{
+    trx_id_t trx_id = (trx_id_t)v.sival_int;
+    uint32_t delay = (uint32_t)TAL_HW_TSTAMP_INTERVAL_MS * 1000;
+
+    ENTER_CRITICAL_REGION();
+    if (tal_state[trx_id] == TAL_SLEEP)
+    {
+        /* The counter does not run during sleep */
+        tstamp_corr[trx_id].valid = false;
+    }
+    else if ((tal_state[trx_id] == TAL_IDLE) && !ack_transmitting[trx_id])
+    {
+        update_correlation(trx_id);
+    }
+    else
+    {
+        delay = TSTAMP_RETRY_MS * 1000;
+    }
+    LEAVE_CRITICAL_REGION();
+
+    pal_timer_start(TAL_T_TSTAMP, trx_id, delay,
+                    TIMEOUT_RELATIVE, (FUNC_PTR())tstamp_timer_cb, NULL);
+}
+#endif /* #ifdef SUPPORT_HW_TSTAMP */
+
+#endif /* #ifdef ENABLE_TSTAMP */
+
+/* EOF */
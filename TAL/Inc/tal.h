@@ -599,8 +599,9 @@ typedef struct
     /** Timestamp information of frame
       * The timestamping is only required for beaconing networks
       * or if timestamping is explicitly enabled.
+      * Start of the frame in ns, time base of pal_get_current_time_ns().
       */
-    uint32_t time_stamp;
+    uint64_t time_stamp;
 #endif  /* #if (defined BEACON_SUPPORT) || (defined ENABLE_TSTAMP) */
 #ifdef MEASURE_TIME_OF_FLIGHT
     /** Time of flight */
@@ -612,8 +613,691 @@ typedef struct
 #endif
     /** Pointer to MPDU */
     uint8_t *mpdu;
+    /**
+     * Optional list of TX MPDU segments (header, IEs, payload, ...);
+     * NULL if the MPDU is contiguous at mpdu.
+     * If used, mpdu is set to the first segment by tal_tx_frame().
+     */
+    pal_iov_t *iov;
+    /** Number of segments in iov */
+    uint8_t iov_cnt;
 } frame_info_t;
 
+/**
+ * @brief TX queue statistics, see tal_tx_queue_get_stats()
+ */
+typedef struct tal_tx_queue_stats_tag
+{
+    /** Number of frames accepted by tal_tx_enqueue() */
+    uint32_t enqueued;
+    /** Number of frames started directly from the queue after a transaction */
+    uint32_t pipelined;
+    /** Number of frames rejected because the queue was full */
+    uint32_t overflows;
+    /** Maximum observed queue depth */
+    uint8_t max_depth;
+} tal_tx_queue_stats_t;
+
+/**
+ * @brief Transmission statistics, see tal_tx_get_stats()
+ */
+typedef struct tal_tx_stats_tag
+{
+    /** Number of frame retries due to a missing ACK */
+    uint32_t retries;
+    /** Number of frame buffer underruns */
+    uint32_t underruns;
+    /** Number of frame buffer downloads done during CSMA backoff */
+    uint32_t preloads;
+    /** Number of frames partly streamed after the transmit command */
+    uint32_t streamed;
+    /** Number of chunks written after the transmit command */
+    uint32_t chunks;
+} tal_tx_stats_t;
+
+/**
+ * @brief Burst and goodput statistics, see tal_tx_burst_get_stats()
+ *
+ * The goodput of bursts (burst_bytes / burst_time_us) can be compared with
+ * the goodput of single frames transmitted with CSMA-CA
+ * (single_bytes / single_time_us) for the same frame size.
+ */
+typedef struct tal_tx_burst_stats_tag
+{
+    /** Number of started bursts */
+    uint32_t bursts;
+    /** Number of bursts stopped due to a failed frame */
+    uint32_t aborted;
+    /** Number of successfully transmitted burst frames */
+    uint32_t burst_frames;
+    /** MPDU bytes of successfully transmitted burst frames, FCS excluded */
+    uint64_t burst_bytes;
+    /** Sum of burst durations in us, from the request until the last frame */
+    uint64_t burst_time_us;
+    /** Number of successful single frames transmitted with CSMA-CA */
+    uint32_t single_frames;
+    /** MPDU bytes of these single frames, FCS excluded */
+    uint64_t single_bytes;
+    /** Sum of their transaction durations in us */
+    uint64_t single_time_us;
+} tal_tx_burst_stats_t;
+
+/**
+ * @brief SPI throughput model, see tal_spi_model_get()
+ *
+ * The duration of a frame buffer write of n bytes is modelled as
+ * access_ns + n * byte_ns; jitter_ns is added once per streamed frame.
+ */
+typedef struct tal_spi_model_tag
+{
+    /** Fixed overhead per SPI access in ns */
+    uint32_t access_ns;
+    /** Duration per byte in ns */
+    uint32_t byte_ns;
+    /** Host jitter margin in ns */
+    uint32_t jitter_ns;
+} tal_spi_model_t;
+
+/**
+ * @brief Latency statistics of a configuration step
+ */
+typedef struct tal_latency_tag
+{
+    uint32_t count;
+    uint32_t last_us;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t total_us;
+} tal_latency_t;
+
+/**
+ * @brief PHY profile, see tal_phy_profile_apply()
+ *
+ * The FCS type follows from the modulation; legacy O-QPSK uses a 2 octet
+ * FCS, all SUN PHYs a 4 octet FCS.
+ */
+typedef struct tal_phy_profile_tag
+{
+    phy_t phy;
+    uint16_t channel;
+    /** Transmit power in dBm */
+    int8_t tx_pwr;
+    /** Receiver preamble control (FSK and MR-O-QPSK) */
+    bool rpc;
+    /** FSK preamble length in octets */
+    uint16_t fsk_preamble_len;
+    bool fsk_fec;
+    /** FSK data whitening */
+    bool fsk_scramble;
+    ofdm_mcs_t ofdm_mcs;
+    bool ofdm_interleaving;
+    oqpsk_rate_mode_t oqpsk_rate_mode;
+} tal_phy_profile_t;
+
+/**
+ * @brief PHY profile statistics, see tal_phy_profile_get_stats()
+ */
+typedef struct tal_phy_profile_stats_tag
+{
+    /** PHY changes to a profile that had to be compiled first */
+    tal_latency_t cold;
+    /** PHY changes to a cached profile */
+    tal_latency_t cached;
+    /** Number of compiled profiles */
+    uint32_t compiles;
+    /** Burst writes of the last applied profile */
+    uint8_t writes;
+    /** Octets of the last applied profile including run headers */
+    uint16_t image_len;
+} tal_phy_profile_stats_t;
+
+/**
+ * @brief Channel switch statistics, see tal_channel_switch_get_stats()
+ */
+typedef struct tal_ch_switch_stats_tag
+{
+    /** Duration from the request until the PLL has locked */
+    tal_latency_t latency;
+    /** Switches whose TRXRDY IRQ has not been seen in time */
+    uint32_t timeouts;
+    /** Aborted switches */
+    uint32_t failures;
+    /** Latency percentiles of the recent switches */
+    uint32_t p50_us;
+    uint32_t p90_us;
+    uint32_t p99_us;
+} tal_ch_switch_stats_t;
+
+#ifdef SUPPORT_AGGREGATION
+/**
+ * @brief Aggregation statistics, see tal_aggr_get_stats()
+ */
+typedef struct tal_aggr_stats_tag
+{
+    /** Number of transmitted aggregates */
+    uint32_t aggregates;
+    /** Number of frames transmitted within aggregates */
+    uint32_t subframes;
+    /** Number of collected frames sent alone after the delay budget */
+    uint32_t single;
+    /** Number of frames that could not be aggregated */
+    uint32_t passthrough;
+    /**
+     * PPDU airtime saved by aggregation in us, i.e. the SHR, PHR and
+     * MHR durations of the aggregated frames minus the sub-frame headers.
+     * Saved CCA and ACK durations are not included.
+     */
+    uint64_t airtime_saved_us;
+    /** Number of frames delivered from received aggregates */
+    uint32_t deaggregated;
+    /** Number of received aggregates with an invalid sub-frame structure */
+    uint32_t rx_errors;
+    /** Number of received sub-frames dropped due to missing buffers */
+    uint32_t rx_dropped;
+} tal_aggr_stats_t;
+#endif  /* #ifdef SUPPORT_AGGREGATION */
+
+#ifdef SUPPORT_BULK_TRANSFER
+/**
+ * @brief Bulk transfer statistics, see tal_bulk_get_stats()
+ *
+ * The throughput of the bulk mode (bytes_acked / time_us) can be compared
+ * with single frames using per-frame ACKs, see tal_tx_burst_stats_t.
+ */
+typedef struct tal_bulk_stats_tag
+{
+    /** Number of started bulk transfers */
+    uint32_t transfers;
+    /** Number of transmitted data frames incl. retransmissions */
+    uint32_t frames_sent;
+    /** Number of retransmitted data frames */
+    uint32_t retransmissions;
+    /** Number of frames finally not acknowledged */
+    uint32_t failed;
+    /** Number of sent block ACK requests */
+    uint32_t bars;
+    /** Number of block ACK requests without answer */
+    uint32_t ba_timeouts;
+    /** Number of received block ACKs */
+    uint32_t bas_received;
+    /** Number of sent block ACKs (receiving side) */
+    uint32_t bas_sent;
+    /** Acknowledged MPDU bytes, FCS excluded */
+    uint64_t bytes_acked;
+    /** Sum of bulk transfer durations in us */
+    uint64_t time_us;
+    /** Current window size */
+    uint8_t window;
+} tal_bulk_stats_t;
+#endif  /* #ifdef SUPPORT_BULK_TRANSFER */
+
+#ifdef SUPPORT_CH_HOPPING
+/**
+ * @brief Channel hopping configuration, see tal_ch_hop_start()
+ */
+typedef struct tal_ch_hop_cfg_tag
+{
+    /** EUI-64 of the node, most significant byte first; seeds the sequence */
+    uint8_t eui64[8];
+    /** Unicast dwell interval in ms */
+    uint8_t dwell_ms;
+    /** First channel of the channel plan */
+    uint16_t ch_first;
+    /** Number of channels of the channel plan */
+    uint16_t num_channels;
+    /** Excluded channels, bit n refers to ch_first + n; NULL if none */
+    const uint8_t *excluded;
+} tal_ch_hop_cfg_t;
+
+/**
+ * @brief Hopping information of a neighbor, see tal_ch_hop_nbr_init()
+ */
+typedef struct tal_ch_hop_nbr_tag
+{
+    /** DH1CF key words of the EUI-64 */
+    uint32_t key[2];
+    uint32_t dwell_us;
+    /** Slot of the neighbor starting at slot_start */
+    uint16_t slot;
+    uint32_t slot_start;
+} tal_ch_hop_nbr_t;
+
+/**
+ * @brief Channel hopping statistics, see tal_ch_hop_get_stats()
+ */
+typedef struct tal_ch_hop_stats_tag
+{
+    /** Number of channel changes of the own sequence */
+    uint32_t hops;
+    /** Number of channel changes delayed because the TAL was busy */
+    uint32_t hops_deferred;
+    /** Number of channel changes that could not be done */
+    uint32_t hops_failed;
+    /** Number of switches to the channel of a neighbor for transmission */
+    uint32_t tx_switches;
+    /** Number of sequence table refills */
+    uint32_t seq_refills;
+    /** Duration of the last sequence table refill in us */
+    uint32_t seq_refill_us;
+    /** Current slot of the own sequence */
+    uint16_t slot;
+    /** Current channel */
+    uint16_t channel;
+} tal_ch_hop_stats_t;
+#endif  /* #ifdef SUPPORT_CH_HOPPING */
+
+#ifdef SUPPORT_HW_TSTAMP
+/**
+ * @brief Hardware time stamp statistics, see tal_hw_tstamp_get_stats()
+ */
+typedef struct tal_hw_tstamp_stats_tag
+{
+    /** Number of correlation samples */
+    uint32_t samples;
+    /** Number of restarts of the correlation due to a too large phase error */
+    uint32_t resyncs;
+    /** Number of frame time stamps taken from the counter */
+    uint32_t hw_stamps;
+    /** Number of frame time stamps taken from the host clock */
+    uint32_t host_stamps;
+    /** Estimated drift of the counter relative to the host clock in ppb */
+    int32_t drift_ppb;
+    /** Phase error of the last sample in ns */
+    int32_t last_err_ns;
+    /** Read window of the last sample in ns */
+    uint32_t last_window_ns;
+    /** The counter is correlated to the host clock */
+    bool valid;
+} tal_hw_tstamp_stats_t;
+#endif  /* #ifdef SUPPORT_HW_TSTAMP */
+
+#ifdef SUPPORT_TSCH
+/** Link options of a TSCH cell */
+#define TAL_TSCH_OPT_TX             (0x01)
+#define TAL_TSCH_OPT_RX             (0x02)
+#define TAL_TSCH_OPT_SHARED         (0x04)
+#define TAL_TSCH_OPT_TIMEKEEPING    (0x08)
+
+/**
+ * @brief Timeslot template in us
+ */
+typedef struct tal_tsch_timing_tag
+{
+    /** Duration of a timeslot */
+    uint32_t timeslot_us;
+    /** Start of the frame transmission from the slot start */
+    uint32_t tx_offset_us;
+    /** Start of the receiver from the slot start */
+    uint32_t rx_offset_us;
+    /** Time the receiver waits for a frame start */
+    uint32_t rx_wait_us;
+} tal_tsch_timing_t;
+
+/**
+ * @brief TSCH cell (link), see tal_tsch_add_cell()
+ */
+typedef struct tal_tsch_cell_tag
+{
+    /** Timeslot within the slotframe */
+    uint16_t slot_offset;
+    /** Offset into the hopping sequence */
+    uint16_t channel_offset;
+    /** Link options, TAL_TSCH_OPT_xxx */
+    uint8_t options;
+} tal_tsch_cell_t;
+
+/**
+ * @brief TSCH configuration, see tal_tsch_start()
+ */
+typedef struct tal_tsch_cfg_tag
+{
+    /** Absolute slot number of the first slot */
+    uint64_t asn;
+    /** Channels of the hopping sequence */
+    const uint16_t *hop_seq;
+    uint8_t hop_seq_len;
+    /** Timeslot template; NULL for the default template */
+    const tal_tsch_timing_t *timing;
+} tal_tsch_cfg_t;
+
+/**
+ * @brief TSCH statistics, see tal_tsch_get_stats()
+ */
+typedef struct tal_tsch_stats_tag
+{
+    /** Lateness of the TX and RX commands relative to the slot timing */
+    tal_latency_t slot_lateness;
+    /** Number of slots whose lateness exceeded TAL_TSCH_LATE_US */
+    uint32_t late_slots;
+    /** Number of active slots skipped since the TAL was busy or too late */
+    uint32_t skipped_slots;
+    /** Number of TX and RX slots */
+    uint32_t tx_slots;
+    uint32_t rx_slots;
+    /** Number of retransmissions within later TX cells */
+    uint32_t tx_retries;
+    /** Number of frames received within RX slots */
+    uint32_t rx_frames;
+    /** Offset of the last received frame to its expected start in us */
+    int32_t last_rx_offset_us;
+    /** Number of applied time corrections */
+    uint32_t corrections;
+    /** Current absolute slot number */
+    uint64_t asn;
+} tal_tsch_stats_t;
+#endif  /* #ifdef SUPPORT_TSCH */
+
+#ifdef SUPPORT_SPECTRUM_SCAN
+/**
+ * @brief Energy sweep configuration, see tal_scan_start()
+ */
+typedef struct tal_scan_cfg_tag
+{
+    /** Channels to be measured in this order; valid until the callback */
+    const uint16_t *channels;
+    uint16_t num_channels;
+    /** Measurement time per channel in us */
+    uint32_t dwell_us;
+    /** ED averaging duration of a sample in us */
+    uint16_t sample_us;
+} tal_scan_cfg_t;
+
+/**
+ * @brief Energy of a single channel, see tal_scan_start()
+ */
+typedef struct tal_scan_result_tag
+{
+    uint16_t channel;
+    /** Number of valid samples; zero if the channel could not be measured */
+    uint16_t samples;
+    /** Energy in dBm; 127 if the channel could not be measured */
+    int8_t max_dbm;
+    int8_t mean_dbm;
+    int8_t p50_dbm;
+    int8_t p90_dbm;
+    /**
+     * Number of samples per energy range; bin i starts at
+     * TAL_SCAN_HIST_MIN_DBM + i * TAL_SCAN_HIST_STEP_DB, the first and
+     * the last bin are open
+     */
+    uint16_t hist[TAL_SCAN_HIST_BINS];
+} tal_scan_result_t;
+
+/**
+ * @brief Energy sweep statistics, see tal_scan_get_stats()
+ */
+typedef struct tal_scan_stats_tag
+{
+    /** Number of completed sweeps */
+    uint32_t sweeps;
+    /** Number of measured channels and samples of all sweeps */
+    uint32_t channels;
+    uint32_t samples;
+    /** Number of channels of all sweeps that could not be measured */
+    uint32_t unmeasured;
+    /** Duration of all sweeps in us */
+    uint32_t total_us;
+    /** Number of channels and duration in us of the last sweep */
+    uint16_t last_channels;
+    uint32_t last_sweep_us;
+} tal_scan_stats_t;
+#endif  /* #ifdef SUPPORT_SPECTRUM_SCAN */
+
+#ifdef SUPPORT_ENTROPY_POOL
+/**
+ * @brief Entropy pool statistics, see tal_get_entropy_stats()
+ */
+typedef struct tal_entropy_stats_tag
+{
+    /** Entropy in bits currently credited to the pool */
+    uint16_t pool_bits;
+    /** Set once the pool has been credited enough for output */
+    bool ready;
+    /** Bursts harvested, skipped since the trx was busy, and rejected */
+    uint32_t bursts;
+    uint32_t busy;
+    uint32_t rejected;
+    /** Number of RNDV values read */
+    uint32_t raw_bytes;
+    /** Number of reseeds of the backoff generators */
+    uint32_t reseeds;
+    /** Number of octets delivered by tal_get_random_bytes() */
+    uint32_t bytes_out;
+} tal_entropy_stats_t;
+#endif  /* #ifdef SUPPORT_ENTROPY_POOL */
+
+#ifdef SUPPORT_ADAPTIVE_CSMA
+/**
+ * @brief CSMA-CA parameters
+ */
+typedef struct tal_csma_params_tag
+{
+    uint8_t min_be;
+    uint8_t max_be;
+    uint8_t max_backoffs;
+} tal_csma_params_t;
+
+/**
+ * @brief Adapted CSMA-CA parameters of a channel, see
+ *        tal_csma_adapt_get_table()
+ */
+typedef struct tal_csma_adapt_info_tag
+{
+    uint16_t channel;
+    tal_csma_params_t params;
+    /** Rates of the last period in 1/1000 */
+    uint16_t busy_permille;
+    uint16_t collision_permille;
+    uint16_t failure_permille;
+    /** Number of CSMA-CA attempts and parameter changes */
+    uint32_t attempts;
+    uint32_t adjustments;
+} tal_csma_adapt_info_t;
+#endif  /* #ifdef SUPPORT_ADAPTIVE_CSMA */
+
+#ifdef SUPPORT_ADAPTIVE_CCA
+/**
+ * @brief Adaptive CCA threshold configuration, see tal_cca_ctrl_start()
+ */
+typedef struct tal_cca_ctrl_cfg_tag
+{
+    /** Distance of the threshold to the noise floor in dB */
+    int8_t margin_db;
+    /**
+     * Bounds of the threshold in dBm; the upper bound has to respect the
+     * regulatory and standard limits of the PHY in use
+     */
+    int8_t min_dbm;
+    int8_t max_dbm;
+    /** Minimum change of the threshold in dB */
+    uint8_t hysteresis_db;
+    /** Interval of the idle energy samples in ms */
+    uint16_t sample_interval_ms;
+} tal_cca_ctrl_cfg_t;
+
+/**
+ * @brief Threshold change, see tal_cca_ctrl_get_history()
+ */
+typedef struct tal_cca_ctrl_hist_tag
+{
+    /** Time of the change in us */
+    uint32_t time_us;
+    /** New threshold and estimated noise floor in dBm */
+    int8_t thres_dbm;
+    int8_t noise_dbm;
+    /** Share of busy CCAs within the last window in 1/1000 */
+    uint16_t busy_permille;
+} tal_cca_ctrl_hist_t;
+
+/**
+ * @brief Adaptive CCA threshold statistics, see tal_cca_ctrl_get_stats()
+ */
+typedef struct tal_cca_ctrl_stats_tag
+{
+    /** Number of CCAs and busy CCAs */
+    uint32_t cca;
+    uint32_t cca_busy;
+    /** Share of busy CCAs within the last window in 1/1000 */
+    uint16_t busy_permille;
+    /** Number of idle energy samples and failed CCA energy samples used */
+    uint32_t idle_samples;
+    uint32_t cca_samples;
+    /** Number of evaluated windows */
+    uint32_t windows;
+    /** Number of threshold changes */
+    uint32_t changes;
+    /** Number of restarts since the threshold has been set externally */
+    uint32_t restarts;
+    /** Estimated noise floor and current threshold in dBm */
+    int8_t noise_dbm;
+    int8_t thres_dbm;
+} tal_cca_ctrl_stats_t;
+#endif  /* #ifdef SUPPORT_ADAPTIVE_CCA */
+
+#ifdef SUPPORT_SPECTRUM_MONITOR
+/**
+ * @brief Background spectrum monitor configuration, see
+ *        tal_scan_monitor_start()
+ */
+typedef struct tal_scan_mon_cfg_tag
+{
+    /** Channels of the current band to be monitored; copied */
+    const uint16_t *channels;
+    uint16_t num_channels;
+    /** Measurement time per step in us; one channel is measured per step */
+    uint32_t dwell_us;
+    /** ED averaging duration of a sample in us */
+    uint16_t sample_us;
+    /** Energy in dBm a sample is counted busy at */
+    int8_t busy_dbm;
+    /** Maximum share of the time spent measuring in 1/1000 */
+    uint16_t budget_permille;
+} tal_scan_mon_cfg_t;
+
+/**
+ * @brief Entry of the occupancy table, see tal_scan_monitor_get_table()
+ */
+typedef struct tal_scan_mon_entry_tag
+{
+    uint16_t channel;
+    /** Average share of busy samples; 0xFFFF is busy all the time */
+    uint16_t occupancy;
+    /** Average mean energy in dBm */
+    int8_t energy_dbm;
+    /** Number of samples; zero if the channel has not been measured yet */
+    uint32_t samples;
+} tal_scan_mon_entry_t;
+
+/**
+ * @brief Background spectrum monitor statistics, see
+ *        tal_scan_monitor_get_stats()
+ */
+typedef struct tal_scan_mon_stats_tag
+{
+    /** Number of measurements */
+    uint32_t steps;
+    /** Number of measurements postponed since the TAL was busy */
+    uint32_t deferred;
+    /** Time spent measuring in us */
+    uint32_t airtime_us;
+    /** Number of table resets due to a band change */
+    uint32_t resets;
+} tal_scan_mon_stats_t;
+#endif  /* #ifdef SUPPORT_SPECTRUM_MONITOR */
+
+#ifdef SUPPORT_MODE_SWITCH
+/**
+ * @brief Mode switch policy statistics, see tal_ms_policy_get_stats()
+ */
+typedef struct tal_ms_policy_stats_tag
+{
+    /** Number of frames sent using a mode switch */
+    uint32_t switched;
+    /** Number of frames sent within the CSM since a mode switch did not pay off */
+    uint32_t csm_frames;
+    /** Airtime in us saved by mode switches compared to the CSM */
+    uint64_t saved_us;
+    /** Airtime in us saved by CSM frames compared to a mode switch */
+    uint64_t avoided_us;
+} tal_ms_policy_stats_t;
+
+/**
+ * @brief Mode switch latency statistics, see tal_ms_get_switch_stats()
+ */
+typedef struct tal_ms_switch_stats_tag
+{
+    /** New mode configured from a precomputed register image */
+    tal_latency_t image;
+    /** New mode configured register by register */
+    tal_latency_t conf;
+    /** CSM restored from a precomputed register image */
+    tal_latency_t restore;
+    /** Number of compiled register images */
+    uint32_t compiles;
+    /** Number of switches whose configuration exceeded the settling delay */
+    uint32_t late;
+    /** Burst writes of the last applied new mode image */
+    uint8_t writes;
+    /** Octets of the last applied new mode image including run headers */
+    uint16_t image_len;
+} tal_ms_switch_stats_t;
+#endif  /* #ifdef SUPPORT_MODE_SWITCH */
+
+#ifdef SUPPORT_RATE_CONTROL
+/**
+ * @brief Statistics of a rate, see tal_rc_get_neighbor_stats() and
+ * tal_rc_get_rate_stats()
+ */
+typedef struct tal_rc_rate_stats_tag
+{
+    /** Mode switch target mode incl. rate and FEC */
+    new_phy_t mode;
+    /** Nominal PSDU data rate in kbit/s */
+    uint16_t kbps;
+    /** Success probability in 1/1000; EWMA for a neighbor, average over all neighbors */
+    uint16_t prob;
+    /** true if prob is valid */
+    bool sampled;
+    /** Number of transmission attempts */
+    uint32_t attempts;
+    /** Number of acknowledged attempts */
+    uint32_t successes;
+} tal_rc_rate_stats_t;
+
+/**
+ * @brief Rate control statistics of a neighbor, see tal_rc_get_neighbor_stats()
+ */
+typedef struct tal_rc_neighbor_stats_tag
+{
+    /** Address of the neighbor, little endian */
+    uint8_t addr[8];
+    /** Address length: 2 or 8 */
+    uint8_t addr_len;
+    /** Averaged energy of received frames in dBm, INT8_MIN if unknown */
+    int8_t ed;
+    /** Number of valid entries in rate */
+    uint8_t num_rates;
+    /** Rate with the best throughput, used for the first attempt */
+    uint8_t best_tp;
+    /** Rate with the second best throughput, used for the first retry */
+    uint8_t second_tp;
+    /** Rate with the best success probability, used for the second retry */
+    uint8_t best_prob;
+    /** Number of rate controlled frames */
+    uint32_t frames;
+    /** Number of frames sent with a sample rate */
+    uint32_t samples;
+    /** Statistics per rate, ordered by increasing data rate */
+    tal_rc_rate_stats_t rate[TAL_RC_MAX_RATES];
+} tal_rc_neighbor_stats_t;
+#endif  /* #ifdef SUPPORT_RATE_CONTROL */
+
+/**
+ * Callback type of an additional receive consumer,
+ * see tal_rx_consumer_register()
+ */
+typedef void (*tal_rx_consumer_t)(trx_id_t trx_id, frame_info_t *rx_frame);
+
 
 /**
  * Sleep Mode supported by transceiver
@@ -1083,6 +1767,69 @@ extern "C" {
      */
     retval_t tal_pib_set_all(uint8_t attribute, pib_value_t *value);
 
+    /**
+     * @brief Starts a PIB transaction
+     *
+     * Attributes set using tal_pib_set_deferred() are staged until
+     * tal_pib_commit() applies them at once. Calling this function again
+     * discards the staged attributes. While a transaction is open,
+     * tal_pib_set() returns TAL_BUSY.
+     *
+     * @param trx_id Transceiver identifier
+     *
+     * @return
+     *      - @ref MAC_SUCCESS if the transaction has been started
+     *      - @ref TAL_BUSY if the TAL is not in TAL_IDLE state
+     *      - @ref TAL_TRX_ASLEEP if trx is in SLEEP mode
+     * @ingroup apiTalApi
+     */
+    retval_t tal_pib_begin(trx_id_t trx_id);
+
+    /**
+     * @brief Stages a TAL PIB attribute within a transaction
+     *
+     * The attribute is not written to the transceiver; attributes are
+     * staged in the order of the calls with the semantics of tal_pib_set().
+     * Supported are the PHY configuration attributes, the transmit power,
+     * the CCA threshold, the FCS type, the CSMA parameters and the
+     * addresses. Checks that depend on other attributes are done by
+     * tal_pib_commit().
+     *
+     * @param trx_id Transceiver identifier
+     * @param attribute TAL infobase attribute ID
+     * @param value TAL infobase attribute value to be staged
+     *
+     * @return
+     *      - @ref MAC_SUCCESS if the attribute has been staged
+     *      - @ref MAC_UNSUPPORTED_ATTRIBUTE if the attribute cannot be deferred
+     *      - @ref MAC_INVALID_PARAMETER if the value is out of range
+     *      - @ref FAILURE if no transaction is open
+     * @ingroup apiTalApi
+     */
+    retval_t tal_pib_set_deferred(trx_id_t trx_id, uint8_t attribute, pib_value_t *value);
+
+    /**
+     * @brief Applies the staged attributes of a transaction
+     *
+     * The combined attribute set is validated and the derived PIB values
+     * are calculated once. Only registers whose values change are written,
+     * using a few burst writes. If the PHY configuration changes, the trx
+     * passes TRXOFF once and returns to its previous state. If validation
+     * fails, neither PIB nor transceiver are changed. The transaction is
+     * closed in any case.
+     *
+     * @param trx_id Transceiver identifier
+     *
+     * @return
+     *      - @ref MAC_SUCCESS if the attributes have been applied
+     *      - @ref MAC_INVALID_PARAMETER if the combined attribute set is invalid
+     *      - @ref TAL_BUSY if the TAL is not in TAL_IDLE state
+     *      - @ref TAL_TRX_ASLEEP if trx is in SLEEP mode
+     *      - @ref FAILURE if no transaction is open or the PHY is not supported
+     * @ingroup apiTalApi
+     */
+    retval_t tal_pib_commit(trx_id_t trx_id);
+
     /**
      * @brief Switches receiver on or off
      *
@@ -1109,6 +1856,39 @@ extern "C" {
      */
     void tal_rx_frame_cb(trx_id_t trx_id, frame_info_t *rx_frame);
 
+    /**
+     * @brief Registers an additional consumer for received frames
+     *
+     * Each registered consumer is called for every received frame before
+     * tal_rx_frame_cb() is invoked. All consumers share the same buffer;
+     * each consumer holds its own reference to rx_frame->buffer_header and
+     * has to drop it by calling bmm_buffer_free() once it is done with the
+     * frame. The frame content must not be modified by a consumer.
+     *
+     * @param trx_id Transceiver identifier
+     * @param consumer Consumer callback function
+     *
+     * @return
+     *      - @ref MAC_SUCCESS if the consumer has been registered
+     *      - @ref MAC_INVALID_PARAMETER if a parameter is invalid
+     *      - @ref MAC_LIMIT_REACHED if no free consumer entry is available
+     * @ingroup apiTalApi
+     */
+    retval_t tal_rx_consumer_register(trx_id_t trx_id, tal_rx_consumer_t consumer);
+
+    /**
+     * @brief Removes a previously registered consumer for received frames
+     *
+     * @param trx_id Transceiver identifier
+     * @param consumer Consumer callback function
+     *
+     * @return
+     *      - @ref MAC_SUCCESS if the consumer has been removed
+     *      - @ref MAC_INVALID_PARAMETER if the consumer is not registered
+     * @ingroup apiTalApi
+     */
+    retval_t tal_rx_consumer_unregister(trx_id_t trx_id, tal_rx_consumer_t consumer);
+
     /**
      * @brief Beacon frame transmission
      *
@@ -1154,6 +1934,742 @@ extern "C" {
      */
     void tal_tx_frame_done_cb(trx_id_t trx_id, retval_t status, frame_info_t *frame);
 
+    /**
+     * @brief Requests to TAL to transmit a frame, queueing it if TAL is busy
+     *
+     * In contrast to tal_tx_frame() the frame is accepted while another
+     * transmission is ongoing. Queued frames are checked at once and
+     * started by the TAL directly after the previous transaction has been
+     * completed, i.e. after its tal_tx_frame_done_cb().
+     * tal_tx_frame_done_cb() is called for every accepted frame.
+     *
+     * @param trx_id Transceiver identifier
+     * @param tx_frame Pointer to the frame_info_t structure updated by the MAC layer
+     * @param csma_mode Indicates mode of csma-ca to be performed for this frame
+     * @param perform_frame_retry Indicates whether to retries are to be performed for
+     *                            this frame
+     *
+     * @return
+     *      - @ref MAC_SUCCESS if the frame has been started or queued
+     *      - @ref MAC_TRANSACTION_OVERFLOW if the queue is full
+     *      - @ref TAL_TRX_ASLEEP if the device is in sleep mode
+     *      - @ref MAC_INVALID_PARAMETER is a provided parameter is invalid
+     * @ingroup apiTalApi
+     */
+    retval_t tal_tx_enqueue(trx_id_t trx_id,
+                            frame_info_t *tx_frame,
+                            csma_mode_t csma_mode,
+                            bool perform_frame_retry);
+
+    /**
+     * @brief Gets the TX queue statistics
+     *
+     * @param trx_id Transceiver identifier
+     * @param stats Pointer to the statistics to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_tx_queue_get_stats(trx_id_t trx_id, tal_tx_queue_stats_t *stats);
+
+    /**
+     * @brief Gets the transmission statistics
+     *
+     * @param trx_id Transceiver identifier
+     * @param stats Pointer to the statistics to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_tx_get_stats(trx_id_t trx_id, tal_tx_stats_t *stats);
+
+    /**
+     * @brief Requests to TAL to transmit a burst of frames
+     *
+     * CSMA-CA is performed for the first frame only; the following frames
+     * are separated by SIFS/LIFS. No frame retries are performed, the burst
+     * stops at the first missing ACK. tal_tx_frame_done_cb() is called for
+     * each frame; frames not transmitted due to an earlier failure are
+     * reported with MAC_TRANSACTION_EXPIRED.
+     *
+     * @param trx_id Transceiver identifier
+     * @param frames Array of frames; has to be valid until the last callback
+     * @param num_frames Number of frames in the array
+     *
+     * @return
+     *      - @ref MAC_SUCCESS if the burst has been started
+     *      - @ref TAL_BUSY if the TAL is busy servicing the previous MAC request
+     *      - @ref TAL_TRX_ASLEEP if the device is in sleep mode
+     *      - @ref MAC_INVALID_PARAMETER is a provided parameter is invalid
+     * @ingroup apiTalApi
+     */
+    retval_t tal_tx_burst(trx_id_t trx_id, frame_info_t **frames, uint8_t num_frames);
+
+    /**
+     * @brief Gets the burst and goodput statistics
+     *
+     * @param trx_id Transceiver identifier
+     * @param stats Pointer to the statistics to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_tx_burst_get_stats(trx_id_t trx_id, tal_tx_burst_stats_t *stats);
+
+#ifdef SUPPORT_AGGREGATION
+    /**
+     * @brief Requests to TAL to transmit a frame via the aggregation layer
+     *
+     * Unsecured data frames with the same MHR (apart from the sequence number)
+     * are collected into one PSDU for up to TAL_AGGR_DELAY_BUDGET_US.
+     * Received aggregates are split before tal_rx_frame_cb() is called.
+     * tal_tx_frame_done_cb() is called for each provided frame.
+     *
+     * @param trx_id Transceiver identifier
+     * @param tx_frame Frame to be transmitted; needs to be contiguous
+     *
+     * @return MAC_SUCCESS, TAL_TRX_ASLEEP, MAC_INVALID_PARAMETER or the
+     *         status of tal_tx_enqueue()
+     * @ingroup apiTalApi
+     */
+    retval_t tal_aggr_tx_frame(trx_id_t trx_id, frame_info_t *tx_frame);
+
+    /**
+     * @brief Sends the aggregate collected so far without waiting
+     *
+     * @param trx_id Transceiver identifier
+     * @ingroup apiTalApi
+     */
+    void tal_aggr_flush(trx_id_t trx_id);
+
+    /**
+     * @brief Gets the aggregation statistics
+     *
+     * @param trx_id Transceiver identifier
+     * @param stats Pointer to the statistics to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_aggr_get_stats(trx_id_t trx_id, tal_aggr_stats_t *stats);
+#endif  /* #ifdef SUPPORT_AGGREGATION */
+
+#ifdef SUPPORT_BULK_TRANSFER
+    /**
+     * @brief Requests to TAL to transmit frames in bulk transfer mode
+     *
+     * Windows of frames are sent without ACK requests, each followed by a
+     * block ACK request. Missing frames are retransmitted selectively and
+     * the window adapts to the observed loss. The TAL assigns consecutive
+     * sequence numbers and clears the ACK request bits of the frames.
+     * tal_tx_frame_done_cb() is called for each frame.
+     *
+     * @param trx_id Transceiver identifier
+     * @param frames Array of unsecured data frames to one unicast destination;
+     *               has to be valid until the last callback
+     * @param num_frames Number of frames in the array
+     *
+     * @return MAC_SUCCESS, TAL_BUSY, TAL_TRX_ASLEEP or MAC_INVALID_PARAMETER
+     * @ingroup apiTalApi
+     */
+    retval_t tal_bulk_tx_start(trx_id_t trx_id, frame_info_t **frames, uint8_t num_frames);
+
+    /**
+     * @brief Gets the bulk transfer statistics
+     *
+     * @param trx_id Transceiver identifier
+     * @param stats Pointer to the statistics to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_bulk_get_stats(trx_id_t trx_id, tal_bulk_stats_t *stats);
+#endif  /* #ifdef SUPPORT_BULK_TRANSFER */
+
+#ifdef SUPPORT_CH_HOPPING
+    /**
+     * @brief Starts unslotted channel hopping
+     *
+     * The receiver follows the DH1CF unicast hop sequence of the node,
+     * changing the channel every dwell interval.
+     *
+     * @param trx_id Transceiver identifier
+     * @param cfg Hopping configuration
+     *
+     * @return MAC_SUCCESS, TAL_TRX_ASLEEP or MAC_INVALID_PARAMETER
+     * @ingroup apiTalApi
+     */
+    retval_t tal_ch_hop_start(trx_id_t trx_id, const tal_ch_hop_cfg_t *cfg);
+
+    /**
+     * @brief Stops channel hopping
+     *
+     * @param trx_id Transceiver identifier
+     * @ingroup apiTalApi
+     */
+    void tal_ch_hop_stop(trx_id_t trx_id);
+
+    /**
+     * @brief Gets the own unicast fractional sequence interval (UFSI)
+     *
+     * @param trx_id Transceiver identifier
+     *
+     * @return Elapsed fraction of the own hop sequence in units of 1/2^24
+     * @ingroup apiTalApi
+     */
+    uint32_t tal_ch_hop_get_ufsi(trx_id_t trx_id);
+
+    /**
+     * @brief Initializes the hopping information of a neighbor
+     *
+     * @param nbr Neighbor to be initialized
+     * @param eui64 EUI-64 of the neighbor, most significant byte first
+     * @param dwell_ms Unicast dwell interval of the neighbor in ms
+     * @param ufsi UFSI advertised by the neighbor
+     * @param rx_time Time the UFSI has been valid at
+     * @ingroup apiTalApi
+     */
+    void tal_ch_hop_nbr_init(tal_ch_hop_nbr_t *nbr, const uint8_t *eui64,
+                             uint8_t dwell_ms, uint32_t ufsi, uint32_t rx_time);
+
+    /**
+     * @brief Gets the current channel of a neighbor
+     *
+     * @param trx_id Transceiver identifier
+     * @param nbr Neighbor
+     * @param ch Storage for the channel
+     *
+     * @return MAC_SUCCESS or MAC_INVALID_PARAMETER
+     * @ingroup apiTalApi
+     */
+    retval_t tal_ch_hop_nbr_channel(trx_id_t trx_id, tal_ch_hop_nbr_t *nbr, uint16_t *ch);
+
+    /**
+     * @brief Transmits a frame on the current channel of a neighbor
+     *
+     * tal_tx_frame_done_cb() is called; the own hop sequence is resumed
+     * after the transmission.
+     *
+     * @param trx_id Transceiver identifier
+     * @param tx_frame Pointer to the frame_info_t structure
+     * @param csma_mode Indicates mode of csma-ca to be performed for this frame
+     * @param perform_frame_retry Indicates whether to retries are to be performed
+     * @param nbr Destination of the frame
+     *
+     * @return MAC_SUCCESS, TAL_BUSY, TAL_TRX_ASLEEP or MAC_INVALID_PARAMETER
+     * @ingroup apiTalApi
+     */
+    retval_t tal_ch_hop_tx_frame(trx_id_t trx_id, frame_info_t *tx_frame,
+                                 csma_mode_t csma_mode, bool perform_frame_retry,
+                                 tal_ch_hop_nbr_t *nbr);
+
+    /**
+     * @brief Gets channels of a DH1CF hop sequence
+     *
+     * @param trx_id Transceiver identifier providing the channel plan
+     * @param eui64 EUI-64 of the node the sequence belongs to
+     * @param first First slot
+     * @param ch Storage for the channels
+     * @param len Number of slots
+     *
+     * @return MAC_SUCCESS or MAC_INVALID_PARAMETER
+     * @ingroup apiTalApi
+     */
+    retval_t tal_ch_hop_get_sequence(trx_id_t trx_id, const uint8_t *eui64,
+                                     uint16_t first, uint16_t *ch, uint16_t len);
+
+    /**
+     * @brief Gets the channel hopping statistics
+     *
+     * @param trx_id Transceiver identifier
+     * @param stats Pointer to the statistics to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_ch_hop_get_stats(trx_id_t trx_id, tal_ch_hop_stats_t *stats);
+#endif  /* #ifdef SUPPORT_CH_HOPPING */
+
+#ifdef SUPPORT_HW_TSTAMP
+    /**
+     * @brief Gets the hardware time stamp statistics
+     *
+     * @param trx_id Transceiver identifier
+     * @param stats Pointer to the statistics to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_hw_tstamp_get_stats(trx_id_t trx_id, tal_hw_tstamp_stats_t *stats);
+#endif  /* #ifdef SUPPORT_HW_TSTAMP */
+
+#ifdef SUPPORT_TSCH
+    /**
+     * @brief Starts time-slotted channel hopping
+     *
+     * @param trx_id Transceiver identifier
+     * @param cfg TSCH configuration
+     *
+     * @return MAC_SUCCESS, TAL_BUSY, TAL_TRX_ASLEEP or MAC_INVALID_PARAMETER
+     * @ingroup apiTalApi
+     */
+    retval_t tal_tsch_start(trx_id_t trx_id, const tal_tsch_cfg_t *cfg);
+
+    /**
+     * @brief Stops time-slotted channel hopping
+     *
+     * @param trx_id Transceiver identifier
+     * @ingroup apiTalApi
+     */
+    void tal_tsch_stop(trx_id_t trx_id);
+
+    /**
+     * @brief Sets the size of a slotframe
+     *
+     * @param trx_id Transceiver identifier
+     * @param handle Slotframe handle; lower handles take precedence
+     * @param size Number of timeslots; 0 removes the slotframe
+     *
+     * @return MAC_SUCCESS or MAC_INVALID_PARAMETER
+     * @ingroup apiTalApi
+     */
+    retval_t tal_tsch_set_slotframe(trx_id_t trx_id, uint8_t handle, uint16_t size);
+
+    /**
+     * @brief Adds a cell to a slotframe
+     *
+     * @param trx_id Transceiver identifier
+     * @param handle Slotframe handle
+     * @param cell Cell to be added
+     *
+     * @return MAC_SUCCESS, MAC_TRANSACTION_OVERFLOW or MAC_INVALID_PARAMETER
+     * @ingroup apiTalApi
+     */
+    retval_t tal_tsch_add_cell(trx_id_t trx_id, uint8_t handle, const tal_tsch_cell_t *cell);
+
+    /**
+     * @brief Removes a cell from a slotframe
+     *
+     * @param trx_id Transceiver identifier
+     * @param handle Slotframe handle
+     * @param slot_offset Timeslot of the cell
+     * @param channel_offset Channel offset of the cell
+     *
+     * @return MAC_SUCCESS or MAC_INVALID_PARAMETER
+     * @ingroup apiTalApi
+     */
+    retval_t tal_tsch_remove_cell(trx_id_t trx_id, uint8_t handle,
+                                  uint16_t slot_offset, uint16_t channel_offset);
+
+    /**
+     * @brief Queues a frame for the next TX cell
+     *
+     * Failed transmissions are retried within later TX cells up to
+     * macMaxFrameRetries times; tal_tx_frame_done_cb() is called once the
+     * frame is completed.
+     *
+     * @param trx_id Transceiver identifier
+     * @param tx_frame Pointer to the frame_info_t structure
+     *
+     * @return MAC_SUCCESS, MAC_TRANSACTION_OVERFLOW or MAC_INVALID_PARAMETER
+     * @ingroup apiTalApi
+     */
+    retval_t tal_tsch_tx_frame(trx_id_t trx_id, frame_info_t *tx_frame);
+
+    /**
+     * @brief Corrects the slot timing
+     *
+     * Used for the time correction reported by a time source, e.g. within
+     * an Enhanced ACK.
+     *
+     * @param trx_id Transceiver identifier
+     * @param correction_us Time the slots are shifted by
+     * @ingroup apiTalApi
+     */
+    void tal_tsch_adjust_time(trx_id_t trx_id, int32_t correction_us);
+
+    /**
+     * @brief Gets the TSCH statistics
+     *
+     * @param trx_id Transceiver identifier
+     * @param stats Pointer to the statistics to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_tsch_get_stats(trx_id_t trx_id, tal_tsch_stats_t *stats);
+#endif  /* #ifdef SUPPORT_TSCH */
+
+#ifdef SUPPORT_SPECTRUM_SCAN
+    /**
+     * @brief Starts an energy sweep over a list of channels
+     *
+     * Each channel is measured for the dwell time using continuous energy
+     * detection; EDV is polled once per sample duration. The channels of
+     * the current band are supported. tal_scan_done_cb() is called once
+     * all channels have been measured; the TAL is busy until then.
+     *
+     * @param trx_id Transceiver identifier
+     * @param cfg Sweep configuration
+     * @param results Storage for one result per channel; valid until the
+     *                callback
+     *
+     * @return
+     *      - @ref MAC_SUCCESS if the sweep has been started
+     *      - @ref MAC_INVALID_PARAMETER if the configuration is invalid
+     *      - @ref TAL_BUSY if the TAL is not in TAL_IDLE state
+     *      - @ref TAL_TRX_ASLEEP if the trx is in SLEEP mode
+     * @ingroup apiTalApi
+     */
+    retval_t tal_scan_start(trx_id_t trx_id, const tal_scan_cfg_t *cfg,
+                            tal_scan_result_t *results);
+
+    /**
+     * User call back function for a completed energy sweep
+     *
+     * @param trx_id Transceiver identifier
+     * @param status MAC_SUCCESS, or FAILURE if the sweep has been aborted
+     *               or a channel could not be measured
+     * @param num_results Number of results; a result with zero samples
+     *                    belongs to a channel that could not be measured
+     * @ingroup apiTalApi
+     */
+    void tal_scan_done_cb(trx_id_t trx_id, retval_t status, uint16_t num_results);
+
+    /**
+     * @brief Gets the energy sweep statistics
+     *
+     * @param trx_id Transceiver identifier
+     * @param stats Pointer to the statistics to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_scan_get_stats(trx_id_t trx_id, tal_scan_stats_t *stats);
+#endif  /* #ifdef SUPPORT_SPECTRUM_SCAN */
+
+#ifdef SUPPORT_ENTROPY_POOL
+    /**
+     * @brief Gets random octets from the entropy pool
+     *
+     * The pool is filled with RNDV values of the transceivers while they
+     * are idle in RX.
+     *
+     * @param data Storage for the random octets
+     * @param len Number of octets
+     *
+     * @return
+     *      - @ref MAC_SUCCESS if the octets have been generated
+     *      - @ref MAC_NO_DATA if the pool has not been filled yet
+     * @ingroup apiTalApi
+     */
+    retval_t tal_get_random_bytes(uint8_t *data, uint16_t len);
+
+    /**
+     * @brief Gets the entropy pool statistics
+     *
+     * @param stats Pointer to the statistics to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_get_entropy_stats(tal_entropy_stats_t *stats);
+#endif  /* #ifdef SUPPORT_ENTROPY_POOL */
+
+#ifdef SUPPORT_ADAPTIVE_CSMA
+    /**
+     * @brief Enables or disables the adaptive CSMA-CA parameters
+     *
+     * MinBE, MaxBE and MaxCSMABackoffs are tuned per channel from the rates
+     * of busy CCAs, collisions (missing ACK after a clear CCA) and channel
+     * access failures of the unslotted CSMA-CA attempts. New channels start
+     * from the PIB values. The table is cleared.
+     *
+     * Under heavy contention fewer frames are dropped, but delivered frames
+     * see a longer access delay, see TAL_CSMA_ADAPT_MAX_BE.
+     *
+     * @param trx_id Transceiver identifier
+     * @param enable true to enable the adaptation
+     * @ingroup apiTalApi
+     */
+    void tal_csma_adapt_enable(trx_id_t trx_id, bool enable);
+
+    /**
+     * @brief Gets the table of the adapted parameters
+     *
+     * @param trx_id Transceiver identifier
+     * @param info Storage for the entries
+     * @param max_entries Number of entries the storage can hold
+     *
+     * @return Number of entries filled
+     * @ingroup apiTalApi
+     */
+    uint8_t tal_csma_adapt_get_table(trx_id_t trx_id, tal_csma_adapt_info_t *info,
+                                     uint8_t max_entries);
+#endif  /* #ifdef SUPPORT_ADAPTIVE_CSMA */
+
+#ifdef SUPPORT_ADAPTIVE_CCA
+    /**
+     * @brief Starts the adaptive CCA threshold
+     *
+     * The noise floor is estimated from idle energy samples and from the
+     * energy of failed CCAs; the CCA threshold follows it plus the margin
+     * within the bounds and with hysteresis. The current threshold is the
+     * starting point. Setting phyCCAThreshold or changing the PHY restarts
+     * the estimation from the new value.
+     *
+     * @param trx_id Transceiver identifier
+     * @param cfg Controller configuration
+     *
+     * @return
+     *      - @ref MAC_SUCCESS if the controller has been started
+     *      - @ref MAC_INVALID_PARAMETER if the configuration is invalid
+     * @ingroup apiTalApi
+     */
+    retval_t tal_cca_ctrl_start(trx_id_t trx_id, const tal_cca_ctrl_cfg_t *cfg);
+
+    /**
+     * @brief Stops the adaptive CCA threshold and restores the PHY default
+     *
+     * @param trx_id Transceiver identifier
+     * @ingroup apiTalApi
+     */
+    void tal_cca_ctrl_stop(trx_id_t trx_id);
+
+    /**
+     * @brief Gets the adaptive CCA threshold statistics
+     *
+     * @param trx_id Transceiver identifier
+     * @param stats Pointer to the statistics to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_cca_ctrl_get_stats(trx_id_t trx_id, tal_cca_ctrl_stats_t *stats);
+
+    /**
+     * @brief Gets the history of threshold changes
+     *
+     * @param trx_id Transceiver identifier
+     * @param hist Storage for the entries; the oldest entry comes first
+     * @param max_entries Number of entries the storage can hold
+     *
+     * @return Number of entries filled
+     * @ingroup apiTalApi
+     */
+    uint8_t tal_cca_ctrl_get_history(trx_id_t trx_id, tal_cca_ctrl_hist_t *hist,
+                                     uint8_t max_entries);
+#endif  /* #ifdef SUPPORT_ADAPTIVE_CCA */
+
+#ifdef SUPPORT_SPECTRUM_MONITOR
+    /**
+     * @brief Starts the background spectrum monitor
+     *
+     * Whenever the TAL is idle and no frame is being received, one channel
+     * is measured for the dwell time; frames are not received meanwhile.
+     * The share of busy samples and the mean energy are averaged per
+     * channel. Measurements are spaced such that they take at most the
+     * budget share of the time. The table is kept if the channels and the
+     * band are unchanged and is cleared if the band changes.
+     *
+     * @param trx_id Transceiver identifier
+     * @param cfg Monitor configuration
+     *
+     * @return
+     *      - @ref MAC_SUCCESS if the monitor has been started
+     *      - @ref MAC_INVALID_PARAMETER if the configuration is invalid
+     * @ingroup apiTalApi
+     */
+    retval_t tal_scan_monitor_start(trx_id_t trx_id, const tal_scan_mon_cfg_t *cfg);
+
+    /**
+     * @brief Stops the background spectrum monitor
+     *
+     * @param trx_id Transceiver identifier
+     * @ingroup apiTalApi
+     */
+    void tal_scan_monitor_stop(trx_id_t trx_id);
+
+    /**
+     * @brief Gets the least busy channel
+     *
+     * The channel with the lowest average occupancy is selected; the mean
+     * energy decides between channels of equal occupancy.
+     *
+     * @param trx_id Transceiver identifier
+     * @param channel Storage for the channel
+     *
+     * @return
+     *      - @ref MAC_SUCCESS if a channel has been selected
+     *      - @ref MAC_NO_DATA if no channel has been measured yet
+     * @ingroup apiTalApi
+     */
+    retval_t tal_scan_monitor_best_channel(trx_id_t trx_id, uint16_t *channel);
+
+    /**
+     * @brief Gets the occupancy table
+     *
+     * @param trx_id Transceiver identifier
+     * @param table Storage for the entries
+     * @param max_entries Number of entries the storage can hold
+     *
+     * @return Number of entries filled
+     * @ingroup apiTalApi
+     */
+    uint16_t tal_scan_monitor_get_table(trx_id_t trx_id, tal_scan_mon_entry_t *table,
+                                        uint16_t max_entries);
+
+    /**
+     * @brief Gets the background spectrum monitor statistics
+     *
+     * @param trx_id Transceiver identifier
+     * @param stats Pointer to the statistics to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_scan_monitor_get_stats(trx_id_t trx_id, tal_scan_mon_stats_t *stats);
+#endif  /* #ifdef SUPPORT_SPECTRUM_MONITOR */
+
+#ifdef SUPPORT_MODE_SWITCH
+    /**
+     * @brief Configures the mode switch policy
+     *
+     * If enabled, a frame is sent using a mode switch only if the mode
+     * switch PPDU, the settling delay and the PPDU within the new mode are
+     * shorter than the PPDU within the CSM by at least min_saving_us.
+     * Otherwise the frame is sent within the CSM directly.
+     *
+     * @param trx_id Transceiver identifier
+     * @param enable true to decide per frame, false to switch for every frame
+     * @param min_saving_us Airtime in us a mode switch has to save at least
+     * @ingroup apiTalApi
+     */
+    void tal_ms_policy_set(trx_id_t trx_id, bool enable, uint16_t min_saving_us);
+
+    /**
+     * @brief Gets the mode switch policy statistics
+     *
+     * @param trx_id Transceiver identifier
+     * @param stats Pointer to the statistics to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_ms_policy_get_stats(trx_id_t trx_id, tal_ms_policy_stats_t *stats);
+
+    /**
+     * @brief Gets the mode switch latency statistics
+     *
+     * The new mode is configured between the end of the mode switch PPDU
+     * and the settling delay; the statistics show how long this takes.
+     *
+     * @param trx_id Transceiver identifier
+     * @param stats Pointer to the statistics to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_ms_get_switch_stats(trx_id_t trx_id, tal_ms_switch_stats_t *stats);
+#endif  /* #ifdef SUPPORT_MODE_SWITCH */
+
+#ifdef SUPPORT_RATE_CONTROL
+    /**
+     * @brief Gets the rate control statistics of a neighbor
+     *
+     * The rate of the mode switch target mode is selected per destination
+     * for frames with ACK request if phyModeSwitchEnabled is set.
+     *
+     * @param trx_id Transceiver identifier
+     * @param index Index of the neighbor table entry, 0 .. TAL_RC_MAX_NEIGHBORS - 1
+     * @param stats Pointer to the statistics to be filled
+     *
+     * @return MAC_SUCCESS, or MAC_INVALID_INDEX if the entry is not used
+     * @ingroup apiTalApi
+     */
+    retval_t tal_rc_get_neighbor_stats(trx_id_t trx_id, uint8_t index,
+                                       tal_rc_neighbor_stats_t *stats);
+
+    /**
+     * @brief Gets the statistics of a rate over all neighbors
+     *
+     * @param trx_id Transceiver identifier
+     * @param rate Index of the rate, ordered by increasing data rate
+     * @param stats Pointer to the statistics to be filled
+     *
+     * @return MAC_SUCCESS, or MAC_INVALID_INDEX if the rate does not exist
+     * @ingroup apiTalApi
+     */
+    retval_t tal_rc_get_rate_stats(trx_id_t trx_id, uint8_t rate,
+                                   tal_rc_rate_stats_t *stats);
+#endif  /* #ifdef SUPPORT_RATE_CONTROL */
+
+    /**
+     * @brief Gets the SPI throughput model calibrated during tal_init()
+     *
+     * @param model Pointer to the model to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_spi_model_get(tal_spi_model_t *model);
+
+    /**
+     * @brief Changes the PHY configuration to a profile
+     *
+     * The profile is compiled into a register image of the RF and baseband
+     * registers when it is used first; this image is cached and applied
+     * using a few burst writes instead of setting each attribute using
+     * tal_pib_set(). The cache is flushed by tal_pib_set() since the images
+     * depend on the remaining PIB attributes.
+     *
+     * @param trx_id Transceiver identifier
+     * @param profile PHY profile to be applied
+     *
+     * @return
+     *      - @ref MAC_SUCCESS if the profile has been applied
+     *      - @ref MAC_INVALID_PARAMETER if the profile is not supported
+     *      - @ref TAL_BUSY if the TAL is not in TAL_IDLE state
+     *      - @ref TAL_TRX_ASLEEP if the trx is in SLEEP mode
+     *      - @ref FAILURE if the profile exceeds TAL_REG_IMAGE_SIZE
+     * @ingroup apiTalApi
+     */
+    retval_t tal_phy_profile_apply(trx_id_t trx_id, const tal_phy_profile_t *profile);
+
+    /**
+     * @brief Gets the PHY profile statistics
+     *
+     * @param trx_id Transceiver identifier
+     * @param stats Pointer to the statistics to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_phy_profile_get_stats(trx_id_t trx_id, tal_phy_profile_stats_t *stats);
+
+    /**
+     * @brief Switches to another channel of the current band
+     *
+     * The channel registers are written together with the TRXOFF command
+     * using a single burst write; the PLL lock is not polled. The switch is
+     * completed by the TRXRDY IRQ within tal_task() and the previous trx
+     * state (RX or TXPREP) is restored. If the trx is off, the switch
+     * completes immediately. In both cases tal_channel_switch_done_cb() is
+     * called; the TAL is busy until then.
+     *
+     * @param trx_id Transceiver identifier
+     * @param ch Channel number
+     *
+     * @return
+     *      - @ref MAC_SUCCESS if the switch has been started
+     *      - @ref MAC_INVALID_PARAMETER if the channel is not within the band
+     *      - @ref TAL_BUSY if the TAL is not in TAL_IDLE state
+     *      - @ref TAL_TRX_ASLEEP if the trx is in SLEEP mode
+     * @ingroup apiTalApi
+     */
+    retval_t tal_channel_switch(trx_id_t trx_id, uint16_t ch);
+
+    /**
+     * User call back function for a completed channel switch
+     *
+     * @param trx_id Transceiver identifier
+     * @param status MAC_SUCCESS or FAILURE if the PLL did not lock
+     * @ingroup apiTalApi
+     */
+    void tal_channel_switch_done_cb(trx_id_t trx_id, retval_t status);
+
+    /**
+     * @brief Gets the channel switch statistics
+     *
+     * @param trx_id Transceiver identifier
+     * @param stats Pointer to the statistics to be filled
+     * @ingroup apiTalApi
+     */
+    void tal_channel_switch_get_stats(trx_id_t trx_id, tal_ch_switch_stats_t *stats);
+
+    /**
+     * @brief Predicts the number of bytes downloaded before the TX command
+     *
+     * The remaining bytes of the frame are streamed during CCA and
+     * SHR/PHR transmission. The prediction uses the current PHY settings.
+     *
+     * @param trx_id Transceiver identifier
+     * @param len MPDU length without FCS
+     * @param with_cca true if a CCA is performed before transmission
+     *
+     * @return Number of preloaded bytes; len if the frame is not streamed
+     * @ingroup apiTalApi
+     */
+    uint16_t tal_tx_preload_len(trx_id_t trx_id, uint16_t len, bool with_cca);
+
     /**
      * @brief Sets the transceiver to sleep
      *
@@ -0,0 +1,2838 @@
+/**
+ * @file phy_timing_ref.h
+ *
+ * @brief Reference PHY timing values for test_phy_timing.
+ *
+ * The values were produced by calculate_pib_values() before the timing
+ * tables replaced its calculations. The rows follow the loop order of
+ * test_table(): for each band and CCA time method, FSK symbol rate,
+ * modulation type, FEC and preamble length 0..1000 in steps of 97, then
+ * OFDM option, MCS and interleaving, MR-O-QPSK chip rate and rate mode,
+ * and O-QPSK chip rate and high rate.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* Prevent double inclusion */
+#ifndef PHY_TIMING_REF_H
+#define PHY_TIMING_REF_H
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+
+/* === TYPES =============================================================== */
+
+/**
+ * PIB values derived from the PHY settings
+ */
+typedef struct phy_timing_ref_tag
+{
+    uint16_t SymbolDuration_us;
+    uint16_t OctetDuration_us;
+    uint16_t CCADuration_us;
+    uint16_t CCADuration_sym;
+    int8_t CCAThreshold;
+    uint16_t ACKWaitDuration;
+    uint16_t ACKTiming;
+} phy_timing_ref_t;
+
+/* === GLOBALS ============================================================= */
+
+static const phy_timing_ref_t phy_timing_ref[] =
+{
+    {20, 160, 160, 8, -105, 3920, 872},
+    {20, 160, 160, 8, -105, 4080, 872},
+    {20, 160, 160, 8, -105, 4240, 872},
+    {20, 160, 160, 8, -105, 4400, 872},
+    {20, 160, 160, 8, -105, 4560, 872},
+    {20, 160, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 4880, 872},
+    {20, 160, 160, 8, -105, 5040, 872},
+    {20, 160, 160, 8, -105, 5200, 872},
+    {20, 160, 160, 8, -105, 5360, 872},
+    {20, 160, 160, 8, -105, 5520, 872},
+    {20, 320, 160, 8, -105, 5360, 872},
+    {20, 320, 160, 8, -105, 5520, 872},
+    {20, 320, 160, 8, -105, 5680, 872},
+    {20, 320, 160, 8, -105, 5840, 872},
+    {20, 320, 160, 8, -105, 6000, 872},
+    {20, 320, 160, 8, -105, 6160, 872},
+    {20, 320, 160, 8, -105, 6320, 872},
+    {20, 320, 160, 8, -105, 6480, 872},
+    {20, 320, 160, 8, -105, 6640, 872},
+    {20, 320, 160, 8, -105, 6800, 872},
+    {20, 320, 160, 8, -105, 6960, 872},
+    {20, 80, 160, 8, -105, 3120, 872},
+    {20, 80, 160, 8, -105, 3280, 872},
+    {20, 80, 160, 8, -105, 3440, 872},
+    {20, 80, 160, 8, -105, 3600, 872},
+    {20, 80, 160, 8, -105, 3760, 872},
+    {20, 80, 160, 8, -105, 3920, 872},
+    {20, 80, 160, 8, -105, 4080, 872},
+    {20, 80, 160, 8, -105, 4240, 872},
+    {20, 80, 160, 8, -105, 4400, 872},
+    {20, 80, 160, 8, -105, 4560, 872},
+    {20, 80, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 3760, 872},
+    {20, 160, 160, 8, -105, 3920, 872},
+    {20, 160, 160, 8, -105, 4080, 872},
+    {20, 160, 160, 8, -105, 4240, 872},
+    {20, 160, 160, 8, -105, 4400, 872},
+    {20, 160, 160, 8, -105, 4560, 872},
+    {20, 160, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 4880, 872},
+    {20, 160, 160, 8, -105, 5040, 872},
+    {20, 160, 160, 8, -105, 5200, 872},
+    {20, 160, 160, 8, -105, 5360, 872},
+    {20, 80, 160, 8, -105, 3920, 930},
+    {20, 80, 160, 8, -105, 4080, 930},
+    {20, 80, 160, 8, -105, 4240, 930},
+    {20, 80, 160, 8, -105, 4400, 930},
+    {20, 80, 160, 8, -105, 4560, 930},
+    {20, 80, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 4880, 930},
+    {20, 80, 160, 8, -105, 5040, 930},
+    {20, 80, 160, 8, -105, 5200, 930},
+    {20, 80, 160, 8, -105, 5360, 930},
+    {20, 80, 160, 8, -105, 5520, 930},
+    {20, 160, 160, 8, -105, 5360, 930},
+    {20, 160, 160, 8, -105, 5520, 930},
+    {20, 160, 160, 8, -105, 5680, 930},
+    {20, 160, 160, 8, -105, 5840, 930},
+    {20, 160, 160, 8, -105, 6000, 930},
+    {20, 160, 160, 8, -105, 6160, 930},
+    {20, 160, 160, 8, -105, 6320, 930},
+    {20, 160, 160, 8, -105, 6480, 930},
+    {20, 160, 160, 8, -105, 6640, 930},
+    {20, 160, 160, 8, -105, 6800, 930},
+    {20, 160, 160, 8, -105, 6960, 930},
+    {20, 40, 160, 8, -105, 3120, 930},
+    {20, 40, 160, 8, -105, 3280, 930},
+    {20, 40, 160, 8, -105, 3440, 930},
+    {20, 40, 160, 8, -105, 3600, 930},
+    {20, 40, 160, 8, -105, 3760, 930},
+    {20, 40, 160, 8, -105, 3920, 930},
+    {20, 40, 160, 8, -105, 4080, 930},
+    {20, 40, 160, 8, -105, 4240, 930},
+    {20, 40, 160, 8, -105, 4400, 930},
+    {20, 40, 160, 8, -105, 4560, 930},
+    {20, 40, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 3760, 930},
+    {20, 80, 160, 8, -105, 3920, 930},
+    {20, 80, 160, 8, -105, 4080, 930},
+    {20, 80, 160, 8, -105, 4240, 930},
+    {20, 80, 160, 8, -105, 4400, 930},
+    {20, 80, 160, 8, -105, 4560, 930},
+    {20, 80, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 4880, 930},
+    {20, 80, 160, 8, -105, 5040, 930},
+    {20, 80, 160, 8, -105, 5200, 930},
+    {20, 80, 160, 8, -105, 5360, 930},
+    {20, 53, 160, 8, -105, 3920, 940},
+    {20, 53, 160, 8, -105, 4080, 940},
+    {20, 53, 160, 8, -105, 4240, 940},
+    {20, 53, 160, 8, -105, 4400, 940},
+    {20, 53, 160, 8, -105, 4560, 940},
+    {20, 53, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 4880, 940},
+    {20, 53, 160, 8, -105, 5040, 940},
+    {20, 53, 160, 8, -105, 5200, 940},
+    {20, 53, 160, 8, -105, 5360, 940},
+    {20, 53, 160, 8, -105, 5520, 940},
+    {20, 106, 160, 8, -105, 5360, 940},
+    {20, 106, 160, 8, -105, 5520, 940},
+    {20, 106, 160, 8, -105, 5680, 940},
+    {20, 106, 160, 8, -105, 5840, 940},
+    {20, 106, 160, 8, -105, 6000, 940},
+    {20, 106, 160, 8, -105, 6160, 940},
+    {20, 106, 160, 8, -105, 6320, 940},
+    {20, 106, 160, 8, -105, 6480, 940},
+    {20, 106, 160, 8, -105, 6640, 940},
+    {20, 106, 160, 8, -105, 6800, 940},
+    {20, 106, 160, 8, -105, 6960, 940},
+    {20, 26, 160, 8, -105, 3120, 940},
+    {20, 26, 160, 8, -105, 3280, 940},
+    {20, 26, 160, 8, -105, 3440, 940},
+    {20, 26, 160, 8, -105, 3600, 940},
+    {20, 26, 160, 8, -105, 3760, 940},
+    {20, 26, 160, 8, -105, 3920, 940},
+    {20, 26, 160, 8, -105, 4080, 940},
+    {20, 26, 160, 8, -105, 4240, 940},
+    {20, 26, 160, 8, -105, 4400, 940},
+    {20, 26, 160, 8, -105, 4560, 940},
+    {20, 26, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 3760, 940},
+    {20, 53, 160, 8, -105, 3920, 940},
+    {20, 53, 160, 8, -105, 4080, 940},
+    {20, 53, 160, 8, -105, 4240, 940},
+    {20, 53, 160, 8, -105, 4400, 940},
+    {20, 53, 160, 8, -105, 4560, 940},
+    {20, 53, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 4880, 940},
+    {20, 53, 160, 8, -105, 5040, 940},
+    {20, 53, 160, 8, -105, 5200, 940},
+    {20, 53, 160, 8, -105, 5360, 940},
+    {20, 40, 160, 8, -105, 3920, 940},
+    {20, 40, 160, 8, -105, 4080, 940},
+    {20, 40, 160, 8, -105, 4240, 940},
+    {20, 40, 160, 8, -105, 4400, 940},
+    {20, 40, 160, 8, -105, 4560, 940},
+    {20, 40, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 4880, 940},
+    {20, 40, 160, 8, -105, 5040, 940},
+    {20, 40, 160, 8, -105, 5200, 940},
+    {20, 40, 160, 8, -105, 5360, 940},
+    {20, 40, 160, 8, -105, 5520, 940},
+    {20, 80, 160, 8, -105, 5360, 940},
+    {20, 80, 160, 8, -105, 5520, 940},
+    {20, 80, 160, 8, -105, 5680, 940},
+    {20, 80, 160, 8, -105, 5840, 940},
+    {20, 80, 160, 8, -105, 6000, 940},
+    {20, 80, 160, 8, -105, 6160, 940},
+    {20, 80, 160, 8, -105, 6320, 940},
+    {20, 80, 160, 8, -105, 6480, 940},
+    {20, 80, 160, 8, -105, 6640, 940},
+    {20, 80, 160, 8, -105, 6800, 940},
+    {20, 80, 160, 8, -105, 6960, 940},
+    {20, 20, 160, 8, -105, 3120, 940},
+    {20, 20, 160, 8, -105, 3280, 940},
+    {20, 20, 160, 8, -105, 3440, 940},
+    {20, 20, 160, 8, -105, 3600, 940},
+    {20, 20, 160, 8, -105, 3760, 940},
+    {20, 20, 160, 8, -105, 3920, 940},
+    {20, 20, 160, 8, -105, 4080, 940},
+    {20, 20, 160, 8, -105, 4240, 940},
+    {20, 20, 160, 8, -105, 4400, 940},
+    {20, 20, 160, 8, -105, 4560, 940},
+    {20, 20, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 3760, 940},
+    {20, 40, 160, 8, -105, 3920, 940},
+    {20, 40, 160, 8, -105, 4080, 940},
+    {20, 40, 160, 8, -105, 4240, 940},
+    {20, 40, 160, 8, -105, 4400, 940},
+    {20, 40, 160, 8, -105, 4560, 940},
+    {20, 40, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 4880, 940},
+    {20, 40, 160, 8, -105, 5040, 940},
+    {20, 40, 160, 8, -105, 5200, 940},
+    {20, 40, 160, 8, -105, 5360, 940},
+    {20, 26, 160, 8, -105, 3920, 970},
+    {20, 26, 160, 8, -105, 4080, 970},
+    {20, 26, 160, 8, -105, 4240, 970},
+    {20, 26, 160, 8, -105, 4400, 970},
+    {20, 26, 160, 8, -105, 4560, 970},
+    {20, 26, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 4880, 970},
+    {20, 26, 160, 8, -105, 5040, 970},
+    {20, 26, 160, 8, -105, 5200, 970},
+    {20, 26, 160, 8, -105, 5360, 970},
+    {20, 26, 160, 8, -105, 5520, 970},
+    {20, 53, 160, 8, -105, 5360, 970},
+    {20, 53, 160, 8, -105, 5520, 970},
+    {20, 53, 160, 8, -105, 5680, 970},
+    {20, 53, 160, 8, -105, 5840, 970},
+    {20, 53, 160, 8, -105, 6000, 970},
+    {20, 53, 160, 8, -105, 6160, 970},
+    {20, 53, 160, 8, -105, 6320, 970},
+    {20, 53, 160, 8, -105, 6480, 970},
+    {20, 53, 160, 8, -105, 6640, 970},
+    {20, 53, 160, 8, -105, 6800, 970},
+    {20, 53, 160, 8, -105, 6960, 970},
+    {20, 13, 160, 8, -105, 3120, 970},
+    {20, 13, 160, 8, -105, 3280, 970},
+    {20, 13, 160, 8, -105, 3440, 970},
+    {20, 13, 160, 8, -105, 3600, 970},
+    {20, 13, 160, 8, -105, 3760, 970},
+    {20, 13, 160, 8, -105, 3920, 970},
+    {20, 13, 160, 8, -105, 4080, 970},
+    {20, 13, 160, 8, -105, 4240, 970},
+    {20, 13, 160, 8, -105, 4400, 970},
+    {20, 13, 160, 8, -105, 4560, 970},
+    {20, 13, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 3760, 970},
+    {20, 26, 160, 8, -105, 3920, 970},
+    {20, 26, 160, 8, -105, 4080, 970},
+    {20, 26, 160, 8, -105, 4240, 970},
+    {20, 26, 160, 8, -105, 4400, 970},
+    {20, 26, 160, 8, -105, 4560, 970},
+    {20, 26, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 4880, 970},
+    {20, 26, 160, 8, -105, 5040, 970},
+    {20, 26, 160, 8, -105, 5200, 970},
+    {20, 26, 160, 8, -105, 5360, 970},
+    {20, 20, 160, 8, -105, 3920, 975},
+    {20, 20, 160, 8, -105, 4080, 975},
+    {20, 20, 160, 8, -105, 4240, 975},
+    {20, 20, 160, 8, -105, 4400, 975},
+    {20, 20, 160, 8, -105, 4560, 975},
+    {20, 20, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 4880, 975},
+    {20, 20, 160, 8, -105, 5040, 975},
+    {20, 20, 160, 8, -105, 5200, 975},
+    {20, 20, 160, 8, -105, 5360, 975},
+    {20, 20, 160, 8, -105, 5520, 975},
+    {20, 40, 160, 8, -105, 5360, 975},
+    {20, 40, 160, 8, -105, 5520, 975},
+    {20, 40, 160, 8, -105, 5680, 975},
+    {20, 40, 160, 8, -105, 5840, 975},
+    {20, 40, 160, 8, -105, 6000, 975},
+    {20, 40, 160, 8, -105, 6160, 975},
+    {20, 40, 160, 8, -105, 6320, 975},
+    {20, 40, 160, 8, -105, 6480, 975},
+    {20, 40, 160, 8, -105, 6640, 975},
+    {20, 40, 160, 8, -105, 6800, 975},
+    {20, 40, 160, 8, -105, 6960, 975},
+    {20, 10, 160, 8, -105, 3120, 975},
+    {20, 10, 160, 8, -105, 3280, 975},
+    {20, 10, 160, 8, -105, 3440, 975},
+    {20, 10, 160, 8, -105, 3600, 975},
+    {20, 10, 160, 8, -105, 3760, 975},
+    {20, 10, 160, 8, -105, 3920, 975},
+    {20, 10, 160, 8, -105, 4080, 975},
+    {20, 10, 160, 8, -105, 4240, 975},
+    {20, 10, 160, 8, -105, 4400, 975},
+    {20, 10, 160, 8, -105, 4560, 975},
+    {20, 10, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 3760, 975},
+    {20, 20, 160, 8, -105, 3920, 975},
+    {20, 20, 160, 8, -105, 4080, 975},
+    {20, 20, 160, 8, -105, 4240, 975},
+    {20, 20, 160, 8, -105, 4400, 975},
+    {20, 20, 160, 8, -105, 4560, 975},
+    {20, 20, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 4880, 975},
+    {20, 20, 160, 8, -105, 5040, 975},
+    {20, 20, 160, 8, -105, 5200, 975},
+    {20, 20, 160, 8, -105, 5360, 975},
+    {120, 80, 960, 8, -105, 4800, 980},
+    {120, 80, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4560, 980},
+    {120, 40, 960, 8, -105, 4680, 980},
+    {120, 20, 960, 8, -105, 4440, 980},
+    {120, 20, 960, 8, -105, 4560, 980},
+    {120, 10, 960, 8, -105, 4320, 980},
+    {120, 10, 960, 8, -105, 4440, 980},
+    {120, 6, 960, 8, -105, 4320, 980},
+    {120, 6, 960, 8, -105, 4440, 980},
+    {120, 5, 960, 8, -105, 4320, 980},
+    {120, 5, 960, 8, -105, 4440, 980},
+    {120, 3, 960, 8, -105, 4320, 980},
+    {120, 3, 960, 8, -105, 4440, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 6000, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5400, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 5160, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 5040, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 13, 960, 8, -105, 4920, 980},
+    {120, 10, 960, 8, -105, 4680, 980},
+    {120, 10, 960, 8, -105, 4920, 980},
+    {120, 6, 960, 8, -105, 4680, 980},
+    {120, 6, 960, 8, -105, 4920, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 666, 960, 8, -105, 9240, 980},
+    {120, 666, 960, 8, -105, 9240, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 53, 960, 8, -105, 5040, 980},
+    {120, 53, 960, 8, -105, 5040, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {320, 1280, 1280, 4, -105, 34880, 1190},
+    {320, 640, 1280, 4, -105, 29440, 1190},
+    {320, 320, 1280, 4, -105, 26880, 1190},
+    {320, 160, 1280, 4, -105, 25600, 1190},
+    {320, 160, 1280, 4, -105, 25600, 1190},
+    {160, 640, 640, 4, -105, 18400, 1070},
+    {160, 320, 640, 4, -105, 15680, 1070},
+    {160, 160, 640, 4, -105, 14400, 1070},
+    {160, 80, 640, 4, -105, 13760, 1070},
+    {160, 80, 640, 4, -105, 13760, 1070},
+    {64, 256, 512, 8, -105, 10304, 999},
+    {64, 128, 512, 8, -105, 9216, 999},
+    {64, 64, 512, 8, -105, 8704, 999},
+    {64, 32, 512, 8, -105, 8448, 999},
+    {64, 16, 512, 8, -105, 8320, 999},
+    {64, 256, 512, 8, -105, 10304, 1004},
+    {64, 128, 512, 8, -105, 9216, 1004},
+    {64, 64, 512, 8, -105, 8704, 1004},
+    {64, 32, 512, 8, -105, 8448, 1004},
+    {64, 8, 512, 8, -105, 8256, 1004},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 16, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {20, 160, 160, 8, -105, 3920, 872},
+    {20, 160, 160, 8, -105, 4080, 872},
+    {20, 160, 160, 8, -105, 4240, 872},
+    {20, 160, 160, 8, -105, 4400, 872},
+    {20, 160, 160, 8, -105, 4560, 872},
+    {20, 160, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 4880, 872},
+    {20, 160, 160, 8, -105, 5040, 872},
+    {20, 160, 160, 8, -105, 5200, 872},
+    {20, 160, 160, 8, -105, 5360, 872},
+    {20, 160, 160, 8, -105, 5520, 872},
+    {20, 320, 160, 8, -105, 5360, 872},
+    {20, 320, 160, 8, -105, 5520, 872},
+    {20, 320, 160, 8, -105, 5680, 872},
+    {20, 320, 160, 8, -105, 5840, 872},
+    {20, 320, 160, 8, -105, 6000, 872},
+    {20, 320, 160, 8, -105, 6160, 872},
+    {20, 320, 160, 8, -105, 6320, 872},
+    {20, 320, 160, 8, -105, 6480, 872},
+    {20, 320, 160, 8, -105, 6640, 872},
+    {20, 320, 160, 8, -105, 6800, 872},
+    {20, 320, 160, 8, -105, 6960, 872},
+    {20, 80, 160, 8, -105, 3120, 872},
+    {20, 80, 160, 8, -105, 3280, 872},
+    {20, 80, 160, 8, -105, 3440, 872},
+    {20, 80, 160, 8, -105, 3600, 872},
+    {20, 80, 160, 8, -105, 3760, 872},
+    {20, 80, 160, 8, -105, 3920, 872},
+    {20, 80, 160, 8, -105, 4080, 872},
+    {20, 80, 160, 8, -105, 4240, 872},
+    {20, 80, 160, 8, -105, 4400, 872},
+    {20, 80, 160, 8, -105, 4560, 872},
+    {20, 80, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 3760, 872},
+    {20, 160, 160, 8, -105, 3920, 872},
+    {20, 160, 160, 8, -105, 4080, 872},
+    {20, 160, 160, 8, -105, 4240, 872},
+    {20, 160, 160, 8, -105, 4400, 872},
+    {20, 160, 160, 8, -105, 4560, 872},
+    {20, 160, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 4880, 872},
+    {20, 160, 160, 8, -105, 5040, 872},
+    {20, 160, 160, 8, -105, 5200, 872},
+    {20, 160, 160, 8, -105, 5360, 872},
+    {20, 80, 160, 8, -105, 3920, 930},
+    {20, 80, 160, 8, -105, 4080, 930},
+    {20, 80, 160, 8, -105, 4240, 930},
+    {20, 80, 160, 8, -105, 4400, 930},
+    {20, 80, 160, 8, -105, 4560, 930},
+    {20, 80, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 4880, 930},
+    {20, 80, 160, 8, -105, 5040, 930},
+    {20, 80, 160, 8, -105, 5200, 930},
+    {20, 80, 160, 8, -105, 5360, 930},
+    {20, 80, 160, 8, -105, 5520, 930},
+    {20, 160, 160, 8, -105, 5360, 930},
+    {20, 160, 160, 8, -105, 5520, 930},
+    {20, 160, 160, 8, -105, 5680, 930},
+    {20, 160, 160, 8, -105, 5840, 930},
+    {20, 160, 160, 8, -105, 6000, 930},
+    {20, 160, 160, 8, -105, 6160, 930},
+    {20, 160, 160, 8, -105, 6320, 930},
+    {20, 160, 160, 8, -105, 6480, 930},
+    {20, 160, 160, 8, -105, 6640, 930},
+    {20, 160, 160, 8, -105, 6800, 930},
+    {20, 160, 160, 8, -105, 6960, 930},
+    {20, 40, 160, 8, -105, 3120, 930},
+    {20, 40, 160, 8, -105, 3280, 930},
+    {20, 40, 160, 8, -105, 3440, 930},
+    {20, 40, 160, 8, -105, 3600, 930},
+    {20, 40, 160, 8, -105, 3760, 930},
+    {20, 40, 160, 8, -105, 3920, 930},
+    {20, 40, 160, 8, -105, 4080, 930},
+    {20, 40, 160, 8, -105, 4240, 930},
+    {20, 40, 160, 8, -105, 4400, 930},
+    {20, 40, 160, 8, -105, 4560, 930},
+    {20, 40, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 3760, 930},
+    {20, 80, 160, 8, -105, 3920, 930},
+    {20, 80, 160, 8, -105, 4080, 930},
+    {20, 80, 160, 8, -105, 4240, 930},
+    {20, 80, 160, 8, -105, 4400, 930},
+    {20, 80, 160, 8, -105, 4560, 930},
+    {20, 80, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 4880, 930},
+    {20, 80, 160, 8, -105, 5040, 930},
+    {20, 80, 160, 8, -105, 5200, 930},
+    {20, 80, 160, 8, -105, 5360, 930},
+    {20, 53, 160, 8, -105, 3920, 940},
+    {20, 53, 160, 8, -105, 4080, 940},
+    {20, 53, 160, 8, -105, 4240, 940},
+    {20, 53, 160, 8, -105, 4400, 940},
+    {20, 53, 160, 8, -105, 4560, 940},
+    {20, 53, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 4880, 940},
+    {20, 53, 160, 8, -105, 5040, 940},
+    {20, 53, 160, 8, -105, 5200, 940},
+    {20, 53, 160, 8, -105, 5360, 940},
+    {20, 53, 160, 8, -105, 5520, 940},
+    {20, 106, 160, 8, -105, 5360, 940},
+    {20, 106, 160, 8, -105, 5520, 940},
+    {20, 106, 160, 8, -105, 5680, 940},
+    {20, 106, 160, 8, -105, 5840, 940},
+    {20, 106, 160, 8, -105, 6000, 940},
+    {20, 106, 160, 8, -105, 6160, 940},
+    {20, 106, 160, 8, -105, 6320, 940},
+    {20, 106, 160, 8, -105, 6480, 940},
+    {20, 106, 160, 8, -105, 6640, 940},
+    {20, 106, 160, 8, -105, 6800, 940},
+    {20, 106, 160, 8, -105, 6960, 940},
+    {20, 26, 160, 8, -105, 3120, 940},
+    {20, 26, 160, 8, -105, 3280, 940},
+    {20, 26, 160, 8, -105, 3440, 940},
+    {20, 26, 160, 8, -105, 3600, 940},
+    {20, 26, 160, 8, -105, 3760, 940},
+    {20, 26, 160, 8, -105, 3920, 940},
+    {20, 26, 160, 8, -105, 4080, 940},
+    {20, 26, 160, 8, -105, 4240, 940},
+    {20, 26, 160, 8, -105, 4400, 940},
+    {20, 26, 160, 8, -105, 4560, 940},
+    {20, 26, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 3760, 940},
+    {20, 53, 160, 8, -105, 3920, 940},
+    {20, 53, 160, 8, -105, 4080, 940},
+    {20, 53, 160, 8, -105, 4240, 940},
+    {20, 53, 160, 8, -105, 4400, 940},
+    {20, 53, 160, 8, -105, 4560, 940},
+    {20, 53, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 4880, 940},
+    {20, 53, 160, 8, -105, 5040, 940},
+    {20, 53, 160, 8, -105, 5200, 940},
+    {20, 53, 160, 8, -105, 5360, 940},
+    {20, 40, 160, 8, -105, 3920, 940},
+    {20, 40, 160, 8, -105, 4080, 940},
+    {20, 40, 160, 8, -105, 4240, 940},
+    {20, 40, 160, 8, -105, 4400, 940},
+    {20, 40, 160, 8, -105, 4560, 940},
+    {20, 40, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 4880, 940},
+    {20, 40, 160, 8, -105, 5040, 940},
+    {20, 40, 160, 8, -105, 5200, 940},
+    {20, 40, 160, 8, -105, 5360, 940},
+    {20, 40, 160, 8, -105, 5520, 940},
+    {20, 80, 160, 8, -105, 5360, 940},
+    {20, 80, 160, 8, -105, 5520, 940},
+    {20, 80, 160, 8, -105, 5680, 940},
+    {20, 80, 160, 8, -105, 5840, 940},
+    {20, 80, 160, 8, -105, 6000, 940},
+    {20, 80, 160, 8, -105, 6160, 940},
+    {20, 80, 160, 8, -105, 6320, 940},
+    {20, 80, 160, 8, -105, 6480, 940},
+    {20, 80, 160, 8, -105, 6640, 940},
+    {20, 80, 160, 8, -105, 6800, 940},
+    {20, 80, 160, 8, -105, 6960, 940},
+    {20, 20, 160, 8, -105, 3120, 940},
+    {20, 20, 160, 8, -105, 3280, 940},
+    {20, 20, 160, 8, -105, 3440, 940},
+    {20, 20, 160, 8, -105, 3600, 940},
+    {20, 20, 160, 8, -105, 3760, 940},
+    {20, 20, 160, 8, -105, 3920, 940},
+    {20, 20, 160, 8, -105, 4080, 940},
+    {20, 20, 160, 8, -105, 4240, 940},
+    {20, 20, 160, 8, -105, 4400, 940},
+    {20, 20, 160, 8, -105, 4560, 940},
+    {20, 20, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 3760, 940},
+    {20, 40, 160, 8, -105, 3920, 940},
+    {20, 40, 160, 8, -105, 4080, 940},
+    {20, 40, 160, 8, -105, 4240, 940},
+    {20, 40, 160, 8, -105, 4400, 940},
+    {20, 40, 160, 8, -105, 4560, 940},
+    {20, 40, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 4880, 940},
+    {20, 40, 160, 8, -105, 5040, 940},
+    {20, 40, 160, 8, -105, 5200, 940},
+    {20, 40, 160, 8, -105, 5360, 940},
+    {20, 26, 160, 8, -105, 3920, 970},
+    {20, 26, 160, 8, -105, 4080, 970},
+    {20, 26, 160, 8, -105, 4240, 970},
+    {20, 26, 160, 8, -105, 4400, 970},
+    {20, 26, 160, 8, -105, 4560, 970},
+    {20, 26, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 4880, 970},
+    {20, 26, 160, 8, -105, 5040, 970},
+    {20, 26, 160, 8, -105, 5200, 970},
+    {20, 26, 160, 8, -105, 5360, 970},
+    {20, 26, 160, 8, -105, 5520, 970},
+    {20, 53, 160, 8, -105, 5360, 970},
+    {20, 53, 160, 8, -105, 5520, 970},
+    {20, 53, 160, 8, -105, 5680, 970},
+    {20, 53, 160, 8, -105, 5840, 970},
+    {20, 53, 160, 8, -105, 6000, 970},
+    {20, 53, 160, 8, -105, 6160, 970},
+    {20, 53, 160, 8, -105, 6320, 970},
+    {20, 53, 160, 8, -105, 6480, 970},
+    {20, 53, 160, 8, -105, 6640, 970},
+    {20, 53, 160, 8, -105, 6800, 970},
+    {20, 53, 160, 8, -105, 6960, 970},
+    {20, 13, 160, 8, -105, 3120, 970},
+    {20, 13, 160, 8, -105, 3280, 970},
+    {20, 13, 160, 8, -105, 3440, 970},
+    {20, 13, 160, 8, -105, 3600, 970},
+    {20, 13, 160, 8, -105, 3760, 970},
+    {20, 13, 160, 8, -105, 3920, 970},
+    {20, 13, 160, 8, -105, 4080, 970},
+    {20, 13, 160, 8, -105, 4240, 970},
+    {20, 13, 160, 8, -105, 4400, 970},
+    {20, 13, 160, 8, -105, 4560, 970},
+    {20, 13, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 3760, 970},
+    {20, 26, 160, 8, -105, 3920, 970},
+    {20, 26, 160, 8, -105, 4080, 970},
+    {20, 26, 160, 8, -105, 4240, 970},
+    {20, 26, 160, 8, -105, 4400, 970},
+    {20, 26, 160, 8, -105, 4560, 970},
+    {20, 26, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 4880, 970},
+    {20, 26, 160, 8, -105, 5040, 970},
+    {20, 26, 160, 8, -105, 5200, 970},
+    {20, 26, 160, 8, -105, 5360, 970},
+    {20, 20, 160, 8, -105, 3920, 975},
+    {20, 20, 160, 8, -105, 4080, 975},
+    {20, 20, 160, 8, -105, 4240, 975},
+    {20, 20, 160, 8, -105, 4400, 975},
+    {20, 20, 160, 8, -105, 4560, 975},
+    {20, 20, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 4880, 975},
+    {20, 20, 160, 8, -105, 5040, 975},
+    {20, 20, 160, 8, -105, 5200, 975},
+    {20, 20, 160, 8, -105, 5360, 975},
+    {20, 20, 160, 8, -105, 5520, 975},
+    {20, 40, 160, 8, -105, 5360, 975},
+    {20, 40, 160, 8, -105, 5520, 975},
+    {20, 40, 160, 8, -105, 5680, 975},
+    {20, 40, 160, 8, -105, 5840, 975},
+    {20, 40, 160, 8, -105, 6000, 975},
+    {20, 40, 160, 8, -105, 6160, 975},
+    {20, 40, 160, 8, -105, 6320, 975},
+    {20, 40, 160, 8, -105, 6480, 975},
+    {20, 40, 160, 8, -105, 6640, 975},
+    {20, 40, 160, 8, -105, 6800, 975},
+    {20, 40, 160, 8, -105, 6960, 975},
+    {20, 10, 160, 8, -105, 3120, 975},
+    {20, 10, 160, 8, -105, 3280, 975},
+    {20, 10, 160, 8, -105, 3440, 975},
+    {20, 10, 160, 8, -105, 3600, 975},
+    {20, 10, 160, 8, -105, 3760, 975},
+    {20, 10, 160, 8, -105, 3920, 975},
+    {20, 10, 160, 8, -105, 4080, 975},
+    {20, 10, 160, 8, -105, 4240, 975},
+    {20, 10, 160, 8, -105, 4400, 975},
+    {20, 10, 160, 8, -105, 4560, 975},
+    {20, 10, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 3760, 975},
+    {20, 20, 160, 8, -105, 3920, 975},
+    {20, 20, 160, 8, -105, 4080, 975},
+    {20, 20, 160, 8, -105, 4240, 975},
+    {20, 20, 160, 8, -105, 4400, 975},
+    {20, 20, 160, 8, -105, 4560, 975},
+    {20, 20, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 4880, 975},
+    {20, 20, 160, 8, -105, 5040, 975},
+    {20, 20, 160, 8, -105, 5200, 975},
+    {20, 20, 160, 8, -105, 5360, 975},
+    {120, 80, 960, 8, -105, 4800, 980},
+    {120, 80, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4560, 980},
+    {120, 40, 960, 8, -105, 4680, 980},
+    {120, 20, 960, 8, -105, 4440, 980},
+    {120, 20, 960, 8, -105, 4560, 980},
+    {120, 10, 960, 8, -105, 4320, 980},
+    {120, 10, 960, 8, -105, 4440, 980},
+    {120, 6, 960, 8, -105, 4320, 980},
+    {120, 6, 960, 8, -105, 4440, 980},
+    {120, 5, 960, 8, -105, 4320, 980},
+    {120, 5, 960, 8, -105, 4440, 980},
+    {120, 3, 960, 8, -105, 4320, 980},
+    {120, 3, 960, 8, -105, 4440, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 6000, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5400, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 5160, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 5040, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 13, 960, 8, -105, 4920, 980},
+    {120, 10, 960, 8, -105, 4680, 980},
+    {120, 10, 960, 8, -105, 4920, 980},
+    {120, 6, 960, 8, -105, 4680, 980},
+    {120, 6, 960, 8, -105, 4920, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 666, 960, 8, -105, 9240, 980},
+    {120, 666, 960, 8, -105, 9240, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 53, 960, 8, -105, 5040, 980},
+    {120, 53, 960, 8, -105, 5040, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {320, 1280, 1280, 4, -105, 34880, 1190},
+    {320, 640, 1280, 4, -105, 29440, 1190},
+    {320, 320, 1280, 4, -105, 26880, 1190},
+    {320, 160, 1280, 4, -105, 25600, 1190},
+    {320, 160, 1280, 4, -105, 25600, 1190},
+    {160, 640, 640, 4, -105, 18400, 1070},
+    {160, 320, 640, 4, -105, 15680, 1070},
+    {160, 160, 640, 4, -105, 14400, 1070},
+    {160, 80, 640, 4, -105, 13760, 1070},
+    {160, 80, 640, 4, -105, 13760, 1070},
+    {64, 256, 512, 8, -105, 10304, 999},
+    {64, 128, 512, 8, -105, 9216, 999},
+    {64, 64, 512, 8, -105, 8704, 999},
+    {64, 32, 512, 8, -105, 8448, 999},
+    {64, 16, 512, 8, -105, 8320, 999},
+    {64, 256, 512, 8, -105, 10304, 1004},
+    {64, 128, 512, 8, -105, 9216, 1004},
+    {64, 64, 512, 8, -105, 8704, 1004},
+    {64, 32, 512, 8, -105, 8448, 1004},
+    {64, 8, 512, 8, -105, 8256, 1004},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 16, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {20, 160, 160, 8, -105, 3920, 872},
+    {20, 160, 160, 8, -105, 4080, 872},
+    {20, 160, 160, 8, -105, 4240, 872},
+    {20, 160, 160, 8, -105, 4400, 872},
+    {20, 160, 160, 8, -105, 4560, 872},
+    {20, 160, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 4880, 872},
+    {20, 160, 160, 8, -105, 5040, 872},
+    {20, 160, 160, 8, -105, 5200, 872},
+    {20, 160, 160, 8, -105, 5360, 872},
+    {20, 160, 160, 8, -105, 5520, 872},
+    {20, 320, 160, 8, -105, 5360, 872},
+    {20, 320, 160, 8, -105, 5520, 872},
+    {20, 320, 160, 8, -105, 5680, 872},
+    {20, 320, 160, 8, -105, 5840, 872},
+    {20, 320, 160, 8, -105, 6000, 872},
+    {20, 320, 160, 8, -105, 6160, 872},
+    {20, 320, 160, 8, -105, 6320, 872},
+    {20, 320, 160, 8, -105, 6480, 872},
+    {20, 320, 160, 8, -105, 6640, 872},
+    {20, 320, 160, 8, -105, 6800, 872},
+    {20, 320, 160, 8, -105, 6960, 872},
+    {20, 80, 160, 8, -105, 3120, 872},
+    {20, 80, 160, 8, -105, 3280, 872},
+    {20, 80, 160, 8, -105, 3440, 872},
+    {20, 80, 160, 8, -105, 3600, 872},
+    {20, 80, 160, 8, -105, 3760, 872},
+    {20, 80, 160, 8, -105, 3920, 872},
+    {20, 80, 160, 8, -105, 4080, 872},
+    {20, 80, 160, 8, -105, 4240, 872},
+    {20, 80, 160, 8, -105, 4400, 872},
+    {20, 80, 160, 8, -105, 4560, 872},
+    {20, 80, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 3760, 872},
+    {20, 160, 160, 8, -105, 3920, 872},
+    {20, 160, 160, 8, -105, 4080, 872},
+    {20, 160, 160, 8, -105, 4240, 872},
+    {20, 160, 160, 8, -105, 4400, 872},
+    {20, 160, 160, 8, -105, 4560, 872},
+    {20, 160, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 4880, 872},
+    {20, 160, 160, 8, -105, 5040, 872},
+    {20, 160, 160, 8, -105, 5200, 872},
+    {20, 160, 160, 8, -105, 5360, 872},
+    {20, 80, 160, 8, -105, 3920, 930},
+    {20, 80, 160, 8, -105, 4080, 930},
+    {20, 80, 160, 8, -105, 4240, 930},
+    {20, 80, 160, 8, -105, 4400, 930},
+    {20, 80, 160, 8, -105, 4560, 930},
+    {20, 80, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 4880, 930},
+    {20, 80, 160, 8, -105, 5040, 930},
+    {20, 80, 160, 8, -105, 5200, 930},
+    {20, 80, 160, 8, -105, 5360, 930},
+    {20, 80, 160, 8, -105, 5520, 930},
+    {20, 160, 160, 8, -105, 5360, 930},
+    {20, 160, 160, 8, -105, 5520, 930},
+    {20, 160, 160, 8, -105, 5680, 930},
+    {20, 160, 160, 8, -105, 5840, 930},
+    {20, 160, 160, 8, -105, 6000, 930},
+    {20, 160, 160, 8, -105, 6160, 930},
+    {20, 160, 160, 8, -105, 6320, 930},
+    {20, 160, 160, 8, -105, 6480, 930},
+    {20, 160, 160, 8, -105, 6640, 930},
+    {20, 160, 160, 8, -105, 6800, 930},
+    {20, 160, 160, 8, -105, 6960, 930},
+    {20, 40, 160, 8, -105, 3120, 930},
+    {20, 40, 160, 8, -105, 3280, 930},
+    {20, 40, 160, 8, -105, 3440, 930},
+    {20, 40, 160, 8, -105, 3600, 930},
+    {20, 40, 160, 8, -105, 3760, 930},
+    {20, 40, 160, 8, -105, 3920, 930},
+    {20, 40, 160, 8, -105, 4080, 930},
+    {20, 40, 160, 8, -105, 4240, 930},
+    {20, 40, 160, 8, -105, 4400, 930},
+    {20, 40, 160, 8, -105, 4560, 930},
+    {20, 40, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 3760, 930},
+    {20, 80, 160, 8, -105, 3920, 930},
+    {20, 80, 160, 8, -105, 4080, 930},
+    {20, 80, 160, 8, -105, 4240, 930},
+    {20, 80, 160, 8, -105, 4400, 930},
+    {20, 80, 160, 8, -105, 4560, 930},
+    {20, 80, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 4880, 930},
+    {20, 80, 160, 8, -105, 5040, 930},
+    {20, 80, 160, 8, -105, 5200, 930},
+    {20, 80, 160, 8, -105, 5360, 930},
+    {20, 53, 160, 8, -105, 3920, 940},
+    {20, 53, 160, 8, -105, 4080, 940},
+    {20, 53, 160, 8, -105, 4240, 940},
+    {20, 53, 160, 8, -105, 4400, 940},
+    {20, 53, 160, 8, -105, 4560, 940},
+    {20, 53, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 4880, 940},
+    {20, 53, 160, 8, -105, 5040, 940},
+    {20, 53, 160, 8, -105, 5200, 940},
+    {20, 53, 160, 8, -105, 5360, 940},
+    {20, 53, 160, 8, -105, 5520, 940},
+    {20, 106, 160, 8, -105, 5360, 940},
+    {20, 106, 160, 8, -105, 5520, 940},
+    {20, 106, 160, 8, -105, 5680, 940},
+    {20, 106, 160, 8, -105, 5840, 940},
+    {20, 106, 160, 8, -105, 6000, 940},
+    {20, 106, 160, 8, -105, 6160, 940},
+    {20, 106, 160, 8, -105, 6320, 940},
+    {20, 106, 160, 8, -105, 6480, 940},
+    {20, 106, 160, 8, -105, 6640, 940},
+    {20, 106, 160, 8, -105, 6800, 940},
+    {20, 106, 160, 8, -105, 6960, 940},
+    {20, 26, 160, 8, -105, 3120, 940},
+    {20, 26, 160, 8, -105, 3280, 940},
+    {20, 26, 160, 8, -105, 3440, 940},
+    {20, 26, 160, 8, -105, 3600, 940},
+    {20, 26, 160, 8, -105, 3760, 940},
+    {20, 26, 160, 8, -105, 3920, 940},
+    {20, 26, 160, 8, -105, 4080, 940},
+    {20, 26, 160, 8, -105, 4240, 940},
+    {20, 26, 160, 8, -105, 4400, 940},
+    {20, 26, 160, 8, -105, 4560, 940},
+    {20, 26, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 3760, 940},
+    {20, 53, 160, 8, -105, 3920, 940},
+    {20, 53, 160, 8, -105, 4080, 940},
+    {20, 53, 160, 8, -105, 4240, 940},
+    {20, 53, 160, 8, -105, 4400, 940},
+    {20, 53, 160, 8, -105, 4560, 940},
+    {20, 53, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 4880, 940},
+    {20, 53, 160, 8, -105, 5040, 940},
+    {20, 53, 160, 8, -105, 5200, 940},
+    {20, 53, 160, 8, -105, 5360, 940},
+    {20, 40, 160, 8, -105, 3920, 940},
+    {20, 40, 160, 8, -105, 4080, 940},
+    {20, 40, 160, 8, -105, 4240, 940},
+    {20, 40, 160, 8, -105, 4400, 940},
+    {20, 40, 160, 8, -105, 4560, 940},
+    {20, 40, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 4880, 940},
+    {20, 40, 160, 8, -105, 5040, 940},
+    {20, 40, 160, 8, -105, 5200, 940},
+    {20, 40, 160, 8, -105, 5360, 940},
+    {20, 40, 160, 8, -105, 5520, 940},
+    {20, 80, 160, 8, -105, 5360, 940},
+    {20, 80, 160, 8, -105, 5520, 940},
+    {20, 80, 160, 8, -105, 5680, 940},
+    {20, 80, 160, 8, -105, 5840, 940},
+    {20, 80, 160, 8, -105, 6000, 940},
+    {20, 80, 160, 8, -105, 6160, 940},
+    {20, 80, 160, 8, -105, 6320, 940},
+    {20, 80, 160, 8, -105, 6480, 940},
+    {20, 80, 160, 8, -105, 6640, 940},
+    {20, 80, 160, 8, -105, 6800, 940},
+    {20, 80, 160, 8, -105, 6960, 940},
+    {20, 20, 160, 8, -105, 3120, 940},
+    {20, 20, 160, 8, -105, 3280, 940},
+    {20, 20, 160, 8, -105, 3440, 940},
+    {20, 20, 160, 8, -105, 3600, 940},
+    {20, 20, 160, 8, -105, 3760, 940},
+    {20, 20, 160, 8, -105, 3920, 940},
+    {20, 20, 160, 8, -105, 4080, 940},
+    {20, 20, 160, 8, -105, 4240, 940},
+    {20, 20, 160, 8, -105, 4400, 940},
+    {20, 20, 160, 8, -105, 4560, 940},
+    {20, 20, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 3760, 940},
+    {20, 40, 160, 8, -105, 3920, 940},
+    {20, 40, 160, 8, -105, 4080, 940},
+    {20, 40, 160, 8, -105, 4240, 940},
+    {20, 40, 160, 8, -105, 4400, 940},
+    {20, 40, 160, 8, -105, 4560, 940},
+    {20, 40, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 4880, 940},
+    {20, 40, 160, 8, -105, 5040, 940},
+    {20, 40, 160, 8, -105, 5200, 940},
+    {20, 40, 160, 8, -105, 5360, 940},
+    {20, 26, 160, 8, -105, 3920, 970},
+    {20, 26, 160, 8, -105, 4080, 970},
+    {20, 26, 160, 8, -105, 4240, 970},
+    {20, 26, 160, 8, -105, 4400, 970},
+    {20, 26, 160, 8, -105, 4560, 970},
+    {20, 26, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 4880, 970},
+    {20, 26, 160, 8, -105, 5040, 970},
+    {20, 26, 160, 8, -105, 5200, 970},
+    {20, 26, 160, 8, -105, 5360, 970},
+    {20, 26, 160, 8, -105, 5520, 970},
+    {20, 53, 160, 8, -105, 5360, 970},
+    {20, 53, 160, 8, -105, 5520, 970},
+    {20, 53, 160, 8, -105, 5680, 970},
+    {20, 53, 160, 8, -105, 5840, 970},
+    {20, 53, 160, 8, -105, 6000, 970},
+    {20, 53, 160, 8, -105, 6160, 970},
+    {20, 53, 160, 8, -105, 6320, 970},
+    {20, 53, 160, 8, -105, 6480, 970},
+    {20, 53, 160, 8, -105, 6640, 970},
+    {20, 53, 160, 8, -105, 6800, 970},
+    {20, 53, 160, 8, -105, 6960, 970},
+    {20, 13, 160, 8, -105, 3120, 970},
+    {20, 13, 160, 8, -105, 3280, 970},
+    {20, 13, 160, 8, -105, 3440, 970},
+    {20, 13, 160, 8, -105, 3600, 970},
+    {20, 13, 160, 8, -105, 3760, 970},
+    {20, 13, 160, 8, -105, 3920, 970},
+    {20, 13, 160, 8, -105, 4080, 970},
+    {20, 13, 160, 8, -105, 4240, 970},
+    {20, 13, 160, 8, -105, 4400, 970},
+    {20, 13, 160, 8, -105, 4560, 970},
+    {20, 13, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 3760, 970},
+    {20, 26, 160, 8, -105, 3920, 970},
+    {20, 26, 160, 8, -105, 4080, 970},
+    {20, 26, 160, 8, -105, 4240, 970},
+    {20, 26, 160, 8, -105, 4400, 970},
+    {20, 26, 160, 8, -105, 4560, 970},
+    {20, 26, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 4880, 970},
+    {20, 26, 160, 8, -105, 5040, 970},
+    {20, 26, 160, 8, -105, 5200, 970},
+    {20, 26, 160, 8, -105, 5360, 970},
+    {20, 20, 160, 8, -105, 3920, 975},
+    {20, 20, 160, 8, -105, 4080, 975},
+    {20, 20, 160, 8, -105, 4240, 975},
+    {20, 20, 160, 8, -105, 4400, 975},
+    {20, 20, 160, 8, -105, 4560, 975},
+    {20, 20, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 4880, 975},
+    {20, 20, 160, 8, -105, 5040, 975},
+    {20, 20, 160, 8, -105, 5200, 975},
+    {20, 20, 160, 8, -105, 5360, 975},
+    {20, 20, 160, 8, -105, 5520, 975},
+    {20, 40, 160, 8, -105, 5360, 975},
+    {20, 40, 160, 8, -105, 5520, 975},
+    {20, 40, 160, 8, -105, 5680, 975},
+    {20, 40, 160, 8, -105, 5840, 975},
+    {20, 40, 160, 8, -105, 6000, 975},
+    {20, 40, 160, 8, -105, 6160, 975},
+    {20, 40, 160, 8, -105, 6320, 975},
+    {20, 40, 160, 8, -105, 6480, 975},
+    {20, 40, 160, 8, -105, 6640, 975},
+    {20, 40, 160, 8, -105, 6800, 975},
+    {20, 40, 160, 8, -105, 6960, 975},
+    {20, 10, 160, 8, -105, 3120, 975},
+    {20, 10, 160, 8, -105, 3280, 975},
+    {20, 10, 160, 8, -105, 3440, 975},
+    {20, 10, 160, 8, -105, 3600, 975},
+    {20, 10, 160, 8, -105, 3760, 975},
+    {20, 10, 160, 8, -105, 3920, 975},
+    {20, 10, 160, 8, -105, 4080, 975},
+    {20, 10, 160, 8, -105, 4240, 975},
+    {20, 10, 160, 8, -105, 4400, 975},
+    {20, 10, 160, 8, -105, 4560, 975},
+    {20, 10, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 3760, 975},
+    {20, 20, 160, 8, -105, 3920, 975},
+    {20, 20, 160, 8, -105, 4080, 975},
+    {20, 20, 160, 8, -105, 4240, 975},
+    {20, 20, 160, 8, -105, 4400, 975},
+    {20, 20, 160, 8, -105, 4560, 975},
+    {20, 20, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 4880, 975},
+    {20, 20, 160, 8, -105, 5040, 975},
+    {20, 20, 160, 8, -105, 5200, 975},
+    {20, 20, 160, 8, -105, 5360, 975},
+    {120, 80, 960, 8, -105, 4800, 980},
+    {120, 80, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4560, 980},
+    {120, 40, 960, 8, -105, 4680, 980},
+    {120, 20, 960, 8, -105, 4440, 980},
+    {120, 20, 960, 8, -105, 4560, 980},
+    {120, 10, 960, 8, -105, 4320, 980},
+    {120, 10, 960, 8, -105, 4440, 980},
+    {120, 6, 960, 8, -105, 4320, 980},
+    {120, 6, 960, 8, -105, 4440, 980},
+    {120, 5, 960, 8, -105, 4320, 980},
+    {120, 5, 960, 8, -105, 4440, 980},
+    {120, 3, 960, 8, -105, 4320, 980},
+    {120, 3, 960, 8, -105, 4440, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 6000, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5400, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 5160, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 5040, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 13, 960, 8, -105, 4920, 980},
+    {120, 10, 960, 8, -105, 4680, 980},
+    {120, 10, 960, 8, -105, 4920, 980},
+    {120, 6, 960, 8, -105, 4680, 980},
+    {120, 6, 960, 8, -105, 4920, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 666, 960, 8, -105, 9240, 980},
+    {120, 666, 960, 8, -105, 9240, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 53, 960, 8, -105, 5040, 980},
+    {120, 53, 960, 8, -105, 5040, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {320, 1280, 1280, 4, -105, 34880, 1190},
+    {320, 640, 1280, 4, -105, 29440, 1190},
+    {320, 320, 1280, 4, -105, 26880, 1190},
+    {320, 160, 1280, 4, -105, 25600, 1190},
+    {320, 160, 1280, 4, -105, 25600, 1190},
+    {160, 640, 640, 4, -105, 18400, 1070},
+    {160, 320, 640, 4, -105, 15680, 1070},
+    {160, 160, 640, 4, -105, 14400, 1070},
+    {160, 80, 640, 4, -105, 13760, 1070},
+    {160, 80, 640, 4, -105, 13760, 1070},
+    {64, 256, 512, 8, -105, 10304, 999},
+    {64, 128, 512, 8, -105, 9216, 999},
+    {64, 64, 512, 8, -105, 8704, 999},
+    {64, 32, 512, 8, -105, 8448, 999},
+    {64, 16, 512, 8, -105, 8320, 999},
+    {64, 256, 512, 8, -105, 10304, 1004},
+    {64, 128, 512, 8, -105, 9216, 1004},
+    {64, 64, 512, 8, -105, 8704, 1004},
+    {64, 32, 512, 8, -105, 8448, 1004},
+    {64, 8, 512, 8, -105, 8256, 1004},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 16, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {20, 160, 160, 8, -105, 3920, 872},
+    {20, 160, 160, 8, -105, 4080, 872},
+    {20, 160, 160, 8, -105, 4240, 872},
+    {20, 160, 160, 8, -105, 4400, 872},
+    {20, 160, 160, 8, -105, 4560, 872},
+    {20, 160, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 4880, 872},
+    {20, 160, 160, 8, -105, 5040, 872},
+    {20, 160, 160, 8, -105, 5200, 872},
+    {20, 160, 160, 8, -105, 5360, 872},
+    {20, 160, 160, 8, -105, 5520, 872},
+    {20, 320, 160, 8, -105, 5360, 872},
+    {20, 320, 160, 8, -105, 5520, 872},
+    {20, 320, 160, 8, -105, 5680, 872},
+    {20, 320, 160, 8, -105, 5840, 872},
+    {20, 320, 160, 8, -105, 6000, 872},
+    {20, 320, 160, 8, -105, 6160, 872},
+    {20, 320, 160, 8, -105, 6320, 872},
+    {20, 320, 160, 8, -105, 6480, 872},
+    {20, 320, 160, 8, -105, 6640, 872},
+    {20, 320, 160, 8, -105, 6800, 872},
+    {20, 320, 160, 8, -105, 6960, 872},
+    {20, 80, 160, 8, -105, 3120, 872},
+    {20, 80, 160, 8, -105, 3280, 872},
+    {20, 80, 160, 8, -105, 3440, 872},
+    {20, 80, 160, 8, -105, 3600, 872},
+    {20, 80, 160, 8, -105, 3760, 872},
+    {20, 80, 160, 8, -105, 3920, 872},
+    {20, 80, 160, 8, -105, 4080, 872},
+    {20, 80, 160, 8, -105, 4240, 872},
+    {20, 80, 160, 8, -105, 4400, 872},
+    {20, 80, 160, 8, -105, 4560, 872},
+    {20, 80, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 3760, 872},
+    {20, 160, 160, 8, -105, 3920, 872},
+    {20, 160, 160, 8, -105, 4080, 872},
+    {20, 160, 160, 8, -105, 4240, 872},
+    {20, 160, 160, 8, -105, 4400, 872},
+    {20, 160, 160, 8, -105, 4560, 872},
+    {20, 160, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 4880, 872},
+    {20, 160, 160, 8, -105, 5040, 872},
+    {20, 160, 160, 8, -105, 5200, 872},
+    {20, 160, 160, 8, -105, 5360, 872},
+    {20, 80, 160, 8, -105, 3920, 930},
+    {20, 80, 160, 8, -105, 4080, 930},
+    {20, 80, 160, 8, -105, 4240, 930},
+    {20, 80, 160, 8, -105, 4400, 930},
+    {20, 80, 160, 8, -105, 4560, 930},
+    {20, 80, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 4880, 930},
+    {20, 80, 160, 8, -105, 5040, 930},
+    {20, 80, 160, 8, -105, 5200, 930},
+    {20, 80, 160, 8, -105, 5360, 930},
+    {20, 80, 160, 8, -105, 5520, 930},
+    {20, 160, 160, 8, -105, 5360, 930},
+    {20, 160, 160, 8, -105, 5520, 930},
+    {20, 160, 160, 8, -105, 5680, 930},
+    {20, 160, 160, 8, -105, 5840, 930},
+    {20, 160, 160, 8, -105, 6000, 930},
+    {20, 160, 160, 8, -105, 6160, 930},
+    {20, 160, 160, 8, -105, 6320, 930},
+    {20, 160, 160, 8, -105, 6480, 930},
+    {20, 160, 160, 8, -105, 6640, 930},
+    {20, 160, 160, 8, -105, 6800, 930},
+    {20, 160, 160, 8, -105, 6960, 930},
+    {20, 40, 160, 8, -105, 3120, 930},
+    {20, 40, 160, 8, -105, 3280, 930},
+    {20, 40, 160, 8, -105, 3440, 930},
+    {20, 40, 160, 8, -105, 3600, 930},
+    {20, 40, 160, 8, -105, 3760, 930},
+    {20, 40, 160, 8, -105, 3920, 930},
+    {20, 40, 160, 8, -105, 4080, 930},
+    {20, 40, 160, 8, -105, 4240, 930},
+    {20, 40, 160, 8, -105, 4400, 930},
+    {20, 40, 160, 8, -105, 4560, 930},
+    {20, 40, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 3760, 930},
+    {20, 80, 160, 8, -105, 3920, 930},
+    {20, 80, 160, 8, -105, 4080, 930},
+    {20, 80, 160, 8, -105, 4240, 930},
+    {20, 80, 160, 8, -105, 4400, 930},
+    {20, 80, 160, 8, -105, 4560, 930},
+    {20, 80, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 4880, 930},
+    {20, 80, 160, 8, -105, 5040, 930},
+    {20, 80, 160, 8, -105, 5200, 930},
+    {20, 80, 160, 8, -105, 5360, 930},
+    {20, 53, 160, 8, -105, 3920, 940},
+    {20, 53, 160, 8, -105, 4080, 940},
+    {20, 53, 160, 8, -105, 4240, 940},
+    {20, 53, 160, 8, -105, 4400, 940},
+    {20, 53, 160, 8, -105, 4560, 940},
+    {20, 53, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 4880, 940},
+    {20, 53, 160, 8, -105, 5040, 940},
+    {20, 53, 160, 8, -105, 5200, 940},
+    {20, 53, 160, 8, -105, 5360, 940},
+    {20, 53, 160, 8, -105, 5520, 940},
+    {20, 106, 160, 8, -105, 5360, 940},
+    {20, 106, 160, 8, -105, 5520, 940},
+    {20, 106, 160, 8, -105, 5680, 940},
+    {20, 106, 160, 8, -105, 5840, 940},
+    {20, 106, 160, 8, -105, 6000, 940},
+    {20, 106, 160, 8, -105, 6160, 940},
+    {20, 106, 160, 8, -105, 6320, 940},
+    {20, 106, 160, 8, -105, 6480, 940},
+    {20, 106, 160, 8, -105, 6640, 940},
+    {20, 106, 160, 8, -105, 6800, 940},
+    {20, 106, 160, 8, -105, 6960, 940},
+    {20, 26, 160, 8, -105, 3120, 940},
+    {20, 26, 160, 8, -105, 3280, 940},
+    {20, 26, 160, 8, -105, 3440, 940},
+    {20, 26, 160, 8, -105, 3600, 940},
+    {20, 26, 160, 8, -105, 3760, 940},
+    {20, 26, 160, 8, -105, 3920, 940},
+    {20, 26, 160, 8, -105, 4080, 940},
+    {20, 26, 160, 8, -105, 4240, 940},
+    {20, 26, 160, 8, -105, 4400, 940},
+    {20, 26, 160, 8, -105, 4560, 940},
+    {20, 26, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 3760, 940},
+    {20, 53, 160, 8, -105, 3920, 940},
+    {20, 53, 160, 8, -105, 4080, 940},
+    {20, 53, 160, 8, -105, 4240, 940},
+    {20, 53, 160, 8, -105, 4400, 940},
+    {20, 53, 160, 8, -105, 4560, 940},
+    {20, 53, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 4880, 940},
+    {20, 53, 160, 8, -105, 5040, 940},
+    {20, 53, 160, 8, -105, 5200, 940},
+    {20, 53, 160, 8, -105, 5360, 940},
+    {20, 40, 160, 8, -105, 3920, 940},
+    {20, 40, 160, 8, -105, 4080, 940},
+    {20, 40, 160, 8, -105, 4240, 940},
+    {20, 40, 160, 8, -105, 4400, 940},
+    {20, 40, 160, 8, -105, 4560, 940},
+    {20, 40, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 4880, 940},
+    {20, 40, 160, 8, -105, 5040, 940},
+    {20, 40, 160, 8, -105, 5200, 940},
+    {20, 40, 160, 8, -105, 5360, 940},
+    {20, 40, 160, 8, -105, 5520, 940},
+    {20, 80, 160, 8, -105, 5360, 940},
+    {20, 80, 160, 8, -105, 5520, 940},
+    {20, 80, 160, 8, -105, 5680, 940},
+    {20, 80, 160, 8, -105, 5840, 940},
+    {20, 80, 160, 8, -105, 6000, 940},
+    {20, 80, 160, 8, -105, 6160, 940},
+    {20, 80, 160, 8, -105, 6320, 940},
+    {20, 80, 160, 8, -105, 6480, 940},
+    {20, 80, 160, 8, -105, 6640, 940},
+    {20, 80, 160, 8, -105, 6800, 940},
+    {20, 80, 160, 8, -105, 6960, 940},
+    {20, 20, 160, 8, -105, 3120, 940},
+    {20, 20, 160, 8, -105, 3280, 940},
+    {20, 20, 160, 8, -105, 3440, 940},
+    {20, 20, 160, 8, -105, 3600, 940},
+    {20, 20, 160, 8, -105, 3760, 940},
+    {20, 20, 160, 8, -105, 3920, 940},
+    {20, 20, 160, 8, -105, 4080, 940},
+    {20, 20, 160, 8, -105, 4240, 940},
+    {20, 20, 160, 8, -105, 4400, 940},
+    {20, 20, 160, 8, -105, 4560, 940},
+    {20, 20, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 3760, 940},
+    {20, 40, 160, 8, -105, 3920, 940},
+    {20, 40, 160, 8, -105, 4080, 940},
+    {20, 40, 160, 8, -105, 4240, 940},
+    {20, 40, 160, 8, -105, 4400, 940},
+    {20, 40, 160, 8, -105, 4560, 940},
+    {20, 40, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 4880, 940},
+    {20, 40, 160, 8, -105, 5040, 940},
+    {20, 40, 160, 8, -105, 5200, 940},
+    {20, 40, 160, 8, -105, 5360, 940},
+    {20, 26, 160, 8, -105, 3920, 970},
+    {20, 26, 160, 8, -105, 4080, 970},
+    {20, 26, 160, 8, -105, 4240, 970},
+    {20, 26, 160, 8, -105, 4400, 970},
+    {20, 26, 160, 8, -105, 4560, 970},
+    {20, 26, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 4880, 970},
+    {20, 26, 160, 8, -105, 5040, 970},
+    {20, 26, 160, 8, -105, 5200, 970},
+    {20, 26, 160, 8, -105, 5360, 970},
+    {20, 26, 160, 8, -105, 5520, 970},
+    {20, 53, 160, 8, -105, 5360, 970},
+    {20, 53, 160, 8, -105, 5520, 970},
+    {20, 53, 160, 8, -105, 5680, 970},
+    {20, 53, 160, 8, -105, 5840, 970},
+    {20, 53, 160, 8, -105, 6000, 970},
+    {20, 53, 160, 8, -105, 6160, 970},
+    {20, 53, 160, 8, -105, 6320, 970},
+    {20, 53, 160, 8, -105, 6480, 970},
+    {20, 53, 160, 8, -105, 6640, 970},
+    {20, 53, 160, 8, -105, 6800, 970},
+    {20, 53, 160, 8, -105, 6960, 970},
+    {20, 13, 160, 8, -105, 3120, 970},
+    {20, 13, 160, 8, -105, 3280, 970},
+    {20, 13, 160, 8, -105, 3440, 970},
+    {20, 13, 160, 8, -105, 3600, 970},
+    {20, 13, 160, 8, -105, 3760, 970},
+    {20, 13, 160, 8, -105, 3920, 970},
+    {20, 13, 160, 8, -105, 4080, 970},
+    {20, 13, 160, 8, -105, 4240, 970},
+    {20, 13, 160, 8, -105, 4400, 970},
+    {20, 13, 160, 8, -105, 4560, 970},
+    {20, 13, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 3760, 970},
+    {20, 26, 160, 8, -105, 3920, 970},
+    {20, 26, 160, 8, -105, 4080, 970},
+    {20, 26, 160, 8, -105, 4240, 970},
+    {20, 26, 160, 8, -105, 4400, 970},
+    {20, 26, 160, 8, -105, 4560, 970},
+    {20, 26, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 4880, 970},
+    {20, 26, 160, 8, -105, 5040, 970},
+    {20, 26, 160, 8, -105, 5200, 970},
+    {20, 26, 160, 8, -105, 5360, 970},
+    {20, 20, 160, 8, -105, 3920, 975},
+    {20, 20, 160, 8, -105, 4080, 975},
+    {20, 20, 160, 8, -105, 4240, 975},
+    {20, 20, 160, 8, -105, 4400, 975},
+    {20, 20, 160, 8, -105, 4560, 975},
+    {20, 20, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 4880, 975},
+    {20, 20, 160, 8, -105, 5040, 975},
+    {20, 20, 160, 8, -105, 5200, 975},
+    {20, 20, 160, 8, -105, 5360, 975},
+    {20, 20, 160, 8, -105, 5520, 975},
+    {20, 40, 160, 8, -105, 5360, 975},
+    {20, 40, 160, 8, -105, 5520, 975},
+    {20, 40, 160, 8, -105, 5680, 975},
+    {20, 40, 160, 8, -105, 5840, 975},
+    {20, 40, 160, 8, -105, 6000, 975},
+    {20, 40, 160, 8, -105, 6160, 975},
+    {20, 40, 160, 8, -105, 6320, 975},
+    {20, 40, 160, 8, -105, 6480, 975},
+    {20, 40, 160, 8, -105, 6640, 975},
+    {20, 40, 160, 8, -105, 6800, 975},
+    {20, 40, 160, 8, -105, 6960, 975},
+    {20, 10, 160, 8, -105, 3120, 975},
+    {20, 10, 160, 8, -105, 3280, 975},
+    {20, 10, 160, 8, -105, 3440, 975},
+    {20, 10, 160, 8, -105, 3600, 975},
+    {20, 10, 160, 8, -105, 3760, 975},
+    {20, 10, 160, 8, -105, 3920, 975},
+    {20, 10, 160, 8, -105, 4080, 975},
+    {20, 10, 160, 8, -105, 4240, 975},
+    {20, 10, 160, 8, -105, 4400, 975},
+    {20, 10, 160, 8, -105, 4560, 975},
+    {20, 10, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 3760, 975},
+    {20, 20, 160, 8, -105, 3920, 975},
+    {20, 20, 160, 8, -105, 4080, 975},
+    {20, 20, 160, 8, -105, 4240, 975},
+    {20, 20, 160, 8, -105, 4400, 975},
+    {20, 20, 160, 8, -105, 4560, 975},
+    {20, 20, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 4880, 975},
+    {20, 20, 160, 8, -105, 5040, 975},
+    {20, 20, 160, 8, -105, 5200, 975},
+    {20, 20, 160, 8, -105, 5360, 975},
+    {120, 80, 960, 8, -105, 4800, 980},
+    {120, 80, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4560, 980},
+    {120, 40, 960, 8, -105, 4680, 980},
+    {120, 20, 960, 8, -105, 4440, 980},
+    {120, 20, 960, 8, -105, 4560, 980},
+    {120, 10, 960, 8, -105, 4320, 980},
+    {120, 10, 960, 8, -105, 4440, 980},
+    {120, 6, 960, 8, -105, 4320, 980},
+    {120, 6, 960, 8, -105, 4440, 980},
+    {120, 5, 960, 8, -105, 4320, 980},
+    {120, 5, 960, 8, -105, 4440, 980},
+    {120, 3, 960, 8, -105, 4320, 980},
+    {120, 3, 960, 8, -105, 4440, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 6000, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5400, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 5160, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 5040, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 13, 960, 8, -105, 4920, 980},
+    {120, 10, 960, 8, -105, 4680, 980},
+    {120, 10, 960, 8, -105, 4920, 980},
+    {120, 6, 960, 8, -105, 4680, 980},
+    {120, 6, 960, 8, -105, 4920, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 666, 960, 8, -105, 9240, 980},
+    {120, 666, 960, 8, -105, 9240, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 53, 960, 8, -105, 5040, 980},
+    {120, 53, 960, 8, -105, 5040, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {320, 1280, 1280, 4, -105, 34880, 1190},
+    {320, 640, 1280, 4, -105, 29440, 1190},
+    {320, 320, 1280, 4, -105, 26880, 1190},
+    {320, 160, 1280, 4, -105, 25600, 1190},
+    {320, 160, 1280, 4, -105, 25600, 1190},
+    {160, 640, 640, 4, -105, 18400, 1070},
+    {160, 320, 640, 4, -105, 15680, 1070},
+    {160, 160, 640, 4, -105, 14400, 1070},
+    {160, 80, 640, 4, -105, 13760, 1070},
+    {160, 80, 640, 4, -105, 13760, 1070},
+    {64, 256, 512, 8, -105, 10304, 999},
+    {64, 128, 512, 8, -105, 9216, 999},
+    {64, 64, 512, 8, -105, 8704, 999},
+    {64, 32, 512, 8, -105, 8448, 999},
+    {64, 16, 512, 8, -105, 8320, 999},
+    {64, 256, 512, 8, -105, 10304, 1004},
+    {64, 128, 512, 8, -105, 9216, 1004},
+    {64, 64, 512, 8, -105, 8704, 1004},
+    {64, 32, 512, 8, -105, 8448, 1004},
+    {64, 8, 512, 8, -105, 8256, 1004},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 16, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {20, 160, 160, 8, -105, 3920, 872},
+    {20, 160, 160, 8, -105, 4080, 872},
+    {20, 160, 160, 8, -105, 4240, 872},
+    {20, 160, 160, 8, -105, 4400, 872},
+    {20, 160, 160, 8, -105, 4560, 872},
+    {20, 160, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 4880, 872},
+    {20, 160, 160, 8, -105, 5040, 872},
+    {20, 160, 160, 8, -105, 5200, 872},
+    {20, 160, 160, 8, -105, 5360, 872},
+    {20, 160, 160, 8, -105, 5520, 872},
+    {20, 320, 160, 8, -105, 5360, 872},
+    {20, 320, 160, 8, -105, 5520, 872},
+    {20, 320, 160, 8, -105, 5680, 872},
+    {20, 320, 160, 8, -105, 5840, 872},
+    {20, 320, 160, 8, -105, 6000, 872},
+    {20, 320, 160, 8, -105, 6160, 872},
+    {20, 320, 160, 8, -105, 6320, 872},
+    {20, 320, 160, 8, -105, 6480, 872},
+    {20, 320, 160, 8, -105, 6640, 872},
+    {20, 320, 160, 8, -105, 6800, 872},
+    {20, 320, 160, 8, -105, 6960, 872},
+    {20, 80, 160, 8, -105, 3120, 872},
+    {20, 80, 160, 8, -105, 3280, 872},
+    {20, 80, 160, 8, -105, 3440, 872},
+    {20, 80, 160, 8, -105, 3600, 872},
+    {20, 80, 160, 8, -105, 3760, 872},
+    {20, 80, 160, 8, -105, 3920, 872},
+    {20, 80, 160, 8, -105, 4080, 872},
+    {20, 80, 160, 8, -105, 4240, 872},
+    {20, 80, 160, 8, -105, 4400, 872},
+    {20, 80, 160, 8, -105, 4560, 872},
+    {20, 80, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 3760, 872},
+    {20, 160, 160, 8, -105, 3920, 872},
+    {20, 160, 160, 8, -105, 4080, 872},
+    {20, 160, 160, 8, -105, 4240, 872},
+    {20, 160, 160, 8, -105, 4400, 872},
+    {20, 160, 160, 8, -105, 4560, 872},
+    {20, 160, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 4880, 872},
+    {20, 160, 160, 8, -105, 5040, 872},
+    {20, 160, 160, 8, -105, 5200, 872},
+    {20, 160, 160, 8, -105, 5360, 872},
+    {20, 80, 160, 8, -105, 3920, 930},
+    {20, 80, 160, 8, -105, 4080, 930},
+    {20, 80, 160, 8, -105, 4240, 930},
+    {20, 80, 160, 8, -105, 4400, 930},
+    {20, 80, 160, 8, -105, 4560, 930},
+    {20, 80, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 4880, 930},
+    {20, 80, 160, 8, -105, 5040, 930},
+    {20, 80, 160, 8, -105, 5200, 930},
+    {20, 80, 160, 8, -105, 5360, 930},
+    {20, 80, 160, 8, -105, 5520, 930},
+    {20, 160, 160, 8, -105, 5360, 930},
+    {20, 160, 160, 8, -105, 5520, 930},
+    {20, 160, 160, 8, -105, 5680, 930},
+    {20, 160, 160, 8, -105, 5840, 930},
+    {20, 160, 160, 8, -105, 6000, 930},
+    {20, 160, 160, 8, -105, 6160, 930},
+    {20, 160, 160, 8, -105, 6320, 930},
+    {20, 160, 160, 8, -105, 6480, 930},
+    {20, 160, 160, 8, -105, 6640, 930},
+    {20, 160, 160, 8, -105, 6800, 930},
+    {20, 160, 160, 8, -105, 6960, 930},
+    {20, 40, 160, 8, -105, 3120, 930},
+    {20, 40, 160, 8, -105, 3280, 930},
+    {20, 40, 160, 8, -105, 3440, 930},
+    {20, 40, 160, 8, -105, 3600, 930},
+    {20, 40, 160, 8, -105, 3760, 930},
+    {20, 40, 160, 8, -105, 3920, 930},
+    {20, 40, 160, 8, -105, 4080, 930},
+    {20, 40, 160, 8, -105, 4240, 930},
+    {20, 40, 160, 8, -105, 4400, 930},
+    {20, 40, 160, 8, -105, 4560, 930},
+    {20, 40, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 3760, 930},
+    {20, 80, 160, 8, -105, 3920, 930},
+    {20, 80, 160, 8, -105, 4080, 930},
+    {20, 80, 160, 8, -105, 4240, 930},
+    {20, 80, 160, 8, -105, 4400, 930},
+    {20, 80, 160, 8, -105, 4560, 930},
+    {20, 80, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 4880, 930},
+    {20, 80, 160, 8, -105, 5040, 930},
+    {20, 80, 160, 8, -105, 5200, 930},
+    {20, 80, 160, 8, -105, 5360, 930},
+    {20, 53, 160, 8, -105, 3920, 940},
+    {20, 53, 160, 8, -105, 4080, 940},
+    {20, 53, 160, 8, -105, 4240, 940},
+    {20, 53, 160, 8, -105, 4400, 940},
+    {20, 53, 160, 8, -105, 4560, 940},
+    {20, 53, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 4880, 940},
+    {20, 53, 160, 8, -105, 5040, 940},
+    {20, 53, 160, 8, -105, 5200, 940},
+    {20, 53, 160, 8, -105, 5360, 940},
+    {20, 53, 160, 8, -105, 5520, 940},
+    {20, 106, 160, 8, -105, 5360, 940},
+    {20, 106, 160, 8, -105, 5520, 940},
+    {20, 106, 160, 8, -105, 5680, 940},
+    {20, 106, 160, 8, -105, 5840, 940},
+    {20, 106, 160, 8, -105, 6000, 940},
+    {20, 106, 160, 8, -105, 6160, 940},
+    {20, 106, 160, 8, -105, 6320, 940},
+    {20, 106, 160, 8, -105, 6480, 940},
+    {20, 106, 160, 8, -105, 6640, 940},
+    {20, 106, 160, 8, -105, 6800, 940},
+    {20, 106, 160, 8, -105, 6960, 940},
+    {20, 26, 160, 8, -105, 3120, 940},
+    {20, 26, 160, 8, -105, 3280, 940},
+    {20, 26, 160, 8, -105, 3440, 940},
+    {20, 26, 160, 8, -105, 3600, 940},
+    {20, 26, 160, 8, -105, 3760, 940},
+    {20, 26, 160, 8, -105, 3920, 940},
+    {20, 26, 160, 8, -105, 4080, 940},
+    {20, 26, 160, 8, -105, 4240, 940},
+    {20, 26, 160, 8, -105, 4400, 940},
+    {20, 26, 160, 8, -105, 4560, 940},
+    {20, 26, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 3760, 940},
+    {20, 53, 160, 8, -105, 3920, 940},
+    {20, 53, 160, 8, -105, 4080, 940},
+    {20, 53, 160, 8, -105, 4240, 940},
+    {20, 53, 160, 8, -105, 4400, 940},
+    {20, 53, 160, 8, -105, 4560, 940},
+    {20, 53, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 4880, 940},
+    {20, 53, 160, 8, -105, 5040, 940},
+    {20, 53, 160, 8, -105, 5200, 940},
+    {20, 53, 160, 8, -105, 5360, 940},
+    {20, 40, 160, 8, -105, 3920, 940},
+    {20, 40, 160, 8, -105, 4080, 940},
+    {20, 40, 160, 8, -105, 4240, 940},
+    {20, 40, 160, 8, -105, 4400, 940},
+    {20, 40, 160, 8, -105, 4560, 940},
+    {20, 40, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 4880, 940},
+    {20, 40, 160, 8, -105, 5040, 940},
+    {20, 40, 160, 8, -105, 5200, 940},
+    {20, 40, 160, 8, -105, 5360, 940},
+    {20, 40, 160, 8, -105, 5520, 940},
+    {20, 80, 160, 8, -105, 5360, 940},
+    {20, 80, 160, 8, -105, 5520, 940},
+    {20, 80, 160, 8, -105, 5680, 940},
+    {20, 80, 160, 8, -105, 5840, 940},
+    {20, 80, 160, 8, -105, 6000, 940},
+    {20, 80, 160, 8, -105, 6160, 940},
+    {20, 80, 160, 8, -105, 6320, 940},
+    {20, 80, 160, 8, -105, 6480, 940},
+    {20, 80, 160, 8, -105, 6640, 940},
+    {20, 80, 160, 8, -105, 6800, 940},
+    {20, 80, 160, 8, -105, 6960, 940},
+    {20, 20, 160, 8, -105, 3120, 940},
+    {20, 20, 160, 8, -105, 3280, 940},
+    {20, 20, 160, 8, -105, 3440, 940},
+    {20, 20, 160, 8, -105, 3600, 940},
+    {20, 20, 160, 8, -105, 3760, 940},
+    {20, 20, 160, 8, -105, 3920, 940},
+    {20, 20, 160, 8, -105, 4080, 940},
+    {20, 20, 160, 8, -105, 4240, 940},
+    {20, 20, 160, 8, -105, 4400, 940},
+    {20, 20, 160, 8, -105, 4560, 940},
+    {20, 20, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 3760, 940},
+    {20, 40, 160, 8, -105, 3920, 940},
+    {20, 40, 160, 8, -105, 4080, 940},
+    {20, 40, 160, 8, -105, 4240, 940},
+    {20, 40, 160, 8, -105, 4400, 940},
+    {20, 40, 160, 8, -105, 4560, 940},
+    {20, 40, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 4880, 940},
+    {20, 40, 160, 8, -105, 5040, 940},
+    {20, 40, 160, 8, -105, 5200, 940},
+    {20, 40, 160, 8, -105, 5360, 940},
+    {20, 26, 160, 8, -105, 3920, 970},
+    {20, 26, 160, 8, -105, 4080, 970},
+    {20, 26, 160, 8, -105, 4240, 970},
+    {20, 26, 160, 8, -105, 4400, 970},
+    {20, 26, 160, 8, -105, 4560, 970},
+    {20, 26, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 4880, 970},
+    {20, 26, 160, 8, -105, 5040, 970},
+    {20, 26, 160, 8, -105, 5200, 970},
+    {20, 26, 160, 8, -105, 5360, 970},
+    {20, 26, 160, 8, -105, 5520, 970},
+    {20, 53, 160, 8, -105, 5360, 970},
+    {20, 53, 160, 8, -105, 5520, 970},
+    {20, 53, 160, 8, -105, 5680, 970},
+    {20, 53, 160, 8, -105, 5840, 970},
+    {20, 53, 160, 8, -105, 6000, 970},
+    {20, 53, 160, 8, -105, 6160, 970},
+    {20, 53, 160, 8, -105, 6320, 970},
+    {20, 53, 160, 8, -105, 6480, 970},
+    {20, 53, 160, 8, -105, 6640, 970},
+    {20, 53, 160, 8, -105, 6800, 970},
+    {20, 53, 160, 8, -105, 6960, 970},
+    {20, 13, 160, 8, -105, 3120, 970},
+    {20, 13, 160, 8, -105, 3280, 970},
+    {20, 13, 160, 8, -105, 3440, 970},
+    {20, 13, 160, 8, -105, 3600, 970},
+    {20, 13, 160, 8, -105, 3760, 970},
+    {20, 13, 160, 8, -105, 3920, 970},
+    {20, 13, 160, 8, -105, 4080, 970},
+    {20, 13, 160, 8, -105, 4240, 970},
+    {20, 13, 160, 8, -105, 4400, 970},
+    {20, 13, 160, 8, -105, 4560, 970},
+    {20, 13, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 3760, 970},
+    {20, 26, 160, 8, -105, 3920, 970},
+    {20, 26, 160, 8, -105, 4080, 970},
+    {20, 26, 160, 8, -105, 4240, 970},
+    {20, 26, 160, 8, -105, 4400, 970},
+    {20, 26, 160, 8, -105, 4560, 970},
+    {20, 26, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 4880, 970},
+    {20, 26, 160, 8, -105, 5040, 970},
+    {20, 26, 160, 8, -105, 5200, 970},
+    {20, 26, 160, 8, -105, 5360, 970},
+    {20, 20, 160, 8, -105, 3920, 975},
+    {20, 20, 160, 8, -105, 4080, 975},
+    {20, 20, 160, 8, -105, 4240, 975},
+    {20, 20, 160, 8, -105, 4400, 975},
+    {20, 20, 160, 8, -105, 4560, 975},
+    {20, 20, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 4880, 975},
+    {20, 20, 160, 8, -105, 5040, 975},
+    {20, 20, 160, 8, -105, 5200, 975},
+    {20, 20, 160, 8, -105, 5360, 975},
+    {20, 20, 160, 8, -105, 5520, 975},
+    {20, 40, 160, 8, -105, 5360, 975},
+    {20, 40, 160, 8, -105, 5520, 975},
+    {20, 40, 160, 8, -105, 5680, 975},
+    {20, 40, 160, 8, -105, 5840, 975},
+    {20, 40, 160, 8, -105, 6000, 975},
+    {20, 40, 160, 8, -105, 6160, 975},
+    {20, 40, 160, 8, -105, 6320, 975},
+    {20, 40, 160, 8, -105, 6480, 975},
+    {20, 40, 160, 8, -105, 6640, 975},
+    {20, 40, 160, 8, -105, 6800, 975},
+    {20, 40, 160, 8, -105, 6960, 975},
+    {20, 10, 160, 8, -105, 3120, 975},
+    {20, 10, 160, 8, -105, 3280, 975},
+    {20, 10, 160, 8, -105, 3440, 975},
+    {20, 10, 160, 8, -105, 3600, 975},
+    {20, 10, 160, 8, -105, 3760, 975},
+    {20, 10, 160, 8, -105, 3920, 975},
+    {20, 10, 160, 8, -105, 4080, 975},
+    {20, 10, 160, 8, -105, 4240, 975},
+    {20, 10, 160, 8, -105, 4400, 975},
+    {20, 10, 160, 8, -105, 4560, 975},
+    {20, 10, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 3760, 975},
+    {20, 20, 160, 8, -105, 3920, 975},
+    {20, 20, 160, 8, -105, 4080, 975},
+    {20, 20, 160, 8, -105, 4240, 975},
+    {20, 20, 160, 8, -105, 4400, 975},
+    {20, 20, 160, 8, -105, 4560, 975},
+    {20, 20, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 4880, 975},
+    {20, 20, 160, 8, -105, 5040, 975},
+    {20, 20, 160, 8, -105, 5200, 975},
+    {20, 20, 160, 8, -105, 5360, 975},
+    {120, 80, 960, 8, -105, 4800, 980},
+    {120, 80, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4560, 980},
+    {120, 40, 960, 8, -105, 4680, 980},
+    {120, 20, 960, 8, -105, 4440, 980},
+    {120, 20, 960, 8, -105, 4560, 980},
+    {120, 10, 960, 8, -105, 4320, 980},
+    {120, 10, 960, 8, -105, 4440, 980},
+    {120, 6, 960, 8, -105, 4320, 980},
+    {120, 6, 960, 8, -105, 4440, 980},
+    {120, 5, 960, 8, -105, 4320, 980},
+    {120, 5, 960, 8, -105, 4440, 980},
+    {120, 3, 960, 8, -105, 4320, 980},
+    {120, 3, 960, 8, -105, 4440, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 6000, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5400, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 5160, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 5040, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 13, 960, 8, -105, 4920, 980},
+    {120, 10, 960, 8, -105, 4680, 980},
+    {120, 10, 960, 8, -105, 4920, 980},
+    {120, 6, 960, 8, -105, 4680, 980},
+    {120, 6, 960, 8, -105, 4920, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 666, 960, 8, -105, 9240, 980},
+    {120, 666, 960, 8, -105, 9240, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 53, 960, 8, -105, 5040, 980},
+    {120, 53, 960, 8, -105, 5040, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {320, 1280, 2560, 8, -105, 36160, 1190},
+    {320, 640, 2560, 8, -105, 30720, 1190},
+    {320, 320, 2560, 8, -105, 28160, 1190},
+    {320, 160, 2560, 8, -105, 26880, 1190},
+    {320, 160, 2560, 8, -105, 26880, 1190},
+    {160, 640, 1280, 8, -105, 19040, 1070},
+    {160, 320, 1280, 8, -105, 16320, 1070},
+    {160, 160, 1280, 8, -105, 15040, 1070},
+    {160, 80, 1280, 8, -105, 14400, 1070},
+    {160, 80, 1280, 8, -105, 14400, 1070},
+    {64, 256, 512, 8, -105, 10304, 999},
+    {64, 128, 512, 8, -105, 9216, 999},
+    {64, 64, 512, 8, -105, 8704, 999},
+    {64, 32, 512, 8, -105, 8448, 999},
+    {64, 16, 512, 8, -105, 8320, 999},
+    {64, 256, 512, 8, -105, 10304, 1004},
+    {64, 128, 512, 8, -105, 9216, 1004},
+    {64, 64, 512, 8, -105, 8704, 1004},
+    {64, 32, 512, 8, -105, 8448, 1004},
+    {64, 8, 512, 8, -105, 8256, 1004},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 16, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {20, 160, 2, 0, -105, 3760, 872},
+    {20, 160, 8, 0, -105, 3920, 872},
+    {20, 160, 512, 25, -105, 4580, 872},
+    {20, 160, 2, 0, -105, 4240, 872},
+    {20, 160, 8, 0, -105, 4400, 872},
+    {20, 160, 512, 25, -105, 5060, 872},
+    {20, 160, 2, 0, -105, 4720, 872},
+    {20, 160, 8, 0, -105, 4880, 872},
+    {20, 160, 512, 25, -105, 5540, 872},
+    {20, 160, 2, 0, -105, 5200, 872},
+    {20, 160, 8, 0, -105, 5360, 872},
+    {20, 320, 512, 25, -105, 5700, 872},
+    {20, 320, 2, 0, -105, 5360, 872},
+    {20, 320, 8, 0, -105, 5520, 872},
+    {20, 320, 512, 25, -105, 6180, 872},
+    {20, 320, 2, 0, -105, 5840, 872},
+    {20, 320, 8, 0, -105, 6000, 872},
+    {20, 320, 512, 25, -105, 6660, 872},
+    {20, 320, 2, 0, -105, 6320, 872},
+    {20, 320, 8, 0, -105, 6480, 872},
+    {20, 320, 512, 25, -105, 7140, 872},
+    {20, 320, 2, 0, -105, 6800, 872},
+    {20, 80, 8, 0, -105, 2960, 872},
+    {20, 80, 512, 25, -105, 3620, 872},
+    {20, 80, 2, 0, -105, 3280, 872},
+    {20, 80, 8, 0, -105, 3440, 872},
+    {20, 80, 512, 25, -105, 4100, 872},
+    {20, 80, 2, 0, -105, 3760, 872},
+    {20, 80, 8, 0, -105, 3920, 872},
+    {20, 80, 512, 25, -105, 4580, 872},
+    {20, 80, 2, 0, -105, 4240, 872},
+    {20, 80, 8, 0, -105, 4400, 872},
+    {20, 80, 512, 25, -105, 5060, 872},
+    {20, 160, 2, 0, -105, 3600, 872},
+    {20, 160, 8, 0, -105, 3760, 872},
+    {20, 160, 512, 25, -105, 4420, 872},
+    {20, 160, 2, 0, -105, 4080, 872},
+    {20, 160, 8, 0, -105, 4240, 872},
+    {20, 160, 512, 25, -105, 4900, 872},
+    {20, 160, 2, 0, -105, 4560, 872},
+    {20, 160, 8, 0, -105, 4720, 872},
+    {20, 160, 512, 25, -105, 5380, 872},
+    {20, 160, 2, 0, -105, 5040, 872},
+    {20, 160, 8, 0, -105, 5200, 872},
+    {20, 80, 512, 25, -105, 4260, 930},
+    {20, 80, 2, 0, -105, 3920, 930},
+    {20, 80, 8, 0, -105, 4080, 930},
+    {20, 80, 512, 25, -105, 4740, 930},
+    {20, 80, 2, 0, -105, 4400, 930},
+    {20, 80, 8, 0, -105, 4560, 930},
+    {20, 80, 512, 25, -105, 5220, 930},
+    {20, 80, 2, 0, -105, 4880, 930},
+    {20, 80, 8, 0, -105, 5040, 930},
+    {20, 80, 512, 25, -105, 5700, 930},
+    {20, 80, 2, 0, -105, 5360, 930},
+    {20, 160, 8, 0, -105, 5200, 930},
+    {20, 160, 512, 25, -105, 5860, 930},
+    {20, 160, 2, 0, -105, 5520, 930},
+    {20, 160, 8, 0, -105, 5680, 930},
+    {20, 160, 512, 25, -105, 6340, 930},
+    {20, 160, 2, 0, -105, 6000, 930},
+    {20, 160, 8, 0, -105, 6160, 930},
+    {20, 160, 512, 25, -105, 6820, 930},
+    {20, 160, 2, 0, -105, 6480, 930},
+    {20, 160, 8, 0, -105, 6640, 930},
+    {20, 160, 512, 25, -105, 7300, 930},
+    {20, 40, 2, 0, -105, 2960, 930},
+    {20, 40, 8, 0, -105, 3120, 930},
+    {20, 40, 512, 25, -105, 3780, 930},
+    {20, 40, 2, 0, -105, 3440, 930},
+    {20, 40, 8, 0, -105, 3600, 930},
+    {20, 40, 512, 25, -105, 4260, 930},
+    {20, 40, 2, 0, -105, 3920, 930},
+    {20, 40, 8, 0, -105, 4080, 930},
+    {20, 40, 512, 25, -105, 4740, 930},
+    {20, 40, 2, 0, -105, 4400, 930},
+    {20, 40, 8, 0, -105, 4560, 930},
+    {20, 80, 512, 25, -105, 4100, 930},
+    {20, 80, 2, 0, -105, 3760, 930},
+    {20, 80, 8, 0, -105, 3920, 930},
+    {20, 80, 512, 25, -105, 4580, 930},
+    {20, 80, 2, 0, -105, 4240, 930},
+    {20, 80, 8, 0, -105, 4400, 930},
+    {20, 80, 512, 25, -105, 5060, 930},
+    {20, 80, 2, 0, -105, 4720, 930},
+    {20, 80, 8, 0, -105, 4880, 930},
+    {20, 80, 512, 25, -105, 5540, 930},
+    {20, 80, 2, 0, -105, 5200, 930},
+    {20, 53, 8, 0, -105, 3760, 940},
+    {20, 53, 512, 25, -105, 4420, 940},
+    {20, 53, 2, 0, -105, 4080, 940},
+    {20, 53, 8, 0, -105, 4240, 940},
+    {20, 53, 512, 25, -105, 4900, 940},
+    {20, 53, 2, 0, -105, 4560, 940},
+    {20, 53, 8, 0, -105, 4720, 940},
+    {20, 53, 512, 25, -105, 5380, 940},
+    {20, 53, 2, 0, -105, 5040, 940},
+    {20, 53, 8, 0, -105, 5200, 940},
+    {20, 53, 512, 25, -105, 5860, 940},
+    {20, 106, 2, 0, -105, 5200, 940},
+    {20, 106, 8, 0, -105, 5360, 940},
+    {20, 106, 512, 25, -105, 6020, 940},
+    {20, 106, 2, 0, -105, 5680, 940},
+    {20, 106, 8, 0, -105, 5840, 940},
+    {20, 106, 512, 25, -105, 6500, 940},
+    {20, 106, 2, 0, -105, 6160, 940},
+    {20, 106, 8, 0, -105, 6320, 940},
+    {20, 106, 512, 25, -105, 6980, 940},
+    {20, 106, 2, 0, -105, 6640, 940},
+    {20, 106, 8, 0, -105, 6800, 940},
+    {20, 26, 512, 25, -105, 3460, 940},
+    {20, 26, 2, 0, -105, 3120, 940},
+    {20, 26, 8, 0, -105, 3280, 940},
+    {20, 26, 512, 25, -105, 3940, 940},
+    {20, 26, 2, 0, -105, 3600, 940},
+    {20, 26, 8, 0, -105, 3760, 940},
+    {20, 26, 512, 25, -105, 4420, 940},
+    {20, 26, 2, 0, -105, 4080, 940},
+    {20, 26, 8, 0, -105, 4240, 940},
+    {20, 26, 512, 25, -105, 4900, 940},
+    {20, 26, 2, 0, -105, 4560, 940},
+    {20, 53, 8, 0, -105, 3600, 940},
+    {20, 53, 512, 25, -105, 4260, 940},
+    {20, 53, 2, 0, -105, 3920, 940},
+    {20, 53, 8, 0, -105, 4080, 940},
+    {20, 53, 512, 25, -105, 4740, 940},
+    {20, 53, 2, 0, -105, 4400, 940},
+    {20, 53, 8, 0, -105, 4560, 940},
+    {20, 53, 512, 25, -105, 5220, 940},
+    {20, 53, 2, 0, -105, 4880, 940},
+    {20, 53, 8, 0, -105, 5040, 940},
+    {20, 53, 512, 25, -105, 5700, 940},
+    {20, 40, 2, 0, -105, 3760, 940},
+    {20, 40, 8, 0, -105, 3920, 940},
+    {20, 40, 512, 25, -105, 4580, 940},
+    {20, 40, 2, 0, -105, 4240, 940},
+    {20, 40, 8, 0, -105, 4400, 940},
+    {20, 40, 512, 25, -105, 5060, 940},
+    {20, 40, 2, 0, -105, 4720, 940},
+    {20, 40, 8, 0, -105, 4880, 940},
+    {20, 40, 512, 25, -105, 5540, 940},
+    {20, 40, 2, 0, -105, 5200, 940},
+    {20, 40, 8, 0, -105, 5360, 940},
+    {20, 80, 512, 25, -105, 5700, 940},
+    {20, 80, 2, 0, -105, 5360, 940},
+    {20, 80, 8, 0, -105, 5520, 940},
+    {20, 80, 512, 25, -105, 6180, 940},
+    {20, 80, 2, 0, -105, 5840, 940},
+    {20, 80, 8, 0, -105, 6000, 940},
+    {20, 80, 512, 25, -105, 6660, 940},
+    {20, 80, 2, 0, -105, 6320, 940},
+    {20, 80, 8, 0, -105, 6480, 940},
+    {20, 80, 512, 25, -105, 7140, 940},
+    {20, 80, 2, 0, -105, 6800, 940},
+    {20, 20, 8, 0, -105, 2960, 940},
+    {20, 20, 512, 25, -105, 3620, 940},
+    {20, 20, 2, 0, -105, 3280, 940},
+    {20, 20, 8, 0, -105, 3440, 940},
+    {20, 20, 512, 25, -105, 4100, 940},
+    {20, 20, 2, 0, -105, 3760, 940},
+    {20, 20, 8, 0, -105, 3920, 940},
+    {20, 20, 512, 25, -105, 4580, 940},
+    {20, 20, 2, 0, -105, 4240, 940},
+    {20, 20, 8, 0, -105, 4400, 940},
+    {20, 20, 512, 25, -105, 5060, 940},
+    {20, 40, 2, 0, -105, 3600, 940},
+    {20, 40, 8, 0, -105, 3760, 940},
+    {20, 40, 512, 25, -105, 4420, 940},
+    {20, 40, 2, 0, -105, 4080, 940},
+    {20, 40, 8, 0, -105, 4240, 940},
+    {20, 40, 512, 25, -105, 4900, 940},
+    {20, 40, 2, 0, -105, 4560, 940},
+    {20, 40, 8, 0, -105, 4720, 940},
+    {20, 40, 512, 25, -105, 5380, 940},
+    {20, 40, 2, 0, -105, 5040, 940},
+    {20, 40, 8, 0, -105, 5200, 940},
+    {20, 26, 512, 25, -105, 4260, 970},
+    {20, 26, 2, 0, -105, 3920, 970},
+    {20, 26, 8, 0, -105, 4080, 970},
+    {20, 26, 512, 25, -105, 4740, 970},
+    {20, 26, 2, 0, -105, 4400, 970},
+    {20, 26, 8, 0, -105, 4560, 970},
+    {20, 26, 512, 25, -105, 5220, 970},
+    {20, 26, 2, 0, -105, 4880, 970},
+    {20, 26, 8, 0, -105, 5040, 970},
+    {20, 26, 512, 25, -105, 5700, 970},
+    {20, 26, 2, 0, -105, 5360, 970},
+    {20, 53, 8, 0, -105, 5200, 970},
+    {20, 53, 512, 25, -105, 5860, 970},
+    {20, 53, 2, 0, -105, 5520, 970},
+    {20, 53, 8, 0, -105, 5680, 970},
+    {20, 53, 512, 25, -105, 6340, 970},
+    {20, 53, 2, 0, -105, 6000, 970},
+    {20, 53, 8, 0, -105, 6160, 970},
+    {20, 53, 512, 25, -105, 6820, 970},
+    {20, 53, 2, 0, -105, 6480, 970},
+    {20, 53, 8, 0, -105, 6640, 970},
+    {20, 53, 512, 25, -105, 7300, 970},
+    {20, 13, 2, 0, -105, 2960, 970},
+    {20, 13, 8, 0, -105, 3120, 970},
+    {20, 13, 512, 25, -105, 3780, 970},
+    {20, 13, 2, 0, -105, 3440, 970},
+    {20, 13, 8, 0, -105, 3600, 970},
+    {20, 13, 512, 25, -105, 4260, 970},
+    {20, 13, 2, 0, -105, 3920, 970},
+    {20, 13, 8, 0, -105, 4080, 970},
+    {20, 13, 512, 25, -105, 4740, 970},
+    {20, 13, 2, 0, -105, 4400, 970},
+    {20, 13, 8, 0, -105, 4560, 970},
+    {20, 26, 512, 25, -105, 4100, 970},
+    {20, 26, 2, 0, -105, 3760, 970},
+    {20, 26, 8, 0, -105, 3920, 970},
+    {20, 26, 512, 25, -105, 4580, 970},
+    {20, 26, 2, 0, -105, 4240, 970},
+    {20, 26, 8, 0, -105, 4400, 970},
+    {20, 26, 512, 25, -105, 5060, 970},
+    {20, 26, 2, 0, -105, 4720, 970},
+    {20, 26, 8, 0, -105, 4880, 970},
+    {20, 26, 512, 25, -105, 5540, 970},
+    {20, 26, 2, 0, -105, 5200, 970},
+    {20, 20, 8, 0, -105, 3760, 975},
+    {20, 20, 512, 25, -105, 4420, 975},
+    {20, 20, 2, 0, -105, 4080, 975},
+    {20, 20, 8, 0, -105, 4240, 975},
+    {20, 20, 512, 25, -105, 4900, 975},
+    {20, 20, 2, 0, -105, 4560, 975},
+    {20, 20, 8, 0, -105, 4720, 975},
+    {20, 20, 512, 25, -105, 5380, 975},
+    {20, 20, 2, 0, -105, 5040, 975},
+    {20, 20, 8, 0, -105, 5200, 975},
+    {20, 20, 512, 25, -105, 5860, 975},
+    {20, 40, 2, 0, -105, 5200, 975},
+    {20, 40, 8, 0, -105, 5360, 975},
+    {20, 40, 512, 25, -105, 6020, 975},
+    {20, 40, 2, 0, -105, 5680, 975},
+    {20, 40, 8, 0, -105, 5840, 975},
+    {20, 40, 512, 25, -105, 6500, 975},
+    {20, 40, 2, 0, -105, 6160, 975},
+    {20, 40, 8, 0, -105, 6320, 975},
+    {20, 40, 512, 25, -105, 6980, 975},
+    {20, 40, 2, 0, -105, 6640, 975},
+    {20, 40, 8, 0, -105, 6800, 975},
+    {20, 10, 512, 25, -105, 3460, 975},
+    {20, 10, 2, 0, -105, 3120, 975},
+    {20, 10, 8, 0, -105, 3280, 975},
+    {20, 10, 512, 25, -105, 3940, 975},
+    {20, 10, 2, 0, -105, 3600, 975},
+    {20, 10, 8, 0, -105, 3760, 975},
+    {20, 10, 512, 25, -105, 4420, 975},
+    {20, 10, 2, 0, -105, 4080, 975},
+    {20, 10, 8, 0, -105, 4240, 975},
+    {20, 10, 512, 25, -105, 4900, 975},
+    {20, 10, 2, 0, -105, 4560, 975},
+    {20, 20, 8, 0, -105, 3600, 975},
+    {20, 20, 512, 25, -105, 4260, 975},
+    {20, 20, 2, 0, -105, 3920, 975},
+    {20, 20, 8, 0, -105, 4080, 975},
+    {20, 20, 512, 25, -105, 4740, 975},
+    {20, 20, 2, 0, -105, 4400, 975},
+    {20, 20, 8, 0, -105, 4560, 975},
+    {20, 20, 512, 25, -105, 5220, 975},
+    {20, 20, 2, 0, -105, 4880, 975},
+    {20, 20, 8, 0, -105, 5040, 975},
+    {20, 20, 512, 25, -105, 5700, 975},
+    {120, 80, 2, 0, -105, 3840, 980},
+    {120, 80, 8, 0, -105, 3960, 980},
+    {120, 40, 512, 4, -105, 4080, 980},
+    {120, 40, 2, 0, -105, 3720, 980},
+    {120, 20, 8, 0, -105, 3480, 980},
+    {120, 20, 512, 4, -105, 4080, 980},
+    {120, 10, 2, 0, -105, 3360, 980},
+    {120, 10, 8, 0, -105, 3480, 980},
+    {120, 6, 512, 4, -105, 3840, 980},
+    {120, 6, 2, 0, -105, 3480, 980},
+    {120, 5, 8, 0, -105, 3360, 980},
+    {120, 5, 512, 4, -105, 3960, 980},
+    {120, 3, 2, 0, -105, 3360, 980},
+    {120, 3, 8, 0, -105, 3480, 980},
+    {120, 160, 512, 4, -105, 5280, 980},
+    {120, 160, 2, 0, -105, 5040, 980},
+    {120, 80, 8, 0, -105, 4200, 980},
+    {120, 80, 512, 4, -105, 4920, 980},
+    {120, 40, 2, 0, -105, 3960, 980},
+    {120, 40, 8, 0, -105, 4200, 980},
+    {120, 20, 512, 4, -105, 4320, 980},
+    {120, 20, 2, 0, -105, 4080, 980},
+    {120, 13, 8, 0, -105, 3720, 980},
+    {120, 13, 512, 4, -105, 4440, 980},
+    {120, 10, 2, 0, -105, 3720, 980},
+    {120, 10, 8, 0, -105, 3960, 980},
+    {120, 6, 512, 4, -105, 4200, 980},
+    {120, 6, 2, 0, -105, 3960, 980},
+    {120, 320, 8, 0, -105, 5880, 980},
+    {120, 320, 512, 4, -105, 6360, 980},
+    {120, 160, 2, 0, -105, 4800, 980},
+    {120, 160, 8, 0, -105, 4800, 980},
+    {120, 80, 512, 4, -105, 4680, 980},
+    {120, 80, 2, 0, -105, 4200, 980},
+    {120, 40, 8, 0, -105, 3960, 980},
+    {120, 40, 512, 4, -105, 4440, 980},
+    {120, 26, 2, 0, -105, 3840, 980},
+    {120, 26, 8, 0, -105, 3840, 980},
+    {120, 20, 512, 4, -105, 4320, 980},
+    {120, 20, 2, 0, -105, 3840, 980},
+    {120, 13, 8, 0, -105, 3720, 980},
+    {120, 13, 512, 4, -105, 4200, 980},
+    {120, 666, 2, 0, -105, 8280, 980},
+    {120, 666, 8, 0, -105, 8280, 980},
+    {120, 320, 512, 4, -105, 6360, 980},
+    {120, 320, 2, 0, -105, 5880, 980},
+    {120, 160, 8, 0, -105, 4800, 980},
+    {120, 160, 512, 4, -105, 5280, 980},
+    {120, 80, 2, 0, -105, 4200, 980},
+    {120, 80, 8, 0, -105, 4200, 980},
+    {120, 53, 512, 4, -105, 4560, 980},
+    {120, 53, 2, 0, -105, 4080, 980},
+    {120, 40, 8, 0, -105, 3960, 980},
+    {120, 40, 512, 4, -105, 4440, 980},
+    {120, 26, 2, 0, -105, 3840, 980},
+    {120, 26, 8, 0, -105, 3840, 980},
+    {320, 1280, 512, 1, -105, 33920, 1190},
+    {320, 640, 2, 0, -105, 28160, 1190},
+    {320, 320, 8, 0, -105, 25600, 1190},
+    {320, 160, 512, 1, -105, 24640, 1190},
+    {320, 160, 2, 0, -105, 24320, 1190},
+    {160, 640, 8, 0, -105, 17760, 1070},
+    {160, 320, 512, 3, -105, 15520, 1070},
+    {160, 160, 2, 0, -105, 13760, 1070},
+    {160, 80, 8, 0, -105, 13120, 1070},
+    {160, 80, 512, 3, -105, 13600, 1070},
+    {64, 256, 2, 0, -105, 9792, 999},
+    {64, 128, 8, 0, -105, 8704, 999},
+    {64, 64, 512, 8, -105, 8704, 999},
+    {64, 32, 2, 0, -105, 7936, 999},
+    {64, 16, 8, 0, -105, 7808, 999},
+    {64, 256, 512, 8, -105, 10304, 1004},
+    {64, 128, 2, 0, -105, 8704, 1004},
+    {64, 64, 8, 0, -105, 8192, 1004},
+    {64, 32, 512, 8, -105, 8448, 1004},
+    {64, 8, 2, 0, -105, 7744, 1004},
+    {16, 32, 8, 0, -105, 864, 172},
+    {16, 8, 512, 32, -105, 864, 172},
+    {16, 32, 2, 0, -105, 864, 172},
+    {16, 8, 8, 0, -105, 864, 172},
+    {16, 32, 512, 32, -105, 864, 172},
+    {16, 16, 2, 0, -105, 864, 172},
+    {16, 32, 8, 0, -105, 864, 172},
+    {16, 8, 512, 32, -105, 864, 172},
+    {20, 160, 160, 8, -105, 3920, 872},
+    {20, 160, 160, 8, -105, 4080, 872},
+    {20, 160, 160, 8, -105, 4240, 872},
+    {20, 160, 160, 8, -105, 4400, 872},
+    {20, 160, 160, 8, -105, 4560, 872},
+    {20, 160, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 4880, 872},
+    {20, 160, 160, 8, -105, 5040, 872},
+    {20, 160, 160, 8, -105, 5200, 872},
+    {20, 160, 160, 8, -105, 5360, 872},
+    {20, 160, 160, 8, -105, 5520, 872},
+    {20, 320, 160, 8, -105, 5360, 872},
+    {20, 320, 160, 8, -105, 5520, 872},
+    {20, 320, 160, 8, -105, 5680, 872},
+    {20, 320, 160, 8, -105, 5840, 872},
+    {20, 320, 160, 8, -105, 6000, 872},
+    {20, 320, 160, 8, -105, 6160, 872},
+    {20, 320, 160, 8, -105, 6320, 872},
+    {20, 320, 160, 8, -105, 6480, 872},
+    {20, 320, 160, 8, -105, 6640, 872},
+    {20, 320, 160, 8, -105, 6800, 872},
+    {20, 320, 160, 8, -105, 6960, 872},
+    {20, 80, 160, 8, -105, 3120, 872},
+    {20, 80, 160, 8, -105, 3280, 872},
+    {20, 80, 160, 8, -105, 3440, 872},
+    {20, 80, 160, 8, -105, 3600, 872},
+    {20, 80, 160, 8, -105, 3760, 872},
+    {20, 80, 160, 8, -105, 3920, 872},
+    {20, 80, 160, 8, -105, 4080, 872},
+    {20, 80, 160, 8, -105, 4240, 872},
+    {20, 80, 160, 8, -105, 4400, 872},
+    {20, 80, 160, 8, -105, 4560, 872},
+    {20, 80, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 3760, 872},
+    {20, 160, 160, 8, -105, 3920, 872},
+    {20, 160, 160, 8, -105, 4080, 872},
+    {20, 160, 160, 8, -105, 4240, 872},
+    {20, 160, 160, 8, -105, 4400, 872},
+    {20, 160, 160, 8, -105, 4560, 872},
+    {20, 160, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 4880, 872},
+    {20, 160, 160, 8, -105, 5040, 872},
+    {20, 160, 160, 8, -105, 5200, 872},
+    {20, 160, 160, 8, -105, 5360, 872},
+    {20, 80, 160, 8, -105, 3920, 930},
+    {20, 80, 160, 8, -105, 4080, 930},
+    {20, 80, 160, 8, -105, 4240, 930},
+    {20, 80, 160, 8, -105, 4400, 930},
+    {20, 80, 160, 8, -105, 4560, 930},
+    {20, 80, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 4880, 930},
+    {20, 80, 160, 8, -105, 5040, 930},
+    {20, 80, 160, 8, -105, 5200, 930},
+    {20, 80, 160, 8, -105, 5360, 930},
+    {20, 80, 160, 8, -105, 5520, 930},
+    {20, 160, 160, 8, -105, 5360, 930},
+    {20, 160, 160, 8, -105, 5520, 930},
+    {20, 160, 160, 8, -105, 5680, 930},
+    {20, 160, 160, 8, -105, 5840, 930},
+    {20, 160, 160, 8, -105, 6000, 930},
+    {20, 160, 160, 8, -105, 6160, 930},
+    {20, 160, 160, 8, -105, 6320, 930},
+    {20, 160, 160, 8, -105, 6480, 930},
+    {20, 160, 160, 8, -105, 6640, 930},
+    {20, 160, 160, 8, -105, 6800, 930},
+    {20, 160, 160, 8, -105, 6960, 930},
+    {20, 40, 160, 8, -105, 3120, 930},
+    {20, 40, 160, 8, -105, 3280, 930},
+    {20, 40, 160, 8, -105, 3440, 930},
+    {20, 40, 160, 8, -105, 3600, 930},
+    {20, 40, 160, 8, -105, 3760, 930},
+    {20, 40, 160, 8, -105, 3920, 930},
+    {20, 40, 160, 8, -105, 4080, 930},
+    {20, 40, 160, 8, -105, 4240, 930},
+    {20, 40, 160, 8, -105, 4400, 930},
+    {20, 40, 160, 8, -105, 4560, 930},
+    {20, 40, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 3760, 930},
+    {20, 80, 160, 8, -105, 3920, 930},
+    {20, 80, 160, 8, -105, 4080, 930},
+    {20, 80, 160, 8, -105, 4240, 930},
+    {20, 80, 160, 8, -105, 4400, 930},
+    {20, 80, 160, 8, -105, 4560, 930},
+    {20, 80, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 4880, 930},
+    {20, 80, 160, 8, -105, 5040, 930},
+    {20, 80, 160, 8, -105, 5200, 930},
+    {20, 80, 160, 8, -105, 5360, 930},
+    {20, 53, 160, 8, -105, 3920, 940},
+    {20, 53, 160, 8, -105, 4080, 940},
+    {20, 53, 160, 8, -105, 4240, 940},
+    {20, 53, 160, 8, -105, 4400, 940},
+    {20, 53, 160, 8, -105, 4560, 940},
+    {20, 53, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 4880, 940},
+    {20, 53, 160, 8, -105, 5040, 940},
+    {20, 53, 160, 8, -105, 5200, 940},
+    {20, 53, 160, 8, -105, 5360, 940},
+    {20, 53, 160, 8, -105, 5520, 940},
+    {20, 106, 160, 8, -105, 5360, 940},
+    {20, 106, 160, 8, -105, 5520, 940},
+    {20, 106, 160, 8, -105, 5680, 940},
+    {20, 106, 160, 8, -105, 5840, 940},
+    {20, 106, 160, 8, -105, 6000, 940},
+    {20, 106, 160, 8, -105, 6160, 940},
+    {20, 106, 160, 8, -105, 6320, 940},
+    {20, 106, 160, 8, -105, 6480, 940},
+    {20, 106, 160, 8, -105, 6640, 940},
+    {20, 106, 160, 8, -105, 6800, 940},
+    {20, 106, 160, 8, -105, 6960, 940},
+    {20, 26, 160, 8, -105, 3120, 940},
+    {20, 26, 160, 8, -105, 3280, 940},
+    {20, 26, 160, 8, -105, 3440, 940},
+    {20, 26, 160, 8, -105, 3600, 940},
+    {20, 26, 160, 8, -105, 3760, 940},
+    {20, 26, 160, 8, -105, 3920, 940},
+    {20, 26, 160, 8, -105, 4080, 940},
+    {20, 26, 160, 8, -105, 4240, 940},
+    {20, 26, 160, 8, -105, 4400, 940},
+    {20, 26, 160, 8, -105, 4560, 940},
+    {20, 26, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 3760, 940},
+    {20, 53, 160, 8, -105, 3920, 940},
+    {20, 53, 160, 8, -105, 4080, 940},
+    {20, 53, 160, 8, -105, 4240, 940},
+    {20, 53, 160, 8, -105, 4400, 940},
+    {20, 53, 160, 8, -105, 4560, 940},
+    {20, 53, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 4880, 940},
+    {20, 53, 160, 8, -105, 5040, 940},
+    {20, 53, 160, 8, -105, 5200, 940},
+    {20, 53, 160, 8, -105, 5360, 940},
+    {20, 40, 160, 8, -105, 3920, 940},
+    {20, 40, 160, 8, -105, 4080, 940},
+    {20, 40, 160, 8, -105, 4240, 940},
+    {20, 40, 160, 8, -105, 4400, 940},
+    {20, 40, 160, 8, -105, 4560, 940},
+    {20, 40, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 4880, 940},
+    {20, 40, 160, 8, -105, 5040, 940},
+    {20, 40, 160, 8, -105, 5200, 940},
+    {20, 40, 160, 8, -105, 5360, 940},
+    {20, 40, 160, 8, -105, 5520, 940},
+    {20, 80, 160, 8, -105, 5360, 940},
+    {20, 80, 160, 8, -105, 5520, 940},
+    {20, 80, 160, 8, -105, 5680, 940},
+    {20, 80, 160, 8, -105, 5840, 940},
+    {20, 80, 160, 8, -105, 6000, 940},
+    {20, 80, 160, 8, -105, 6160, 940},
+    {20, 80, 160, 8, -105, 6320, 940},
+    {20, 80, 160, 8, -105, 6480, 940},
+    {20, 80, 160, 8, -105, 6640, 940},
+    {20, 80, 160, 8, -105, 6800, 940},
+    {20, 80, 160, 8, -105, 6960, 940},
+    {20, 20, 160, 8, -105, 3120, 940},
+    {20, 20, 160, 8, -105, 3280, 940},
+    {20, 20, 160, 8, -105, 3440, 940},
+    {20, 20, 160, 8, -105, 3600, 940},
+    {20, 20, 160, 8, -105, 3760, 940},
+    {20, 20, 160, 8, -105, 3920, 940},
+    {20, 20, 160, 8, -105, 4080, 940},
+    {20, 20, 160, 8, -105, 4240, 940},
+    {20, 20, 160, 8, -105, 4400, 940},
+    {20, 20, 160, 8, -105, 4560, 940},
+    {20, 20, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 3760, 940},
+    {20, 40, 160, 8, -105, 3920, 940},
+    {20, 40, 160, 8, -105, 4080, 940},
+    {20, 40, 160, 8, -105, 4240, 940},
+    {20, 40, 160, 8, -105, 4400, 940},
+    {20, 40, 160, 8, -105, 4560, 940},
+    {20, 40, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 4880, 940},
+    {20, 40, 160, 8, -105, 5040, 940},
+    {20, 40, 160, 8, -105, 5200, 940},
+    {20, 40, 160, 8, -105, 5360, 940},
+    {20, 26, 160, 8, -105, 3920, 970},
+    {20, 26, 160, 8, -105, 4080, 970},
+    {20, 26, 160, 8, -105, 4240, 970},
+    {20, 26, 160, 8, -105, 4400, 970},
+    {20, 26, 160, 8, -105, 4560, 970},
+    {20, 26, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 4880, 970},
+    {20, 26, 160, 8, -105, 5040, 970},
+    {20, 26, 160, 8, -105, 5200, 970},
+    {20, 26, 160, 8, -105, 5360, 970},
+    {20, 26, 160, 8, -105, 5520, 970},
+    {20, 53, 160, 8, -105, 5360, 970},
+    {20, 53, 160, 8, -105, 5520, 970},
+    {20, 53, 160, 8, -105, 5680, 970},
+    {20, 53, 160, 8, -105, 5840, 970},
+    {20, 53, 160, 8, -105, 6000, 970},
+    {20, 53, 160, 8, -105, 6160, 970},
+    {20, 53, 160, 8, -105, 6320, 970},
+    {20, 53, 160, 8, -105, 6480, 970},
+    {20, 53, 160, 8, -105, 6640, 970},
+    {20, 53, 160, 8, -105, 6800, 970},
+    {20, 53, 160, 8, -105, 6960, 970},
+    {20, 13, 160, 8, -105, 3120, 970},
+    {20, 13, 160, 8, -105, 3280, 970},
+    {20, 13, 160, 8, -105, 3440, 970},
+    {20, 13, 160, 8, -105, 3600, 970},
+    {20, 13, 160, 8, -105, 3760, 970},
+    {20, 13, 160, 8, -105, 3920, 970},
+    {20, 13, 160, 8, -105, 4080, 970},
+    {20, 13, 160, 8, -105, 4240, 970},
+    {20, 13, 160, 8, -105, 4400, 970},
+    {20, 13, 160, 8, -105, 4560, 970},
+    {20, 13, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 3760, 970},
+    {20, 26, 160, 8, -105, 3920, 970},
+    {20, 26, 160, 8, -105, 4080, 970},
+    {20, 26, 160, 8, -105, 4240, 970},
+    {20, 26, 160, 8, -105, 4400, 970},
+    {20, 26, 160, 8, -105, 4560, 970},
+    {20, 26, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 4880, 970},
+    {20, 26, 160, 8, -105, 5040, 970},
+    {20, 26, 160, 8, -105, 5200, 970},
+    {20, 26, 160, 8, -105, 5360, 970},
+    {20, 20, 160, 8, -105, 3920, 975},
+    {20, 20, 160, 8, -105, 4080, 975},
+    {20, 20, 160, 8, -105, 4240, 975},
+    {20, 20, 160, 8, -105, 4400, 975},
+    {20, 20, 160, 8, -105, 4560, 975},
+    {20, 20, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 4880, 975},
+    {20, 20, 160, 8, -105, 5040, 975},
+    {20, 20, 160, 8, -105, 5200, 975},
+    {20, 20, 160, 8, -105, 5360, 975},
+    {20, 20, 160, 8, -105, 5520, 975},
+    {20, 40, 160, 8, -105, 5360, 975},
+    {20, 40, 160, 8, -105, 5520, 975},
+    {20, 40, 160, 8, -105, 5680, 975},
+    {20, 40, 160, 8, -105, 5840, 975},
+    {20, 40, 160, 8, -105, 6000, 975},
+    {20, 40, 160, 8, -105, 6160, 975},
+    {20, 40, 160, 8, -105, 6320, 975},
+    {20, 40, 160, 8, -105, 6480, 975},
+    {20, 40, 160, 8, -105, 6640, 975},
+    {20, 40, 160, 8, -105, 6800, 975},
+    {20, 40, 160, 8, -105, 6960, 975},
+    {20, 10, 160, 8, -105, 3120, 975},
+    {20, 10, 160, 8, -105, 3280, 975},
+    {20, 10, 160, 8, -105, 3440, 975},
+    {20, 10, 160, 8, -105, 3600, 975},
+    {20, 10, 160, 8, -105, 3760, 975},
+    {20, 10, 160, 8, -105, 3920, 975},
+    {20, 10, 160, 8, -105, 4080, 975},
+    {20, 10, 160, 8, -105, 4240, 975},
+    {20, 10, 160, 8, -105, 4400, 975},
+    {20, 10, 160, 8, -105, 4560, 975},
+    {20, 10, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 3760, 975},
+    {20, 20, 160, 8, -105, 3920, 975},
+    {20, 20, 160, 8, -105, 4080, 975},
+    {20, 20, 160, 8, -105, 4240, 975},
+    {20, 20, 160, 8, -105, 4400, 975},
+    {20, 20, 160, 8, -105, 4560, 975},
+    {20, 20, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 4880, 975},
+    {20, 20, 160, 8, -105, 5040, 975},
+    {20, 20, 160, 8, -105, 5200, 975},
+    {20, 20, 160, 8, -105, 5360, 975},
+    {120, 80, 960, 8, -105, 4800, 980},
+    {120, 80, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4560, 980},
+    {120, 40, 960, 8, -105, 4680, 980},
+    {120, 20, 960, 8, -105, 4440, 980},
+    {120, 20, 960, 8, -105, 4560, 980},
+    {120, 10, 960, 8, -105, 4320, 980},
+    {120, 10, 960, 8, -105, 4440, 980},
+    {120, 6, 960, 8, -105, 4320, 980},
+    {120, 6, 960, 8, -105, 4440, 980},
+    {120, 5, 960, 8, -105, 4320, 980},
+    {120, 5, 960, 8, -105, 4440, 980},
+    {120, 3, 960, 8, -105, 4320, 980},
+    {120, 3, 960, 8, -105, 4440, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 6000, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5400, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 5160, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 5040, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 13, 960, 8, -105, 4920, 980},
+    {120, 10, 960, 8, -105, 4680, 980},
+    {120, 10, 960, 8, -105, 4920, 980},
+    {120, 6, 960, 8, -105, 4680, 980},
+    {120, 6, 960, 8, -105, 4920, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 666, 960, 8, -105, 9240, 980},
+    {120, 666, 960, 8, -105, 9240, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 53, 960, 8, -105, 5040, 980},
+    {120, 53, 960, 8, -105, 5040, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {320, 1280, 1280, 4, -105, 34880, 1190},
+    {320, 640, 1280, 4, -105, 29440, 1190},
+    {320, 320, 1280, 4, -105, 26880, 1190},
+    {320, 160, 1280, 4, -105, 25600, 1190},
+    {320, 160, 1280, 4, -105, 25600, 1190},
+    {160, 640, 640, 4, -105, 18400, 1070},
+    {160, 320, 640, 4, -105, 15680, 1070},
+    {160, 160, 640, 4, -105, 14400, 1070},
+    {160, 80, 640, 4, -105, 13760, 1070},
+    {160, 80, 640, 4, -105, 13760, 1070},
+    {64, 256, 512, 8, -105, 10304, 999},
+    {64, 128, 512, 8, -105, 9216, 999},
+    {64, 64, 512, 8, -105, 8704, 999},
+    {64, 32, 512, 8, -105, 8448, 999},
+    {64, 16, 512, 8, -105, 8320, 999},
+    {64, 256, 512, 8, -105, 10304, 1004},
+    {64, 128, 512, 8, -105, 9216, 1004},
+    {64, 64, 512, 8, -105, 8704, 1004},
+    {64, 32, 512, 8, -105, 8448, 1004},
+    {64, 8, 512, 8, -105, 8256, 1004},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 16, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {20, 160, 160, 8, -105, 3920, 872},
+    {20, 160, 160, 8, -105, 4080, 872},
+    {20, 160, 160, 8, -105, 4240, 872},
+    {20, 160, 160, 8, -105, 4400, 872},
+    {20, 160, 160, 8, -105, 4560, 872},
+    {20, 160, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 4880, 872},
+    {20, 160, 160, 8, -105, 5040, 872},
+    {20, 160, 160, 8, -105, 5200, 872},
+    {20, 160, 160, 8, -105, 5360, 872},
+    {20, 160, 160, 8, -105, 5520, 872},
+    {20, 320, 160, 8, -105, 5360, 872},
+    {20, 320, 160, 8, -105, 5520, 872},
+    {20, 320, 160, 8, -105, 5680, 872},
+    {20, 320, 160, 8, -105, 5840, 872},
+    {20, 320, 160, 8, -105, 6000, 872},
+    {20, 320, 160, 8, -105, 6160, 872},
+    {20, 320, 160, 8, -105, 6320, 872},
+    {20, 320, 160, 8, -105, 6480, 872},
+    {20, 320, 160, 8, -105, 6640, 872},
+    {20, 320, 160, 8, -105, 6800, 872},
+    {20, 320, 160, 8, -105, 6960, 872},
+    {20, 80, 160, 8, -105, 3120, 872},
+    {20, 80, 160, 8, -105, 3280, 872},
+    {20, 80, 160, 8, -105, 3440, 872},
+    {20, 80, 160, 8, -105, 3600, 872},
+    {20, 80, 160, 8, -105, 3760, 872},
+    {20, 80, 160, 8, -105, 3920, 872},
+    {20, 80, 160, 8, -105, 4080, 872},
+    {20, 80, 160, 8, -105, 4240, 872},
+    {20, 80, 160, 8, -105, 4400, 872},
+    {20, 80, 160, 8, -105, 4560, 872},
+    {20, 80, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 3760, 872},
+    {20, 160, 160, 8, -105, 3920, 872},
+    {20, 160, 160, 8, -105, 4080, 872},
+    {20, 160, 160, 8, -105, 4240, 872},
+    {20, 160, 160, 8, -105, 4400, 872},
+    {20, 160, 160, 8, -105, 4560, 872},
+    {20, 160, 160, 8, -105, 4720, 872},
+    {20, 160, 160, 8, -105, 4880, 872},
+    {20, 160, 160, 8, -105, 5040, 872},
+    {20, 160, 160, 8, -105, 5200, 872},
+    {20, 160, 160, 8, -105, 5360, 872},
+    {20, 80, 160, 8, -105, 3920, 930},
+    {20, 80, 160, 8, -105, 4080, 930},
+    {20, 80, 160, 8, -105, 4240, 930},
+    {20, 80, 160, 8, -105, 4400, 930},
+    {20, 80, 160, 8, -105, 4560, 930},
+    {20, 80, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 4880, 930},
+    {20, 80, 160, 8, -105, 5040, 930},
+    {20, 80, 160, 8, -105, 5200, 930},
+    {20, 80, 160, 8, -105, 5360, 930},
+    {20, 80, 160, 8, -105, 5520, 930},
+    {20, 160, 160, 8, -105, 5360, 930},
+    {20, 160, 160, 8, -105, 5520, 930},
+    {20, 160, 160, 8, -105, 5680, 930},
+    {20, 160, 160, 8, -105, 5840, 930},
+    {20, 160, 160, 8, -105, 6000, 930},
+    {20, 160, 160, 8, -105, 6160, 930},
+    {20, 160, 160, 8, -105, 6320, 930},
+    {20, 160, 160, 8, -105, 6480, 930},
+    {20, 160, 160, 8, -105, 6640, 930},
+    {20, 160, 160, 8, -105, 6800, 930},
+    {20, 160, 160, 8, -105, 6960, 930},
+    {20, 40, 160, 8, -105, 3120, 930},
+    {20, 40, 160, 8, -105, 3280, 930},
+    {20, 40, 160, 8, -105, 3440, 930},
+    {20, 40, 160, 8, -105, 3600, 930},
+    {20, 40, 160, 8, -105, 3760, 930},
+    {20, 40, 160, 8, -105, 3920, 930},
+    {20, 40, 160, 8, -105, 4080, 930},
+    {20, 40, 160, 8, -105, 4240, 930},
+    {20, 40, 160, 8, -105, 4400, 930},
+    {20, 40, 160, 8, -105, 4560, 930},
+    {20, 40, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 3760, 930},
+    {20, 80, 160, 8, -105, 3920, 930},
+    {20, 80, 160, 8, -105, 4080, 930},
+    {20, 80, 160, 8, -105, 4240, 930},
+    {20, 80, 160, 8, -105, 4400, 930},
+    {20, 80, 160, 8, -105, 4560, 930},
+    {20, 80, 160, 8, -105, 4720, 930},
+    {20, 80, 160, 8, -105, 4880, 930},
+    {20, 80, 160, 8, -105, 5040, 930},
+    {20, 80, 160, 8, -105, 5200, 930},
+    {20, 80, 160, 8, -105, 5360, 930},
+    {20, 53, 160, 8, -105, 3920, 940},
+    {20, 53, 160, 8, -105, 4080, 940},
+    {20, 53, 160, 8, -105, 4240, 940},
+    {20, 53, 160, 8, -105, 4400, 940},
+    {20, 53, 160, 8, -105, 4560, 940},
+    {20, 53, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 4880, 940},
+    {20, 53, 160, 8, -105, 5040, 940},
+    {20, 53, 160, 8, -105, 5200, 940},
+    {20, 53, 160, 8, -105, 5360, 940},
+    {20, 53, 160, 8, -105, 5520, 940},
+    {20, 106, 160, 8, -105, 5360, 940},
+    {20, 106, 160, 8, -105, 5520, 940},
+    {20, 106, 160, 8, -105, 5680, 940},
+    {20, 106, 160, 8, -105, 5840, 940},
+    {20, 106, 160, 8, -105, 6000, 940},
+    {20, 106, 160, 8, -105, 6160, 940},
+    {20, 106, 160, 8, -105, 6320, 940},
+    {20, 106, 160, 8, -105, 6480, 940},
+    {20, 106, 160, 8, -105, 6640, 940},
+    {20, 106, 160, 8, -105, 6800, 940},
+    {20, 106, 160, 8, -105, 6960, 940},
+    {20, 26, 160, 8, -105, 3120, 940},
+    {20, 26, 160, 8, -105, 3280, 940},
+    {20, 26, 160, 8, -105, 3440, 940},
+    {20, 26, 160, 8, -105, 3600, 940},
+    {20, 26, 160, 8, -105, 3760, 940},
+    {20, 26, 160, 8, -105, 3920, 940},
+    {20, 26, 160, 8, -105, 4080, 940},
+    {20, 26, 160, 8, -105, 4240, 940},
+    {20, 26, 160, 8, -105, 4400, 940},
+    {20, 26, 160, 8, -105, 4560, 940},
+    {20, 26, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 3760, 940},
+    {20, 53, 160, 8, -105, 3920, 940},
+    {20, 53, 160, 8, -105, 4080, 940},
+    {20, 53, 160, 8, -105, 4240, 940},
+    {20, 53, 160, 8, -105, 4400, 940},
+    {20, 53, 160, 8, -105, 4560, 940},
+    {20, 53, 160, 8, -105, 4720, 940},
+    {20, 53, 160, 8, -105, 4880, 940},
+    {20, 53, 160, 8, -105, 5040, 940},
+    {20, 53, 160, 8, -105, 5200, 940},
+    {20, 53, 160, 8, -105, 5360, 940},
+    {20, 40, 160, 8, -105, 3920, 940},
+    {20, 40, 160, 8, -105, 4080, 940},
+    {20, 40, 160, 8, -105, 4240, 940},
+    {20, 40, 160, 8, -105, 4400, 940},
+    {20, 40, 160, 8, -105, 4560, 940},
+    {20, 40, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 4880, 940},
+    {20, 40, 160, 8, -105, 5040, 940},
+    {20, 40, 160, 8, -105, 5200, 940},
+    {20, 40, 160, 8, -105, 5360, 940},
+    {20, 40, 160, 8, -105, 5520, 940},
+    {20, 80, 160, 8, -105, 5360, 940},
+    {20, 80, 160, 8, -105, 5520, 940},
+    {20, 80, 160, 8, -105, 5680, 940},
+    {20, 80, 160, 8, -105, 5840, 940},
+    {20, 80, 160, 8, -105, 6000, 940},
+    {20, 80, 160, 8, -105, 6160, 940},
+    {20, 80, 160, 8, -105, 6320, 940},
+    {20, 80, 160, 8, -105, 6480, 940},
+    {20, 80, 160, 8, -105, 6640, 940},
+    {20, 80, 160, 8, -105, 6800, 940},
+    {20, 80, 160, 8, -105, 6960, 940},
+    {20, 20, 160, 8, -105, 3120, 940},
+    {20, 20, 160, 8, -105, 3280, 940},
+    {20, 20, 160, 8, -105, 3440, 940},
+    {20, 20, 160, 8, -105, 3600, 940},
+    {20, 20, 160, 8, -105, 3760, 940},
+    {20, 20, 160, 8, -105, 3920, 940},
+    {20, 20, 160, 8, -105, 4080, 940},
+    {20, 20, 160, 8, -105, 4240, 940},
+    {20, 20, 160, 8, -105, 4400, 940},
+    {20, 20, 160, 8, -105, 4560, 940},
+    {20, 20, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 3760, 940},
+    {20, 40, 160, 8, -105, 3920, 940},
+    {20, 40, 160, 8, -105, 4080, 940},
+    {20, 40, 160, 8, -105, 4240, 940},
+    {20, 40, 160, 8, -105, 4400, 940},
+    {20, 40, 160, 8, -105, 4560, 940},
+    {20, 40, 160, 8, -105, 4720, 940},
+    {20, 40, 160, 8, -105, 4880, 940},
+    {20, 40, 160, 8, -105, 5040, 940},
+    {20, 40, 160, 8, -105, 5200, 940},
+    {20, 40, 160, 8, -105, 5360, 940},
+    {20, 26, 160, 8, -105, 3920, 970},
+    {20, 26, 160, 8, -105, 4080, 970},
+    {20, 26, 160, 8, -105, 4240, 970},
+    {20, 26, 160, 8, -105, 4400, 970},
+    {20, 26, 160, 8, -105, 4560, 970},
+    {20, 26, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 4880, 970},
+    {20, 26, 160, 8, -105, 5040, 970},
+    {20, 26, 160, 8, -105, 5200, 970},
+    {20, 26, 160, 8, -105, 5360, 970},
+    {20, 26, 160, 8, -105, 5520, 970},
+    {20, 53, 160, 8, -105, 5360, 970},
+    {20, 53, 160, 8, -105, 5520, 970},
+    {20, 53, 160, 8, -105, 5680, 970},
+    {20, 53, 160, 8, -105, 5840, 970},
+    {20, 53, 160, 8, -105, 6000, 970},
+    {20, 53, 160, 8, -105, 6160, 970},
+    {20, 53, 160, 8, -105, 6320, 970},
+    {20, 53, 160, 8, -105, 6480, 970},
+    {20, 53, 160, 8, -105, 6640, 970},
+    {20, 53, 160, 8, -105, 6800, 970},
+    {20, 53, 160, 8, -105, 6960, 970},
+    {20, 13, 160, 8, -105, 3120, 970},
+    {20, 13, 160, 8, -105, 3280, 970},
+    {20, 13, 160, 8, -105, 3440, 970},
+    {20, 13, 160, 8, -105, 3600, 970},
+    {20, 13, 160, 8, -105, 3760, 970},
+    {20, 13, 160, 8, -105, 3920, 970},
+    {20, 13, 160, 8, -105, 4080, 970},
+    {20, 13, 160, 8, -105, 4240, 970},
+    {20, 13, 160, 8, -105, 4400, 970},
+    {20, 13, 160, 8, -105, 4560, 970},
+    {20, 13, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 3760, 970},
+    {20, 26, 160, 8, -105, 3920, 970},
+    {20, 26, 160, 8, -105, 4080, 970},
+    {20, 26, 160, 8, -105, 4240, 970},
+    {20, 26, 160, 8, -105, 4400, 970},
+    {20, 26, 160, 8, -105, 4560, 970},
+    {20, 26, 160, 8, -105, 4720, 970},
+    {20, 26, 160, 8, -105, 4880, 970},
+    {20, 26, 160, 8, -105, 5040, 970},
+    {20, 26, 160, 8, -105, 5200, 970},
+    {20, 26, 160, 8, -105, 5360, 970},
+    {20, 20, 160, 8, -105, 3920, 975},
+    {20, 20, 160, 8, -105, 4080, 975},
+    {20, 20, 160, 8, -105, 4240, 975},
+    {20, 20, 160, 8, -105, 4400, 975},
+    {20, 20, 160, 8, -105, 4560, 975},
+    {20, 20, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 4880, 975},
+    {20, 20, 160, 8, -105, 5040, 975},
+    {20, 20, 160, 8, -105, 5200, 975},
+    {20, 20, 160, 8, -105, 5360, 975},
+    {20, 20, 160, 8, -105, 5520, 975},
+    {20, 40, 160, 8, -105, 5360, 975},
+    {20, 40, 160, 8, -105, 5520, 975},
+    {20, 40, 160, 8, -105, 5680, 975},
+    {20, 40, 160, 8, -105, 5840, 975},
+    {20, 40, 160, 8, -105, 6000, 975},
+    {20, 40, 160, 8, -105, 6160, 975},
+    {20, 40, 160, 8, -105, 6320, 975},
+    {20, 40, 160, 8, -105, 6480, 975},
+    {20, 40, 160, 8, -105, 6640, 975},
+    {20, 40, 160, 8, -105, 6800, 975},
+    {20, 40, 160, 8, -105, 6960, 975},
+    {20, 10, 160, 8, -105, 3120, 975},
+    {20, 10, 160, 8, -105, 3280, 975},
+    {20, 10, 160, 8, -105, 3440, 975},
+    {20, 10, 160, 8, -105, 3600, 975},
+    {20, 10, 160, 8, -105, 3760, 975},
+    {20, 10, 160, 8, -105, 3920, 975},
+    {20, 10, 160, 8, -105, 4080, 975},
+    {20, 10, 160, 8, -105, 4240, 975},
+    {20, 10, 160, 8, -105, 4400, 975},
+    {20, 10, 160, 8, -105, 4560, 975},
+    {20, 10, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 3760, 975},
+    {20, 20, 160, 8, -105, 3920, 975},
+    {20, 20, 160, 8, -105, 4080, 975},
+    {20, 20, 160, 8, -105, 4240, 975},
+    {20, 20, 160, 8, -105, 4400, 975},
+    {20, 20, 160, 8, -105, 4560, 975},
+    {20, 20, 160, 8, -105, 4720, 975},
+    {20, 20, 160, 8, -105, 4880, 975},
+    {20, 20, 160, 8, -105, 5040, 975},
+    {20, 20, 160, 8, -105, 5200, 975},
+    {20, 20, 160, 8, -105, 5360, 975},
+    {120, 80, 960, 8, -105, 4800, 980},
+    {120, 80, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4560, 980},
+    {120, 40, 960, 8, -105, 4680, 980},
+    {120, 20, 960, 8, -105, 4440, 980},
+    {120, 20, 960, 8, -105, 4560, 980},
+    {120, 10, 960, 8, -105, 4320, 980},
+    {120, 10, 960, 8, -105, 4440, 980},
+    {120, 6, 960, 8, -105, 4320, 980},
+    {120, 6, 960, 8, -105, 4440, 980},
+    {120, 5, 960, 8, -105, 4320, 980},
+    {120, 5, 960, 8, -105, 4440, 980},
+    {120, 3, 960, 8, -105, 4320, 980},
+    {120, 3, 960, 8, -105, 4440, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 6000, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5400, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 5160, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 5040, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 13, 960, 8, -105, 4920, 980},
+    {120, 10, 960, 8, -105, 4680, 980},
+    {120, 10, 960, 8, -105, 4920, 980},
+    {120, 6, 960, 8, -105, 4680, 980},
+    {120, 6, 960, 8, -105, 4920, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 20, 960, 8, -105, 4800, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 13, 960, 8, -105, 4680, 980},
+    {120, 666, 960, 8, -105, 9240, 980},
+    {120, 666, 960, 8, -105, 9240, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 320, 960, 8, -105, 6840, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 160, 960, 8, -105, 5760, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 80, 960, 8, -105, 5160, 980},
+    {120, 53, 960, 8, -105, 5040, 980},
+    {120, 53, 960, 8, -105, 5040, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 40, 960, 8, -105, 4920, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {120, 26, 960, 8, -105, 4800, 980},
+    {320, 1280, 1280, 4, -105, 34880, 1190},
+    {320, 640, 1280, 4, -105, 29440, 1190},
+    {320, 320, 1280, 4, -105, 26880, 1190},
+    {320, 160, 1280, 4, -105, 25600, 1190},
+    {320, 160, 1280, 4, -105, 25600, 1190},
+    {160, 640, 640, 4, -105, 18400, 1070},
+    {160, 320, 640, 4, -105, 15680, 1070},
+    {160, 160, 640, 4, -105, 14400, 1070},
+    {160, 80, 640, 4, -105, 13760, 1070},
+    {160, 80, 640, 4, -105, 13760, 1070},
+    {64, 256, 512, 8, -105, 10304, 999},
+    {64, 128, 512, 8, -105, 9216, 999},
+    {64, 64, 512, 8, -105, 8704, 999},
+    {64, 32, 512, 8, -105, 8448, 999},
+    {64, 16, 512, 8, -105, 8320, 999},
+    {64, 256, 512, 8, -105, 10304, 1004},
+    {64, 128, 512, 8, -105, 9216, 1004},
+    {64, 64, 512, 8, -105, 8704, 1004},
+    {64, 32, 512, 8, -105, 8448, 1004},
+    {64, 8, 512, 8, -105, 8256, 1004},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 16, 128, 8, -105, 864, 172},
+    {16, 32, 128, 8, -105, 864, 172},
+    {16, 8, 128, 8, -105, 864, 172},
+};
+
+#endif /* PHY_TIMING_REF_H */
+
+/* EOF */
@@ -0,0 +1,85 @@
+/**
+ * @file trx_mock.h
+ *
+ * @brief Transceiver register mock of the host tests.
+ *
+ * The SPI driver is replaced by a register array, so the TAL can be run
+ * on the host without a transceiver.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+#ifndef TRX_MOCK_H
+#define TRX_MOCK_H
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include "return_val.h"
+#include "pal.h"
+#include "tal.h"
+
+/* === MACROS ============================================================== */
+
+/** Number of transceiver register addresses */
+#define TRX_MOCK_REGS           (0x4000)
+
+/** Checks a condition; a failure is printed and counted */
+#define TEST_CHECK(cond)                                                \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            test_failures++;                                            \
+        }                                                               \
+    } while (0)
+
+/* === EXTERNALS =========================================================== */
+
+/** Register content of the transceiver */
+extern uint8_t trx_mock_reg[TRX_MOCK_REGS];
+
+/** Number of writes per register since trx_mock_reset() */
+extern uint16_t trx_mock_writes[TRX_MOCK_REGS];
+
+extern unsigned test_failures;
+
+/** Number of tal_tx_frame_done_cb() calls and the last status reported */
+extern unsigned trx_mock_tx_done;
+extern retval_t trx_mock_tx_status;
+
+/** Number of tal_scan_done_cb() calls and the last status reported */
+extern unsigned trx_mock_scan_done;
+extern retval_t trx_mock_scan_status;
+
+/**
+ * Number of frame transmissions started per trx, either by RF_TX or by a
+ * single ED measurement with CCATX enabled
+ */
+extern volatile unsigned trx_mock_tx_starts[NUM_TRX];
+
+/** Number of TX frame buffer underruns per trx */
+extern unsigned trx_mock_underruns[NUM_TRX];
+
+/* === PROTOTYPES ========================================================== */
+
+void trx_mock_reset(void);
+void trx_mock_clear_writes(void);
+void trx_mock_setup(trx_id_t trx_id);
+void trx_mock_set_spi_speed(uint32_t access_ns, uint32_t byte_ns);
+void trx_mock_wait_us(uint32_t us);
+uint16_t trx_mock_get_tx_frame(trx_id_t trx_id, uint8_t *psdu);
+void trx_mock_irq(trx_id_t trx_id, uint8_t rf_irqs, uint8_t bb_irqs);
+void trx_mock_rx_frame(trx_id_t trx_id, const uint8_t *psdu, uint16_t len);
+
+#endif /* TRX_MOCK_H */
+
+/* EOF */
@@ -0,0 +1,243 @@
+/**
+ * @file sim_bulk.c
+ *
+ * @brief Host benchmark of the bulk transfer mode against per-frame ACKs.
+ *
+ * RF09 sends NUM_FRAMES data frames to RF24, which acts as the peer node.
+ * The frames go either as one tal_tx_burst() requesting an ACK per frame
+ * or as one tal_bulk_tx_start() with block ACKs. Each frame, ACK, BAR and
+ * BA is lost with the given probability; the timers of both nodes run in
+ * real time. Air times follow the PHY of RF09.
+ *
+ * The goodput counts acknowledged MPDU bytes over the time until the last
+ * tal_tx_frame_done_cb().
+ *
+ * Build and run with "make sim".
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pal.h"
+#include "tal.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include "ieee_const.h"
+#include "trx_mock.h"
+
+/* === MACROS ============================================================== */
+
+#define SENDER                      (RF09)
+#define PEER                        (RF24)
+#define NUM_FRAMES                  (64)
+/** MPDU length without FCS */
+#define FRAME_LEN                   (100)
+/** Transfers per setting */
+#define RUNS                        (5)
+/** A transfer taking longer is reported as stuck */
+#define MAX_TRANSFER_US             (10000000UL)
+
+/* === GLOBALS ============================================================= */
+
+static uint8_t mpdu[NUM_FRAMES][FRAME_LEN];
+static frame_info_t frames[NUM_FRAMES];
+static frame_info_t *frame_list[NUM_FRAMES];
+
+/** Loss probabilities in percent */
+static const uint8_t loss_pct[] = {0, 2, 10};
+
+static uint8_t loss;
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Decides whether a frame on air is lost
+ */
+static bool is_lost(void)
+{
+    return (rand() % 100) < loss;
+}
+
+
+/**
+ * @brief Plays the air interface for a frame started by a node
+ *
+ * The frame is received by the other node. An ACK requested from the
+ * peer is sent automatically after the turnaround time.
+ *
+ * @param src Sending trx
+ */
+static void frame_on_air(trx_id_t src)
+{
+    trx_id_t dst = (src == SENDER) ? PEER : SENDER;
+    uint8_t psdu[aMaxPHYPacketSize];
+    uint16_t len = trx_mock_get_tx_frame(src, psdu);
+    bool delivered = !is_lost();
+
+    trx_mock_wait_us(get_ppdu_duration_us(SENDER, len));
+    trx_mock_irq(src, RF_IRQ_NO_IRQ, BB_IRQ_TXFE);
+    if (!delivered)
+    {
+        return;
+    }
+    trx_mock_rx_frame(dst, psdu, len);
+
+    if (((psdu[PL_POS_FCF_1] & FCF_FRAMETYPE_MASK) != FCF_FRAMETYPE_ACK) &&
+        (psdu[PL_POS_FCF_1] & FCF_ACK_REQUEST))
+    {
+        uint8_t ack[3] = {FCF_FRAMETYPE_ACK, 0, psdu[PL_POS_SEQ_NUM]};
+        uint16_t ack_len = sizeof(ack) + tal_pib[src].FCSLen;
+
+        trx_mock_wait_us(aTurnaroundTime * tal_pib[SENDER].SymbolDuration_us +
+                         get_ppdu_duration_us(SENDER, ack_len));
+        trx_mock_irq(dst, RF_IRQ_NO_IRQ, BB_IRQ_TXFE);
+        if (!is_lost())
+        {
+            trx_mock_rx_frame(src, ack, ack_len);
+        }
+    }
+}
+
+
+/**
+ * @brief Runs one transfer of NUM_FRAMES frames
+ *
+ * @param bulk true for the bulk mode, false for per-frame ACKs
+ * @param bytes Returns the acknowledged bytes
+ *
+ * @return Duration in us
+ */
+static uint32_t transfer(bool bulk, uint32_t *bytes)
+{
+    unsigned seen[NUM_TRX];
+    tal_tx_burst_stats_t burst_before, burst_after;
+    tal_bulk_stats_t bulk_before, bulk_after;
+    uint32_t start;
+    uint32_t end;
+
+    for (uint8_t i = 0; i < NUM_FRAMES; i++)
+    {
+        mpdu[i][PL_POS_FCF_1] = FCF_FRAMETYPE_DATA | FCF_PAN_ID_COMPRESSION |
+                                (bulk ? 0 : FCF_ACK_REQUEST);
+        mpdu[i][PL_POS_SEQ_NUM] = i;
+    }
+
+    trx_mock_clear_writes();
+    for (uint8_t trx_id = 0; trx_id < NUM_TRX; trx_id++)
+    {
+        seen[trx_id] = trx_mock_tx_starts[trx_id];
+    }
+    tal_tx_burst_get_stats(SENDER, &burst_before);
+    tal_bulk_get_stats(SENDER, &bulk_before);
+
+    pal_get_current_time(&start);
+    if (bulk)
+    {
+        tal_bulk_tx_start(SENDER, frame_list, NUM_FRAMES);
+    }
+    else
+    {
+        tal_tx_burst(SENDER, frame_list, NUM_FRAMES);
+    }
+
+    do
+    {
+        tal_task();
+        for (uint8_t trx_id = 0; trx_id < NUM_TRX; trx_id++)
+        {
+            if (trx_mock_tx_starts[trx_id] != seen[trx_id])
+            {
+                seen[trx_id]++;
+                frame_on_air((trx_id_t)trx_id);
+            }
+        }
+        pal_get_current_time(&end);
+    } while ((trx_mock_tx_done < NUM_FRAMES) && ((end - start) < MAX_TRANSFER_US));
+
+    if (trx_mock_tx_done < NUM_FRAMES)
+    {
+        printf("%s transfer stuck after %u frames\n", bulk ? "bulk" : "burst", trx_mock_tx_done);
+    }
+
+    if (bulk)
+    {
+        tal_bulk_get_stats(SENDER, &bulk_after);
+        *bytes = (uint32_t)(bulk_after.bytes_acked - bulk_before.bytes_acked);
+    }
+    else
+    {
+        tal_tx_burst_get_stats(SENDER, &burst_after);
+        *bytes = burst_after.burst_bytes - burst_before.burst_bytes;
+    }
+
+    /* Let outstanding timers and BAs pass */
+    trx_mock_wait_us(TAL_BULK_BA_TIMEOUT_US);
+    tal_task();
+
+    return end - start;
+}
+
+
+int main(void)
+{
+    trx_mock_reset();
+    trx_mock_setup(SENDER);
+    trx_mock_setup(PEER);
+
+    for (uint8_t i = 0; i < NUM_FRAMES; i++)
+    {
+        memset(mpdu[i], 0, FRAME_LEN);
+        /* PAN 0x1234, destination 0x0002, source 0x0001 */
+        mpdu[i][PL_POS_FCF_2] = (FCF_SHORT_ADDR << FCF_2_DEST_ADDR_OFFSET) |
+                                (FCF_SHORT_ADDR << FCF_2_SOURCE_ADDR_OFFSET) |
+                                (FCF_FRAME_VERSION_2006 >> 8);
+        mpdu[i][3] = 0x34;
+        mpdu[i][4] = 0x12;
+        mpdu[i][5] = 0x02;
+        mpdu[i][7] = 0x01;
+        frames[i].mpdu = mpdu[i];
+        frames[i].len_no_crc = FRAME_LEN;
+        frames[i].trx_id = SENDER;
+        frame_list[i] = &frames[i];
+    }
+
+    printf("%u frames of %u bytes, PPDU %u us\n", NUM_FRAMES, FRAME_LEN,
+           (unsigned)get_ppdu_duration_us(SENDER, FRAME_LEN + tal_pib[SENDER].FCSLen));
+    printf("%6s %18s %18s\n", "loss", "per-frame kbit/s", "bulk kbit/s");
+    for (uint8_t i = 0; i < sizeof(loss_pct); i++)
+    {
+        uint64_t bytes[2] = {0, 0};
+        uint64_t time_us[2] = {0, 0};
+
+        loss = loss_pct[i];
+        srand(1);
+        for (uint8_t run = 0; run < RUNS; run++)
+        {
+            for (uint8_t bulk = 0; bulk < 2; bulk++)
+            {
+                uint32_t acked;
+                time_us[bulk] += transfer(bulk, &acked);
+                bytes[bulk] += acked;
+            }
+        }
+        printf("%5u%% %18.1f %18.1f\n", loss,
+               (double)bytes[0] * 8000 / time_us[0], (double)bytes[1] * 8000 / time_us[1]);
+    }
+
+    return 0;
+}
+
+/* EOF */
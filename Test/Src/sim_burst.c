@@ -0,0 +1,167 @@
+/**
+ * @file sim_burst.c
+ *
+ * @brief Host benchmark of the goodput of bursts against single frames.
+ *
+ * RF09 sends NUM_FRAMES data frames requesting ACKs per frame size, once
+ * as single tal_tx_frame() calls with CSMA-CA each and once as bursts of
+ * BURST_LEN frames through tal_tx_burst(), which run CSMA-CA for the first
+ * frame only. The mock keeps each frame on air for its PPDU duration and
+ * returns the ACK of the peer after the turnaround time; the CSMA-CA
+ * backoffs run on the PAL timers in real time. With the default MinBE of 5
+ * and the 2.4 ms backoff period of the default OFDM PHY a single frame waits
+ * 37 ms on average before its CCA, which dominates the short frames.
+ *
+ * The goodput counts acknowledged MPDU bytes over the time from the first
+ * request until the last tal_tx_frame_done_cb().
+ *
+ * Build and run with "make sim".
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pal.h"
+#include "tal.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include "ieee_const.h"
+#include "ieee_154g.h"
+#include "trx_mock.h"
+
+/* === MACROS ============================================================== */
+
+#define SIM_TRX                     (RF09)
+#define NUM_FRAMES                  (32)
+#define BURST_LEN                   (8)
+#define MAX_FRAME_LEN               (1000)
+
+/* === GLOBALS ============================================================= */
+
+static uint8_t mpdu[NUM_FRAMES][MAX_FRAME_LEN];
+static frame_info_t frames[NUM_FRAMES];
+static frame_info_t *frame_list[NUM_FRAMES];
+
+/** MPDU lengths without FCS */
+static const uint16_t frame_len[] = {20, 50, 100, 250, 500, 1000};
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Plays the air interface for a started frame
+ *
+ * The peer acknowledges every frame.
+ */
+static void frame_on_air(void)
+{
+    static uint8_t psdu[aMaxPHYPacketSize_4g];
+    uint16_t len = trx_mock_get_tx_frame(SIM_TRX, psdu);
+    uint8_t ack[3] = {FCF_FRAMETYPE_ACK, 0, psdu[PL_POS_SEQ_NUM]};
+    uint16_t ack_len = sizeof(ack) + tal_pib[SIM_TRX].FCSLen;
+
+    trx_mock_wait_us(get_ppdu_duration_us(SIM_TRX, len));
+    trx_mock_irq(SIM_TRX, RF_IRQ_NO_IRQ, BB_IRQ_TXFE);
+    trx_mock_wait_us(aTurnaroundTime * tal_pib[SIM_TRX].SymbolDuration_us +
+                     get_ppdu_duration_us(SIM_TRX, ack_len));
+    trx_mock_rx_frame(SIM_TRX, ack, ack_len);
+}
+
+
+/**
+ * @brief Sends NUM_FRAMES frames of a size
+ *
+ * @param len MPDU length without FCS
+ * @param burst true to use bursts, false for single frames
+ *
+ * @return Goodput in kbit/s
+ */
+static double run(uint16_t len, bool burst)
+{
+    unsigned seen = trx_mock_tx_starts[SIM_TRX];
+    uint8_t next = 0;
+    uint32_t start;
+    uint32_t end;
+
+    for (uint8_t i = 0; i < NUM_FRAMES; i++)
+    {
+        frames[i].len_no_crc = len;
+    }
+    trx_mock_clear_writes();
+
+    pal_get_current_time(&start);
+    while (trx_mock_tx_done < NUM_FRAMES)
+    {
+        /* The application hands over the next frames once TAL is idle */
+        if ((next < NUM_FRAMES) && (trx_mock_tx_done == next) && (tal_state[SIM_TRX] == TAL_IDLE))
+        {
+            if (burst)
+            {
+                tal_tx_burst(SIM_TRX, &frame_list[next], BURST_LEN);
+                next += BURST_LEN;
+            }
+            else
+            {
+                tal_tx_frame(SIM_TRX, frame_list[next], CSMA_UNSLOTTED, false);
+                next++;
+            }
+        }
+        if (trx_mock_tx_starts[SIM_TRX] != seen)
+        {
+            seen++;
+            frame_on_air();
+        }
+        tal_task();
+    }
+    pal_get_current_time(&end);
+
+    if (trx_mock_tx_status != MAC_SUCCESS)
+    {
+        printf("%u bytes: last frame failed with 0x%02X\n", len, trx_mock_tx_status);
+    }
+
+    return (double)len * NUM_FRAMES * 8000 / (end - start);
+}
+
+
+int main(void)
+{
+    trx_mock_reset();
+    trx_mock_setup(SIM_TRX);
+
+    for (uint8_t i = 0; i < NUM_FRAMES; i++)
+    {
+        mpdu[i][PL_POS_FCF_1] = FCF_FRAMETYPE_DATA | FCF_ACK_REQUEST;
+        mpdu[i][PL_POS_SEQ_NUM] = i;
+        frames[i].mpdu = mpdu[i];
+        frames[i].trx_id = SIM_TRX;
+        frame_list[i] = &frames[i];
+    }
+
+    printf("%u frames with ACK, bursts of %u\n", NUM_FRAMES, BURST_LEN);
+    printf("%6s %10s %16s %16s %8s\n", "bytes", "PPDU us", "single kbit/s", "burst kbit/s", "gain");
+    for (uint8_t i = 0; i < sizeof(frame_len) / sizeof(frame_len[0]); i++)
+    {
+        double single = run(frame_len[i], false);
+        double burst = run(frame_len[i], true);
+
+        printf("%6u %10u %16.1f %16.1f %7.0f%%\n", frame_len[i],
+               (unsigned)get_ppdu_duration_us(SIM_TRX, frame_len[i] + tal_pib[SIM_TRX].FCSLen),
+               single, burst, (burst / single - 1) * 100);
+    }
+
+    return 0;
+}
+
+/* EOF */
@@ -0,0 +1,117 @@
+/**
+ * @file sim_ch_hop.c
+ *
+ * @brief Host benchmark of the DH1CF hop sequence generation.
+ *
+ * The whole sequence of 65536 slots is generated ROUNDS times per channel
+ * plan with tal_ch_hop_get_sequence(), the generator that also refills the
+ * own sequence table. The channel lookup of a neighbor,
+ * tal_ch_hop_nbr_channel(), is timed on its own; it includes reading the
+ * clock.
+ *
+ * Build and run with "make sim".
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include "pal.h"
+#include "tal.h"
+#include "tal_config.h"
+#include "tal_internal.h"
+#include "trx_mock.h"
+
+/* === MACROS ============================================================== */
+
+#define SIM_TRX                     (RF09)
+#define SEQ_BLOCK                   (32768)
+#define ROUNDS                      (50)
+#define NBR_LOOKUPS                 (1000000L)
+
+/* === GLOBALS ============================================================= */
+
+static uint16_t seq[SEQ_BLOCK];
+
+static const uint8_t eui64[8] = {0x00, 0x04, 0x25, 0x19, 0x18, 0x01, 0x02, 0x03};
+
+/** Numbers of channels of the plans */
+static const uint16_t plan_len[] = {35, 64, TAL_CH_HOP_MAX_CHANNELS};
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Gets the monotonic time in ns
+ */
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+
+int main(void)
+{
+    tal_ch_hop_cfg_t cfg;
+    volatile uint16_t sink = 0;
+
+    trx_mock_reset();
+    trx_mock_setup(SIM_TRX);
+
+    memset(&cfg, 0, sizeof(cfg));
+    memcpy(cfg.eui64, eui64, sizeof(cfg.eui64));
+    cfg.dwell_ms = 255;
+
+    printf("%9s %12s %14s\n", "channels", "ns/slot", "ns/nbr lookup");
+    for (uint8_t p = 0; p < sizeof(plan_len) / sizeof(plan_len[0]); p++)
+    {
+        tal_ch_hop_nbr_t nbr;
+        uint64_t start;
+        double seq_ns;
+        double nbr_ns;
+
+        cfg.num_channels = plan_len[p];
+        tal_ch_hop_start(SIM_TRX, &cfg);
+        tal_ch_hop_stop(SIM_TRX);
+
+        start = now_ns();
+        for (uint16_t r = 0; r < ROUNDS; r++)
+        {
+            tal_ch_hop_get_sequence(SIM_TRX, cfg.eui64, 0, seq, SEQ_BLOCK);
+            sink += seq[r];
+            tal_ch_hop_get_sequence(SIM_TRX, cfg.eui64, SEQ_BLOCK, seq, SEQ_BLOCK);
+            sink += seq[r];
+        }
+        seq_ns = (double)(now_ns() - start) / ((double)ROUNDS * 2 * SEQ_BLOCK);
+
+        tal_ch_hop_nbr_init(&nbr, cfg.eui64, cfg.dwell_ms, 0, 0);
+        start = now_ns();
+        for (long i = 0; i < NBR_LOOKUPS; i++)
+        {
+            uint16_t ch;
+
+            tal_ch_hop_nbr_channel(SIM_TRX, &nbr, &ch);
+            sink += ch;
+        }
+        nbr_ns = (double)(now_ns() - start) / NBR_LOOKUPS;
+
+        printf("%9u %12.1f %14.1f\n", plan_len[p], seq_ns, nbr_ns);
+    }
+
+    return 0;
+}
+
+/* EOF */
@@ -0,0 +1,279 @@
+/**
+ * @file sim_csma_adapt.c
+ *
+ * @brief Host simulation of the adaptive CSMA-CA parameters.
+ *
+ * N saturated nodes share one channel. Time runs in backoff units; a frame
+ * plus turnaround and ACK occupies TX_UNITS of them. A CCA is busy while
+ * another node transmits, and nodes starting in the same unit collide and
+ * miss their ACK. A frame is dropped after a channel access failure or
+ * after MAX_FRAME_RETRIES collisions. The fixed setup uses MinBE 3,
+ * MaxBE 5 and 4 backoffs; the adaptive setup starts from the same values.
+ *
+ * Each node has its own table entry; the node number is used as channel.
+ * The delay is taken from the start of a frame until its ACK, so it only
+ * covers delivered frames. The time per frame is the mean time a node
+ * needs per delivered frame, including the time spent on dropped ones.
+ *
+ * Build and run with "make sim".
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pal.h"
+#include "tal.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include "ieee_const.h"
+#include "trx_mock.h"
+
+/* === MACROS ============================================================== */
+
+/** Frame, turnaround and ACK in backoff units */
+#define TX_UNITS                    (13)
+/** Payload part of TX_UNITS used for the goodput */
+#define PAYLOAD_UNITS               (11)
+#define MAX_FRAME_RETRIES           (3)
+/** Duration of a backoff unit in ms (20 symbols at 62.5 ksym/s) */
+#define UNIT_MS                     (0.32)
+#define SIM_UNITS                   (2000000L)
+#define MAX_NODES                   (40)
+
+#if (TAL_CSMA_ADAPT_CHANNELS < MAX_NODES)
+#   error "The simulation needs a table entry per node"
+#endif
+
+/* === TYPES =============================================================== */
+
+/**
+ * State of a simulated node
+ */
+typedef struct sim_node_tag
+{
+    tal_csma_params_t params;
+    uint8_t nb;
+    uint8_t be;
+    uint16_t backoff;
+    uint8_t retries;
+    uint8_t tx_left;
+    bool collided;
+    /** Start of the current frame */
+    long born;
+} sim_node_t;
+
+/**
+ * Results of a run
+ */
+typedef struct sim_result_tag
+{
+    double goodput;
+    double drops;
+    double delay_ms;
+    double frame_ms;
+    double busy_cca;
+} sim_result_t;
+
+/* === GLOBALS ============================================================= */
+
+static sim_node_t node[MAX_NODES];
+static bool adaptive;
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Starts a CSMA-CA attempt of a node
+ *
+ * @param i Node number
+ */
+static void attempt_start(int i)
+{
+    sim_node_t *n = &node[i];
+
+    tal_pib[RF09].CurrentChannel = (uint16_t)i;
+    get_csma_params(RF09, &n->params);
+    n->nb = 0;
+    n->be = n->params.min_be;
+    n->backoff = (uint16_t)(rand() % (1 << n->be));
+}
+
+
+/**
+ * @brief Ends a CSMA-CA attempt of a node
+ *
+ * @param i Node number
+ * @param status Outcome of the attempt
+ */
+static void attempt_done(int i, retval_t status)
+{
+    tal_pib[RF09].CurrentChannel = (uint16_t)i;
+    csma_adapt_attempt_done(RF09, status, node[i].nb);
+}
+
+
+/**
+ * @brief Runs the simulation for a number of nodes
+ *
+ * @param nodes Number of nodes
+ * @param res Results of the run
+ */
+static void run(int nodes, sim_result_t *res)
+{
+    long ok = 0;
+    long dropped = 0;
+    long delay = 0;
+    long cca = 0;
+    long busy = 0;
+    int ready[MAX_NODES];
+
+    srand(42 + nodes);
+    memset(node, 0, sizeof(node));
+    tal_csma_adapt_enable(RF09, adaptive);
+    for (int i = 0; i < nodes; i++)
+    {
+        attempt_start(i);
+    }
+
+    for (long t = 0; t < SIM_UNITS; t++)
+    {
+        bool txing = false;
+        int num_ready = 0;
+
+        for (int i = 0; i < nodes; i++)
+        {
+            if (node[i].tx_left > 0)
+            {
+                txing = true;
+            }
+            else if (node[i].backoff > 0)
+            {
+                node[i].backoff--;
+            }
+            else
+            {
+                ready[num_ready++] = i;
+            }
+        }
+
+        /* CCA of all nodes whose backoff has expired */
+        for (int k = 0; k < num_ready; k++)
+        {
+            sim_node_t *n = &node[ready[k]];
+
+            cca++;
+            if (txing)
+            {
+                busy++;
+                n->nb++;
+                if (n->be < n->params.max_be)
+                {
+                    n->be++;
+                }
+                if (n->nb > n->params.max_backoffs)
+                {
+                    attempt_done(ready[k], MAC_CHANNEL_ACCESS_FAILURE);
+                    dropped++;
+                    n->retries = 0;
+                    n->born = t;
+                    attempt_start(ready[k]);
+                }
+                else
+                {
+                    n->backoff = (uint16_t)(rand() % (1 << n->be));
+                }
+            }
+            else
+            {
+                n->tx_left = TX_UNITS;
+                n->collided = (num_ready > 1);
+            }
+        }
+
+        for (int i = 0; i < nodes; i++)
+        {
+            sim_node_t *n = &node[i];
+
+            if ((n->tx_left == 0) || (--n->tx_left > 0))
+            {
+                continue;
+            }
+            if (n->collided)
+            {
+                attempt_done(i, MAC_NO_ACK);
+                if (++n->retries > MAX_FRAME_RETRIES)
+                {
+                    dropped++;
+                    n->retries = 0;
+                    n->born = t;
+                }
+            }
+            else
+            {
+                attempt_done(i, MAC_SUCCESS);
+                ok++;
+                delay += t - n->born;
+                n->retries = 0;
+                n->born = t;
+            }
+            attempt_start(i);
+        }
+    }
+
+    res->goodput = (double)ok * PAYLOAD_UNITS / SIM_UNITS;
+    res->drops = (ok + dropped > 0) ? (double)dropped / (ok + dropped) : 0;
+    res->delay_ms = (ok > 0) ? (double)delay / ok * UNIT_MS : 0;
+    res->frame_ms = (ok > 0) ? (double)SIM_UNITS * nodes / ok * UNIT_MS : 0;
+    res->busy_cca = (cca > 0) ? (double)busy / cca : 0;
+}
+
+
+/**
+ * @brief Runs the fixed and the adaptive setup for several node counts
+ *
+ * @return 0
+ */
+int main(void)
+{
+    static const int nodes[] = {2, 5, 10, 20, 40};
+
+    trx_mock_reset();
+    tal_pib[RF09].MinBE = 3;
+    tal_pib[RF09].MaxBE = 5;
+    tal_pib[RF09].MaxCSMABackoffs = 4;
+
+    printf("MaxBE limit %u\n", TAL_CSMA_ADAPT_MAX_BE);
+    printf(" N | setup    | goodput | drops  | delay ms | ms/frame | busy CCA\n");
+    for (uint8_t k = 0; k < (sizeof(nodes) / sizeof(nodes[0])); k++)
+    {
+        for (int a = 0; a < 2; a++)
+        {
+            sim_result_t res;
+
+            adaptive = (a != 0);
+            run(nodes[k], &res);
+            printf("%2d | %-8s | %5.1f%%  | %5.1f%% | %8.1f | %8.1f | %5.1f%%\n",
+                   nodes[k], adaptive ? "adaptive" : "fixed",
+                   100 * res.goodput, 100 * res.drops, res.delay_ms,
+                   res.frame_ms, 100 * res.busy_cca);
+        }
+    }
+
+    tal_csma_adapt_enable(RF09, false);
+
+    return 0;
+}
+
+/* EOF */
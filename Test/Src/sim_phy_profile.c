@@ -0,0 +1,232 @@
+/**
+ * @file sim_phy_profile.c
+ *
+ * @brief Host benchmark of the SPI cost of the PHY presets.
+ *
+ * Each preset of phy_conf.c is applied to a trx in TRXOFF coming from the
+ * next preset, three times:
+ * - before: the tal_pib_set() sequence the preset issued before the PHY
+ *   profiles, with the values the profile has set; tal_pib_set() flushes
+ *   the profile cache
+ * - cold: the preset through tal_phy_profile_apply(), compiling the profile
+ * - cached: the preset once more from the profile cache
+ *
+ * The compilation runs against the register shadow, so a cold change costs
+ * the same SPI accesses as a cached one; it differs in CPU time only.
+ *
+ * The SPI accesses and octets are taken from pal_trx_get_stats().
+ *
+ * Build and run with "make sim".
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pal.h"
+#include "tal.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include "ieee_const.h"
+#include "ieee_154g.h"
+#include "app_common.h"
+#include "trx_mock.h"
+
+/* === MACROS ============================================================== */
+
+#define NUM_PRESETS                 (4)
+
+/* === TYPES =============================================================== */
+
+/**
+ * PHY preset of phy_conf.c and the attributes it used to set
+ */
+typedef struct preset_tag
+{
+    const char *name;
+    retval_t (*set)(trx_id_t trx_id);
+    const uint8_t *attrs;
+    uint8_t num_attrs;
+} preset_t;
+
+/* === GLOBALS ============================================================= */
+
+static const uint8_t fsk_attrs[] =
+{
+    phyFSKPreambleLength, phyFSKFECEnabled, phyFSKScramblePSDU, macFCSType,
+    phySetting, phyCurrentChannel, phyTransmitPower, phyRPCEnabled
+};
+
+static const uint8_t ofdm_attrs[] =
+{
+    phyOFDMInterleaving, phyOFDMMCS, macFCSType,
+    phySetting, phyCurrentChannel, phyTransmitPower
+};
+
+static const uint8_t oqpsk_attrs[] =
+{
+    phyOQPSKRateMode, macFCSType,
+    phySetting, phyCurrentChannel, phyTransmitPower, phyRPCEnabled
+};
+
+static const uint8_t leg_oqpsk_attrs[] =
+{
+    phySetting, phyCurrentChannel, phyTransmitPower
+};
+
+static const preset_t presets[NUM_PRESETS] =
+{
+    {"FSK", set_fsk, fsk_attrs, sizeof(fsk_attrs)},
+    {"OFDM", set_ofdm, ofdm_attrs, sizeof(ofdm_attrs)},
+    {"MR-O-QPSK", set_oqpsk, oqpsk_attrs, sizeof(oqpsk_attrs)},
+    {"O-QPSK", set_leg_oqpsk, leg_oqpsk_attrs, sizeof(leg_oqpsk_attrs)}
+};
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Gets the value of an attribute within a PIB
+ *
+ * @param pib PIB holding the values
+ * @param attr PIB attribute
+ *
+ * @return Pointer to the value
+ */
+static pib_value_t *attr_value(tal_pib_t *pib, uint8_t attr)
+{
+    /* The presets set the FCS type as 16 bit value */
+    static uint16_t crc_type = FCS_TYPE_4_OCTETS;
+
+    switch (attr)
+    {
+        case phyFSKPreambleLength:
+            return (pib_value_t *)&pib->FSKPreambleLength;
+        case phyFSKFECEnabled:
+            return (pib_value_t *)&pib->FSKFECEnabled;
+        case phyFSKScramblePSDU:
+            return (pib_value_t *)&pib->FSKScramblePSDU;
+        case phyOFDMInterleaving:
+            return (pib_value_t *)&pib->OFDMInterleaving;
+        case phyOFDMMCS:
+            return (pib_value_t *)&pib->OFDMMCS;
+        case phyOQPSKRateMode:
+            return (pib_value_t *)&pib->OQPSKRateMode;
+        case phySetting:
+            return (pib_value_t *)&pib->phy;
+        case phyCurrentChannel:
+            return (pib_value_t *)&pib->CurrentChannel;
+        case phyTransmitPower:
+            return (pib_value_t *)&pib->TransmitPower;
+        case phyRPCEnabled:
+            return (pib_value_t *)&pib->RPCEnabled;
+        default:
+            return (pib_value_t *)&crc_type;
+    }
+}
+
+
+/**
+ * @brief Applies a preset and counts the SPI accesses
+ *
+ * @param trx_id Transceiver identifier
+ * @param preset Preset
+ * @param pib PIB holding the values of the preset; NULL to apply the
+ *            profile, otherwise the attributes are set one by one
+ * @param spi Storage for the SPI accesses
+ */
+static void apply(trx_id_t trx_id, const preset_t *preset, tal_pib_t *pib,
+                  pal_trx_stats_t *spi)
+{
+    pal_trx_stats_t start;
+    retval_t status = MAC_SUCCESS;
+
+    pal_trx_get_stats(&start);
+    if (pib == NULL)
+    {
+        status = preset->set(trx_id);
+    }
+    else
+    {
+        for (uint8_t i = 0; (i < preset->num_attrs) && (status == MAC_SUCCESS); i++)
+        {
+            status = tal_pib_set(trx_id, preset->attrs[i], attr_value(pib, preset->attrs[i]));
+        }
+    }
+    pal_trx_get_stats(spi);
+    spi->accesses -= start.accesses;
+    spi->bytes -= start.bytes;
+
+    if (status != MAC_SUCCESS)
+    {
+        printf("%s failed with 0x%02X\n", preset->name, status);
+    }
+}
+
+
+int main(void)
+{
+    static const char *trx_name[NUM_TRX] = {"RF09", "RF24"};
+    tal_pib_t pib;
+    pal_trx_stats_t before;
+    pal_trx_stats_t cold;
+    pal_trx_stats_t cached;
+    pal_trx_stats_t other;
+    tal_phy_profile_stats_t stats;
+    uint32_t compiles;
+
+    trx_mock_reset();
+
+    printf("SPI accesses / octets per PHY change\n");
+    printf("%5s %10s %12s %12s %12s\n", "trx", "preset", "before", "cold", "cached");
+    for (trx_id_t trx_id = RF09; trx_id < NUM_TRX; trx_id++)
+    {
+        trx_mock_setup(trx_id);
+        for (uint8_t p = 0; p < NUM_PRESETS; p++)
+        {
+            const preset_t *preset = &presets[p];
+            const preset_t *next = &presets[(p + 1) % NUM_PRESETS];
+
+            apply(trx_id, preset, NULL, &other);
+            memcpy(&pib, &tal_pib[trx_id], sizeof(tal_pib_t));
+
+            apply(trx_id, next, NULL, &other);
+            apply(trx_id, preset, &pib, &before);
+            if (memcmp(&pib.phy, &tal_pib[trx_id].phy, sizeof(phy_t)) != 0)
+            {
+                printf("%s: the attributes do not match the profile\n", preset->name);
+            }
+            apply(trx_id, next, NULL, &other);
+            tal_phy_profile_get_stats(trx_id, &stats);
+            compiles = stats.compiles;
+            apply(trx_id, preset, NULL, &cold);
+            apply(trx_id, next, NULL, &other);
+            apply(trx_id, preset, NULL, &cached);
+            tal_phy_profile_get_stats(trx_id, &stats);
+            if (stats.compiles != (compiles + 1))
+            {
+                printf("%s: %u compiles instead of 1\n", preset->name,
+                       (unsigned)(stats.compiles - compiles));
+            }
+
+            printf("%5s %10s %5u / %4u %5u / %4u %5u / %4u\n", trx_name[trx_id], preset->name,
+                   (unsigned)before.accesses, (unsigned)before.bytes,
+                   (unsigned)cold.accesses, (unsigned)cold.bytes,
+                   (unsigned)cached.accesses, (unsigned)cached.bytes);
+        }
+    }
+
+    return 0;
+}
+
+/* EOF */
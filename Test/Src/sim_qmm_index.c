@@ -0,0 +1,154 @@
+/**
+ * @file sim_qmm_index.c
+ *
+ * @brief Host benchmark of the keyed QMM queue index.
+ *
+ * A queue holds DEPTH buffers with distinct keys. Each step removes the
+ * buffer of a random key and appends it again, once with a search_t
+ * criteria scan and once with qmm_queue_remove_by_key(). The queue depth
+ * is limited to 255 by the 8-bit queue size.
+ *
+ * Build and run with "make sim".
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include "pal.h"
+#include "bmm.h"
+#include "qmm.h"
+#include "trx_mock.h"
+
+/* === MACROS ============================================================== */
+
+#define MAX_DEPTH                   (255)
+#define MAX_SLOTS                   (512)
+#define STEPS                       (200000L)
+
+/* === GLOBALS ============================================================= */
+
+static buffer_t bufs[MAX_DEPTH];
+static uint32_t keys[MAX_DEPTH];
+static qmm_index_slot_t slots[MAX_SLOTS];
+
+static const uint8_t depths[] = {16, 64, 255};
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Gets the key of a buffer body
+ */
+static uint32_t get_key(void *buf)
+{
+    return *(uint32_t *)buf;
+}
+
+
+/**
+ * @brief Search criteria matching the key given as handle
+ */
+static uint8_t match_key(void *buf, void *handle)
+{
+    return *(uint32_t *)buf == *(uint32_t *)handle;
+}
+
+
+/**
+ * @brief Gets the monotonic time in ns
+ */
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+
+/**
+ * @brief Runs the remove and append steps on a queue
+ *
+ * @param depth Number of buffers in the queue
+ * @param indexed true to use the index, false to scan
+ * @param idx Index, used if indexed
+ *
+ * @return Mean time per step in ns
+ */
+static double run(uint8_t depth, bool indexed, qmm_index_t *idx)
+{
+    queue_t q;
+    uint16_t num_slots = 2;
+
+    while (num_slots < (uint16_t)depth * 2)
+    {
+        num_slots <<= 1;
+    }
+
+    qmm_queue_init(&q);
+    for (uint8_t i = 0; i < depth; i++)
+    {
+        keys[i] = (uint32_t)i * 7919UL;
+        bufs[i].body = (uint8_t *)&keys[i];
+        qmm_queue_append(&q, &bufs[i]);
+    }
+    if (indexed)
+    {
+        qmm_queue_index_init(&q, idx, slots, num_slots, depth, get_key);
+    }
+
+    srand(1);
+    uint64_t start = now_ns();
+    for (long n = 0; n < STEPS; n++)
+    {
+        uint32_t key = (uint32_t)(rand() % depth) * 7919UL;
+        buffer_t *buf;
+
+        if (indexed)
+        {
+            buf = qmm_queue_remove_by_key(&q, key);
+        }
+        else
+        {
+            search_t search = {match_key, &key};
+            buf = qmm_queue_remove(&q, &search);
+        }
+        if ((buf == NULL) || (qmm_queue_append(&q, buf) != MAC_SUCCESS))
+        {
+            printf("depth %u: step %ld failed\n", depth, n);
+            break;
+        }
+    }
+
+    return (double)(now_ns() - start) / STEPS;
+}
+
+
+int main(void)
+{
+    printf("%6s %14s %14s %14s\n", "depth", "scan ns/op", "index ns/op", "probes/lookup");
+    for (uint8_t i = 0; i < sizeof(depths); i++)
+    {
+        qmm_index_t idx;
+        double scan = run(depths[i], false, NULL);
+        double index = run(depths[i], true, &idx);
+
+        printf("%6u %14.1f %14.1f %14.2f\n", depths[i], scan, index,
+               (double)idx.probes / idx.lookups);
+    }
+
+    return 0;
+}
+
+/* EOF */
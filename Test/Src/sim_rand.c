@@ -0,0 +1,254 @@
+/**
+ * @file sim_rand.c
+ *
+ * @brief Host benchmark of the entropy pool and the backoff generators.
+ *
+ * Both transceivers are set idle in RX and harvest RNDV on their entropy
+ * timers. The SPI is emulated as SPI_ACCESS_NS per message plus
+ * SPI_BYTE_NS per chip-select frame, so a burst of TAL_ENTROPY_BURST
+ * values costs a single message. The simulation reports:
+ * - the time from starting the entropy timers until the pool is ready
+ * - the SPI time per raw octet, batched by pal_dev_read_repeat() and read
+ *   by single pal_dev_reg_read() calls
+ * - the throughput of tal_get_random_bytes() against one rand() call per
+ *   octet
+ * - the draws per second of TAL_RAND() against rand() with one thread, and
+ *   with two threads using a transceiver each
+ * - the largest deviation of a 32-bin histogram of TAL_RAND() & 31, as
+ *   used for the backoffs, from the uniform distribution
+ *
+ * The timers are stopped and the SPI is instant again after the first two
+ * steps.
+ *
+ * Build and run with "make sim".
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "pal.h"
+#include "tal.h"
+#include "tal_config.h"
+#include "tal_internal.h"
+#include "trx_mock.h"
+
+/* === MACROS ============================================================== */
+
+#define SPI_ACCESS_NS               (20000)
+#define SPI_BYTE_NS                 (3000)
+#define SPI_ROUNDS                  (200)
+#define BLOCK_LEN                   (256)
+#define OUT_BYTES                   (32L * 1024 * 1024)
+#define DRAWS                       (50000000L)
+#define HIST_BINS                   (32)
+#define HIST_DRAWS                  (HIST_BINS * 100000L)
+
+/* === TYPES =============================================================== */
+
+/**
+ * Draws of a thread
+ */
+typedef struct draw_job_tag
+{
+    trx_id_t trx_id;
+    bool tal_rand;
+    uint32_t sink;
+} draw_job_t;
+
+/* === GLOBALS ============================================================= */
+
+static uint8_t block[BLOCK_LEN];
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Gets the monotonic time in ns
+ */
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+
+/**
+ * @brief Draws DRAWS numbers
+ *
+ * @param arg Draw job
+ */
+static void *draw(void *arg)
+{
+    draw_job_t *job = (draw_job_t *)arg;
+    uint32_t sink = 0;
+
+    for (long i = 0; i < DRAWS; i++)
+    {
+        sink += job->tal_rand ? TAL_RAND(job->trx_id) : (uint32_t)rand();
+    }
+    job->sink = sink;
+
+    return NULL;
+}
+
+
+/**
+ * @brief Measures the draws per second
+ *
+ * @param threads Number of threads, one per transceiver
+ * @param tal_rand true for TAL_RAND(), false for rand()
+ *
+ * @return Draws of all threads in M/s
+ */
+static double draw_rate(uint8_t threads, bool tal_rand)
+{
+    pthread_t thread[NUM_TRX];
+    draw_job_t job[NUM_TRX];
+    uint64_t start = now_ns();
+
+    for (uint8_t i = 0; i < threads; i++)
+    {
+        job[i].trx_id = (trx_id_t)i;
+        job[i].tal_rand = tal_rand;
+        pthread_create(&thread[i], NULL, draw, &job[i]);
+    }
+    for (uint8_t i = 0; i < threads; i++)
+    {
+        pthread_join(thread[i], NULL);
+    }
+
+    return (double)DRAWS * threads * 1000 / (now_ns() - start);
+}
+
+
+/**
+ * @brief Measures the octet throughput
+ *
+ * @param pool true for tal_get_random_bytes(), false for rand()
+ *
+ * @return Throughput in MB/s
+ */
+static double octet_rate(bool pool)
+{
+    uint64_t start = now_ns();
+
+    for (long n = 0; n < OUT_BYTES; n += BLOCK_LEN)
+    {
+        if (pool)
+        {
+            tal_get_random_bytes(block, BLOCK_LEN);
+        }
+        else
+        {
+            for (uint16_t i = 0; i < BLOCK_LEN; i++)
+            {
+                block[i] = (uint8_t)rand();
+            }
+        }
+    }
+
+    return (double)OUT_BYTES * 1000 / (now_ns() - start);
+}
+
+
+int main(void)
+{
+    tal_entropy_stats_t stats;
+    uint8_t raw[TAL_ENTROPY_BURST];
+    uint32_t hist[HIST_BINS];
+    double dev = 0;
+    uint64_t start;
+    uint64_t batched;
+    uint64_t single;
+
+    trx_mock_reset();
+    for (trx_id_t trx_id = RF09; trx_id < NUM_TRX; trx_id++)
+    {
+        trx_mock_setup(trx_id);
+        trx_state[trx_id] = RF_RX;
+    }
+    trx_mock_set_spi_speed(SPI_ACCESS_NS, SPI_BYTE_NS);
+
+    /* Pool ready time */
+    start = now_ns();
+    for (trx_id_t trx_id = RF09; trx_id < NUM_TRX; trx_id++)
+    {
+        init_entropy_pool(trx_id);
+    }
+    do
+    {
+        tal_get_entropy_stats(&stats);
+    } while (!stats.ready);
+    printf("pool ready after %u bursts: %.1f ms\n", (unsigned)stats.bursts,
+           (double)(now_ns() - start) / 1000000);
+
+    /* SPI time per raw octet */
+    start = now_ns();
+    for (uint16_t r = 0; r < SPI_ROUNDS; r++)
+    {
+        pal_dev_read_repeat(RF215_TRX, RG_RF09_RNDV, raw, TAL_ENTROPY_BURST);
+    }
+    batched = now_ns() - start;
+    start = now_ns();
+    for (uint16_t r = 0; r < SPI_ROUNDS; r++)
+    {
+        for (uint8_t i = 0; i < TAL_ENTROPY_BURST; i++)
+        {
+            raw[i] = pal_dev_reg_read(RF215_TRX, RG_RF09_RNDV);
+        }
+    }
+    single = now_ns() - start;
+    printf("SPI time per raw octet: %.1f us batched, %.1f us single reads\n",
+           (double)batched / (SPI_ROUNDS * TAL_ENTROPY_BURST * 1000),
+           (double)single / (SPI_ROUNDS * TAL_ENTROPY_BURST * 1000));
+
+    for (trx_id_t trx_id = RF09; trx_id < NUM_TRX; trx_id++)
+    {
+        pal_timer_stop(TAL_T_ENTROPY, trx_id);
+    }
+    trx_mock_set_spi_speed(0, 0);
+
+    printf("tal_get_random_bytes(): %.0f MB/s, rand() octets: %.0f MB/s\n",
+           octet_rate(true), octet_rate(false));
+    printf("%8s %14s %14s\n", "threads", "rand() M/s", "TAL_RAND M/s");
+    for (uint8_t threads = 1; threads <= NUM_TRX; threads++)
+    {
+        printf("%8u %14.1f %14.1f\n", threads,
+               draw_rate(threads, false), draw_rate(threads, true));
+    }
+
+    memset(hist, 0, sizeof(hist));
+    for (long i = 0; i < HIST_DRAWS; i++)
+    {
+        hist[TAL_RAND(RF09) & (HIST_BINS - 1)]++;
+    }
+    for (uint8_t i = 0; i < HIST_BINS; i++)
+    {
+        double d = ((double)hist[i] * HIST_BINS / HIST_DRAWS - 1) * 100;
+        if (((d < 0) ? -d : d) > ((dev < 0) ? -dev : dev))
+        {
+            dev = d;
+        }
+    }
+    printf("%u-bin histogram of %ld draws: largest deviation %+.2f%%\n",
+           HIST_BINS, HIST_DRAWS, dev);
+
+    return 0;
+}
+
+/* EOF */
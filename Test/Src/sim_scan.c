@@ -0,0 +1,137 @@
+/**
+ * @file sim_scan.c
+ *
+ * @brief Host benchmark of the multi-channel energy sweep.
+ *
+ * Sweeps of ten channels run on the register mock with 128 us samples and
+ * several dwell times. The channels per second follow from the sweep
+ * duration reported by tal_scan_get_stats(), the SPI accesses per sample
+ * from the PAL counters.
+ *
+ * For comparison, tal_ed_start() measures one channel in 1920 symbols
+ * with an EDC interrupt per sample, i.e. 30.7 ms or at most 32 channels
+ * per second with 16 us symbols.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include "pal.h"
+#include "tal.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include "ieee_const.h"
+#include "trx_mock.h"
+
+/* === MACROS ============================================================== */
+
+#define NUM_CHANNELS                (10)
+#define SAMPLE_US                   (128)
+/** Sweeps per dwell time */
+#define SWEEPS                      (5)
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Sets up the TAL of a trx in TRXOFF without a transceiver
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void setup(trx_id_t trx_id)
+{
+    CALC_REG_OFFSET(trx_id);
+
+    memset(&tal_pib[trx_id], 0, sizeof(tal_pib_t));
+    init_tal_pib(trx_id);
+    calculate_pib_values(trx_id);
+    tal_state[trx_id] = TAL_IDLE;
+    trx_state[trx_id] = RF_TRXOFF;
+    trx_mock_reg[GET_REG_ADDR(RG_RF09_STATE)] = RF_TRXOFF;
+    trx_mock_reg[GET_REG_ADDR(RG_BBC0_PC)] |= PC_BBEN_MASK;
+    write_all_tal_pib_to_trx(trx_id);
+    config_phy(trx_id);
+    /* Energy of every sample */
+    trx_mock_reg[GET_REG_ADDR(RG_RF09_EDV)] = (uint8_t)-90;
+}
+
+
+/**
+ * @brief Runs the sweeps of a dwell time
+ *
+ * @param dwell_us Measurement time per channel in us
+ */
+static void run(uint32_t dwell_us)
+{
+    static const uint16_t channels[NUM_CHANNELS] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    tal_scan_result_t results[NUM_CHANNELS];
+    tal_scan_cfg_t cfg;
+    tal_scan_stats_t before;
+    tal_scan_stats_t after;
+    pal_trx_stats_t spi_before;
+    pal_trx_stats_t spi_after;
+
+    cfg.channels = channels;
+    cfg.num_channels = NUM_CHANNELS;
+    cfg.dwell_us = dwell_us;
+    cfg.sample_us = SAMPLE_US;
+
+    tal_scan_get_stats(RF09, &before);
+    pal_trx_get_stats(&spi_before);
+    for (uint8_t i = 0; i < SWEEPS; i++)
+    {
+        trx_mock_scan_done = 0;
+        if (tal_scan_start(RF09, &cfg, results) != MAC_SUCCESS)
+        {
+            printf("sweep not started\n");
+            return;
+        }
+        while (trx_mock_scan_done == 0)
+        {
+            usleep(100);
+        }
+        if (trx_mock_scan_status != MAC_SUCCESS)
+        {
+            printf("sweep failed\n");
+        }
+    }
+    pal_trx_get_stats(&spi_after);
+    tal_scan_get_stats(RF09, &after);
+
+    uint32_t channels_done = after.channels - before.channels;
+    uint32_t samples = after.samples - before.samples;
+    uint32_t total_us = after.total_us - before.total_us;
+
+    printf("dwell %5u us | %6.0f ch/s | %5.1f samples/ch | %4.1f SPI accesses/sample\n",
+           (unsigned)dwell_us, (double)channels_done * 1000000 / total_us,
+           (double)samples / channels_done,
+           (double)(spi_after.accesses - spi_before.accesses) / samples);
+}
+
+
+int main(void)
+{
+    trx_mock_reset();
+    setup(RF09);
+
+    printf("%u channels, %u us samples\n", NUM_CHANNELS, SAMPLE_US);
+    run(500);
+    run(1000);
+    run(5000);
+
+    return 0;
+}
+
+/* EOF */
@@ -0,0 +1,143 @@
+/**
+ * @file sim_tsch.c
+ *
+ * @brief Host simulation of the TSCH slot timing.
+ *
+ * RF09 runs a slotframe of two 10 ms timeslots for SIM_DURATION_MS: a TX
+ * cell at slot offset 0 and an RX cell at slot offset 1. The TX cell finds
+ * a frame without ACK request queued in every slotframe; the mock keeps it
+ * on air for its PPDU duration. No frame is received, so the receiver is
+ * switched off after TsRxWait. The slots run on the PAL timers in real
+ * time.
+ *
+ * The lateness of the RF_TX and RF_RX commands relative to the slot timing
+ * is taken from tal_tsch_get_stats(). "make sim" runs the simulation twice:
+ * with the default TAL_TSCH_SPIN_US, and as sim_tsch_no_spin with the TSCH
+ * module built with TAL_TSCH_SPIN_US 0, so that the action timer expires at
+ * the slot action itself and its latency adds to the lateness.
+ *
+ * Build and run with "make sim".
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pal.h"
+#include "tal.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include "ieee_const.h"
+#include "ieee_154g.h"
+#include "trx_mock.h"
+
+/* === MACROS ============================================================== */
+
+#define SIM_TRX                     (RF09)
+#define SIM_DURATION_MS             (2000)
+#define SIM_FRAME_LEN               (20)
+
+/* === GLOBALS ============================================================= */
+
+static uint8_t mpdu[SIM_FRAME_LEN];
+static frame_info_t frame;
+
+static const uint16_t hop_seq[] = {0, 3, 1, 4, 2};
+
+static const tal_tsch_cell_t cells[] =
+{
+    {0, 0, TAL_TSCH_OPT_TX},
+    {1, 0, TAL_TSCH_OPT_RX}
+};
+
+/* === IMPLEMENTATION ====================================================== */
+
+int main(void)
+{
+    tal_tsch_cfg_t cfg;
+    tal_tsch_stats_t stats;
+    retval_t status;
+    unsigned seen;
+    unsigned queued = 0;
+    uint32_t start;
+    uint32_t now;
+
+    trx_mock_reset();
+    trx_mock_setup(SIM_TRX);
+
+    mpdu[PL_POS_FCF_1] = FCF_FRAMETYPE_DATA;
+    frame.mpdu = mpdu;
+    frame.len_no_crc = SIM_FRAME_LEN;
+    frame.trx_id = SIM_TRX;
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.hop_seq = hop_seq;
+    cfg.hop_seq_len = sizeof(hop_seq) / sizeof(hop_seq[0]);
+
+    tal_tsch_set_slotframe(SIM_TRX, 0, 2);
+    for (uint8_t i = 0; i < sizeof(cells) / sizeof(cells[0]); i++)
+    {
+        tal_tsch_add_cell(SIM_TRX, 0, &cells[i]);
+    }
+
+    seen = trx_mock_tx_starts[SIM_TRX];
+    pal_get_current_time(&start);
+    if (tal_tsch_start(SIM_TRX, &cfg) != MAC_SUCCESS)
+    {
+        printf("sim_tsch: tal_tsch_start() failed\n");
+        return 1;
+    }
+
+    do
+    {
+        /* One frame is queued at a time; it is sent within the next TX cell */
+        if (queued == trx_mock_tx_done)
+        {
+            tal_tsch_tx_frame(SIM_TRX, &frame);
+            queued++;
+        }
+        if (trx_mock_tx_starts[SIM_TRX] != seen)
+        {
+            seen++;
+            trx_mock_wait_us(get_ppdu_duration_us(SIM_TRX, SIM_FRAME_LEN + tal_pib[SIM_TRX].FCSLen));
+            trx_mock_irq(SIM_TRX, RF_IRQ_NO_IRQ, BB_IRQ_TXFE);
+        }
+        pal_get_current_time(&now);
+    } while ((now - start) < (SIM_DURATION_MS * 1000UL));
+
+    /* Taken ahead of the stop, which expires the queued frame */
+    tal_tsch_get_stats(SIM_TRX, &stats);
+    status = trx_mock_tx_status;
+    tal_tsch_stop(SIM_TRX);
+
+    printf("TSCH, %u ms timeslots for %u ms, TAL_TSCH_SPIN_US %u\n",
+           TAL_TSCH_TIMESLOT_US / 1000, SIM_DURATION_MS, TAL_TSCH_SPIN_US);
+    printf("%8s %8s %8s %10s %8s %8s %8s\n", "TX", "RX", "skipped",
+           "mean us", "min us", "max us", "late");
+    printf("%8u %8u %8u %10.1f %8u %8u %8u\n",
+           (unsigned)stats.tx_slots, (unsigned)stats.rx_slots,
+           (unsigned)stats.skipped_slots,
+           (stats.slot_lateness.count > 0) ?
+           (double)stats.slot_lateness.total_us / stats.slot_lateness.count : 0.0,
+           (unsigned)stats.slot_lateness.min_us, (unsigned)stats.slot_lateness.max_us,
+           (unsigned)stats.late_slots);
+    if (status != MAC_SUCCESS)
+    {
+        printf("last frame failed with 0x%02X\n", status);
+    }
+
+    return 0;
+}
+
+/* EOF */
@@ -0,0 +1,213 @@
+/**
+ * @file sim_tx_queue.c
+ *
+ * @brief Host benchmark of the TX queue under saturation.
+ *
+ * The application keeps RF09 busy with data frames for RUN_US of real
+ * time, with and without ACK request. With the queue it refills
+ * tal_tx_enqueue() until it overflows; without it the application
+ * resubmits each frame with tal_tx_frame() APP_LATENCY_US after its
+ * tal_tx_frame_done_cb(), i.e. after one round of its main loop.
+ *
+ * The mock keeps each frame on air for its PPDU duration and returns the
+ * ACK of the peer after the turnaround time. The frames are sent without
+ * CSMA-CA and IFS; both cost the same with and without the queue.
+ *
+ * Build and run with "make sim".
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pal.h"
+#include "tal.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include "ieee_const.h"
+#include "trx_mock.h"
+
+/* === MACROS ============================================================== */
+
+#define SIM_TRX                     (RF09)
+/** MPDU length without FCS */
+#define FRAME_LEN                   (50)
+#define RUN_US                      (1000000UL)
+/** Frames in use: a full queue, the frame on air and the one to be queued */
+#define POOL_SIZE                   (TAL_TX_QUEUE_LEN + 2)
+
+/* === GLOBALS ============================================================= */
+
+static uint8_t mpdu[POOL_SIZE][FRAME_LEN];
+static frame_info_t pool[POOL_SIZE];
+
+/** Main loop latencies of the application without queue, 0 selects the queue */
+static const uint32_t app_latency_us[] = {0, 100, 1000};
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Plays the air interface for a started frame
+ *
+ * @param ack true if the peer acknowledges the frame
+ */
+static void frame_on_air(bool ack)
+{
+    uint8_t psdu[aMaxPHYPacketSize];
+    uint16_t len = trx_mock_get_tx_frame(SIM_TRX, psdu);
+
+    trx_mock_wait_us(get_ppdu_duration_us(SIM_TRX, len));
+    trx_mock_irq(SIM_TRX, RF_IRQ_NO_IRQ, BB_IRQ_TXFE);
+
+    if (ack)
+    {
+        uint8_t ack_psdu[3] = {FCF_FRAMETYPE_ACK, 0, psdu[PL_POS_SEQ_NUM]};
+        uint16_t ack_len = sizeof(ack_psdu) + tal_pib[SIM_TRX].FCSLen;
+
+        trx_mock_wait_us(aTurnaroundTime * tal_pib[SIM_TRX].SymbolDuration_us +
+                         get_ppdu_duration_us(SIM_TRX, ack_len));
+        trx_mock_rx_frame(SIM_TRX, ack_psdu, ack_len);
+    }
+}
+
+
+/**
+ * @brief Gets the pool frame for the n-th submission
+ *
+ * @param n Number of the submission
+ * @param ack true if an ACK is requested
+ *
+ * @return Frame
+ */
+static frame_info_t *get_frame(unsigned n, bool ack)
+{
+    frame_info_t *frame = &pool[n % POOL_SIZE];
+
+    frame->mpdu[PL_POS_FCF_1] = FCF_FRAMETYPE_DATA | (ack ? FCF_ACK_REQUEST : 0);
+    frame->mpdu[PL_POS_SEQ_NUM] = (uint8_t)n;
+
+    return frame;
+}
+
+
+/**
+ * @brief Saturates the trx for RUN_US
+ *
+ * @param latency_us Main loop latency of the application, 0 uses the queue
+ * @param ack true if ACKs are requested
+ *
+ * @return Frames per second reported as successful
+ */
+static unsigned run(uint32_t latency_us, bool ack)
+{
+    uint32_t start;
+    uint32_t now;
+    uint32_t submit_time;
+    unsigned next = 0;
+    unsigned seen_starts;
+    unsigned seen_done;
+    unsigned succeeded = 0;
+
+    trx_mock_setup(SIM_TRX);
+    trx_mock_clear_writes();
+    seen_starts = trx_mock_tx_starts[SIM_TRX];
+    seen_done = trx_mock_tx_done;
+
+    pal_get_current_time(&start);
+    submit_time = start;
+    do
+    {
+        pal_get_current_time(&now);
+
+        if (latency_us == 0)
+        {
+            while (tal_tx_enqueue(SIM_TRX, get_frame(next, ack), NO_CSMA_NO_IFS, false) ==
+                   MAC_SUCCESS)
+            {
+                next++;
+            }
+        }
+        else if ((tal_state[SIM_TRX] == TAL_IDLE) && ((int32_t)(now - submit_time) >= 0))
+        {
+            if (tal_tx_frame(SIM_TRX, get_frame(next, ack), NO_CSMA_NO_IFS, false) == MAC_SUCCESS)
+            {
+                next++;
+            }
+        }
+
+        if (trx_mock_tx_starts[SIM_TRX] != seen_starts)
+        {
+            seen_starts++;
+            frame_on_air(ack);
+        }
+
+        if (trx_mock_tx_done != seen_done)
+        {
+            if (trx_mock_tx_status == MAC_SUCCESS)
+            {
+                succeeded++;
+            }
+            seen_done = trx_mock_tx_done;
+            pal_get_current_time(&submit_time);
+            submit_time += latency_us;
+        }
+    } while ((now - start) < RUN_US);
+
+    /* Let the last frame end and drop the queued ones */
+    pal_timer_stop(TAL_T, SIM_TRX);
+    flush_tx_queue(SIM_TRX);
+    if (tal_state[SIM_TRX] == TAL_TX)
+    {
+        tx_done_handling(SIM_TRX, FAILURE);
+    }
+    tal_state[SIM_TRX] = TAL_IDLE;
+
+    return (unsigned)((succeeded * 1000000ULL) / RUN_US);
+}
+
+
+int main(void)
+{
+    trx_mock_reset();
+    for (uint8_t i = 0; i < POOL_SIZE; i++)
+    {
+        memset(mpdu[i], 0, FRAME_LEN);
+        pool[i].mpdu = mpdu[i];
+        pool[i].len_no_crc = FRAME_LEN;
+    }
+
+    trx_mock_setup(SIM_TRX);
+    printf("%u byte frames, PPDU %u us\n", FRAME_LEN,
+           (unsigned)get_ppdu_duration_us(SIM_TRX, FRAME_LEN + tal_pib[SIM_TRX].FCSLen));
+    printf("%-22s %12s %12s\n", "", "frames/s", "with ACK");
+    for (uint8_t i = 0; i < sizeof(app_latency_us) / sizeof(app_latency_us[0]); i++)
+    {
+        char name[32];
+        if (app_latency_us[i] == 0)
+        {
+            snprintf(name, sizeof(name), "queue");
+        }
+        else
+        {
+            snprintf(name, sizeof(name), "no queue, loop %u us", (unsigned)app_latency_us[i]);
+        }
+        unsigned no_ack = run(app_latency_us[i], false);
+        unsigned with_ack = run(app_latency_us[i], true);
+        printf("%-22s %12u %12u\n", name, no_ack, with_ack);
+    }
+
+    return 0;
+}
+
+/* EOF */
@@ -0,0 +1,297 @@
+/**
+ * @file test_ch_hop.c
+ *
+ * @brief Host test of the DH1CF hop sequence against lookup3.
+ *
+ * The reference is hashword() of lookup3 by Bob Jenkins. It is checked
+ * against the published hashlittle() vectors first; hashword() of three
+ * words equals hashlittle() of the same words as 12 little endian octets.
+ * The channel of slot n is then the usable channel with the index
+ * hashword({n, EUI-64 octets 4..7, EUI-64 octets 0..3}, 3, 0) modulo the
+ * number of usable channels, the EUI-64 words being big endian.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "pal.h"
+#include "tal.h"
+#include "tal_config.h"
+#include "tal_internal.h"
+#include "trx_mock.h"
+
+/* === MACROS ============================================================== */
+
+#define TEST_TRX                    (RF09)
+
+/** Number of slots of a hop sequence */
+#define NUM_SLOTS                   (65536L)
+
+/** Slots per tal_ch_hop_get_sequence() call */
+#define SEQ_BLOCK                   (32768)
+
+#define rot(x, k) (((x) << (k)) | ((x) >> (32 - (k))))
+
+/** lookup3 mix() */
+#define mix(a, b, c)                                \
+    {                                               \
+        a -= c;  a ^= rot(c, 4);   c += b;          \
+        b -= a;  b ^= rot(a, 6);   a += c;          \
+        c -= b;  c ^= rot(b, 8);   b += a;          \
+        a -= c;  a ^= rot(c, 16);  c += b;          \
+        b -= a;  b ^= rot(a, 19);  a += c;          \
+        c -= b;  c ^= rot(b, 4);   b += a;          \
+    }
+
+/** lookup3 final() */
+#define final(a, b, c)                              \
+    {                                               \
+        c ^= b; c -= rot(b, 14);                    \
+        a ^= c; a -= rot(c, 11);                    \
+        b ^= a; b -= rot(a, 25);                    \
+        c ^= b; c -= rot(b, 16);                    \
+        a ^= c; a -= rot(c, 4);                     \
+        b ^= a; b -= rot(a, 14);                    \
+        c ^= b; c -= rot(b, 24);                    \
+    }
+
+/* === GLOBALS ============================================================= */
+
+static uint16_t seq[SEQ_BLOCK];
+
+static const uint8_t eui64[][8] =
+{
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x04, 0x25, 0x19, 0x18, 0x01, 0x02, 0x03},
+    {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE}
+};
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Reference hashword() of lookup3
+ *
+ * @param k Words to be hashed
+ * @param length Number of words
+ * @param initval Initial value
+ *
+ * @return Hash value
+ */
+static uint32_t ref_hashword(const uint32_t *k, size_t length, uint32_t initval)
+{
+    uint32_t a, b, c;
+
+    a = b = c = 0xDEADBEEF + (((uint32_t)length) << 2) + initval;
+
+    while (length > 3)
+    {
+        a += k[0];
+        b += k[1];
+        c += k[2];
+        mix(a, b, c);
+        length -= 3;
+        k += 3;
+    }
+
+    switch (length)
+    {
+        case 3:
+            c += k[2];
+        /* fall through */
+        case 2:
+            b += k[1];
+        /* fall through */
+        case 1:
+            a += k[0];
+            final(a, b, c);
+        /* fall through */
+        default:
+            break;
+    }
+
+    return c;
+}
+
+
+/**
+ * @brief Reference hashlittle() of lookup3, octet by octet
+ *
+ * @param key Octets to be hashed
+ * @param length Number of octets
+ * @param initval Initial value
+ *
+ * @return Hash value
+ */
+static uint32_t ref_hashlittle(const uint8_t *k, size_t length, uint32_t initval)
+{
+    uint32_t a, b, c;
+
+    a = b = c = 0xDEADBEEF + ((uint32_t)length) + initval;
+
+    while (length > 12)
+    {
+        a += k[0] + ((uint32_t)k[1] << 8) + ((uint32_t)k[2] << 16) + ((uint32_t)k[3] << 24);
+        b += k[4] + ((uint32_t)k[5] << 8) + ((uint32_t)k[6] << 16) + ((uint32_t)k[7] << 24);
+        c += k[8] + ((uint32_t)k[9] << 8) + ((uint32_t)k[10] << 16) + ((uint32_t)k[11] << 24);
+        mix(a, b, c);
+        length -= 12;
+        k += 12;
+    }
+
+    switch (length)
+    {
+        case 12: c += (uint32_t)k[11] << 24; /* fall through */
+        case 11: c += (uint32_t)k[10] << 16; /* fall through */
+        case 10: c += (uint32_t)k[9] << 8;   /* fall through */
+        case 9:  c += k[8];                  /* fall through */
+        case 8:  b += (uint32_t)k[7] << 24;  /* fall through */
+        case 7:  b += (uint32_t)k[6] << 16;  /* fall through */
+        case 6:  b += (uint32_t)k[5] << 8;   /* fall through */
+        case 5:  b += k[4];                  /* fall through */
+        case 4:  a += (uint32_t)k[3] << 24;  /* fall through */
+        case 3:  a += (uint32_t)k[2] << 16;  /* fall through */
+        case 2:  a += (uint32_t)k[1] << 8;   /* fall through */
+        case 1:  a += k[0];
+            break;
+        default:
+            return c;
+    }
+    final(a, b, c);
+
+    return c;
+}
+
+
+/**
+ * @brief Checks the reference against the published lookup3 vectors
+ */
+static void test_reference(void)
+{
+    const uint8_t *text = (const uint8_t *)"Four score and seven years ago";
+
+    TEST_CHECK(ref_hashlittle(text, 0, 0) == 0xDEADBEEF);
+    TEST_CHECK(ref_hashlittle(text, 30, 0) == 0x17770551);
+    TEST_CHECK(ref_hashlittle(text, 30, 1) == 0xCD628161);
+
+    /* hashword() of three words is hashlittle() of their 12 octets */
+    uint32_t k[3] = {0x12345678, 0x9ABCDEF0, 0x0F1E2D3C};
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        uint8_t octets[12];
+
+        k[0] = k[0] * 1103515245 + 12345;
+        k[1] ^= k[0] >> 7;
+        k[2] += k[1];
+        for (uint8_t j = 0; j < 12; j++)
+        {
+            octets[j] = (uint8_t)(k[j >> 2] >> ((j & 3) * 8));
+        }
+        TEST_CHECK(ref_hashword(k, 3, 0) == ref_hashlittle(octets, 12, 0));
+    }
+}
+
+
+/**
+ * @brief Compares a whole hop sequence with the reference
+ *
+ * @param cfg Hopping configuration
+ */
+static void check_sequence(const tal_ch_hop_cfg_t *cfg)
+{
+    uint16_t channels[TAL_CH_HOP_MAX_CHANNELS];
+    uint16_t num_channels = 0;
+    uint32_t k[3];
+    uint32_t mismatches = 0;
+
+    for (uint16_t i = 0; i < cfg->num_channels; i++)
+    {
+        if ((cfg->excluded == NULL) || !((cfg->excluded[i >> 3] >> (i & 7)) & 1))
+        {
+            channels[num_channels++] = cfg->ch_first + i;
+        }
+    }
+
+    TEST_CHECK(tal_ch_hop_start(TEST_TRX, cfg) == MAC_SUCCESS);
+    tal_ch_hop_stop(TEST_TRX);
+
+    k[1] = ((uint32_t)cfg->eui64[4] << 24) | ((uint32_t)cfg->eui64[5] << 16) |
+           ((uint32_t)cfg->eui64[6] << 8) | cfg->eui64[7];
+    k[2] = ((uint32_t)cfg->eui64[0] << 24) | ((uint32_t)cfg->eui64[1] << 16) |
+           ((uint32_t)cfg->eui64[2] << 8) | cfg->eui64[3];
+
+    for (uint32_t first = 0; first < NUM_SLOTS; first += SEQ_BLOCK)
+    {
+        TEST_CHECK(tal_ch_hop_get_sequence(TEST_TRX, cfg->eui64, (uint16_t)first,
+                                           seq, SEQ_BLOCK) == MAC_SUCCESS);
+        for (uint32_t i = 0; i < SEQ_BLOCK; i++)
+        {
+            k[0] = first + i;
+            if (seq[i] != channels[ref_hashword(k, 3, 0) % num_channels])
+            {
+                mismatches++;
+            }
+        }
+    }
+    TEST_CHECK(mismatches == 0);
+}
+
+
+/**
+ * @brief Sequences of several nodes and channel plans
+ */
+static void test_sequences(void)
+{
+    /* Channels 0..9 and every 8th channel excluded */
+    uint8_t excluded[(TAL_CH_HOP_MAX_CHANNELS + 7) / 8];
+    tal_ch_hop_cfg_t cfg;
+
+    memset(excluded, 0x01, sizeof(excluded));
+    excluded[0] = 0xFF;
+    excluded[1] |= 0x03;
+
+    memset(&cfg, 0, sizeof(cfg));
+    cfg.dwell_ms = 255;
+    for (uint8_t e = 0; e < sizeof(eui64) / sizeof(eui64[0]); e++)
+    {
+        memcpy(cfg.eui64, eui64[e], sizeof(cfg.eui64));
+
+        cfg.ch_first = 0;
+        cfg.num_channels = TAL_CH_HOP_MAX_CHANNELS;
+        cfg.excluded = NULL;
+        check_sequence(&cfg);
+
+        cfg.excluded = excluded;
+        check_sequence(&cfg);
+
+        cfg.ch_first = 3;
+        cfg.num_channels = 35;
+        cfg.excluded = NULL;
+        check_sequence(&cfg);
+    }
+}
+
+
+int main(void)
+{
+    trx_mock_reset();
+    trx_mock_setup(TEST_TRX);
+
+    test_reference();
+    test_sequences();
+
+    printf("test_ch_hop: %s\n", (test_failures == 0) ? "OK" : "FAILED");
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/* EOF */
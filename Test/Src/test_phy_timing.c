@@ -0,0 +1,225 @@
+/**
+ * @file test_phy_timing.c
+ *
+ * @brief Host test of the PHY timing table lookup.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pal.h"
+#include "tal.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include "ieee_154g.h"
+#include "trx_mock.h"
+#include "phy_timing_ref.h"
+
+/* === MACROS ============================================================== */
+
+/** Step of the FSK preamble length */
+#define PREAMBLE_STEP               (97)
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Valid OFDM settings are looked up, invalid ones are rejected
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void test_ofdm(trx_id_t trx_id)
+{
+    phy_timing_t timing;
+
+    tal_pib[trx_id].phy.modulation = OFDM;
+    tal_pib[trx_id].phy.phy_mode.ofdm.option = OFDM_OPT_1;
+    tal_pib[trx_id].OFDMMCS = MCS3;
+    TEST_CHECK(get_phy_timing(trx_id, &timing) == MAC_SUCCESS);
+    TEST_CHECK(timing.data_rate_kbps == 800);
+
+    tal_pib[trx_id].OFDMMCS = (ofdm_mcs_t)(MCS6 + 1);
+    TEST_CHECK(get_phy_timing(trx_id, &timing) == FAILURE);
+
+    tal_pib[trx_id].OFDMMCS = MCS3;
+    tal_pib[trx_id].phy.phy_mode.ofdm.option = (ofdm_option_t)0;
+    TEST_CHECK(get_phy_timing(trx_id, &timing) == FAILURE);
+    tal_pib[trx_id].phy.phy_mode.ofdm.option = (ofdm_option_t)5;
+    TEST_CHECK(get_phy_timing(trx_id, &timing) == FAILURE);
+}
+
+
+/**
+ * @brief Valid FSK settings are looked up, invalid ones are rejected
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void test_fsk(trx_id_t trx_id)
+{
+    phy_timing_t timing;
+
+    tal_pib[trx_id].phy.modulation = FSK;
+    tal_pib[trx_id].phy.phy_mode.fsk.sym_rate = FSK_SYM_RATE_50;
+    tal_pib[trx_id].phy.phy_mode.fsk.mod_type = F2FSK;
+    tal_pib[trx_id].FSKFECEnabled = true;
+    TEST_CHECK(get_phy_timing(trx_id, &timing) == MAC_SUCCESS);
+    TEST_CHECK(timing.data_rate_kbps == 25);
+
+    tal_pib[trx_id].phy.phy_mode.fsk.sym_rate = (fsk_sym_rate_t)(FSK_SYM_RATE_400 + 1);
+    TEST_CHECK(get_phy_timing(trx_id, &timing) == FAILURE);
+}
+
+
+/**
+ * @brief Valid O-QPSK settings are looked up, invalid ones are rejected
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void test_oqpsk(trx_id_t trx_id)
+{
+    phy_timing_t timing;
+
+    tal_pib[trx_id].phy.modulation = OQPSK;
+    tal_pib[trx_id].phy.phy_mode.oqpsk.chip_rate = CHIP_RATE_100;
+    tal_pib[trx_id].OQPSKRateMode = OQPSK_RATE_MOD_0;
+    TEST_CHECK(get_phy_timing(trx_id, &timing) == MAC_SUCCESS);
+    TEST_CHECK(timing.data_rate_kbps == 6);
+
+    tal_pib[trx_id].OQPSKRateMode = (oqpsk_rate_mode_t)5;
+    TEST_CHECK(get_phy_timing(trx_id, &timing) == FAILURE);
+
+    tal_pib[trx_id].OQPSKRateMode = OQPSK_RATE_MOD_0;
+    tal_pib[trx_id].phy.phy_mode.oqpsk.chip_rate = (oqpsk_chip_rate_t)4;
+    TEST_CHECK(get_phy_timing(trx_id, &timing) == FAILURE);
+}
+
+
+/**
+ * @brief Compares the derived PIB values with the reference row
+ *
+ * @param trx_id Transceiver identifier
+ * @param row Index of the reference row
+ */
+static void check_row(trx_id_t trx_id, uint16_t row)
+{
+    const phy_timing_ref_t *ref = &phy_timing_ref[row];
+
+    calculate_pib_values(trx_id);
+    TEST_CHECK(tal_pib[trx_id].SymbolDuration_us == ref->SymbolDuration_us);
+    TEST_CHECK(tal_pib[trx_id].OctetDuration_us == ref->OctetDuration_us);
+    TEST_CHECK(tal_pib[trx_id].CCADuration_us == ref->CCADuration_us);
+    TEST_CHECK(tal_pib[trx_id].CCADuration_sym == ref->CCADuration_sym);
+    TEST_CHECK(tal_pib[trx_id].CCAThreshold == ref->CCAThreshold);
+    TEST_CHECK(tal_pib[trx_id].ACKWaitDuration == ref->ACKWaitDuration);
+    TEST_CHECK(tal_pib[trx_id].ACKTiming == ref->ACKTiming);
+}
+
+
+/**
+ * @brief All PHY settings give the values of the former calculation
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void test_table(trx_id_t trx_id)
+{
+    static const sun_freq_band_t bands[] = {EU_863, US_915, JAPAN_920, WORLD_2450};
+    tal_pib_t *pib = &tal_pib[trx_id];
+    uint16_t row = 0;
+
+    init_tal_pib(trx_id);
+    for (uint8_t b = 0; b < sizeof(bands) / sizeof(bands[0]); b++)
+    {
+        for (uint8_t method = 0; method < 2; method++)
+        {
+            pib->phy.freq_band = bands[b];
+            pib->CCATimeMethod = method;
+
+            pib->phy.modulation = FSK;
+            for (uint8_t rate = FSK_SYM_RATE_50; rate <= FSK_SYM_RATE_400; rate++)
+            {
+                for (uint8_t type = F2FSK; type <= F4FSK; type++)
+                {
+                    for (uint8_t fec = 0; fec < 2; fec++)
+                    {
+                        for (uint16_t len = 0; len <= 1000; len += PREAMBLE_STEP)
+                        {
+                            pib->phy.phy_mode.fsk.sym_rate = (fsk_sym_rate_t)rate;
+                            pib->phy.phy_mode.fsk.mod_type = (fsk_mod_type_t)type;
+                            pib->FSKFECEnabled = fec;
+                            pib->FSKPreambleLength = len;
+                            check_row(trx_id, row++);
+                        }
+                    }
+                }
+            }
+
+            pib->phy.modulation = OFDM;
+            for (uint8_t option = OFDM_OPT_1; option <= OFDM_OPT_4; option++)
+            {
+                for (uint8_t mcs = MCS0; mcs <= MCS6; mcs++)
+                {
+                    for (uint8_t il = 0; il < 2; il++)
+                    {
+                        pib->phy.phy_mode.ofdm.option = (ofdm_option_t)option;
+                        pib->OFDMMCS = (ofdm_mcs_t)mcs;
+                        pib->OFDMInterleaving = il;
+                        check_row(trx_id, row++);
+                    }
+                }
+            }
+
+            pib->phy.modulation = OQPSK;
+            for (uint8_t chip = CHIP_RATE_100; chip <= CHIP_RATE_2000; chip++)
+            {
+                for (uint8_t mode = OQPSK_RATE_MOD_0; mode <= OQPSK_RATE_MOD_4; mode++)
+                {
+                    pib->phy.phy_mode.oqpsk.chip_rate = (oqpsk_chip_rate_t)chip;
+                    pib->OQPSKRateMode = (oqpsk_rate_mode_t)mode;
+                    check_row(trx_id, row++);
+                }
+            }
+
+            pib->phy.modulation = LEG_OQPSK;
+            for (uint8_t chip = CHIP_RATE_100; chip <= CHIP_RATE_2000; chip++)
+            {
+                for (uint8_t high = 0; high < 2; high++)
+                {
+                    pib->phy.phy_mode.leg_oqpsk.chip_rate = (oqpsk_chip_rate_t)chip;
+                    pib->HighRateEnabled = high;
+                    check_row(trx_id, row++);
+                }
+            }
+        }
+    }
+
+    TEST_CHECK(row == sizeof(phy_timing_ref) / sizeof(phy_timing_ref[0]));
+}
+
+
+int main(void)
+{
+    trx_mock_reset();
+    for (uint8_t trx_id = 0; trx_id < NUM_TRX; trx_id++)
+    {
+        init_tal_pib((trx_id_t)trx_id);
+        test_ofdm((trx_id_t)trx_id);
+        test_fsk((trx_id_t)trx_id);
+        test_oqpsk((trx_id_t)trx_id);
+        test_table((trx_id_t)trx_id);
+    }
+
+    printf("test_phy_timing: %s\n", (test_failures == 0) ? "OK" : "FAILED");
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/* EOF */
@@ -0,0 +1,227 @@
+/**
+ * @file test_pib_commit.c
+ *
+ * @brief Host test of the transactional PIB API.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pal.h"
+#include "tal.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include "ieee_const.h"
+#include "ieee_154g.h"
+#include "trx_mock.h"
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Sets up the TAL of a trx in TRXOFF without a transceiver
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void setup(trx_id_t trx_id)
+{
+    CALC_REG_OFFSET(trx_id);
+
+    memset(&tal_pib[trx_id], 0, sizeof(tal_pib_t));
+    init_tal_pib(trx_id);
+    calculate_pib_values(trx_id);
+    tal_state[trx_id] = TAL_IDLE;
+    trx_state[trx_id] = RF_TRXOFF;
+    trx_mock_reg[GET_REG_ADDR(RG_RF09_STATE)] = RF_TRXOFF;
+    trx_mock_reg[GET_REG_ADDR(RG_BBC0_PC)] |= PC_BBEN_MASK;
+    write_all_tal_pib_to_trx(trx_id);
+    TEST_CHECK(config_phy(trx_id) == MAC_SUCCESS);
+}
+
+
+/**
+ * @brief A channel change alone has to end with a write to CNM
+ *
+ * The transceiver retunes only if the CNM register is written.
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void test_channel_only(trx_id_t trx_id)
+{
+    CALC_REG_OFFSET(trx_id);
+    channel_t ch;
+
+    setup(trx_id);
+    uint8_t cnm = trx_mock_reg[GET_REG_ADDR(RG_RF09_CNM)];
+
+    trx_mock_clear_writes();
+    ch = 3;
+    TEST_CHECK(tal_pib_begin(trx_id) == MAC_SUCCESS);
+    TEST_CHECK(tal_pib_set_deferred(trx_id, phyCurrentChannel, (pib_value_t *)&ch) == MAC_SUCCESS);
+    TEST_CHECK(tal_pib_commit(trx_id) == MAC_SUCCESS);
+
+    TEST_CHECK(tal_pib[trx_id].CurrentChannel == 3);
+    TEST_CHECK(trx_mock_reg[GET_REG_ADDR(RG_RF09_CNL)] == 3);
+    TEST_CHECK(trx_mock_reg[GET_REG_ADDR(RG_RF09_CNM)] == cnm);
+    TEST_CHECK(trx_mock_writes[GET_REG_ADDR(RG_RF09_CNL)] == 1);
+    TEST_CHECK(trx_mock_writes[GET_REG_ADDR(RG_RF09_CNM)] == 1);
+
+    /* Nothing changes, nothing is written */
+    trx_mock_clear_writes();
+    TEST_CHECK(tal_pib_begin(trx_id) == MAC_SUCCESS);
+    TEST_CHECK(tal_pib_set_deferred(trx_id, phyCurrentChannel, (pib_value_t *)&ch) == MAC_SUCCESS);
+    TEST_CHECK(tal_pib_commit(trx_id) == MAC_SUCCESS);
+    TEST_CHECK(trx_mock_writes[GET_REG_ADDR(RG_RF09_CNM)] == 0);
+}
+
+
+/**
+ * @brief A MAC attribute does not touch the channel registers
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void test_mac_only(trx_id_t trx_id)
+{
+    CALC_REG_OFFSET(trx_id);
+    uint16_t pan_id = 0xCAFE;
+
+    setup(trx_id);
+    trx_mock_clear_writes();
+    TEST_CHECK(tal_pib_begin(trx_id) == MAC_SUCCESS);
+    TEST_CHECK(tal_pib_set_deferred(trx_id, macPANId, (pib_value_t *)&pan_id) == MAC_SUCCESS);
+    TEST_CHECK(tal_pib_commit(trx_id) == MAC_SUCCESS);
+
+    TEST_CHECK(trx_mock_reg[GET_REG_ADDR(RG_BBC0_MACPID0F0)] == 0xFE);
+    TEST_CHECK(trx_mock_reg[GET_REG_ADDR(RG_BBC0_MACPID1F0)] == 0xCA);
+    TEST_CHECK(trx_mock_writes[GET_REG_ADDR(RG_RF09_CNM)] == 0);
+}
+
+
+/**
+ * @brief Sets the attributes of the former set_fsk() preset
+ *
+ * @param trx_id Transceiver identifier
+ * @param set tal_pib_set() or tal_pib_set_deferred()
+ */
+static void set_fsk_attributes(trx_id_t trx_id,
+                               retval_t (*set)(trx_id_t, uint8_t, pib_value_t *))
+{
+    phy_t phy;
+    uint16_t len = 8;
+    bool fec = false;
+    bool dw = true;
+    uint16_t crc_type = FCS_TYPE_4_OCTETS;
+    channel_t ch = 0;
+    int8_t pwr = 14;
+    bool rpc = true;
+
+    memset(&phy, 0, sizeof(phy));
+    phy.modulation = FSK;
+    phy.phy_mode.fsk.sym_rate = FSK_SYM_RATE_50;
+    phy.phy_mode.fsk.mod_idx = MOD_IDX_1_0;
+    phy.phy_mode.fsk.mod_type = F2FSK;
+    if (trx_id == RF09)
+    {
+        phy.freq_band = US_915;
+        phy.ch_spacing = FSK_915_MOD1_CH_SPAC;
+        phy.freq_f0 = FSK_915_MOD1_F0;
+    }
+    else
+    {
+        phy.freq_band = WORLD_2450;
+        phy.ch_spacing = FSK_2450_MOD1_CH_SPAC;
+        phy.freq_f0 = FSK_2450_MOD1_F0;
+    }
+
+    TEST_CHECK(set(trx_id, phyFSKPreambleLength, (pib_value_t *)&len) == MAC_SUCCESS);
+    TEST_CHECK(set(trx_id, phyFSKFECEnabled, (pib_value_t *)&fec) == MAC_SUCCESS);
+    TEST_CHECK(set(trx_id, phyFSKScramblePSDU, (pib_value_t *)&dw) == MAC_SUCCESS);
+    TEST_CHECK(set(trx_id, macFCSType, (pib_value_t *)&crc_type) == MAC_SUCCESS);
+    TEST_CHECK(set(trx_id, phySetting, (pib_value_t *)&phy) == MAC_SUCCESS);
+    TEST_CHECK(set(trx_id, phyCurrentChannel, (pib_value_t *)&ch) == MAC_SUCCESS);
+    TEST_CHECK(set(trx_id, phyTransmitPower, (pib_value_t *)&pwr) == MAC_SUCCESS);
+    TEST_CHECK(set(trx_id, phyRPCEnabled, (pib_value_t *)&rpc) == MAC_SUCCESS);
+}
+
+
+/**
+ * @brief The set_fsk() sequence costs fewer SPI accesses in a transaction
+ *
+ * Both APIs have to end with the same PIB and trx configuration. The SPI
+ * accesses of each are printed.
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void test_set_fsk(trx_id_t trx_id)
+{
+    CALC_REG_OFFSET(trx_id);
+    static uint8_t regs[2][TRX_MOCK_REGS];
+    static pal_trx_shadow_t tracked;
+    tal_pib_t pib;
+    pal_trx_stats_t start;
+    pal_trx_stats_t immediate;
+    pal_trx_stats_t txn;
+
+    setup(trx_id);
+    pal_trx_get_stats(&start);
+    set_fsk_attributes(trx_id, tal_pib_set);
+    pal_trx_get_stats(&immediate);
+    immediate.accesses -= start.accesses;
+    immediate.bytes -= start.bytes;
+    memcpy(regs[0], trx_mock_reg, TRX_MOCK_REGS);
+    memcpy(&pib, &tal_pib[trx_id], sizeof(tal_pib_t));
+
+    setup(trx_id);
+    pal_trx_get_stats(&start);
+    TEST_CHECK(tal_pib_begin(trx_id) == MAC_SUCCESS);
+    set_fsk_attributes(trx_id, tal_pib_set_deferred);
+    TEST_CHECK(tal_pib_commit(trx_id) == MAC_SUCCESS);
+    pal_trx_get_stats(&txn);
+    txn.accesses -= start.accesses;
+    txn.bytes -= start.bytes;
+    memcpy(regs[1], trx_mock_reg, TRX_MOCK_REGS);
+
+    TEST_CHECK(memcmp(&pib, &tal_pib[trx_id], sizeof(tal_pib_t)) == 0);
+    TEST_CHECK(memcmp(&regs[0][GET_REG_ADDR(RG_RF09_IRQM)], &regs[1][GET_REG_ADDR(RG_RF09_IRQM)],
+                      PAL_TRX_SHADOW_SIZE) == 0);
+    TEST_CHECK(memcmp(&regs[0][GET_REG_ADDR(RG_BBC0_IRQM)], &regs[1][GET_REG_ADDR(RG_BBC0_IRQM)],
+                      PAL_TRX_SHADOW_SIZE) == 0);
+    TEST_CHECK(txn.accesses < immediate.accesses);
+    TEST_CHECK(txn.bytes < immediate.bytes);
+
+    /* The registers known to the TAL are those of the trx; RNDV changes with each read */
+    reg_image_seed(trx_id, &tracked);
+    tracked.reg[0][RG_RF09_RNDV - RG_RF09_IRQM] = trx_mock_reg[GET_REG_ADDR(RG_RF09_RNDV)];
+    TEST_CHECK(memcmp(tracked.reg[0], &trx_mock_reg[tracked.base[0]], PAL_TRX_SHADOW_SIZE) == 0);
+    TEST_CHECK(memcmp(tracked.reg[1], &trx_mock_reg[tracked.base[1]], PAL_TRX_SHADOW_SIZE) == 0);
+
+    printf("trx %u set_fsk(): immediate %u accesses / %u bytes, transaction %u / %u\n",
+           trx_id, immediate.accesses, immediate.bytes, txn.accesses, txn.bytes);
+}
+
+
+int main(void)
+{
+    trx_mock_reset();
+    for (uint8_t trx_id = 0; trx_id < NUM_TRX; trx_id++)
+    {
+        test_channel_only((trx_id_t)trx_id);
+        test_mac_only((trx_id_t)trx_id);
+        test_set_fsk((trx_id_t)trx_id);
+    }
+
+    printf("test_pib_commit: %s\n", (test_failures == 0) ? "OK" : "FAILED");
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/* EOF */
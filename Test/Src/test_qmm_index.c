@@ -0,0 +1,156 @@
+/**
+ * @file test_qmm_index.c
+ *
+ * @brief Host test of the keyed QMM queue index.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pal.h"
+#include "bmm.h"
+#include "qmm.h"
+#include "trx_mock.h"
+
+/* === MACROS ============================================================== */
+
+#define CAPACITY                    (8)
+#define NUM_SLOTS                   (16)
+
+/* === GLOBALS ============================================================= */
+
+static buffer_t bufs[CAPACITY + 1];
+static uint32_t keys[CAPACITY + 1];
+static qmm_index_slot_t slots[NUM_SLOTS];
+static qmm_index_t idx;
+static queue_t q;
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Gets the key of a buffer body
+ */
+static uint32_t get_key(void *buf)
+{
+    return *(uint32_t *)buf;
+}
+
+
+/**
+ * @brief Sets up an empty indexed queue
+ */
+static void setup(void)
+{
+    qmm_queue_init(&q);
+    TEST_CHECK(qmm_queue_index_init(&q, &idx, slots, NUM_SLOTS, CAPACITY, get_key) ==
+               MAC_SUCCESS);
+    for (uint8_t i = 0; i <= CAPACITY; i++)
+    {
+        keys[i] = i;
+        bufs[i].body = (uint8_t *)&keys[i];
+    }
+}
+
+
+/**
+ * @brief The capacity is checked against the number of slots and the queue
+ */
+static void test_init(void)
+{
+    qmm_queue_init(&q);
+    TEST_CHECK(qmm_queue_index_init(&q, &idx, slots, NUM_SLOTS, NUM_SLOTS / 2 + 1, get_key) ==
+               MAC_INVALID_PARAMETER);
+    TEST_CHECK(qmm_queue_index_init(&q, &idx, slots, NUM_SLOTS, 0, get_key) ==
+               MAC_INVALID_PARAMETER);
+
+    keys[0] = 0;
+    keys[1] = 1;
+    bufs[0].body = (uint8_t *)&keys[0];
+    bufs[1].body = (uint8_t *)&keys[1];
+    qmm_queue_append(&q, &bufs[0]);
+    qmm_queue_append(&q, &bufs[1]);
+    TEST_CHECK(qmm_queue_index_init(&q, &idx, slots, NUM_SLOTS, 1, get_key) ==
+               MAC_INVALID_PARAMETER);
+    TEST_CHECK(qmm_queue_index_init(&q, &idx, slots, NUM_SLOTS, 2, get_key) == MAC_SUCCESS);
+    TEST_CHECK(qmm_queue_read_by_key(&q, 1) == &bufs[1]);
+}
+
+
+/**
+ * @brief A full indexed queue rejects further buffers
+ */
+static void test_overflow(void)
+{
+    setup();
+    for (uint8_t i = 0; i < CAPACITY; i++)
+    {
+        TEST_CHECK(qmm_queue_append(&q, &bufs[i]) == MAC_SUCCESS);
+    }
+    TEST_CHECK(qmm_queue_append(&q, &bufs[CAPACITY]) == MAC_TRANSACTION_OVERFLOW);
+    TEST_CHECK(q.size == CAPACITY);
+    TEST_CHECK(q.tail == &bufs[CAPACITY - 1]);
+    TEST_CHECK(qmm_queue_read_by_key(&q, CAPACITY) == NULL);
+}
+
+
+/**
+ * @brief Buffers stay found across many rebuilds
+ */
+static void test_churn(void)
+{
+    setup();
+    for (uint8_t i = 0; i < CAPACITY; i++)
+    {
+        qmm_queue_append(&q, &bufs[i]);
+    }
+    for (uint16_t n = 0; n < 1000; n++)
+    {
+        uint32_t key = (n * 5) % CAPACITY;
+        buffer_t *buf = qmm_queue_remove_by_key(&q, key);
+
+        TEST_CHECK(buf == &bufs[key]);
+        TEST_CHECK(qmm_queue_append(&q, buf) == MAC_SUCCESS);
+    }
+    TEST_CHECK(q.size == CAPACITY);
+    TEST_CHECK(idx.used_slots < NUM_SLOTS);
+}
+
+
+/**
+ * @brief Buffers sharing a key are found in FIFO order
+ */
+static void test_fifo(void)
+{
+    setup();
+    keys[1] = 0;
+    keys[2] = 0;
+    qmm_queue_append(&q, &bufs[1]);
+    qmm_queue_append(&q, &bufs[2]);
+    TEST_CHECK(qmm_queue_remove_by_key(&q, 0) == &bufs[1]);
+    TEST_CHECK(qmm_queue_remove_by_key(&q, 0) == &bufs[2]);
+    TEST_CHECK(qmm_queue_remove_by_key(&q, 0) == NULL);
+    TEST_CHECK(q.size == 0);
+}
+
+
+int main(void)
+{
+    test_init();
+    test_overflow();
+    test_churn();
+    test_fifo();
+
+    printf("test_qmm_index: %s\n", (test_failures == 0) ? "OK" : "FAILED");
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/* EOF */
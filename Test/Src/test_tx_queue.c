@@ -0,0 +1,112 @@
+/**
+ * @file test_tx_queue.c
+ *
+ * @brief Host test of the TX queue restart.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pal.h"
+#include "tal.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include "ieee_const.h"
+#include "trx_mock.h"
+
+/* === GLOBALS ============================================================= */
+
+static uint8_t mpdu[20];
+static frame_info_t frame;
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Sets up the TAL of a trx in RX without a transceiver
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void setup(trx_id_t trx_id)
+{
+    CALC_REG_OFFSET(trx_id);
+
+    memset(&tal_pib[trx_id], 0, sizeof(tal_pib_t));
+    init_tal_pib(trx_id);
+    calculate_pib_values(trx_id);
+    tal_state[trx_id] = TAL_IDLE;
+    trx_state[trx_id] = RF_TRXOFF;
+    trx_mock_reg[GET_REG_ADDR(RG_RF09_STATE)] = RF_TRXOFF;
+    trx_mock_reg[GET_REG_ADDR(RG_BBC0_PC)] |= PC_BBEN_MASK;
+    write_all_tal_pib_to_trx(trx_id);
+    TEST_CHECK(config_phy(trx_id) == MAC_SUCCESS);
+    trx_state[trx_id] = RF_RX;
+
+    memset(mpdu, 0, sizeof(mpdu));
+    mpdu[0] = FCF_FRAMETYPE_DATA;
+    memset(&frame, 0, sizeof(frame));
+    frame.mpdu = mpdu;
+    frame.len_no_crc = sizeof(mpdu);
+}
+
+
+/**
+ * @brief A frame queued during a channel switch starts once it completes
+ *
+ * @param trx_id Transceiver identifier
+ */
+static void test_after_ch_switch(trx_id_t trx_id)
+{
+    tal_tx_queue_stats_t before;
+    tal_tx_queue_stats_t after;
+
+    setup(trx_id);
+    tal_tx_queue_get_stats(trx_id, &before);
+
+    TEST_CHECK(tal_channel_switch(trx_id, 1) == MAC_SUCCESS);
+    TEST_CHECK(tal_state[trx_id] == TAL_CH_SWITCH);
+    TEST_CHECK(tal_tx_enqueue(trx_id, &frame, NO_CSMA_NO_IFS, false) == MAC_SUCCESS);
+    TEST_CHECK(tal_state[trx_id] == TAL_CH_SWITCH);
+
+    /* TRXRDY completes the switch */
+    tal_rf_irqs[trx_id] = RF_IRQ_TRXRDY;
+    tal_task();
+
+    tal_tx_queue_get_stats(trx_id, &after);
+    TEST_CHECK(tal_state[trx_id] == TAL_TX);
+    TEST_CHECK(after.enqueued == before.enqueued + 1);
+    TEST_CHECK(after.pipelined == before.pipelined + 1);
+
+    pal_timer_stop(TAL_T_CH_SWITCH, trx_id);
+    flush_tx_queue(trx_id);
+    if (tal_state[trx_id] == TAL_TX)
+    {
+        tx_done_handling(trx_id, FAILURE);
+    }
+    tal_state[trx_id] = TAL_IDLE;
+}
+
+
+int main(void)
+{
+    trx_mock_reset();
+    for (uint8_t trx_id = 0; trx_id < NUM_TRX; trx_id++)
+    {
+        test_after_ch_switch((trx_id_t)trx_id);
+    }
+
+    printf("test_tx_queue: %s\n", (test_failures == 0) ? "OK" : "FAILED");
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/* EOF */
@@ -0,0 +1,283 @@
+/**
+ * @file test_tx_stream.c
+ *
+ * @brief Host stress test of the TX frame buffer streaming.
+ *
+ * Frames of all sizes are sent on several PHYs and emulated SPI speeds
+ * without CCA, which leaves the least time for streaming. The mock flags an
+ * underrun if a frame buffer write ends after the trx had to send its first
+ * byte. The SPI model is calibrated on the emulated SPI each time.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "pal.h"
+#include "tal.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include "ieee_const.h"
+#include "ieee_154g.h"
+#include "trx_mock.h"
+
+/* === MACROS ============================================================== */
+
+#define TEST_TRX                    (RF09)
+
+/** Largest MPDU without FCS */
+#define MAX_FRAME_LEN               (2000)
+
+/**
+ * Transmissions per frame before an underrun counts as failure; a host
+ * that preempts the test during streaming causes single underruns.
+ */
+#define TX_ATTEMPTS                 (3)
+
+/* === TYPES =============================================================== */
+
+/** Emulated SPI */
+typedef struct spi_speed_tag
+{
+    uint32_t access_ns;
+    uint32_t byte_ns;
+} spi_speed_t;
+
+/* === GLOBALS ============================================================= */
+
+static uint8_t mpdu[MAX_FRAME_LEN];
+static uint8_t psdu[MAX_FRAME_LEN];
+static frame_info_t frame;
+
+/** SPI of about 8 MHz and 1 MHz including the driver overhead */
+static const spi_speed_t spi_speed[] = {{5000, 1000}, {20000, 8000}};
+
+/** MPDU lengths without FCS */
+static const uint16_t frame_len[] = {20, 127, 500, 1000, MAX_FRAME_LEN};
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Initializes a PHY profile of the US 915 MHz band
+ *
+ * @param profile Profile to be initialized
+ * @param mod Modulation
+ */
+static void init_profile(tal_phy_profile_t *profile, modulation_t mod)
+{
+    memset(profile, 0, sizeof(tal_phy_profile_t));
+    profile->tx_pwr = 14;
+    profile->fsk_preamble_len = 8;
+    profile->ofdm_mcs = MCS3;
+    profile->oqpsk_rate_mode = OQPSK_RATE_MOD_0;
+    profile->phy.modulation = mod;
+    profile->phy.freq_band = US_915;
+}
+
+
+/**
+ * @brief Fills the PHY profiles of the sweep
+ *
+ * @param profiles Storage for the profiles
+ *
+ * @return Number of profiles
+ */
+static uint8_t get_profiles(tal_phy_profile_t *profiles)
+{
+    tal_phy_profile_t *p = profiles;
+
+    /* FSK at 50 and 200 kbit/s */
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        init_profile(p, FSK);
+        p->phy.phy_mode.fsk.sym_rate = (i == 0) ? FSK_SYM_RATE_50 : FSK_SYM_RATE_200;
+        p->phy.phy_mode.fsk.mod_idx = MOD_IDX_1_0;
+        p->phy.phy_mode.fsk.mod_type = F2FSK;
+        p->phy.ch_spacing = FSK_915_MOD1_CH_SPAC;
+        p->phy.freq_f0 = FSK_915_MOD1_F0;
+        p++;
+    }
+
+    /* OFDM option 1 at 200 and 2400 kbit/s */
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        init_profile(p, OFDM);
+        p->phy.phy_mode.ofdm.option = OFDM_OPT_1;
+        p->phy.ch_spacing = OFDM_915_OPT1_CH_SPAC;
+        p->phy.freq_f0 = OFDM_915_OPT1_F0;
+        p->ofdm_mcs = (i == 0) ? MCS1 : MCS6;
+        p++;
+    }
+
+    /* MR-O-QPSK at 6.25 and 500 kbit/s */
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        init_profile(p, OQPSK);
+        p->phy.phy_mode.oqpsk.chip_rate = (i == 0) ? CHIP_RATE_100 : CHIP_RATE_2000;
+        p->phy.ch_spacing = OQPSK_915_CH_SPAC;
+        p->phy.freq_f0 = OQPSK_915_F0;
+        p->oqpsk_rate_mode = (i == 0) ? OQPSK_RATE_MOD_0 : OQPSK_RATE_MOD_3;
+        p++;
+    }
+
+    return (uint8_t)(p - profiles);
+}
+
+
+/**
+ * @brief Sends the frame without CCA and ends its transmission
+ *
+ * @param len MPDU length without FCS
+ */
+static void send(uint16_t len)
+{
+    frame.len_no_crc = len;
+    trx_mock_clear_writes();
+    TEST_CHECK(tal_tx_frame(TEST_TRX, &frame, NO_CSMA_NO_IFS, false) == MAC_SUCCESS);
+
+    /* An underrun has already been reported */
+    if (trx_mock_tx_done == 0)
+    {
+        trx_mock_irq(TEST_TRX, RF_IRQ_NO_IRQ, BB_IRQ_TXFE);
+    }
+    TEST_CHECK(trx_mock_tx_done == 1);
+}
+
+
+/**
+ * @brief Streams a frame of a size on the current PHY and SPI
+ *
+ * The frame has to be complete in the frame buffer; the preload and the
+ * chunks follow the prediction and each underrun is reported as failure.
+ *
+ * @param len MPDU length without FCS
+ */
+static void test_frame(uint16_t len)
+{
+    uint16_t preload = tal_tx_preload_len(TEST_TRX, len, false);
+    tal_tx_stats_t before;
+    tal_tx_stats_t after;
+    uint8_t attempt;
+
+    for (uint16_t i = PL_POS_SEQ_NUM; i < len; i++)
+    {
+        mpdu[i] = (uint8_t)(i + len);
+    }
+
+    for (attempt = 0; attempt < TX_ATTEMPTS; attempt++)
+    {
+        unsigned underruns = trx_mock_underruns[TEST_TRX];
+
+        tal_tx_get_stats(TEST_TRX, &before);
+        send(len);
+        tal_tx_get_stats(TEST_TRX, &after);
+
+        TEST_CHECK(after.underruns - before.underruns == trx_mock_underruns[TEST_TRX] - underruns);
+        if (trx_mock_underruns[TEST_TRX] == underruns)
+        {
+            break;
+        }
+        TEST_CHECK(trx_mock_tx_status == FAILURE);
+    }
+
+    if (attempt == TX_ATTEMPTS)
+    {
+        printf("%u bytes, %u us per octet: underrun with %u bytes preloaded\n",
+               len, tal_pib[TEST_TRX].OctetDuration_us, preload);
+        test_failures++;
+        return;
+    }
+
+    TEST_CHECK(trx_mock_tx_status == MAC_SUCCESS);
+    TEST_CHECK(after.streamed - before.streamed == ((preload < len) ? 1 : 0));
+    TEST_CHECK(after.chunks - before.chunks ==
+               (uint32_t)(len - preload + TAL_TX_STREAM_CHUNK - 1) / TAL_TX_STREAM_CHUNK);
+    TEST_CHECK(trx_mock_get_tx_frame(TEST_TRX, psdu) == len + tal_pib[TEST_TRX].FCSLen);
+    TEST_CHECK(memcmp(psdu, mpdu, len) == 0);
+}
+
+
+/**
+ * @brief Sweeps frame sizes, PHYs and SPI speeds
+ */
+static void test_sweep(void)
+{
+    tal_phy_profile_t profiles[6];
+    uint8_t num_profiles = get_profiles(profiles);
+
+    for (uint8_t s = 0; s < sizeof(spi_speed) / sizeof(spi_speed[0]); s++)
+    {
+        trx_mock_set_spi_speed(spi_speed[s].access_ns, spi_speed[s].byte_ns);
+        calibrate_spi_model();
+
+        for (uint8_t p = 0; p < num_profiles; p++)
+        {
+            TEST_CHECK(tal_phy_profile_apply(TEST_TRX, &profiles[p]) == MAC_SUCCESS);
+            for (uint8_t i = 0; i < sizeof(frame_len) / sizeof(frame_len[0]); i++)
+            {
+                test_frame(frame_len[i]);
+            }
+        }
+    }
+
+    /* The slow SPI cannot keep up with OFDM MCS6; most of the frame is preloaded */
+    TEST_CHECK(tal_phy_profile_apply(TEST_TRX, &profiles[3]) == MAC_SUCCESS);
+    TEST_CHECK(tal_tx_preload_len(TEST_TRX, MAX_FRAME_LEN, false) > (MAX_FRAME_LEN / 2));
+}
+
+
+/**
+ * @brief A model of a faster SPI than the actual one ends in an underrun
+ *
+ * The underrun has to abort the transmission and be reported.
+ */
+static void test_optimistic_model(void)
+{
+    tal_phy_profile_t profiles[6];
+    tal_tx_stats_t before;
+    tal_tx_stats_t after;
+
+    get_profiles(profiles);
+    TEST_CHECK(tal_phy_profile_apply(TEST_TRX, &profiles[3]) == MAC_SUCCESS);
+    trx_mock_set_spi_speed(0, 0);
+    calibrate_spi_model();
+    trx_mock_set_spi_speed(spi_speed[1].access_ns, spi_speed[1].byte_ns);
+
+    tal_tx_get_stats(TEST_TRX, &before);
+    send(MAX_FRAME_LEN);
+    tal_tx_get_stats(TEST_TRX, &after);
+
+    TEST_CHECK(trx_mock_tx_status == FAILURE);
+    TEST_CHECK(after.underruns - before.underruns == 1);
+    TEST_CHECK(tal_state[TEST_TRX] == TAL_IDLE);
+    trx_mock_set_spi_speed(0, 0);
+}
+
+
+int main(void)
+{
+    trx_mock_reset();
+    trx_mock_setup(TEST_TRX);
+
+    mpdu[PL_POS_FCF_1] = FCF_FRAMETYPE_DATA;
+    frame.mpdu = mpdu;
+    frame.trx_id = TEST_TRX;
+
+    test_sweep();
+    test_optimistic_model();
+
+    printf("test_tx_stream: %s\n", (test_failures == 0) ? "OK" : "FAILED");
+    return (test_failures == 0) ? 0 : 1;
+}
+
+/* EOF */
@@ -0,0 +1,491 @@
+/**
+ * @file trx_mock.c
+ *
+ * @brief Transceiver register mock of the host tests.
+ *
+ * Implements the SPI driver functions used by the PAL on top of a register
+ * array, and the callbacks otherwise provided by the application.
+ *
+ * @author    Atmel Corporation: http://www.atmel.com
+ * @author    Support email: avr@atmel.com
+ */
+/*
+ * Copyright (c) 2012, Atmel Corporation All rights reserved.
+ *
+ * Licensed under Atmel's Limited License Agreement --> EULA.txt
+ */
+
+/* === INCLUDES ============================================================ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "pal.h"
+#include "tal.h"
+#include "bmm.h"
+#include "qmm.h"
+#include "ieee_const.h"
+#include "tal_config.h"
+#include "tal_pib.h"
+#include "tal_internal.h"
+#include "trx_mock.h"
+
+/* === GLOBALS ============================================================= */
+
+uint8_t trx_mock_reg[TRX_MOCK_REGS];
+uint16_t trx_mock_writes[TRX_MOCK_REGS];
+unsigned test_failures;
+unsigned trx_mock_tx_done;
+retval_t trx_mock_tx_status;
+unsigned trx_mock_scan_done;
+retval_t trx_mock_scan_status;
+volatile unsigned trx_mock_tx_starts[NUM_TRX];
+unsigned trx_mock_underruns[NUM_TRX];
+
+/* Emulated SPI timing, see trx_mock_set_spi_speed() */
+static uint32_t spi_access_ns;
+static uint32_t spi_byte_ns;
+
+/* Ongoing transmission: time of the transmit command and until the PSDU */
+static bool tx_on_air[NUM_TRX];
+static uint64_t tx_cmd_ns[NUM_TRX];
+static uint64_t tx_headroom_ns[NUM_TRX];
+
+At86rf215_Dev_t at86rf215_dev;
+modulation_t current_mod[NUM_TRX];
+
+/* === IMPLEMENTATION ====================================================== */
+
+/**
+ * @brief Clears the registers and the write counters
+ */
+void trx_mock_reset(void)
+{
+    memset(trx_mock_reg, 0, sizeof(trx_mock_reg));
+    trx_mock_clear_writes();
+}
+
+
+/**
+ * @brief Sets up the TAL of a trx idle in TRXOFF without a transceiver
+ *
+ * The buffers are initialized with the first call. The random generators
+ * are seeded as by tal_init().
+ *
+ * @param trx_id Transceiver identifier
+ */
+void trx_mock_setup(trx_id_t trx_id)
+{
+    static bool buffers_ready;
+    CALC_REG_OFFSET(trx_id);
+
+    if (!buffers_ready)
+    {
+        bmm_buffer_init();
+        buffers_ready = true;
+    }
+
+    memset(&tal_pib[trx_id], 0, sizeof(tal_pib_t));
+    init_tal_pib(trx_id);
+    calculate_pib_values(trx_id);
+    tal_state[trx_id] = TAL_IDLE;
+    trx_state[trx_id] = RF_TRXOFF;
+    trx_default_state[trx_id] = RF_TRXOFF;
+    trx_mock_reg[GET_REG_ADDR(RG_RF09_STATE)] = RF_TRXOFF;
+    trx_mock_reg[GET_REG_ADDR(RG_BBC0_PC)] |= PC_BBEN_MASK;
+    write_all_tal_pib_to_trx(trx_id);
+    config_phy(trx_id);
+    tal_generate_rand_seed();
+
+    if (tal_rx_buffer[trx_id] == NULL)
+    {
+        tal_rx_buffer[trx_id] = bmm_buffer_alloc(LARGE_BUFFER_SIZE);
+        frame_info_t *frm_info = (frame_info_t *)BMM_BUFFER_POINTER(tal_rx_buffer[trx_id]);
+        frm_info->trx_id = trx_id;
+    }
+    qmm_queue_init(&tal_incoming_frame_queue[trx_id]);
+}
+
+
+/**
+ * @brief Emulates the duration of SPI accesses
+ *
+ * Each access busy-waits for access_ns plus byte_ns per byte; 0/0 makes
+ * the accesses instant again.
+ *
+ * @param access_ns Fixed duration per access in ns
+ * @param byte_ns Duration per byte in ns
+ */
+void trx_mock_set_spi_speed(uint32_t access_ns, uint32_t byte_ns)
+{
+    spi_access_ns = access_ns;
+    spi_byte_ns = byte_ns;
+}
+
+
+/**
+ * @brief Gets the monotonic clock
+ *
+ * @return Time in ns
+ */
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000) + (uint64_t)ts.tv_nsec;
+}
+
+
+/**
+ * @brief Waits for the emulated duration of an SPI access
+ *
+ * @param len Number of bytes transferred
+ */
+static void spi_access(uint32_t len)
+{
+    if ((spi_access_ns == 0) && (spi_byte_ns == 0))
+    {
+        return;
+    }
+
+    uint64_t end = now_ns() + spi_access_ns + ((uint64_t)len * spi_byte_ns);
+    while (now_ns() < end)
+    {
+    }
+}
+
+
+/**
+ * @brief Waits by polling the clock
+ *
+ * @param us Time in us
+ */
+void trx_mock_wait_us(uint32_t us)
+{
+    uint32_t start;
+    uint32_t now;
+
+    pal_get_current_time(&start);
+    do
+    {
+        pal_get_current_time(&now);
+    } while ((now - start) < us);
+}
+
+
+/**
+ * @brief Gets the frame in the TX frame buffer
+ *
+ * @param trx_id Transceiver identifier
+ * @param psdu Storage for the PSDU without FCS
+ *
+ * @return PSDU length including the FCS
+ */
+uint16_t trx_mock_get_tx_frame(trx_id_t trx_id, uint8_t *psdu)
+{
+    CALC_REG_OFFSET(trx_id);
+    uint16_t len = trx_mock_reg[GET_REG_ADDR(RG_BBC0_TXFLL)] |
+                   ((uint16_t)trx_mock_reg[GET_REG_ADDR(RG_BBC0_TXFLH)] << 8);
+
+    memcpy(psdu, &trx_mock_reg[RG_BBC0_FBTXS + (BB_TX_FRM_BUF_OFFSET * trx_id)],
+           len - tal_pib[trx_id].FCSLen);
+
+    return len;
+}
+
+
+/**
+ * @brief Raises interrupts of a trx and runs the TAL
+ *
+ * @param trx_id Transceiver identifier
+ * @param rf_irqs RF interrupts
+ * @param bb_irqs Baseband interrupts
+ */
+void trx_mock_irq(trx_id_t trx_id, uint8_t rf_irqs, uint8_t bb_irqs)
+{
+    if (bb_irqs & BB_IRQ_TXFE)
+    {
+        tx_on_air[trx_id] = false;
+    }
+    trx_mock_reg[RG_RF09_IRQS + trx_id] = rf_irqs;
+    trx_mock_reg[RG_BBC0_IRQS + trx_id] = bb_irqs;
+    trx_irq_handler_cb();
+    /* The IRQ status is cleared by reading it */
+    trx_mock_reg[RG_RF09_IRQS + trx_id] = 0;
+    trx_mock_reg[RG_BBC0_IRQS + trx_id] = 0;
+    tal_task();
+}
+
+
+/**
+ * @brief Receives a frame
+ *
+ * If the frame requests an ACK, the trx signals an ACK transmission; its
+ * end is to be raised as TXFE.
+ *
+ * @param trx_id Transceiver identifier
+ * @param psdu PSDU without FCS
+ * @param len PSDU length including the FCS
+ */
+void trx_mock_rx_frame(trx_id_t trx_id, const uint8_t *psdu, uint16_t len)
+{
+    CALC_REG_OFFSET(trx_id);
+    bool ack = ((psdu[0] & 0x07) != FCF_FRAMETYPE_ACK) && (psdu[0] & FCF_ACK_REQUEST);
+
+    memcpy(&trx_mock_reg[RG_BBC0_FBRXS + (BB_RX_FRM_BUF_OFFSET * trx_id)], psdu,
+           len - tal_pib[trx_id].FCSLen);
+    trx_mock_reg[GET_REG_ADDR(RG_BBC0_RXFLL)] = (uint8_t)len;
+    trx_mock_reg[GET_REG_ADDR(RG_BBC0_RXFLH)] = (uint8_t)(len >> 8);
+    /* The FCS type of the sender matches */
+    trx_mock_reg[GET_REG_ADDR(RG_BBC0_FSKPHRRX)] =
+        (uint8_t)(tal_pib[trx_id].FCSType << FSKPHRRX_FCST_SHIFT);
+    if (ack)
+    {
+        trx_mock_reg[GET_REG_ADDR(RG_BBC0_AMCS)] |= AMCS_AACKFT_MASK;
+    }
+    else
+    {
+        trx_mock_reg[GET_REG_ADDR(RG_BBC0_AMCS)] &= (uint8_t)~AMCS_AACKFT_MASK;
+    }
+    trx_mock_irq(trx_id, RF_IRQ_NO_IRQ, BB_IRQ_RXFS | BB_IRQ_RXFE);
+}
+
+
+/**
+ * @brief Clears the write counters
+ */
+void trx_mock_clear_writes(void)
+{
+    memset(trx_mock_writes, 0, sizeof(trx_mock_writes));
+    trx_mock_tx_done = 0;
+    trx_mock_scan_done = 0;
+}
+
+
+/**
+ * @brief Starts the air interface of a transmission
+ *
+ * The first PSDU byte is sent after the SHR and PHR, and after the CCA if
+ * the transmission is started by a CCA.
+ *
+ * @param trx_id Transceiver identifier
+ * @param cca true if a CCA is performed first
+ */
+static void start_tx(uint8_t trx_id, bool cca)
+{
+    tx_on_air[trx_id] = true;
+    tx_cmd_ns[trx_id] = now_ns();
+    tx_headroom_ns[trx_id] = (uint64_t)(shr_duration_sym((trx_id_t)trx_id) +
+                                        phr_duration_sym((trx_id_t)trx_id)) *
+                             tal_pib[trx_id].SymbolDuration_us * 1000;
+    if (cca)
+    {
+        tx_headroom_ns[trx_id] += (uint64_t)tal_pib[trx_id].CCADuration_us * 1000;
+    }
+    trx_mock_reg[RF_BASE_ADDR_OFFSET * trx_id + RG_BBC0_PS] &= (uint8_t)~PS_TXUR_MASK;
+    trx_mock_tx_starts[trx_id]++;
+}
+
+
+/**
+ * @brief Checks a TX frame buffer write against the air interface
+ *
+ * A write during a transmission is too late if the trx has already sent
+ * its first byte; the underrun is flagged in the PS register.
+ *
+ * @param addr Address of the first register written
+ */
+static void check_tx_underrun(uint16_t addr)
+{
+    for (uint8_t trx_id = 0; trx_id < NUM_TRX; trx_id++)
+    {
+        uint16_t fbtxs = RG_BBC0_FBTXS + (BB_TX_FRM_BUF_OFFSET * trx_id);
+
+        if (!tx_on_air[trx_id] || (addr < fbtxs) || (addr > (fbtxs + RG_BBC0_FBTXE - RG_BBC0_FBTXS)))
+        {
+            continue;
+        }
+
+        uint64_t due = tx_cmd_ns[trx_id] + tx_headroom_ns[trx_id] +
+                       ((uint64_t)(addr - fbtxs) * tal_pib[trx_id].OctetDuration_us * 1000);
+        if (now_ns() > due)
+        {
+            trx_mock_reg[RF_BASE_ADDR_OFFSET * trx_id + RG_BBC0_PS] |= PS_TXUR_MASK;
+            trx_mock_underruns[trx_id]++;
+            tx_on_air[trx_id] = false;
+        }
+    }
+}
+
+
+/**
+ * @brief Writes registers; a command is reached at once
+ *
+ * @param addr Address of the first register
+ * @param data Values to be written
+ * @param len Number of registers
+ */
+static void mock_write(uint16_t addr, const uint8_t *data, uint32_t len)
+{
+    check_tx_underrun(addr);
+
+    for (uint32_t i = 0; (i < len) && ((addr + i) < TRX_MOCK_REGS); i++)
+    {
+        trx_mock_reg[addr + i] = data[i];
+        trx_mock_writes[addr + i]++;
+        if ((addr + i == RG_RF09_CMD) || (addr + i == RG_RF24_CMD))
+        {
+            trx_mock_reg[addr + i - RG_RF09_CMD + RG_RF09_STATE] = data[i];
+            if (data[i] == RF_TX)
+            {
+                start_tx(addr + i == RG_RF24_CMD, false);
+            }
+        }
+        if (((addr + i == RG_RF09_EDC) || (addr + i == RG_RF24_EDC)) &&
+            (data[i] == RF_EDSINGLE))
+        {
+            uint8_t trx_id = (addr + i == RG_RF24_EDC);
+            if (trx_mock_reg[RF_BASE_ADDR_OFFSET * trx_id + RG_BBC0_AMCS] & AMCS_CCATX_MASK)
+            {
+                start_tx(trx_id, true);
+            }
+        }
+        /* The next frame is downloaded */
+        if ((addr + i == RG_BBC0_TXFLL) || (addr + i == RG_BBC1_TXFLL))
+        {
+            tx_on_air[addr + i == RG_BBC1_TXFLL] = false;
+        }
+    }
+}
+
+
+/**
+ * @brief Reads a register; the random value register changes on each read
+ *
+ * @param addr Register address
+ *
+ * @return Register value
+ */
+static uint8_t mock_read(uint16_t addr)
+{
+    if ((addr == RG_RF09_RNDV) || (addr == RG_RF24_RNDV))
+    {
+        return (uint8_t)rand();
+    }
+    return trx_mock_reg[addr];
+}
+
+
+int spi_init(spi_t *spi)
+{
+    return 0;
+}
+
+
+int spi_write(spi_t *spi, spi_data_t *data)
+{
+    spi_access(data->len);
+    mock_write(data->address, data->data, data->len);
+    return data->len;
+}
+
+
+int spi_writev(spi_t *spi, uint16_t address, const pal_iov_t *iov, uint8_t iov_cnt)
+{
+    int len = 0;
+
+    for (uint8_t i = 0; i < iov_cnt; i++)
+    {
+        len += iov[i].len;
+    }
+    spi_access(len);
+    len = 0;
+    for (uint8_t i = 0; i < iov_cnt; i++)
+    {
+        mock_write(address + len, iov[i].base, iov[i].len);
+        len += iov[i].len;
+    }
+    return len;
+}
+
+
+int spi_read(spi_t *spi, spi_data_t *data)
+{
+    spi_access(data->len);
+    for (uint32_t i = 0; i < data->len; i++)
+    {
+        data->data[i] = mock_read(data->address + i);
+    }
+    return data->len;
+}
+
+
+int spi_read_repeat(spi_t *spi, uint16_t address, uint8_t *data, uint8_t count)
+{
+    spi_access(count);
+    for (uint8_t i = 0; i < count; i++)
+    {
+        data[i] = mock_read(address);
+    }
+    return count;
+}
+
+
+uint8_t spi_reg_read(spi_t *spi, uint16_t address)
+{
+    spi_access(1);
+    return mock_read(address);
+}
+
+
+int spi_reg_write(spi_t *spi, uint16_t address, uint8_t value)
+{
+    spi_access(1);
+    mock_write(address, &value, 1);
+    return 0;
+}
+
+
+uint8_t spi_reg_bit_read(spi_t *spi, uint16_t address, uint8_t mask, uint8_t pos)
+{
+    return (spi_reg_read(spi, address) & mask) >> pos;
+}
+
+
+uint8_t spi_reg_bit_write(spi_t *spi, uint16_t address, uint8_t mask, uint8_t pos,
+                          uint8_t new_value)
+{
+    uint8_t value = (spi_reg_read(spi, address) & ~mask) | ((new_value << pos) & mask);
+
+    return spi_reg_write(spi, address, value);
+}
+
+
+void tal_rx_frame_cb(trx_id_t trx_id, frame_info_t *rx_frame)
+{
+    bmm_buffer_free(rx_frame->buffer_header);
+}
+
+
+void tal_tx_frame_done_cb(trx_id_t trx_id, retval_t status, frame_info_t *frame)
+{
+    trx_mock_tx_done++;
+    trx_mock_tx_status = status;
+}
+
+
+void tal_channel_switch_done_cb(trx_id_t trx_id, retval_t status)
+{
+}
+
+
+void tal_scan_done_cb(trx_id_t trx_id, retval_t status, uint16_t num_results)
+{
+    trx_mock_scan_done++;
+    trx_mock_scan_status = status;
+}
+
+/* EOF */